@@ -106,6 +106,7 @@
 #include "CleanupProcess.h"
 #include "ComplexGeoData.h"
 #include "Services.h"
+#include "DocumentChangeBatchPy.h"
 #include "DocumentObjectFileIncluded.h"
 #include "DocumentObjectGroup.h"
 #include "DocumentObjectGroupPy.h"
@@ -389,6 +390,9 @@ void Application::setupPythonTypes()
     Base::Vector2dPy::init_type();
     Base::InterpreterSingleton::addType(Base::Vector2dPy::type_object(),
         pBaseModule,"Vector2d");
+
+    // only created through Document.changeBatch()
+    App::DocumentChangeBatchPy::init_type();
     // clang-format on
 }
 
@@ -484,6 +488,7 @@ Document* Application::newDocument(const char * proposedName, const char * propo
     doc->signalDeletedObject.connect(std::bind(&Application::slotDeletedObject, this, sp::_1));
     doc->signalBeforeChangeObject.connect(std::bind(&Application::slotBeforeChangeObject, this, sp::_1, sp::_2));
     doc->signalChangedObject.connect(std::bind(&Application::slotChangedObject, this, sp::_1, sp::_2));
+    doc->signalChangedObjects.connect(std::bind(&Application::slotChangedObjects, this, sp::_1, sp::_2));
     doc->signalRelabelObject.connect(std::bind(&Application::slotRelabelObject, this, sp::_1));
     doc->signalActivatedObject.connect(std::bind(&Application::slotActivatedObject, this, sp::_1));
     doc->signalUndo.connect(std::bind(&Application::slotUndoDocument, this, sp::_1));
@@ -1605,6 +1610,11 @@ void Application::slotChangedObject(const DocumentObject& obj, const Property& p
     this->signalChangedObject(obj, prop);
 }
 
+void Application::slotChangedObjects(const Document& doc, const Document::PropertyChanges& changes)
+{
+    this->signalChangedObjects(doc, changes);
+}
+
 void Application::slotRelabelObject(const DocumentObject& obj)
 {
     this->signalRelabelObject(obj);
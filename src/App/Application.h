@@ -281,6 +281,9 @@ public:
     boost::signals2::signal<void (const App::DocumentObject&, const App::Property&)> signalBeforeChangeObject;
     /// signal on changed Object
     boost::signals2::signal<void (const App::DocumentObject&, const App::Property&)> signalChangedObject;
+    /// signal at the end of a property change batch, see Document::endChangeBatch()
+    boost::signals2::signal<void (const App::Document&,
+        const std::vector<std::pair<const App::DocumentObject*, const App::Property*>>&)> signalChangedObjects;
     /// signal on relabeled Object
     boost::signals2::signal<void (const App::DocumentObject&)> signalRelabelObject;
     /// signal on activated Object
@@ -495,6 +498,8 @@ protected:
     void slotDeletedObject(const App::DocumentObject& obj);
     void slotBeforeChangeObject(const App::DocumentObject& obj, const App::Property& prop);
     void slotChangedObject(const App::DocumentObject& obj, const App::Property& prop);
+    void slotChangedObjects(const App::Document& doc,
+                            const std::vector<std::pair<const App::DocumentObject*, const App::Property*>>& changes);
     void slotRelabelObject(const App::DocumentObject& obj);
     void slotActivatedObject(const App::DocumentObject& obj);
     void slotUndoDocument(const App::Document& doc);
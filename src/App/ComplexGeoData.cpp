@@ -227,6 +227,12 @@ size_t ComplexGeoData::getElementMapSize(bool flush) const
     return _elementMap ? _elementMap->size() : 0;
 }
 
+ElementMap::MemoryUsage ComplexGeoData::getElementMapMemoryUsage(bool flush) const
+{
+    auto map = elementMap(flush);
+    return map ? map->getMemoryUsage() : ElementMap::MemoryUsage();
+}
+
 MappedName ComplexGeoData::getMappedName(const IndexedName& element,
                                          bool allowUnmapped,
                                          ElementIDRefs* sid) const
@@ -637,7 +643,7 @@ void ComplexGeoData::SaveDocFile(Base::Writer& writer) const
 {
     flushElementMap();
     if (_elementMap) {
-        writer.Stream() << "BeginElementMap v1\n";
+        writer.Stream() << "BeginElementMap v2\n";
         _elementMap->save(writer.Stream());
     }
 }
@@ -650,7 +656,7 @@ void ComplexGeoData::RestoreDocFile(Base::Reader& reader)
     if (boost::equals(marker, "BeginElementMap")) {
         resetElementMap();
         reader >> ver;
-        if (ver != "v1") {
+        if (ver != "v1" && ver != "v2") {
             FC_WARN("Unknown element map format");  // NOLINT
         }
         else {
@@ -666,7 +672,7 @@ void ComplexGeoData::RestoreDocFile(Base::Reader& reader)
     restoreStream(reader, static_cast<std::size_t>(count));
 }
 
-unsigned int ComplexGeoData::getMemSize() const
+std::size_t ComplexGeoData::getMemSize() const
 {
     flushElementMap();
     if (_elementMap) {
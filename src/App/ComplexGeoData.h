@@ -346,6 +346,9 @@ public:
     /// Get the current element map size
     size_t getElementMapSize(bool flush = true) const;
 
+    /// Get the memory used by the element map
+    ElementMap::MemoryUsage getElementMapMemoryUsage(bool flush = true) const;
+
     /// Return the higher level element names of the given element
     virtual std::vector<IndexedName> getHigherElements(const char* name, bool silent = false) const;
 
@@ -382,7 +385,7 @@ public:
     void Restore(Base::XMLReader& reader) override;
     void SaveDocFile(Base::Writer& writer) const override;
     void RestoreDocFile(Base::Reader& reader) override;
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     void setPersistenceFileName(const char* name) const;
     virtual void beforeSave() const;
     bool isRestoreFailed() const
@@ -143,6 +143,9 @@ class ComplexGeoData(Persistence):
     ElementMapSize: Final[int] = 0
     """Get the current element map size"""
 
+    ElementMapMemory: Final[Dict[str, int]] = {}
+    """Get an estimate of the memory used by the element map, in bytes where applicable"""
+
     ElementMap: Dict[Any, Any] = {}
     """Get/Set a dict of element mapping"""
 
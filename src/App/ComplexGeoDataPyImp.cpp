@@ -514,6 +514,22 @@ Py::Long ComplexGeoDataPy::getElementMapSize() const
     return Py::Long((long)getComplexGeoDataPtr()->getElementMapSize());
 }
 
+Py::Dict ComplexGeoDataPy::getElementMapMemory() const
+{
+    auto usage = getComplexGeoDataPtr()->getElementMapMemoryUsage();
+    Py::Dict ret;
+    ret.setItem("Names", Py::Long(static_cast<unsigned long>(usage.names)));
+    ret.setItem("ChildElements", Py::Long(static_cast<unsigned long>(usage.childElements)));
+    ret.setItem("ChildMaps", Py::Long(static_cast<unsigned long>(usage.childMaps)));
+    ret.setItem("Buffers", Py::Long(static_cast<unsigned long>(usage.buffers)));
+    ret.setItem("BufferBytes", Py::Long(static_cast<unsigned long>(usage.bufferBytes)));
+    ret.setItem("SharedBytes", Py::Long(static_cast<unsigned long>(usage.sharedBytes)));
+    ret.setItem("IndexBytes", Py::Long(static_cast<unsigned long>(usage.indexBytes)));
+    ret.setItem("TotalBytes",
+                Py::Long(static_cast<unsigned long>(usage.bufferBytes + usage.indexBytes)));
+    return ret;
+}
+
 void ComplexGeoDataPy::setHasher(Py::Object obj)
 {
     auto self = getComplexGeoDataPtr();
@@ -35,7 +35,9 @@
 #include <vector>
 #include <list>
 #include <algorithm>
+#include <condition_variable>
 #include <filesystem>
+#include <mutex>
 #endif
 
 #include <boost/algorithm/string.hpp>
@@ -49,6 +51,8 @@
 
 #include <QCryptographicHash>
 #include <QCoreApplication>
+#include <QThread>
+#include <QThreadPool>
 
 #include <App/DocumentPy.h>
 #include <Base/Interpreter.h>
@@ -71,6 +75,7 @@
 #include "AutoTransaction.h"
 #include "BackupPolicy.h"
 #include "ExpressionParser.h"
+#include "Extension.h"
 #include "GeoFeature.h"
 #include "License.h"
 #include "Link.h"
@@ -329,6 +334,31 @@ std::vector<std::string> Document::getAvailableRedoNames() const
     return vList;
 }
 
+std::vector<std::size_t> Document::getAvailableUndoMemSizes() const
+{
+    std::vector<std::size_t> vList;
+    if (d->activeUndoTransaction) {
+        vList.push_back(d->activeUndoTransaction->getMemSize());
+    }
+    for (auto It = mUndoTransactions.rbegin();
+         It != mUndoTransactions.rend();
+         ++It) {
+        vList.push_back((*It)->getMemSize());
+    }
+    return vList;
+}
+
+std::vector<std::size_t> Document::getAvailableRedoMemSizes() const
+{
+    std::vector<std::size_t> vList;
+    for (auto It = mRedoTransactions.rbegin();
+         It != mRedoTransactions.rend();
+         ++It) {
+        vList.push_back((*It)->getMemSize());
+    }
+    return vList;
+}
+
 void Document::openTransaction(const char* name) // NOLINT
 {
     if (isPerformingTransaction() || d->committing) {
@@ -496,8 +526,19 @@ void Document::_commitTransaction(const bool notify)
         const int id = d->activeUndoTransaction->getID();
         mUndoTransactions.push_back(d->activeUndoTransaction);
         d->activeUndoTransaction = nullptr;
-        // check the stack for the limits
-        if (mUndoTransactions.size() > d->UndoMaxStackSize) {
+        // check the stack for the limits, the latest transaction is always kept
+        std::size_t memSize = 0;
+        if (d->UndoMemLimit > 0) {
+            for (auto it : mUndoTransactions) {
+                memSize += it->getMemSize();
+            }
+        }
+        while (mUndoTransactions.size() > d->UndoMaxStackSize
+               || (d->UndoMemLimit > 0 && memSize > d->UndoMemLimit
+                   && mUndoTransactions.size() > 1)) {
+            if (d->UndoMemLimit > 0) {
+                memSize -= mUndoTransactions.front()->getMemSize();
+            }
             mUndoMap.erase(mUndoTransactions.front()->getID());
             delete mUndoTransactions.front();
             mUndoTransactions.pop_front();
@@ -701,14 +742,29 @@ int Document::getUndoMode() const
     return d->iUndoMode;
 }
 
-unsigned int Document::getUndoMemSize() const
+std::size_t Document::getUndoMemSize() const
 {
-    return d->UndoMemSize;
+    std::size_t size = 0;
+    if (d->activeUndoTransaction) {
+        size += d->activeUndoTransaction->getMemSize();
+    }
+    for (auto it : mUndoTransactions) {
+        size += it->getMemSize();
+    }
+    for (auto it : mRedoTransactions) {
+        size += it->getMemSize();
+    }
+    return size;
+}
+
+void Document::setUndoLimit(const std::size_t UndoMemSize) // NOLINT
+{
+    d->UndoMemLimit = UndoMemSize;
 }
 
-void Document::setUndoLimit(const unsigned int UndoMemSize) // NOLINT
+std::size_t Document::getUndoLimit() const
 {
-    d->UndoMemSize = UndoMemSize;
+    return d->UndoMemLimit;
 }
 
 void Document::setMaxUndoStackSize(const unsigned int UndoMaxStackSize) // NOLINT
@@ -794,9 +850,17 @@ void Document::onChanged(const Property* prop)
 void Document::onBeforeChangeProperty(const TransactionalObject* Who, const Property* What)
 {
     if (Who->isDerivedFrom<DocumentObject>()) {
-        signalBeforeChangeObject(*static_cast<const DocumentObject*>(Who), *What);
+        auto obj = static_cast<const DocumentObject*>(Who);
+        auto notify = [this, obj, What]() {
+            signalBeforeChangeObject(*obj, *What);
+        };
+        if (!deferNotification(notify)) {
+            notify();
+        }
     }
     if (!d->rollback && !globalIsRelabeling) {
+        // the old value must be recorded now, even in a worker thread
+        auto lock = lockChangeNotification();
         _checkTransaction(nullptr, What, __LINE__);
         if (d->activeUndoTransaction) {
             d->activeUndoTransaction->addObjectChange(Who, What);
@@ -806,9 +870,88 @@ void Document::onBeforeChangeProperty(const TransactionalObject* Who, const Prop
 
 void Document::onChangedProperty(const DocumentObject* Who, const Property* What)
 {
+    if (d->changeBatchLevel > 0 && Who->isAttachedToDocument() && What->getName()) {
+        // the ID is never reused, unlike the name of a removed object
+        std::pair<long, std::string> key(Who->getID(), What->getName());
+        if (d->pendingChangeSet.insert(key).second) {
+            d->pendingChanges.push_back(std::move(key));
+        }
+        return;
+    }
     signalChangedObject(*Who, *What);
 }
 
+void Document::beginChangeBatch()
+{
+    ++d->changeBatchLevel;
+}
+
+void Document::endChangeBatch()
+{
+    if (d->changeBatchLevel <= 0 || --d->changeBatchLevel > 0) {
+        return;
+    }
+
+    auto pending = std::move(d->pendingChanges);
+    d->pendingChanges.clear();
+    d->pendingChangeSet.clear();
+
+    // look the objects and properties up again, they may have been removed in the meantime
+    PropertyChanges changes;
+    changes.reserve(pending.size());
+    for (const auto& [objId, propName] : pending) {
+        auto obj = getObjectByID(objId);
+        if (!obj) {
+            continue;
+        }
+        if (auto prop = obj->getPropertyByName(propName.c_str())) {
+            changes.emplace_back(obj, prop);
+        }
+    }
+    if (changes.empty()) {
+        return;
+    }
+
+    Base::FlagToggler<> flag(d->deliveringChanges);
+    signalChangedObjects(*this, changes);
+    for (const auto& [obj, prop] : changes) {
+        signalChangedObject(*obj, *prop);
+    }
+}
+
+bool Document::isChangeBatchActive() const
+{
+    return d->changeBatchLevel > 0;
+}
+
+bool Document::isDeliveringChangeBatch() const
+{
+    return d->deliveringChanges;
+}
+
+namespace
+{
+// the notifications of the object that the current worker thread of a parallel recompute runs
+thread_local std::vector<std::function<void()>>* deferredNotifications = nullptr;
+}  // namespace
+
+bool Document::deferNotification(std::function<void()>&& notification)
+{
+    if (!deferredNotifications) {
+        return false;
+    }
+    deferredNotifications->push_back(std::move(notification));
+    return true;
+}
+
+std::unique_lock<std::recursive_mutex> Document::lockChangeNotification() const
+{
+    if (!d->parallelRecompute) {
+        return {};
+    }
+    return std::unique_lock<std::recursive_mutex>(d->notificationMutex);
+}
+
 void Document::setTransactionMode(const int iMode) // NOLINT
 {
     d->iTransactionMode = iMode;
@@ -1650,9 +1793,9 @@ std::vector<DocumentObject*> Document::importObjects(Base::XMLReader& reader)
     return objs;
 }
 
-unsigned int Document::getMemSize() const
+std::size_t Document::getMemSize() const
 {
-    unsigned int size = 0;
+    std::size_t size = 0;
 
     // size of the DocObjects in the document
     for (const auto & it : d->objectArray) {
@@ -1751,6 +1894,7 @@ bool Document::save()
 
 bool Document::saveToFile(const char* filename) const
 {
+    ZoneScoped;
     signalStartSave(*this, filename);
 
     auto hGrp = GetApplication().GetParameterGroupByPath(
@@ -1922,6 +2066,7 @@ void Document::restore(const char* filename,
                        bool delaySignal,
                        const std::vector<std::string>& objNames)
 {
+    ZoneScoped;
     clearUndos();
     d->activeObject = nullptr;
 
@@ -1994,6 +2139,16 @@ void Document::restore(const char* filename,
     // Note: This file doesn't need to be available if the document has been created
     // without GUI. But if available then follow after all data files of the App document.
     signalRestoreDocument(reader);
+
+    ParameterGrp::handle hGrp =
+        GetApplication().GetParameterGroupByPath("User parameter:BaseApp/Preferences/Document");
+    if (hGrp->GetBool("ParallelRestore", false)) {
+        int threads = static_cast<int>(hGrp->GetInt("RestoreThreads", 0));
+        if (threads <= 0) {
+            threads = QThread::idealThreadCount();
+        }
+        reader.setParallelRestore(threads);
+    }
     reader.readFiles(zipstream);
 
     DocumentP::checkStringHasher(reader);
@@ -2672,6 +2827,7 @@ int Document::recompute(const std::vector<DocumentObject*>& objs,
     ParameterGrp::handle hGrp =
         GetApplication().GetParameterGroupByPath("User parameter:BaseApp/Preferences/Document");
     bool canAbort = hGrp->GetBool("CanAbortRecompute", true);
+    bool parallel = hGrp->GetBool("ParallelRecompute", false);
 
     FC_TIME_INIT(t2);
 
@@ -2686,6 +2842,15 @@ int Document::recompute(const std::vector<DocumentObject*>& objs,
                                                                 topoSortedObjects.size());
             }
             FC_LOG("Recompute pass " << passes);
+            // the first pass may run independent branches concurrently, the
+            // second pass for dependency inversion is always done serially
+            if (parallel && passes == 0 && idx == 0) {
+                if (_recomputeParallel(topoSortedObjects, filter, seq.get(), hasError, objectCount)
+                    < 0) {
+                    passes = 2;
+                }
+                idx = topoSortedObjects.size();
+            }
             for (; idx < topoSortedObjects.size(); ++idx) {
                 auto obj = topoSortedObjects[idx];
                 if (!obj->isAttachedToDocument() || filter.find(obj) != filter.end()) {
@@ -2977,9 +3142,217 @@ const char* Document::getErrorDescription(const DocumentObject* Obj) const
     return d->findRecomputeLog(Obj);
 }
 
+int Document::_recomputeParallel(const std::vector<DocumentObject*>& objs,
+                                 std::set<DocumentObject*>& filter,
+                                 Base::SequencerLauncher* seq,
+                                 bool* hasError,
+                                 int& objectCount)
+{
+    ZoneScoped;
+
+    ParameterGrp::handle hGrp =
+        GetApplication().GetParameterGroupByPath("User parameter:BaseApp/Preferences/Document");
+    int threads = static_cast<int>(hGrp->GetInt("RecomputeThreads", 0));
+    if (threads <= 0) {
+        threads = QThread::idealThreadCount();
+    }
+
+    // count the unfinished dependencies of each object, only considering the
+    // objects that take part in this recompute
+    std::unordered_map<const DocumentObject*, std::size_t> indices;
+    indices.reserve(objs.size());
+    for (std::size_t i = 0; i < objs.size(); ++i) {
+        indices.emplace(objs[i], i);
+    }
+    std::vector<std::size_t> pending(objs.size(), 0);
+    std::vector<std::vector<std::size_t>> dependents(objs.size());
+    for (std::size_t i = 0; i < objs.size(); ++i) {
+        for (auto dep : objs[i]->getOutList()) {
+            auto it = indices.find(dep);
+            if (it != indices.end() && it->second != i) {
+                ++pending[i];
+                dependents[it->second].push_back(i);
+            }
+        }
+    }
+
+    // Prefer the lowest index so that the order stays close to the serial recompute
+    std::set<std::size_t> ready;
+    std::vector<bool> scheduled(objs.size(), false);
+    for (std::size_t i = 0; i < objs.size(); ++i) {
+        if (pending[i] == 0) {
+            ready.insert(i);
+            scheduled[i] = true;
+        }
+    }
+
+    auto mustRunInMainThread = [](const DocumentObject* obj) {
+        if (!obj->isRecomputeThreadSafe() || obj->ExpressionEngine.numExpressions() > 0) {
+            return true;
+        }
+        for (auto ext : obj->getExtensionsDerivedFromType<App::Extension>()) {
+            if (ext->isPythonExtension()) {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    struct Result
+    {
+        std::size_t index;
+        int result;
+        std::vector<std::function<void()>> notifications;
+    };
+    std::mutex mutex;
+    std::condition_variable finished;
+    std::deque<Result> results;
+    std::size_t running = 0;
+    std::size_t done = 0;
+    bool aborted = false;
+
+    auto release = [&](std::size_t index) {
+        ++done;
+        for (auto dependent : dependents[index]) {
+            if (pending[dependent] > 0 && --pending[dependent] == 0 && !scheduled[dependent]) {
+                ready.insert(dependent);
+                scheduled[dependent] = true;
+            }
+        }
+    };
+
+    // Handles a finished object the same way as the serial recompute does.
+    // This is always called in the main thread.
+    auto complete = [&](std::size_t index, bool recomputed, int res) {
+        auto obj = objs[index];
+        if (recomputed && res != 0) {
+            if (hasError) {
+                *hasError = true;
+            }
+            if (res < 0) {
+                aborted = true;
+            }
+            else {
+                obj->getInListEx(filter, true);
+                filter.insert(obj);
+            }
+        }
+        else {
+            if (obj->isTouched() || recomputed) {
+                signalRecomputedObject(*obj);
+                obj->purgeTouched();
+                for (auto inObjIt : obj->getInList()) {
+                    inObjIt->enforceRecompute();
+                }
+            }
+            if (seq) {
+                seq->next(true);
+            }
+        }
+        release(index);
+    };
+
+    Base::StateLocker guard(d->parallelRecompute);
+
+    // Declared after the shared state so that its destructor waits for all
+    // running jobs even if an exception leaves this function.
+    QThreadPool pool;
+    pool.setMaxThreadCount(threads);
+    FC_LOG("Parallel recompute of " << objs.size() << " objects with " << threads << " threads");
+
+    while (done < objs.size()) {
+        // dispatch everything that is ready, objects pinned to the main
+        // thread are recomputed one at a time in between
+        while (!ready.empty() && !aborted) {
+            std::size_t index = *ready.begin();
+            ready.erase(ready.begin());
+            auto obj = objs[index];
+            if (!obj->isAttachedToDocument() || filter.contains(obj)) {
+                release(index);
+                continue;
+            }
+            if (!obj->mustRecompute()) {
+                complete(index, false, 0);
+                continue;
+            }
+            ++objectCount;
+            if (mustRunInMainThread(obj)) {
+                FC_TIME_INIT(t);
+                int res = _recomputeFeature(obj);
+                FC_TIME_LOG(t, "Recompute " << obj->getFullName() << " in main thread");
+                complete(index, true, res);
+                break;
+            }
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                ++running;
+            }
+            pool.start([this, obj, index, &mutex, &finished, &results]() {
+                FC_TIME_INIT(t);
+                std::vector<std::function<void()>> notifications;
+                deferredNotifications = &notifications;
+                int res = 0;
+                try {
+                    res = _recomputeFeature(obj);
+                }
+                catch (...) {
+                    d->addRecomputeLog("Unknown exception!", obj);
+                    res = 1;
+                }
+                deferredNotifications = nullptr;
+                FC_TIME_LOG(t, "Recompute " << obj->getFullName() << " in worker thread");
+                std::lock_guard<std::mutex> lock(mutex);
+                results.push_back({index, res, std::move(notifications)});
+                finished.notify_one();
+            });
+        }
+
+        std::deque<Result> collected;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            if (results.empty() && running > 0 && (ready.empty() || aborted)) {
+                finished.wait(lock, [&results]() {
+                    return !results.empty();
+                });
+            }
+            running -= results.size();
+            collected.swap(results);
+        }
+        for (const auto& it : collected) {
+            // deliver the changes made in the worker thread before the object counts as done
+            for (const auto& notify : it.notifications) {
+                notify();
+            }
+            complete(it.index, true, it.result);
+        }
+
+        if (aborted) {
+            if (running == 0) {
+                break;
+            }
+            continue;
+        }
+        if (collected.empty() && ready.empty() && running == 0 && done < objs.size()) {
+            // only objects within a dependency cycle are left, continue with
+            // them in the order of the sorted list
+            for (std::size_t i = 0; i < objs.size(); ++i) {
+                if (!scheduled[i]) {
+                    ready.insert(i);
+                    scheduled[i] = true;
+                    break;
+                }
+            }
+        }
+    }
+
+    return aborted ? -1 : 0;
+}
+
 // call the recompute of the Feature and handle the exceptions and errors.
 int Document::_recomputeFeature(DocumentObject* Feat) // NOLINT
 {
+    ZoneScoped;
+    ZoneNameF("Recompute %s", Feat->Label.getValue());
     FC_LOG("Recomputing " << Feat->getFullName());
 
     DocumentObjectExecReturn* returnCode = nullptr;
@@ -3844,3 +4217,29 @@ bool Document::mustExecute() const
     }
     return false;
 }
+
+DocumentChangeBatch::DocumentChangeBatch(Document* doc)
+{
+    if (doc) {
+        docName = doc->getName();
+        doc->beginChangeBatch();
+    }
+}
+
+DocumentChangeBatch::~DocumentChangeBatch()
+{
+    if (docName.empty()) {
+        return;
+    }
+    if (auto doc = GetApplication().getDocument(docName.c_str())) {
+        try {
+            doc->endChangeBatch();
+        }
+        catch (Base::Exception& e) {
+            e.reportException();
+        }
+        catch (...) {
+            FC_ERR("Exception on delivering the change batch of " << docName);
+        }
+    }
+}
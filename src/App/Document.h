@@ -35,7 +35,10 @@
 #include "PropertyStandard.h"
 #include "ExportInfo.h"
 
+#include <functional>
 #include <map>
+#include <mutex>
+#include <set>
 #include <vector>
 #include <utility>
 #include <list>
@@ -44,6 +47,7 @@
 namespace Base
 {
 class Writer;
+class SequencerLauncher;
 }
 
 namespace App 
@@ -116,6 +120,8 @@ public:
     };
     // clang-format on
 
+    using PropertyChanges = std::vector<std::pair<const DocumentObject*, const Property*>>;
+
     // NOLINTBEGIN
     /** @name Properties */
     //@{
@@ -174,6 +180,11 @@ public:
     boost::signals2::signal<void(const DocumentObject&, const Property&)> signalBeforeChangeObject;
     /// signal on changed Object
     boost::signals2::signal<void(const DocumentObject&, const Property&)> signalChangedObject;
+    /** signal at the end of a property change batch
+     * It lists every changed object and property once, in the order of the first change.
+     * The held back signalChangedObject of each entry follows right after.
+     */
+    boost::signals2::signal<void(const Document&, const PropertyChanges&)> signalChangedObjects;
     /// signal on manually called DocumentObject::touch()
     boost::signals2::signal<void(const DocumentObject&)> signalTouchedObject;
     /// signal on relabeled Object
@@ -288,7 +299,7 @@ public:
 
     /// returns the complete document memory consumption, including all managed DocObjects and Undo
     /// Redo.
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
 
     /** @name Object handling  */
     //@{
@@ -494,10 +505,15 @@ public:
     /// Check if a transaction is open and its list is empty.
     /// If no transaction is open true is returned.
     bool isTransactionEmpty() const;
-    /// Set the Undo limit in Byte!
-    void setUndoLimit(unsigned int UndoMemSize = 0);
+    /** Set the Undo limit in Byte!
+     * When a transaction is committed the oldest Undos are removed until the memory
+     * consumption fits into the limit. The latest Undo is always kept. 0 means no limit.
+     */
+    void setUndoLimit(std::size_t UndoMemSize = 0);
+    /// Returns the Undo limit in Byte
+    std::size_t getUndoLimit() const;
     /// Returns the actual memory consumption of the Undo redo stuff.
-    unsigned int getUndoMemSize() const;
+    std::size_t getUndoMemSize() const;
     /// Set the Undo limit as stack size
     void setMaxUndoStackSize(unsigned int UndoMaxStackSize = 20);  // NOLINT
     /// Set the Undo limit as stack size
@@ -508,12 +524,16 @@ public:
     int getAvailableUndos(int id = 0) const;
     /// Returns a list of the Undo names
     std::vector<std::string> getAvailableUndoNames() const;
+    /// Returns the memory consumption of each Undo in the order of getAvailableUndoNames()
+    std::vector<std::size_t> getAvailableUndoMemSizes() const;
     /// Will UNDO one step, returns False if no undo was done (Undos == 0).
     bool undo(int id = 0);
     /// Returns the number of stored Redos. If greater than 0 Redo will be effective.
     int getAvailableRedos(int id = 0) const;
     /// Returns a list of the Redo names.
     std::vector<std::string> getAvailableRedoNames() const;
+    /// Returns the memory consumption of each Redo in the order of getAvailableRedoNames()
+    std::vector<std::size_t> getAvailableRedoMemSizes() const;
     /// Will REDO one step, returns False if no redo was done (Redos == 0).
     bool redo(int id = 0);
     /// returns true if the document is in an Transaction phase, e.g. currently performing a
@@ -524,6 +544,24 @@ public:
     void renamePropertyOfObject(TransactionalObject*, const Property* prop, const char* newName);
     //@}
 
+    /** @name Property change batching */
+    //@{
+    /** Start holding back the change notifications of the document objects
+     * Until the matching endChangeBatch() signalChangedObject is not emitted. The
+     * objects themselves are still notified immediately. Batches can be nested.
+     */
+    void beginChangeBatch();
+    /** End a change batch
+     * When the outermost batch ends, signalChangedObjects is emitted followed by
+     * one signalChangedObject per changed object and property.
+     */
+    void endChangeBatch();
+    /// Check if change notifications are held back
+    bool isChangeBatchActive() const;
+    /// Check if the notifications of a finished batch are being delivered
+    bool isDeliveringChangeBatch() const;
+    //@}
+
     /** @name dependency stuff */
     //@{
     /// write GraphViz file
@@ -640,6 +678,15 @@ public:
     /// Indicate if there is any document restoring/importing
     static bool isAnyRestoring();
 
+    /** Queue a change notification if called from a worker thread of the parallel recompute
+     *
+     * Observers such as view providers and Python observers must only be notified in the
+     * calling thread of recompute(). The queued notifications of an object are replayed
+     * there once its recompute has finished.
+     * @return true if the notification was queued, false if it must be delivered right away.
+     */
+    static bool deferNotification(std::function<void()>&& notification);
+
     void registerLabel(const std ::string& newLabel);
     void unregisterLabel(const std::string& oldLabel);
     bool containsLabel(const std::string& label);
@@ -678,6 +725,19 @@ protected:
     /// helper which Recompute only this feature
     /// @return 0 if succeeded, 1 if failed, -1 if aborted by user.
     int _recomputeFeature(DocumentObject* Feat);
+    /** Recompute the sorted objects by scheduling independent branches in parallel
+     *
+     * An object is started as soon as all objects of its out list are done.
+     * Objects that are not thread-safe are recomputed in the calling thread.
+     * @return 0 if finished, -1 if aborted by user.
+     */
+    int _recomputeParallel(const std::vector<DocumentObject*>& objs,
+                           std::set<DocumentObject*>& filter,
+                           Base::SequencerLauncher* seq,
+                           bool* hasError,
+                           int& objectCount);
+    /// Serializes the undo records of property changes during a parallel recompute
+    std::unique_lock<std::recursive_mutex> lockChangeNotification() const;
     void _clearRedos();
 
     /// refresh the internal dependency graph
@@ -722,6 +782,23 @@ private:
     bool autoCreated;    // Flag to know if the document was automatically created at startup
 };
 
+/** Holds back the change notifications of a document for the lifetime of this object
+ * @see Document::beginChangeBatch()
+ */
+class AppExport DocumentChangeBatch
+{
+public:
+    explicit DocumentChangeBatch(Document* doc);
+    ~DocumentChangeBatch();
+
+    DocumentChangeBatch(const DocumentChangeBatch&) = delete;
+    DocumentChangeBatch& operator=(const DocumentChangeBatch&) = delete;
+
+private:
+    // the document may be closed inside the scope
+    std::string docName;
+};
+
 template<typename T>
 inline std::vector<T*> Document::getObjectsOfType() const
 {
@@ -1,6 +1,6 @@
 from PropertyContainer import PropertyContainer
 from DocumentObject import DocumentObject
-from typing import Final, List, Tuple, Sequence
+from typing import ContextManager, Final, List, Tuple, Sequence
 
 
 class Document(PropertyContainer):
@@ -34,6 +34,9 @@ class Document(PropertyContainer):
     UndoRedoMemSize: Final[int] = 0
     """The size of the Undo stack in byte"""
 
+    UndoLimit: int = 0
+    """The memory limit of the Undo stack in byte (0 = no limit). The oldest Undos are removed when it is exceeded"""
+
     UndoCount: Final[int] = 0
     """Number of possible Undos"""
 
@@ -46,6 +49,12 @@ class Document(PropertyContainer):
     RedoNames: Final[List[str]] = []
     """A List of Redo names"""
 
+    UndoMemSizes: Final[List[int]] = []
+    """A list of the memory sizes of the Undos in byte"""
+
+    RedoMemSizes: Final[List[int]] = []
+    """A list of the memory sizes of the Redos in byte"""
+
     Name: Final[str] = ""
     """The internal name of the document"""
 
@@ -179,6 +188,21 @@ class Document(PropertyContainer):
         """
         ...
 
+    def changeBatch(self) -> ContextManager[None]:
+        """
+        Return a context manager holding back the change notifications of the document objects.
+
+        Inside the with statement observers are not notified about property
+        changes. Batches can be nested. When the outermost batch ends, observers
+        receive slotChangedObjects(doc, changes) once and then
+        slotChangedObject(obj, prop) once per changed object and property.
+
+            with doc.changeBatch():
+                obj.Length = 10
+                obj.Width = 20
+        """
+        ...
+
     def addObject(
         self,
         *,
@@ -0,0 +1,114 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 The FreeCAD Project Association                     *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+#ifndef _PreComp_
+#include <sstream>
+#endif
+
+#include "DocumentChangeBatchPy.h"
+#include "Application.h"
+#include "Document.h"
+
+
+using namespace App;
+
+Py::PythonType& DocumentChangeBatchPy::behaviors()
+{
+    return Py::PythonClass<DocumentChangeBatchPy>::behaviors();
+}
+
+PyTypeObject* DocumentChangeBatchPy::type_object()
+{
+    return Py::PythonClass<DocumentChangeBatchPy>::type_object();
+}
+
+bool DocumentChangeBatchPy::check(PyObject* py)
+{
+    return Py::PythonClass<DocumentChangeBatchPy>::check(py);
+}
+
+Py::Object DocumentChangeBatchPy::create(const std::string& docName)
+{
+    Py::Callable class_type(type());
+    Py::TupleN arg(Py::String(docName));
+    return class_type.apply(arg, Py::Dict());
+}
+
+DocumentChangeBatchPy::DocumentChangeBatchPy(Py::PythonClassInstance* self,
+                                             Py::Tuple& args,
+                                             Py::Dict& kwds)
+    : Py::PythonClass<DocumentChangeBatchPy>::PythonClass(self, args, kwds)
+{
+    const char* name {};
+    if (!PyArg_ParseTuple(args.ptr(), "s", &name)) {
+        throw Py::Exception();
+    }
+
+    docName = name;
+}
+
+DocumentChangeBatchPy::~DocumentChangeBatchPy() = default;
+
+Py::Object DocumentChangeBatchPy::repr()
+{
+    std::stringstream str;
+    str << "<Change batch of document " << docName << ">";
+    return Py::String(str.str());  // NOLINT
+}
+
+Py::Object DocumentChangeBatchPy::enter(const Py::Tuple&)
+{
+    if (batch) {
+        throw Py::RuntimeError("Change batch is already active");
+    }
+    auto doc = GetApplication().getDocument(docName.c_str());
+    if (!doc) {
+        throw Py::RuntimeError("Document " + docName + " is closed");
+    }
+
+    batch = std::make_unique<DocumentChangeBatch>(doc);
+    return self();  // NOLINT
+}
+PYCXX_VARARGS_METHOD_DECL(DocumentChangeBatchPy, enter)
+
+Py::Object DocumentChangeBatchPy::exit(const Py::Tuple&)
+{
+    // delivers the held back notifications, exceptions of the observers are reported there
+    batch.reset();
+    return Py::Boolean(false);  // NOLINT
+}
+PYCXX_VARARGS_METHOD_DECL(DocumentChangeBatchPy, exit)
+
+void DocumentChangeBatchPy::init_type()
+{
+    behaviors().name("DocumentChangeBatch");
+    behaviors().doc("Context manager holding back the change notifications of a document");
+    behaviors().supportRepr();
+
+    PYCXX_ADD_VARARGS_METHOD(__enter__, enter, "__enter__()");
+    PYCXX_ADD_VARARGS_METHOD(__exit__, exit, "__exit__(type, value, traceback)");
+
+    // Call to make the type ready for use
+    behaviors().readyType();
+}
@@ -0,0 +1,68 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 The FreeCAD Project Association                     *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#ifndef APP_DOCUMENTCHANGEBATCHPY_H
+#define APP_DOCUMENTCHANGEBATCHPY_H
+
+#include <memory>
+#include <string>
+
+#include <CXX/Extensions.hxx>
+#include <FCGlobal.h>
+
+
+namespace App
+{
+
+class DocumentChangeBatch;
+
+/** Python context manager returned by Document.changeBatch()
+ * Entering it holds back the change notifications of the document, leaving
+ * it delivers them.
+ * @see Document::beginChangeBatch()
+ */
+class AppExport DocumentChangeBatchPy: public Py::PythonClass<DocumentChangeBatchPy>  // NOLINT
+{
+public:
+    static Py::PythonType& behaviors();
+    static PyTypeObject* type_object();
+    static bool check(PyObject* py);
+
+    static Py::Object create(const std::string& docName);
+    DocumentChangeBatchPy(Py::PythonClassInstance* self, Py::Tuple& args, Py::Dict& kwds);
+    ~DocumentChangeBatchPy() override;
+
+    static void init_type();
+    Py::Object repr() override;
+
+    Py::Object enter(const Py::Tuple&);
+    Py::Object exit(const Py::Tuple&);
+
+private:
+    std::string docName;
+    std::unique_ptr<DocumentChangeBatch> batch;
+};
+
+}  // namespace App
+
+#endif  // APP_DOCUMENTCHANGEBATCHPY_H
@@ -752,7 +752,12 @@ void DocumentObject::onBeforeChange(const Property* prop)
         onBeforeChangeProperty(_pDoc, prop);
     }
 
-    signalBeforeChange(*this, *prop);
+    auto notify = [this, prop]() {
+        signalBeforeChange(*this, *prop);
+    };
+    if (!Document::deferNotification(notify)) {
+        notify();
+    }
 }
 
 std::vector<std::pair<Property*, std::unique_ptr<Property>>>
@@ -889,11 +894,15 @@ void DocumentObject::onChanged(const Property* prop)
     TransactionalObject::onChanged(prop);
 
     // Now signal the view provider
-    if (_pDoc) {
-        _pDoc->onChangedProperty(this, prop);
+    auto notify = [this, prop]() {
+        if (_pDoc) {
+            _pDoc->onChangedProperty(this, prop);
+        }
+        signalChanged(*this, *prop);
+    };
+    if (!Document::deferNotification(notify)) {
+        notify();
     }
-
-    signalChanged(*this, *prop);
 }
 
 void DocumentObject::clearOutListCache() const
@@ -517,6 +517,19 @@ public:
     {
         return false;
     }
+
+    /** Return true if execute() can safely run in a worker thread
+     *
+     * This is only used by the opt-in parallel recompute of the document.
+     * An object may only return true if its execute() reads its own and its
+     * dependencies' properties, writes only its own properties and does not
+     * call into Python or the GUI. Objects returning false are always
+     * recomputed in the main thread.
+     */
+    virtual bool isRecomputeThreadSafe() const
+    {
+        return false;
+    }
     /// Handle Label changes, including forcing unique label values,
     /// signalling OnBeforeLabelChange, and arranging to update linked references,
     /// on the assumption that after returning the label will indeed be changed to
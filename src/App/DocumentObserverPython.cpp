@@ -101,6 +101,7 @@ DocumentObserverPython::DocumentObserverPython(const Py::Object& obj)
     FC_PY_ELEMENT_ARG1(DeletedObject, DeletedObject)
     FC_PY_ELEMENT_ARG2(BeforeChangeObject, BeforeChangeObject)
     FC_PY_ELEMENT_ARG2(ChangedObject, ChangedObject)
+    FC_PY_ELEMENT_ARG2(ChangedObjects, ChangedObjects)
     FC_PY_ELEMENT_ARG1(RecomputedObject, ObjectRecomputed)
     FC_PY_ELEMENT_ARG1(BeforeRecomputeDocument, BeforeRecomputeDocument)
     FC_PY_ELEMENT_ARG1(RecomputedDocument, Recomputed)
@@ -372,6 +373,33 @@ void DocumentObserverPython::slotChangedObject(const App::DocumentObject& Obj,
     }
 }
 
+void DocumentObserverPython::slotChangedObjects(
+    const App::Document& Doc,
+    const std::vector<std::pair<const App::DocumentObject*, const App::Property*>>& Changes)
+{
+    Base::PyGILStateLocker lock;
+    try {
+        Py::List list;
+        for (const auto& [obj, prop] : Changes) {
+            const char* prop_name = obj->getPropertyName(prop);
+            if (prop_name) {
+                Py::Tuple item(2);
+                item.setItem(0, Py::asObject(const_cast<App::DocumentObject*>(obj)->getPyObject()));
+                item.setItem(1, Py::String(prop_name));
+                list.append(item);
+            }
+        }
+        Py::Tuple args(2);
+        args.setItem(0, Py::asObject(const_cast<App::Document&>(Doc).getPyObject()));
+        args.setItem(1, list);
+        Base::pyCall(pyChangedObjects.ptr(), args.ptr());
+    }
+    catch (Py::Exception&) {
+        Base::PyException e;  // extract the Python error text
+        e.reportException();
+    }
+}
+
 void DocumentObserverPython::slotRecomputedObject(const App::DocumentObject& Obj)
 {
     Base::PyGILStateLocker lock;
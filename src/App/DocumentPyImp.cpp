@@ -28,6 +28,7 @@
 #include <Base/Stream.h>
 
 #include "Document.h"
+#include "DocumentChangeBatchPy.h"
 #include "DocumentObject.h"
 #include "DocumentObjectPy.h"
 #include "MergeDocuments.h"
@@ -596,6 +597,18 @@ PyObject* DocumentPy::commitTransaction(PyObject* args)
     Py_Return;
 }
 
+PyObject* DocumentPy::changeBatch(PyObject* args)
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+    PY_TRY
+    {
+        return Py::new_reference_to(DocumentChangeBatchPy::create(getDocumentPtr()->getName()));
+    }
+    PY_CATCH;
+}
+
 Py::Boolean DocumentPy::getHasPendingTransaction() const
 {
     return {getDocumentPtr()->hasPendingTransaction()};
@@ -939,7 +952,21 @@ void DocumentPy::setUndoMode(Py::Long arg)
 
 Py::Long DocumentPy::getUndoRedoMemSize() const
 {
-    return Py::Long((long)getDocumentPtr()->getUndoMemSize());
+    return Py::Long(static_cast<unsigned long>(getDocumentPtr()->getUndoMemSize()));
+}
+
+Py::Long DocumentPy::getUndoLimit() const
+{
+    return Py::Long(static_cast<unsigned long>(getDocumentPtr()->getUndoLimit()));
+}
+
+void DocumentPy::setUndoLimit(Py::Long arg)
+{
+    long limit = static_cast<long>(arg);
+    if (limit < 0) {
+        throw Py::ValueError("Undo limit must not be negative");
+    }
+    getDocumentPtr()->setUndoLimit(static_cast<std::size_t>(limit));
 }
 
 Py::Long DocumentPy::getUndoCount() const
@@ -976,6 +1003,30 @@ Py::List DocumentPy::getRedoNames() const
     return res;
 }
 
+Py::List DocumentPy::getUndoMemSizes() const
+{
+    std::vector<std::size_t> vList = getDocumentPtr()->getAvailableUndoMemSizes();
+    Py::List res;
+
+    for (auto It : vList) {
+        res.append(Py::Long(static_cast<unsigned long>(It)));
+    }
+
+    return res;
+}
+
+Py::List DocumentPy::getRedoMemSizes() const
+{
+    std::vector<std::size_t> vList = getDocumentPtr()->getAvailableRedoMemSizes();
+    Py::List res;
+
+    for (auto It : vList) {
+        res.append(Py::Long(static_cast<unsigned long>(It)));
+    }
+
+    return res;
+}
+
 Py::String DocumentPy::getDependencyGraph() const
 {
     std::stringstream out;
@@ -1,5 +1,7 @@
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <algorithm>
+#include <mutex>
 #include <unordered_map>
 #ifndef FC_DEBUG
 #include <random>
@@ -45,6 +47,170 @@ namespace Data
 static std::unordered_map<const ElementMap*, unsigned> _elementMapToId;
 static std::unordered_map<unsigned, ElementMapPtr> _idToElementMap;
 
+namespace
+{
+
+// The postfix buffers shared by the element maps of all features. A feature
+// copies most names from the shapes of its inputs and the element maps of
+// the features along a history end up with many equal postfixes, which then
+// take the memory of a single copy each.
+//
+// Each map keeps its own set of the postfixes it uses, so the pool is only
+// locked once per distinct postfix and map. Buffers held by nobody but the
+// pool are dropped whenever the pool has doubled in size.
+class SharedPostfixes
+{
+public:
+    QByteArray intern(const QByteArray& postfix)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = pool.constFind(postfix);
+        if (it != pool.constEnd()) {
+            return *it;
+        }
+        if (pool.size() >= purgeSize) {
+            purge();
+        }
+        pool.insert(postfix);
+        return postfix;
+    }
+
+private:
+    void purge()
+    {
+        for (auto it = pool.begin(); it != pool.end();) {
+            if (it->isDetached()) {
+                it = pool.erase(it);
+            }
+            else {
+                ++it;
+            }
+        }
+        purgeSize = std::max<qsizetype>(minPurgeSize, pool.size() * 2);
+    }
+
+    static constexpr qsizetype minPurgeSize {1024};
+    std::mutex mutex;
+    QSet<QByteArray> pool;
+    qsizetype purgeSize {minPurgeSize};
+};
+
+// Version 2 stores the names as their interned parts, and may refer to the
+// data of the names through the postfix table with an '@' marker
+constexpr int formatVersion = 2;
+
+SharedPostfixes& sharedPostfixes()
+{
+    static SharedPostfixes postfixes;
+    return postfixes;
+}
+
+// Names hashed by the string hasher have the text of their string ID as data,
+// '#' followed by the ID in hex. The data of such names is stored as the ID
+// itself, flagged to tell it from the IDs of the interned name parts.
+constexpr std::uint32_t hashedNameFlag = 0x80000000U;
+constexpr int hashedNameSize = 9;  // '#' and up to eight hex digits
+
+bool parseHashedName(const QByteArray& data, std::uint32_t& id)
+{
+    // Only accept the text written by StringID::toString(), so that the name
+    // is restored with the same bytes
+    if (data.size() < 2 || data.size() > hashedNameSize || data[0] != '#' || data[1] == '0') {
+        return false;
+    }
+    std::uint32_t value = 0;
+    for (int i = 1; i < data.size(); ++i) {
+        char digit = data[i];
+        if (digit >= '0' && digit <= '9') {
+            value = (value << 4) | std::uint32_t(digit - '0');
+        }
+        else if (digit >= 'a' && digit <= 'f') {
+            value = (value << 4) | std::uint32_t(digit - 'a' + 10);
+        }
+        else {
+            return false;
+        }
+    }
+    if ((value & hashedNameFlag) != 0) {
+        return false;
+    }
+    id = value | hashedNameFlag;
+    return true;
+}
+
+// Write the text of a hashed name to the end of buffer, returns where it starts
+int formatHashedName(std::uint32_t id, char (&buffer)[hashedNameSize])
+{
+    static const char digits[] = "0123456789abcdef";
+    int pos = hashedNameSize;
+    id &= ~hashedNameFlag;
+    do {
+        buffer[--pos] = digits[id & 0xfU];
+        id >>= 4;
+    } while (id != 0);
+    buffer[--pos] = '#';
+    return pos;
+}
+
+std::uint32_t hashBytes(std::uint32_t hash, const QByteArray& bytes)
+{
+    for (char byte : bytes) {
+        hash ^= static_cast<unsigned char>(byte);
+        hash *= 16777619U;
+    }
+    return hash;
+}
+
+// FNV-1a hash of the name, which does not depend on where the name is split
+// into data and postfix
+std::uint32_t hashName(const MappedName& name)
+{
+    std::uint32_t hash = hashBytes(hashBytes(2166136261U, name.dataBytes()), name.postfixBytes());
+    // the index uses the lower bits only
+    hash ^= hash >> 16;
+    hash *= 0x85ebca6bU;
+    hash ^= hash >> 13;
+    return hash;
+}
+
+// Compare the concatenations of data1 and postfix1 and of data2 and postfix2
+bool equalNames(const QByteArray& data1,
+                const QByteArray& postfix1,
+                const QByteArray& data2,
+                const QByteArray& postfix2)
+{
+    if (data1.size() + postfix1.size() != data2.size() + postfix2.size()) {
+        return false;
+    }
+    const QByteArray* part1 = &data1;
+    const QByteArray* part2 = &data2;
+    int pos1 = 0;
+    int pos2 = 0;
+    while (true) {
+        if (pos1 == part1->size()) {
+            if (part1 == &postfix1) {
+                return true;
+            }
+            part1 = &postfix1;
+            pos1 = 0;
+            continue;
+        }
+        if (pos2 == part2->size()) {
+            part2 = &postfix2;
+            pos2 = 0;
+            continue;
+        }
+        int count = static_cast<int>(std::min(part1->size() - pos1, part2->size() - pos2));
+        if (std::memcmp(part1->constData() + pos1, part2->constData() + pos2, count) != 0) {
+            return false;
+        }
+        pos1 += count;
+        pos2 += count;
+    }
+}
+
+}  // namespace
+
 
 void ElementMap::init()
 {
@@ -82,16 +248,14 @@ void ElementMap::beforeSave(const ::App::StringHasherRef& hasherRef) const
     }
     this->_id = id;
 
-    for (auto& indexedName : this->indexedNames) {
-        for (const MappedNameRef& mappedName : indexedName.second.names) {
-            for (const MappedNameRef* ref = &mappedName; ref; ref = ref->next.get()) {
-                for (const ::App::StringIDRef& sid : ref->sids) {
-                    if (sid.isFromSameHasher(hasherRef)) {
-                        sid.mark();
-                    }
-                }
+    for (const NameEntry& entry : this->nameEntries) {
+        for (const ::App::StringIDRef& sid : entry.sids) {
+            if (sid.isFromSameHasher(hasherRef)) {
+                sid.mark();
             }
         }
+    }
+    for (auto& indexedName : this->indexedNames) {
         for (auto& childPair : indexedName.second.children) {
             if (childPair.second.elementMap) {
                 childPair.second.elementMap->beforeSave(hasherRef);
@@ -149,15 +313,14 @@ void ElementMap::save(std::ostream& stream,
         boost::io::ios_flags_saver ifs(stream);
         stream << std::hex;
 
-        for (auto& dequeueOfMappedNameRef : indexedName.second.names) {
-            for (auto ref = &dequeueOfMappedNameRef; ref; ref = ref->next.get()) {
-                if (!ref->name) {
-                    break;
-                }
+        for (NameID first : indexedName.second.names) {
+            for (NameID id = first; id != noName; id = this->nameEntries[id].next) {
+                const NameEntry& entry = this->nameEntries[id];
+                MappedName name = entryName(entry);
 
                 ::App::StringID::IndexID prefixID {};
                 prefixID.id = 0;
-                IndexedName idx(ref->name.dataBytes());
+                IndexedName idx(name.dataBytes());
                 bool printName = true;
                 if (idx) {
                     auto key = QByteArray::fromRawData(idx.getType(),
@@ -169,13 +332,13 @@ void ElementMap::save(std::ostream& stream,
                     }
                 }
                 else {
-                    prefixID = ::App::StringID::fromString(ref->name.dataBytes());
+                    prefixID = ::App::StringID::fromString(name.dataBytes());
                     if (prefixID.id != 0) {
-                        for (auto& sid : ref->sids) {
+                        for (auto& sid : entry.sids) {
                             if (sid.isMarked() && sid.value() == prefixID.id) {
                                 stream << '$';
-                                stream.write(ref->name.dataBytes().constData(),
-                                             ref->name.dataBytes().size());
+                                stream.write(name.dataBytes().constData(),
+                                             name.dataBytes().size());
                                 printName = false;
                                 break;
                             }
@@ -186,11 +349,17 @@ void ElementMap::save(std::ostream& stream,
                     }
                 }
                 if (printName) {
-                    stream << ';';
-                    stream.write(ref->name.dataBytes().constData(), ref->name.dataBytes().size());
+                    auto it = postfixMap.find(name.dataBytes());
+                    if (it != postfixMap.end()) {
+                        stream << '@' << it->second;
+                    }
+                    else {
+                        stream << ';';
+                        stream.write(name.dataBytes().constData(), name.dataBytes().size());
+                    }
                 }
 
-                const QByteArray& postfix = ref->name.postfixBytes();
+                const QByteArray& postfix = name.postfixBytes();
                 if (postfix.isEmpty()) {
                     stream << ".0";
                 }
@@ -199,7 +368,7 @@ void ElementMap::save(std::ostream& stream,
                     assert(it != postfixMap.end());
                     stream << '.' << it->second;
                 }
-                for (auto& sid : ref->sids) {
+                for (auto& sid : entry.sids) {
                     if (sid.isMarked() && sid.value() != prefixID.id) {
                         stream << '.' << sid.value();
                     }
@@ -222,6 +391,7 @@ void ElementMap::save(std::ostream& stream) const
 
     collectChildMaps(childMapSet, childMaps, postfixMap, postfixes);
 
+    stream << "MapVersion " << formatVersion << '\n';
     stream << this->_id << " PostfixCount " << postfixes.size() << '\n';
     for (auto& postfix : postfixes) {
         stream.write(postfix.constData(), postfix.size());
@@ -241,7 +411,23 @@ ElementMapPtr ElementMap::restore(::App::StringHasherRef hasherRef, std::istream
     unsigned id = 0;
     int count = 0;
     std::string tmp;
-    if (!(stream >> id >> tmp >> count) || tmp != "PostfixCount") {
+    // Maps saved before version 2 start with the id
+    if (!(stream >> tmp)) {
+        FC_THROWM(Base::RuntimeError, msg);  // NOLINT
+    }
+    if (tmp == "MapVersion") {
+        int version = 0;
+        if (!(stream >> version) || version < 2 || version > formatVersion) {
+            FC_THROWM(Base::RuntimeError, "Unsupported element map version");  // NOLINT
+        }
+        if (!(stream >> tmp)) {
+            FC_THROWM(Base::RuntimeError, msg);  // NOLINT
+        }
+    }
+    const int decBase {10};
+    char* end = nullptr;
+    id = std::strtoul(tmp.c_str(), &end, decBase);
+    if (*end != 0 || !(stream >> tmp >> count) || tmp != "PostfixCount") {
         FC_THROWM(Base::RuntimeError, msg);  // NOLINT
     }
 
@@ -250,11 +436,12 @@ ElementMapPtr ElementMap::restore(::App::StringHasherRef hasherRef, std::istream
         return map;
     }
 
-    std::vector<std::string> postfixes;
+    // Kept as QByteArray, so that all the restored names ending with the same postfix share it
+    std::vector<QByteArray> postfixes;
     postfixes.reserve(count);
     for (int i = 0; i < count; ++i) {
-        postfixes.emplace_back();
-        stream >> postfixes.back();
+        stream >> tmp;
+        postfixes.emplace_back(tmp.c_str(), static_cast<int>(tmp.size()));
     }
 
     std::vector<ElementMapPtr> childMaps;
@@ -275,7 +462,7 @@ ElementMapPtr ElementMap::restore(::App::StringHasherRef hasherRef, std::istream
 ElementMapPtr ElementMap::restore(::App::StringHasherRef hasherRef,
                                   std::istream& stream,
                                   std::vector<ElementMapPtr>& childMaps,
-                                  const std::vector<std::string>& postfixes)
+                                  const std::vector<QByteArray>& postfixes)
 {
     const char* msg = "Invalid element map";
     const int hexBase {16};
@@ -306,6 +493,7 @@ ElementMapPtr ElementMap::restore(::App::StringHasherRef hasherRef,
     const char* hasherIDWarn = nullptr;
     const char* postfixWarn = nullptr;
     const char* childSIDWarn = nullptr;
+    const char* duplicateWarn = nullptr;
     std::vector<std::string> tokens;
 
     for (int i = 0; i < typeCount; ++i) {
@@ -385,11 +573,10 @@ ElementMapPtr ElementMap::restore(::App::StringHasherRef hasherRef,
         boost::io::ios_flags_saver ifs(stream);
         stream >> std::hex;
 
-        indices.names.resize(outerCount);
+        indices.names.assign(outerCount, noName);
         for (int j = 0; j < outerCount; ++j) {
             idx.setIndex(j);
-            auto* ref = &indices.names[j];
-            int innerCount = 0;
+            NameID last = noName;
             while (true) {
                 if (!(stream >> tmp)) {
                     FC_THROWM(Base::RuntimeError, "Failed to read element name");  // NOLINT
@@ -397,10 +584,6 @@ ElementMapPtr ElementMap::restore(::App::StringHasherRef hasherRef,
                 if (tmp == "0") {
                     break;
                 }
-                if (innerCount++ != 0) {
-                    ref->next = std::make_unique<MappedNameRef>();
-                    ref = ref->next.get();
-                }
                 tokens.clear();
                 boost::split(tokens, tmp, boost::is_any_of("."));
                 if (tokens.size() < 2) {
@@ -410,6 +593,7 @@ ElementMapPtr ElementMap::restore(::App::StringHasherRef hasherRef,
                 int offset = 1;
                 ::App::StringID::IndexID prefixID {};
                 prefixID.id = 0;
+                MappedName name;
 
                 switch (tokens[0][0]) {
                     case ':': {
@@ -422,17 +606,25 @@ ElementMapPtr ElementMap::restore(::App::StringHasherRef hasherRef,
                             FC_THROWM(Base::RuntimeError, "Invalid element name index");  // NOLINT
                         }
                         long elementIndex = strtol(tokens[1].c_str(), nullptr, hexBase);
-                        ref->name = MappedName(
-                            IndexedName::fromConst(postfixes[elementNameIndex - 1].c_str(),
+                        name = MappedName(
+                            IndexedName::fromConst(postfixes[elementNameIndex - 1].constData(),
                                                    static_cast<int>(elementIndex)));
                         break;
                     }
+                    case '@': {
+                        long dataIndex = strtol(tokens[0].c_str() + 1, nullptr, hexBase);
+                        if (dataIndex <= 0 || dataIndex > (int)postfixes.size()) {
+                            FC_THROWM(Base::RuntimeError, "Invalid element name index");  // NOLINT
+                        }
+                        name = MappedName::fromParts(postfixes[dataIndex - 1], QByteArray());
+                        break;
+                    }
                     case '$':
-                        ref->name = MappedName(tokens[0].c_str() + 1);
-                        prefixID = ::App::StringID::fromString(ref->name.dataBytes());
+                        name = MappedName(tokens[0].c_str() + 1);
+                        prefixID = ::App::StringID::fromString(name.dataBytes());
                         break;
                     case ';':
-                        ref->name = MappedName(tokens[0].c_str() + 1);
+                        name = MappedName(tokens[0].c_str() + 1);
                         break;
                     default:
                         FC_THROWM(Base::RuntimeError, "Invalid element name marker");  // NOLINT
@@ -444,39 +636,55 @@ ElementMapPtr ElementMap::restore(::App::StringHasherRef hasherRef,
                         postfixWarn = "Invalid element postfix index";
                     }
                     else {
-                        ref->name += postfixes[postfixIndex - 1];
+                        name += postfixes[postfixIndex - 1];
                     }
                 }
 
-                this->mappedNames.emplace(ref->name, idx);
-
+                ElementIDRefs sids;
                 if (!hasherRef) {
                     if (offset + 1 < (int)tokens.size()) {
                         hasherWarn = "No hasherRef";
                     }
-                    continue;
                 }
-
-                ref->sids.reserve((tokens.size() - offset - 1 + prefixID.id) != 0U ? 1 : 0);
-                if (prefixID.id != 0) {
-                    auto sid = hasherRef->getID(prefixID.id);
-                    if (!sid) {
-                        hasherIDWarn = "Missing element name prefix id";
+                else {
+                    sids.reserve((tokens.size() - offset - 1 + prefixID.id) != 0U ? 1 : 0);
+                    if (prefixID.id != 0) {
+                        auto sid = hasherRef->getID(prefixID.id);
+                        if (!sid) {
+                            hasherIDWarn = "Missing element name prefix id";
+                        }
+                        else {
+                            sids.push_back(sid);
+                        }
                     }
-                    else {
-                        ref->sids.push_back(sid);
+                    for (int l = offset + 1; l < (int)tokens.size(); ++l) {
+                        long readID = strtol(tokens[l].c_str(), nullptr, hexBase);
+                        auto sid = hasherRef->getID(readID);
+                        if (!sid) {
+                            hasherIDWarn = "Invalid element name string id";
+                        }
+                        else {
+                            sids.push_back(sid);
+                        }
                     }
                 }
-                for (int l = offset + 1; l < (int)tokens.size(); ++l) {
-                    long readID = strtol(tokens[l].c_str(), nullptr, hexBase);
-                    auto sid = hasherRef->getID(readID);
-                    if (!sid) {
-                        hasherIDWarn = "Invalid element name string id";
-                    }
-                    else {
-                        ref->sids.push_back(sid);
-                    }
+
+                if (!name) {
+                    continue;
                 }
+                std::uint32_t hash = hashName(name);
+                if (findEntry(name, hash) != noName) {
+                    duplicateWarn = "Duplicate element name";
+                    continue;
+                }
+                NameID entryId = addEntry(name, hash, idx, sids);
+                if (last == noName) {
+                    indices.names[j] = entryId;
+                }
+                else {
+                    this->nameEntries[last].next = entryId;
+                }
+                last = entryId;
             }
         }
     }
@@ -492,6 +700,9 @@ ElementMapPtr ElementMap::restore(::App::StringHasherRef hasherRef,
     if (childSIDWarn) {
         FC_WARN(childSIDWarn);  // NOLINT
     }
+    if (duplicateWarn) {
+        FC_WARN(duplicateWarn);  // NOLINT
+    }
 
     if (!(stream >> tmp) || tmp != "EndMap") {
         FC_THROWM(Base::RuntimeError, "unexpected end of child element map");  // NOLINT
@@ -500,7 +711,7 @@ ElementMapPtr ElementMap::restore(::App::StringHasherRef hasherRef,
     return shared_from_this();
 }
 
-MappedName ElementMap::addName(MappedName& name,
+MappedName ElementMap::addName(const MappedName& name,
                                const IndexedName& idx,
                                const ElementIDRefs& sids,
                                bool overwrite,
@@ -511,32 +722,198 @@ MappedName ElementMap::addName(MappedName& name,
             FC_ERR("missing tag postfix " << name);  // NOLINT
         }
     }
+    std::uint32_t hash = hashName(name);
     while (true) {
         if (overwrite) {
             erase(idx);
         }
-        auto ret = mappedNames.insert(std::make_pair(name, idx));
-        if (ret.second) {                // element just inserted did not exist yet in the map
-            ret.first->first.compact();  // FIXME see MappedName.cpp
-            mappedRef(idx).append(ret.first->first, sids);
+        NameID id = findEntry(name, hash);
+        if (id == noName) {  // element just inserted did not exist yet in the map
+            id = addEntry(name, hash, idx, sids);
+            NameID& first = firstEntryRef(idx);
+            if (first == noName) {
+                first = id;
+            }
+            else {
+                this->nameEntries[id].next = this->nameEntries[first].next;
+                this->nameEntries[first].next = id;
+            }
             FC_TRACE(idx << " -> " << name);  // NOLINT
-            return ret.first->first;
+            return entryName(this->nameEntries[id]);
         }
-        if (ret.first->second == idx) {
+        const NameEntry& entry = this->nameEntries[id];
+        if (entry.element == idx) {
             FC_TRACE("duplicate " << idx << " -> " << name);  // NOLINT
-            return ret.first->first;
+            return entryName(entry);
         }
         if (!overwrite) {
             if (existing) {
-                *existing = ret.first->second;
+                *existing = entry.element;
             }
             return {};
         }
 
-        erase(ret.first->first);
+        erase(name);
     };
 }
 
+MappedName ElementMap::entryName(const NameEntry& entry) const
+{
+    if ((entry.data & hashedNameFlag) != 0) {
+        char buffer[hashedNameSize];
+        int pos = formatHashedName(entry.data, buffer);
+        return MappedName::fromParts(QByteArray(buffer + pos, hashedNameSize - pos),
+                                     this->nameParts[entry.postfix]);
+    }
+    return MappedName::fromParts(this->nameParts[entry.data], this->nameParts[entry.postfix]);
+}
+
+ElementMap::NameID ElementMap::findEntry(const MappedName& name, std::uint32_t hash) const
+{
+    if (this->nameSlots.empty()) {
+        return noName;
+    }
+    return this->nameSlots[findSlot(name, hash)];
+}
+
+std::size_t ElementMap::findSlot(const MappedName& name, std::uint32_t hash) const
+{
+    // Linear probing, there is always an empty slot as the index is at most three quarters full
+    std::size_t mask = this->nameSlots.size() - 1;
+    char buffer[hashedNameSize];
+    for (std::size_t pos = hash & mask;; pos = (pos + 1) & mask) {
+        NameID id = this->nameSlots[pos];
+        if (id == noName) {
+            return pos;
+        }
+        const NameEntry& entry = this->nameEntries[id];
+        if (entry.hash != hash) {
+            continue;
+        }
+        QByteArray data;
+        if ((entry.data & hashedNameFlag) != 0) {
+            int start = formatHashedName(entry.data, buffer);
+            data = QByteArray::fromRawData(buffer + start, hashedNameSize - start);
+        }
+        else {
+            data = this->nameParts[entry.data];
+        }
+        if (equalNames(data,
+                       this->nameParts[entry.postfix],
+                       name.dataBytes(),
+                       name.postfixBytes())) {
+            return pos;
+        }
+    }
+}
+
+ElementMap::NameID ElementMap::addEntry(const MappedName& name,
+                                        std::uint32_t hash,
+                                        const IndexedName& element,
+                                        const ElementIDRefs& sids)
+{
+    if ((this->nameCount + 1) * 4 > this->nameSlots.size() * 3) {
+        growNameIndex();
+    }
+    NameID id = this->freeEntry;
+    if (id != noName) {
+        this->freeEntry = this->nameEntries[id].next;
+    }
+    else {
+        id = static_cast<NameID>(this->nameEntries.size());
+        this->nameEntries.emplace_back();
+    }
+
+    NameEntry& entry = this->nameEntries[id];
+    if (!parseHashedName(name.dataBytes(), entry.data)) {
+        // the data of a raw name is not owned by it
+        entry.data = internPart(name.dataBytes(), false, name.isRaw());
+    }
+    entry.postfix = internPart(name.postfixBytes(), true, false);
+    entry.hash = hash;
+    entry.next = noName;
+    entry.element = element;
+    entry.sids = sids;
+    if (entry.sids.size() > 1) {
+        std::sort(entry.sids.begin(), entry.sids.end());
+        entry.sids.erase(std::unique(entry.sids.begin(), entry.sids.end()), entry.sids.end());
+    }
+
+    this->nameSlots[findSlot(name, hash)] = id;
+    ++this->nameCount;
+    return id;
+}
+
+void ElementMap::removeEntry(NameID id)
+{
+    NameEntry& entry = this->nameEntries[id];
+    std::size_t mask = this->nameSlots.size() - 1;
+    std::size_t hole = entry.hash & mask;
+    while (this->nameSlots[hole] != id) {
+        hole = (hole + 1) & mask;
+    }
+    // Shift back the following entries of the probe sequence which may take the hole, so that
+    // no lookup stops early at it
+    for (std::size_t pos = (hole + 1) & mask; this->nameSlots[pos] != noName;
+         pos = (pos + 1) & mask) {
+        std::size_t home = this->nameEntries[this->nameSlots[pos]].hash & mask;
+        if (((pos - home) & mask) >= ((pos - hole) & mask)) {
+            this->nameSlots[hole] = this->nameSlots[pos];
+            hole = pos;
+        }
+    }
+    this->nameSlots[hole] = noName;
+
+    entry.element = IndexedName();
+    entry.sids.clear();
+    entry.next = this->freeEntry;
+    this->freeEntry = id;
+    --this->nameCount;
+}
+
+void ElementMap::growNameIndex()
+{
+    const std::size_t minSlots {16};
+    std::size_t size = this->nameSlots.empty() ? minSlots : this->nameSlots.size() * 2;
+    std::size_t mask = size - 1;
+    this->nameSlots.assign(size, noName);
+    for (NameID id = 0; id < this->nameEntries.size(); ++id) {
+        if (!this->nameEntries[id].element) {
+            continue;
+        }
+        std::size_t pos = this->nameEntries[id].hash & mask;
+        while (this->nameSlots[pos] != noName) {
+            pos = (pos + 1) & mask;
+        }
+        this->nameSlots[pos] = id;
+    }
+}
+
+ElementMap::NameID ElementMap::internPart(const QByteArray& bytes, bool postfix, bool copy)
+{
+    if (bytes.isEmpty()) {
+        return 0;
+    }
+    auto it = this->namePartIds.constFind(bytes);
+    if (it != this->namePartIds.constEnd()) {
+        return it.value();
+    }
+    QByteArray part;
+    if (postfix) {
+        part = sharedPostfixes().intern(bytes);
+    }
+    else if (copy) {
+        part = QByteArray(bytes.constData(), bytes.size());
+    }
+    else {
+        part = bytes;
+    }
+    auto id = static_cast<NameID>(this->nameParts.size());
+    this->nameParts.push_back(part);
+    this->namePartIds.insert(part, id);
+    return id;
+}
+
 void ElementMap::addPostfix(const QByteArray& postfix,
                             std::map<QByteArray, int>& postfixMap,
                             std::vector<QByteArray>& postfixes)
@@ -783,16 +1160,17 @@ MappedName ElementMap::renameDuplicateElement(int index,
 
 void ElementMap::erase(const MappedName& name)
 {
-    auto it = this->mappedNames.find(name);
-    if (it == this->mappedNames.end()) {
+    NameID id = findEntry(name, hashName(name));
+    if (id == noName) {
         return;
     }
-    MappedNameRef* ref = findMappedRef(it->second);
-    if (!ref) {
-        return;
+    const IndexedName& idx = this->nameEntries[id].element;
+    NameID* link = &this->indexedNames[idx.getType()].names[idx.getIndex()];
+    while (*link != id) {
+        link = &this->nameEntries[*link].next;
     }
-    ref->erase(name);
-    this->mappedNames.erase(it);
+    *link = this->nameEntries[id].next;
+    removeEntry(id);
 }
 
 void ElementMap::erase(const IndexedName& idx)
@@ -805,27 +1183,29 @@ void ElementMap::erase(const IndexedName& idx)
     if (idx.getIndex() >= (int)indices.names.size()) {
         return;
     }
-    auto& ref = indices.names[idx.getIndex()];
-    for (auto* nameRef = &ref; nameRef; nameRef = nameRef->next.get()) {
-        this->mappedNames.erase(nameRef->name);
+    NameID& first = indices.names[idx.getIndex()];
+    for (NameID id = first; id != noName;) {
+        NameID next = this->nameEntries[id].next;
+        removeEntry(id);
+        id = next;
     }
-    ref.clear();
+    first = noName;
 }
 
 unsigned long ElementMap::size() const
 {
-    return mappedNames.size() + childElementSize;
+    return nameCount + childElementSize;
 }
 
 bool ElementMap::empty() const
 {
-    return mappedNames.empty() && childElementSize == 0;
+    return nameCount == 0 && childElementSize == 0;
 }
 
 IndexedName ElementMap::find(const MappedName& name, ElementIDRefs* sids) const
 {
-    auto nameIter = mappedNames.find(name);
-    if (nameIter == mappedNames.end()) {
+    NameID id = findEntry(name, hashName(name));
+    if (id == noName) {
         if (childElements.isEmpty()) {
             return IndexedName();
         }
@@ -861,21 +1241,16 @@ IndexedName ElementMap::find(const MappedName& name, ElementIDRefs* sids) const
         return IndexedName();
     }
 
+    const NameEntry& entry = this->nameEntries[id];
     if (sids) {
-        const MappedNameRef* ref = findMappedRef(nameIter->second);
-        for (; ref; ref = ref->next.get()) {
-            if (ref->name == name) {
-                if (sids->empty()) {
-                    *sids = ref->sids;
-                }
-                else {
-                    *sids += ref->sids;
-                }
-                break;
-            }
+        if (sids->empty()) {
+            *sids = entry.sids;
+        }
+        else {
+            *sids += entry.sids;
         }
     }
-    return nameIter->second;
+    return entry.element;
 }
 
 MappedName ElementMap::find(const IndexedName& idx, ElementIDRefs* sids) const
@@ -890,19 +1265,17 @@ MappedName ElementMap::find(const IndexedName& idx, ElementIDRefs* sids) const
     }
 
     auto& indices = iter->second;
-    if (idx.getIndex() < (int)indices.names.size()) {
-        const MappedNameRef& ref = indices.names[idx.getIndex()];
-        if (ref.name) {
-            if (sids) {
-                if (!sids->size()) {
-                    *sids = ref.sids;
-                }
-                else {
-                    *sids += ref.sids;
-                }
+    if (idx.getIndex() < (int)indices.names.size() && indices.names[idx.getIndex()] != noName) {
+        const NameEntry& entry = this->nameEntries[indices.names[idx.getIndex()]];
+        if (sids) {
+            if (!sids->size()) {
+                *sids = entry.sids;
+            }
+            else {
+                *sids += entry.sids;
             }
-            return ref.name;
         }
+        return entryName(entry);
     }
 
     auto it = indices.children.upper_bound(idx.getIndex());
@@ -938,23 +1311,18 @@ std::vector<std::pair<MappedName, ElementIDRefs>> ElementMap::findAll(const Inde
     }
 
     auto& indices = iter->second;
-    if (idx.getIndex() < (int)indices.names.size()) {
-        const MappedNameRef& ref = indices.names[idx.getIndex()];
+    if (idx.getIndex() < (int)indices.names.size() && indices.names[idx.getIndex()] != noName) {
+        NameID first = indices.names[idx.getIndex()];
         int count = 0;
-        for (auto nameRef = &ref; nameRef; nameRef = nameRef->next.get()) {
-            if (nameRef->name) {
-                ++count;
-            }
+        for (NameID id = first; id != noName; id = this->nameEntries[id].next) {
+            ++count;
         }
-        if (count != 0) {
-            res.reserve(count);
-            for (auto nameRef = &ref; nameRef; nameRef = nameRef->next.get()) {
-                if (nameRef->name) {
-                    res.emplace_back(nameRef->name, nameRef->sids);
-                }
-            }
-            return res;
+        res.reserve(count);
+        for (NameID id = first; id != noName; id = this->nameEntries[id].next) {
+            const NameEntry& entry = this->nameEntries[id];
+            res.emplace_back(entryName(entry), entry.sids);
         }
+        return res;
     }
 
     auto it = indices.children.upper_bound(idx.getIndex());
@@ -976,38 +1344,12 @@ std::vector<std::pair<MappedName, ElementIDRefs>> ElementMap::findAll(const Inde
     return res;
 }
 
-const MappedNameRef* ElementMap::findMappedRef(const IndexedName& idx) const
-{
-    auto iter = this->indexedNames.find(idx.getType());
-    if (iter == this->indexedNames.end()) {
-        return nullptr;
-    }
-    auto& indices = iter->second;
-    if (idx.getIndex() >= (int)indices.names.size()) {
-        return nullptr;
-    }
-    return &indices.names[idx.getIndex()];
-}
-
-MappedNameRef* ElementMap::findMappedRef(const IndexedName& idx)
-{
-    auto iter = this->indexedNames.find(idx.getType());
-    if (iter == this->indexedNames.end()) {
-        return nullptr;
-    }
-    auto& indices = iter->second;
-    if (idx.getIndex() >= (int)indices.names.size()) {
-        return nullptr;
-    }
-    return &indices.names[idx.getIndex()];
-}
-
-MappedNameRef& ElementMap::mappedRef(const IndexedName& idx)
+ElementMap::NameID& ElementMap::firstEntryRef(const IndexedName& idx)
 {
     assert(idx);
     auto& indices = this->indexedNames[idx.getType()];
     if (idx.getIndex() >= (int)indices.names.size()) {
-        indices.names.resize(idx.getIndex() + 1);
+        indices.names.resize(idx.getIndex() + 1, noName);
     }
     return indices.names[idx.getIndex()];
 }
@@ -1078,8 +1420,17 @@ void ElementMap::collectChildMaps(std::map<const ElementMap*, int>& childMapSet,
         }
     }
 
-    for (auto& mappedName : this->mappedNames) {
-        addPostfix(mappedName.first.constPostfix(), postfixMap, postfixes);
+    for (const NameEntry& entry : this->nameEntries) {
+        if (!entry.element) {
+            continue;
+        }
+        // Long names, such as those of a map without hasher, are written once and then
+        // referred to by their index, see save()
+        if ((entry.data & hashedNameFlag) == 0 && entry.data != 0
+            && !IndexedName(this->nameParts[entry.data])) {
+            addPostfix(this->nameParts[entry.data], postfixMap, postfixes);
+        }
+        addPostfix(this->nameParts[entry.postfix], postfixMap, postfixes);
     }
 
     childMaps.push_back(this);
@@ -1305,8 +1656,13 @@ std::vector<MappedElement> ElementMap::getAll() const
 {
     std::vector<MappedElement> ret;
     ret.reserve(size());
-    for (auto& mappedName : this->mappedNames) {
-        ret.emplace_back(mappedName.first, mappedName.second);
+    for (const auto& indexedName : this->indexedNames) {
+        for (NameID first : indexedName.second.names) {
+            for (NameID id = first; id != noName; id = this->nameEntries[id].next) {
+                const NameEntry& entry = this->nameEntries[id];
+                ret.emplace_back(entryName(entry), entry.element);
+            }
+        }
     }
     for (auto& childElement : this->childElements) {
         auto& child = *childElement.childMap;
@@ -1478,5 +1834,76 @@ void ElementMap::traceElement(const MappedName& name, long masterTag, TraceCallb
     }
 }
 
+ElementMap::MemoryUsage ElementMap::getMemoryUsage() const
+{
+    MemoryUsage usage;
+    std::set<const ElementMap*> maps;
+    std::unordered_set<const char*> buffers;
+    addMemoryUsage(usage, maps, buffers);
+    return usage;
+}
+
+void ElementMap::addMemoryUsage(MemoryUsage& usage,
+                                std::set<const ElementMap*>& maps,
+                                std::unordered_set<const char*>& buffers) const
+{
+    if (!maps.insert(this).second) {
+        return;
+    }
+    if (maps.size() > 1) {
+        ++usage.childMaps;
+    }
+
+    // A rough allocation overhead of a QByteArray buffer and of a tree node
+    constexpr std::size_t bufferOverhead = 24;
+    constexpr std::size_t nodeOverhead = 32;
+
+    auto addBuffer = [&](const QByteArray& bytes) {
+        if (bytes.isEmpty()) {
+            return;
+        }
+        std::size_t bytesUsed = static_cast<std::size_t>(bytes.size()) + bufferOverhead;
+        if (buffers.insert(bytes.constData()).second) {
+            ++usage.buffers;
+            usage.bufferBytes += bytesUsed;
+        }
+        else {
+            usage.sharedBytes += bytesUsed;
+        }
+    };
+
+    usage.names += nameCount;
+    usage.childElements += childElementSize;
+    usage.indexBytes += nameEntries.capacity() * sizeof(NameEntry)
+        + nameSlots.capacity() * sizeof(NameID) + nameParts.capacity() * sizeof(QByteArray)
+        + namePartIds.size() * (nodeOverhead + sizeof(QByteArray) + sizeof(NameID));
+
+    for (const NameEntry& entry : nameEntries) {
+        if (!entry.element) {
+            continue;
+        }
+        usage.indexBytes += entry.sids.size() * sizeof(App::StringIDRef);
+        if ((entry.data & hashedNameFlag) == 0) {
+            addBuffer(nameParts[entry.data]);
+        }
+        addBuffer(nameParts[entry.postfix]);
+    }
+
+    for (const auto& indexedName : indexedNames) {
+        const auto& elements = indexedName.second;
+        usage.indexBytes += nodeOverhead + sizeof(IndexedElements)
+            + elements.names.capacity() * sizeof(NameID);
+        for (const auto& child : elements.children) {
+            usage.indexBytes += nodeOverhead + sizeof(MappedChildElements)
+                + child.second.sids.size() * sizeof(App::StringIDRef);
+            addBuffer(child.second.postfix);
+            if (child.second.elementMap) {
+                child.second.elementMap->addMemoryUsage(usage, maps, buffers);
+            }
+        }
+    }
+    usage.indexBytes += childElements.size() * (nodeOverhead + sizeof(ChildMapInfo));
+}
+
 
 }  // Namespace Data
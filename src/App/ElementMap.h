@@ -32,11 +32,16 @@
 #include "MappedElement.h"
 #include "StringHasher.h"
 
+#include <cstdint>
 #include <cstring>
-#include <deque>
 #include <functional>
 #include <map>
 #include <memory>
+#include <set>
+#include <unordered_set>
+#include <vector>
+
+#include <QHash>
 
 
 namespace Data
@@ -62,11 +67,12 @@ typedef std::function<bool(const MappedName&, int, long, long)> TraceCallback;
 
 /* This class provides for ComplexGeoData's ability to provide proper naming.
  * Specifically, ComplexGeoData uses this class for it's `_id` property.
- * Most of the operations work with the `indexedNames` and `mappedNames` maps.
- * `indexedNames` maps a string to both a name queue and children.
+ * Most of the operations work with `indexedNames` and the name entries.
+ * `indexedNames` maps a string to both the first name entry of each index and children.
  *   each of those children store an IndexedName, offset details, postfix, ids, and
  *   possibly a recursive elementmap
- * `mappedNames` maps a MappedName to a specific IndexedName.
+ * `nameEntries` stores each MappedName as a sequence of IDs together with its IndexedName,
+ *   `nameSlots` is the hash index used to look the entries up by name.
  */
 class AppExport ElementMap
     : public std::enable_shared_from_this<ElementMap>  // TODO can remove shared_from_this?
@@ -210,6 +216,25 @@ public:
      */
     void traceElement(const MappedName& name, long masterTag, TraceCallback cb) const;
 
+    /// Memory used by an element map and its child maps
+    struct AppExport MemoryUsage
+    {
+        std::size_t names = 0;          ///< names stored in the maps
+        std::size_t childElements = 0;  ///< names provided through child element maps
+        std::size_t childMaps = 0;      ///< distinct child element maps
+        std::size_t buffers = 0;        ///< distinct name and postfix buffers
+        std::size_t bufferBytes = 0;    ///< size of the distinct buffers
+        std::size_t sharedBytes = 0;    ///< size the shared buffers would take if they were copies
+        std::size_t indexBytes = 0;     ///< estimated size of the lookup structures
+    };
+
+    /** Estimate the memory used by this map
+     *
+     * Child element maps are visited once each, no matter how many children refer to them, and
+     * buffers shared between names are only counted once.
+     */
+    MemoryUsage getMemoryUsage() const;
+
 
 private:
     /** Serialize this map
@@ -231,7 +256,7 @@ private:
     ElementMapPtr restore(::App::StringHasherRef hasherRef,
                           std::istream& stream,
                           std::vector<ElementMapPtr>& childMaps,
-                          const std::vector<std::string>& postfixes);
+                          const std::vector<QByteArray>& postfixes);
 
     /** Associate the MappedName \c name with the IndexedName \c idx.
      * @param name: the name to add
@@ -242,12 +267,65 @@ private:
      * associated with another indexedName, set \c existing to that indexedname
      * @return the name just added, or an empty name if it wasn't added.
      */
-    MappedName addName(MappedName& name,
+    MappedName addName(const MappedName& name,
                        const IndexedName& idx,
                        const ElementIDRefs& sids,
                        bool overwrite,
                        IndexedName* existing);
 
+    /// The index of a name entry or of an interned name part
+    using NameID = std::uint32_t;
+
+    static constexpr NameID noName = ~NameID(0);
+
+    /** A mapped name stored as a sequence of IDs: the ID of its data, which is either the string
+     * ID of a hashed name or an interned part, followed by the ID of its interned postfix. The
+     * names of an element are chained through \c next, unused entries through the free list.
+     */
+    struct NameEntry
+    {
+        NameID data = 0;
+        NameID postfix = 0;
+        std::uint32_t hash = 0;
+        NameID next = noName;
+        IndexedName element;  ///< the element of the name, null for an unused entry
+        ElementIDRefs sids;
+    };
+
+    /// Return the name stored in \c entry, sharing the interned parts
+    MappedName entryName(const NameEntry& entry) const;
+
+    /// Return the entry storing \c name, or \c noName
+    NameID findEntry(const MappedName& name, std::uint32_t hash) const;
+
+    /// Return the slot of \c name in the hash index, or the empty slot to insert it into
+    std::size_t findSlot(const MappedName& name, std::uint32_t hash) const;
+
+    /** Store \c name in a new entry and add it to the hash index. The entry is not chained
+     * to the other names of \c element yet.
+     */
+    NameID addEntry(const MappedName& name,
+                    std::uint32_t hash,
+                    const IndexedName& element,
+                    const ElementIDRefs& sids);
+
+    /// Remove the entry \c id, which must be unchained already, from the hash index
+    void removeEntry(NameID id);
+
+    /// Double the number of slots of the hash index
+    void growNameIndex();
+
+    /** Return the ID of \c bytes in the name parts of this map, adding them if needed.
+     * Postfixes share their buffer with the equal postfixes in the map of any other feature.
+     * Most names of a map end with one of a few postfixes, which then take the memory of a
+     * single copy each.
+     */
+    NameID internPart(const QByteArray& bytes, bool postfix, bool copy);
+
+    void addMemoryUsage(MemoryUsage& usage,
+                        std::set<const ElementMap*>& maps,
+                        std::unordered_set<const char*>& buffers) const;
+
     /** Utility function that adds \c postfix to \c postfixMap, and to \c postfixes
      * if it was not present in the map.
      */
@@ -275,11 +353,8 @@ private:
     /// Reverse hashElementName()
     MappedName dehashElementName(const MappedName& name) const;
 
-    // FIXME duplicate code? as in copy/paste
-    const MappedNameRef* findMappedRef(const IndexedName& idx) const;
-    MappedNameRef* findMappedRef(const IndexedName& idx);
-
-    MappedNameRef& mappedRef(const IndexedName& idx);
+    /// Return the first name entry of \c idx for modification, adding \c idx if needed
+    NameID& firstEntryRef(const IndexedName& idx);
 
     void collectChildMaps(std::map<const ElementMap*, int>& childMapSet,
                           std::vector<const ElementMap*>& childMaps,
@@ -297,13 +372,21 @@ private:
 
     struct IndexedElements
     {
-        std::deque<MappedNameRef> names;
+        std::vector<NameID> names;
         std::map<int, MappedChildElements> children;
     };
 
     std::map<const char*, IndexedElements, CStringComp> indexedNames;
 
-    std::map<MappedName, IndexedName, std::less<>> mappedNames;
+    std::vector<NameEntry> nameEntries;
+    std::vector<NameID> nameSlots;
+    NameID freeEntry = noName;
+    std::size_t nameCount = 0;
+
+    // the data and postfixes of the names, the first part is empty. The parts are kept until the
+    // map is destroyed, also after the names using them are erased.
+    std::vector<QByteArray> nameParts = std::vector<QByteArray>(1);
+    QHash<QByteArray, NameID> namePartIds;
 
     struct ChildMapInfo
     {
@@ -299,6 +299,12 @@ public:
         }
     }
 
+    bool isRecomputeThreadSafe() const override
+    {
+        // Python features must never leave the main thread
+        return false;
+    }
+
     bool allowDuplicateLabel() const override
     {
         switch (imp->allowDuplicateLabel()) {
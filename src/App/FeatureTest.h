@@ -108,6 +108,11 @@ public:
     short mustExecute() const override;
     /// recalculate the Feature
     DocumentObjectExecReturn* execute() override;
+    /// execute() only touches its own properties
+    bool isRecomputeThreadSafe() const override
+    {
+        return true;
+    }
     /// returns the type name of the ViewProvider
     // Hint: Probably it makes sense to have a view provider for unittests (e.g.
     // Gui::ViewProviderTest)
@@ -27,6 +27,7 @@
 
 #ifndef _PreComp_
 #include <cstdlib>
+#include <mutex>
 #include <unordered_set>
 #endif
 
@@ -73,8 +74,10 @@ void IndexedName::set(const char* name,
                       const std::vector<const char*>& allowedNames,
                       bool allowOthers)
 {
-    // Storage for names that we weren't given external storage for
+    // Storage for names that we weren't given external storage for. Element names are also
+    // looked up from worker threads, e.g. by TopoShape::makeShapeWithElementMap().
     static std::unordered_set<ByteArray, ByteArrayHasher> NameSet;
+    static std::mutex NameSetMutex;
 
     if (length < 0) {
         length = static_cast<int>(std::strlen(name));
@@ -106,6 +109,7 @@ void IndexedName::set(const char* name,
     // If the type was NOT in the list of allowedNames, but the caller has set the allowOthers flag
     // to true, then add the new type to the static NameSet (if it is not already there).
     if (allowOthers) {
+        std::lock_guard<std::mutex> lock(NameSetMutex);
         auto res = NameSet.insert(ByteArray(QByteArray::fromRawData(name, suffixPosition)));
         if (res.second /*The insert succeeded (the type was new)*/) {
             // Make sure that the data in the set is a unique (unshared) copy of the text
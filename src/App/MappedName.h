@@ -171,6 +171,19 @@ public:
         return fromRawData(data.constData(), data.size());
     }
 
+    /// Construct a MappedName from separately stored data and postfix.
+    ///
+    /// \param data The data of the new name. No copy is made, the data is shared.
+    /// \param postfix The postfix of the new name. No copy is made, the postfix is shared.
+    /// \return a new MappedName with the given data and postfix.
+    static MappedName fromParts(const QByteArray& data, const QByteArray& postfix)
+    {
+        MappedName res;
+        res.data = data;
+        res.postfix = postfix;
+        return res;
+    }
+
     /// Construct a MappedName from another MappedName
     ///
     /// \param other The MappedName to copy from. The data is usually not copied, but in some
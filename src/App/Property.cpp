@@ -33,6 +33,7 @@
 #include <CXX/Objects.hxx>
 
 #include "Property.h"
+#include "Document.h"
 #include "ObjectIdentifier.h"
 #include "PropertyContainer.h"
 
@@ -272,9 +273,14 @@ void Property::hasSetValue()
     PropertyCleaner guard(this);
     if (father) {
         father->onChanged(this);
-        if (!testStatus(Busy)) {
-            Base::BitsetLocker<decltype(StatusBits)> guard(StatusBits, Busy);
-            signalChanged(*this);
+        auto notify = [this]() {
+            if (!testStatus(Busy)) {
+                Base::BitsetLocker<decltype(StatusBits)> guard(StatusBits, Busy);
+                signalChanged(*this);
+            }
+        };
+        if (!Document::deferNotification(notify)) {
+            notify();
         }
     }
     StatusBits.set(Touched);
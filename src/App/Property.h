@@ -155,7 +155,7 @@ public:
      */
     static void destroy(Property* p);
 
-    unsigned int getMemSize() const override
+    std::size_t getMemSize() const override
     {
         // you have to implement this method in all property classes!
         return sizeof(father) + sizeof(StatusBits);
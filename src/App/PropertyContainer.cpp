@@ -53,12 +53,12 @@ PropertyContainer::PropertyContainer()
 
 PropertyContainer::~PropertyContainer() = default;
 
-unsigned int PropertyContainer::getMemSize () const
+std::size_t PropertyContainer::getMemSize () const
 {
     std::map<std::string,Property*> Map;
     getPropertyMap(Map);
     std::map<std::string,Property*>::const_iterator It;
-    unsigned int size = 0;
+    std::size_t size = 0;
     for (It = Map.begin(); It != Map.end();++It)
         size += It->second->getMemSize();
     return size;
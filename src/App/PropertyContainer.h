@@ -328,7 +328,7 @@ public:
    */
   ~PropertyContainer() override;
 
-  unsigned int getMemSize () const override;
+  std::size_t getMemSize () const override;
 
   /**
    * @brief Get the full name of the property container.
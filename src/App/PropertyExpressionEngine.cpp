@@ -120,7 +120,7 @@ PropertyExpressionEngine::~PropertyExpressionEngine() = default;
  * @return Size of object.
  */
 
-unsigned int PropertyExpressionEngine::getMemSize() const
+std::size_t PropertyExpressionEngine::getMemSize() const
 {
     return 0;
 }
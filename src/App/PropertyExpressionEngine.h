@@ -114,7 +114,7 @@ public:
     PropertyExpressionEngine();
     ~PropertyExpressionEngine() override;
 
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
 
     std::map<App::ObjectIdentifier, const App::Expression*> getExpressions() const override;
     void setExpressions(std::map<App::ObjectIdentifier, App::ExpressionPtr>&& exprs) override;
@@ -101,7 +101,7 @@ public:
 
     Property* Copy() const override;
     void Paste(const Property& from) override;
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
 
     bool isSame(const Property& other) const override
     {
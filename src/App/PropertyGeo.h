@@ -94,7 +94,7 @@ public:
     Property* Copy() const override;
     void Paste(const Property& from) override;
 
-    unsigned int getMemSize() const override
+    std::size_t getMemSize() const override
     {
         return sizeof(Base::Vector3d);
     }
@@ -239,7 +239,7 @@ public:
     Property* Copy() const override;
     void Paste(const Property& from) override;
 
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     const char* getEditorName() const override
     {
         return "Gui::PropertyEditor::PropertyVectorListItem";
@@ -291,7 +291,7 @@ public:
     Property* Copy() const override;
     void Paste(const Property& from) override;
 
-    unsigned int getMemSize() const override
+    std::size_t getMemSize() const override
     {
         return sizeof(Base::Matrix4D);
     }
@@ -368,7 +368,7 @@ public:
     Property* Copy() const override;
     void Paste(const Property& from) override;
 
-    unsigned int getMemSize() const override
+    std::size_t getMemSize() const override
     {
         return sizeof(Base::Placement);
     }
@@ -440,7 +440,7 @@ public:
     Property* Copy() const override;
     void Paste(const Property& from) override;
 
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
 
 protected:
     Base::Placement getPyValue(PyObject* item) const override;
@@ -506,7 +506,7 @@ public:
     Property* Copy() const override;
     void Paste(const Property& from) override;
 
-    unsigned int getMemSize() const override
+    std::size_t getMemSize() const override
     {
         return sizeof(Base::Placement);
     }
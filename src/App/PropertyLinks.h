@@ -693,7 +693,7 @@ public:
     Property* Copy() const override;
     void Paste(const Property& from) override;
 
-    unsigned int getMemSize() const override
+    std::size_t getMemSize() const override
     {
         return sizeof(App::DocumentObject*);
     }
@@ -812,7 +812,7 @@ public:
     Property* Copy() const override;
     void Paste(const Property& from) override;
 
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     const char* getEditorName() const override
     {
         return "Gui::PropertyEditor::PropertyLinkListItem";
@@ -976,7 +976,7 @@ public:
                                 App::DocumentObject* oldObj,
                                 App::DocumentObject* newObj) const override;
 
-    unsigned int getMemSize() const override
+    std::size_t getMemSize() const override
     {
         return sizeof(App::DocumentObject*);
     }
@@ -1160,7 +1160,7 @@ public:
                                 App::DocumentObject* oldObj,
                                 App::DocumentObject* newObj) const override;
 
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
 
     void updateElementReference(DocumentObject* feature,
                                 bool reverse = false,
@@ -1519,7 +1519,7 @@ public:
                                 App::DocumentObject* oldObj,
                                 App::DocumentObject* newObj) const override;
 
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
 
     void updateElementReference(DocumentObject* feature,
                                 bool reverse = false,
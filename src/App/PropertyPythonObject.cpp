@@ -436,7 +436,7 @@ void PropertyPythonObject::RestoreDocFile(Base::Reader& reader)
     hasSetValue();
 }
 
-unsigned int PropertyPythonObject::getMemSize() const
+std::size_t PropertyPythonObject::getMemSize() const
 {
     return sizeof(Py::Object);
 }
@@ -267,9 +267,9 @@ void PropertyPath::Paste(const Property& from)
     hasSetValue();
 }
 
-unsigned int PropertyPath::getMemSize() const
+std::size_t PropertyPath::getMemSize() const
 {
-    return static_cast<unsigned int>(_cValue.string().size());
+    return _cValue.string().size();
 }
 
 //**************************************************************************
@@ -870,9 +870,9 @@ void PropertyIntegerList::Paste(const Property& from)
     setValues(dynamic_cast<const PropertyIntegerList&>(from)._lValueList);
 }
 
-unsigned int PropertyIntegerList::getMemSize() const
+std::size_t PropertyIntegerList::getMemSize() const
 {
-    return static_cast<unsigned int>(_lValueList.size() * sizeof(long));
+    return _lValueList.size() * sizeof(long);
 }
 
 
@@ -993,9 +993,9 @@ void PropertyIntegerSet::Paste(const Property& from)
     hasSetValue();
 }
 
-unsigned int PropertyIntegerSet::getMemSize() const
+std::size_t PropertyIntegerSet::getMemSize() const
 {
-    return static_cast<unsigned int>(_lValueSet.size() * sizeof(long));
+    return _lValueSet.size() * sizeof(long);
 }
 
 
@@ -1414,9 +1414,9 @@ void PropertyFloatList::Paste(const Property& from)
     setValues(dynamic_cast<const PropertyFloatList&>(from)._lValueList);
 }
 
-unsigned int PropertyFloatList::getMemSize() const
+std::size_t PropertyFloatList::getMemSize() const
 {
-    return static_cast<unsigned int>(_lValueList.size() * sizeof(double));
+    return _lValueList.size() * sizeof(double);
 }
 
 //**************************************************************************
@@ -1568,9 +1568,9 @@ void PropertyString::Paste(const Property& from)
     setValue(dynamic_cast<const PropertyString&>(from)._cValue);
 }
 
-unsigned int PropertyString::getMemSize() const
+std::size_t PropertyString::getMemSize() const
 {
-    return static_cast<unsigned int>(_cValue.size());
+    return _cValue.size();
 }
 
 void PropertyString::setPathValue(const ObjectIdentifier& path, const boost::any& value)
@@ -1709,9 +1709,9 @@ void PropertyUUID::Paste(const Property& from)
     hasSetValue();
 }
 
-unsigned int PropertyUUID::getMemSize() const
+std::size_t PropertyUUID::getMemSize() const
 {
-    return static_cast<unsigned int>(sizeof(_uuid));
+    return sizeof(_uuid);
 }
 
 //**************************************************************************
@@ -1782,13 +1782,13 @@ std::string PropertyStringList::getPyValue(PyObject* item) const
     return ret;
 }
 
-unsigned int PropertyStringList::getMemSize() const
+std::size_t PropertyStringList::getMemSize() const
 {
-    size_t size = 0;
+    std::size_t size = 0;
     for (int i = 0; i < getSize(); i++) {
         size += _lValueList[i].size();
     }
-    return static_cast<unsigned int>(size);
+    return size;
 }
 
 void PropertyStringList::Save(Base::Writer& writer) const
@@ -1941,9 +1941,9 @@ void PropertyMap::setPyObject(PyObject* value)
     }
 }
 
-unsigned int PropertyMap::getMemSize() const
+std::size_t PropertyMap::getMemSize() const
 {
-    size_t size = 0;
+    std::size_t size = 0;
     for (const auto& it : _lValueList) {
         size += it.second.size();
         size += it.first.size();
@@ -2210,9 +2210,9 @@ void PropertyBoolList::Paste(const Property& from)
     setValues(dynamic_cast<const PropertyBoolList&>(from)._lValueList);
 }
 
-unsigned int PropertyBoolList::getMemSize() const
+std::size_t PropertyBoolList::getMemSize() const
 {
-    return static_cast<unsigned int>(_lValueList.size());
+    return _lValueList.size();
 }
 
 //**************************************************************************
@@ -2391,6 +2391,14 @@ PropertyColorList::PropertyColorList() = default;
 
 PropertyColorList::~PropertyColorList() = default;
 
+void PropertyColorList::setValues(std::vector<Base::Color>&& values)
+{
+    atomic_change guard(*this);
+    _touchList.clear();
+    _lValueList = std::move(values);
+    guard.tryInvoke();
+}
+
 //**************************************************************************
 // Base class implementer
 
@@ -2481,9 +2489,9 @@ void PropertyColorList::Paste(const Property& from)
     setValues(dynamic_cast<const PropertyColorList&>(from)._lValueList);
 }
 
-unsigned int PropertyColorList::getMemSize() const
+std::size_t PropertyColorList::getMemSize() const
 {
-    return static_cast<unsigned int>(_lValueList.size() * sizeof(Base::Color));
+    return _lValueList.size() * sizeof(Base::Color);
 }
 
 //**************************************************************************
@@ -3387,9 +3395,9 @@ void PropertyMaterialList::Paste(const Property& from)
     setValues(dynamic_cast<const PropertyMaterialList&>(from)._lValueList);
 }
 
-unsigned int PropertyMaterialList::getMemSize() const
+std::size_t PropertyMaterialList::getMemSize() const
 {
-    return static_cast<unsigned int>(_lValueList.size() * sizeof(Material));
+    return _lValueList.size() * sizeof(Material);
 }
 
 //**************************************************************************
@@ -3447,7 +3455,7 @@ void PropertyPersistentObject::Paste(const Property& from)
     }
 }
 
-unsigned int PropertyPersistentObject::getMemSize() const
+std::size_t PropertyPersistentObject::getMemSize() const
 {
     auto size = inherited::getMemSize();
     if (_pObject) {
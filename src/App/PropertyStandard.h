@@ -79,7 +79,7 @@ public:
     Property* Copy() const override;
     void Paste(const Property& from) override;
 
-    unsigned int getMemSize() const override
+    std::size_t getMemSize() const override
     {
         return sizeof(long);
     }
@@ -140,7 +140,7 @@ public:
     Property* Copy() const override;
     void Paste(const Property& from) override;
 
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
 
     bool isSame(const Property& other) const override
     {
@@ -391,7 +391,7 @@ public:
 
     Property* Copy() const override;
     void Paste(const Property& from) override;
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
 
 protected:
     long getPyValue(PyObject* item) const override;
@@ -445,7 +445,7 @@ public:
 
     Property* Copy() const override;
     void Paste(const Property& from) override;
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
 
     bool isSame(const Property& other) const override
     {
@@ -515,7 +515,7 @@ public:
     Property* Copy() const override;
     void Paste(const Property& from) override;
 
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
 
     bool isSame(const Property& other) const override
     {
@@ -572,7 +572,7 @@ public:
     Property* Copy() const override;
     void Paste(const Property& from) override;
 
-    unsigned int getMemSize() const override
+    std::size_t getMemSize() const override
     {
         return sizeof(double);
     }
@@ -727,7 +727,7 @@ public:
 
     Property* Copy() const override;
     void Paste(const Property& from) override;
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
 
 protected:
     double getPyValue(PyObject* item) const override;
@@ -778,7 +778,7 @@ public:
 
     Property* Copy() const override;
     void Paste(const Property& from) override;
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
 
     void setPathValue(const App::ObjectIdentifier& path, const boost::any& value) override;
     const boost::any getPathValue(const App::ObjectIdentifier& path) const override;
@@ -833,7 +833,7 @@ public:
 
     Property* Copy() const override;
     void Paste(const Property& from) override;
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
 
     bool isSame(const Property& other) const override
     {
@@ -907,7 +907,7 @@ public:
     Property* Copy() const override;
     void Paste(const Property& from) override;
 
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
 
 protected:
     std::string getPyValue(PyObject* item) const override;
@@ -950,7 +950,7 @@ public:
     Property* Copy() const override;
     void Paste(const Property& from) override;
 
-    unsigned int getMemSize() const override
+    std::size_t getMemSize() const override
     {
         return sizeof(bool);
     }
@@ -991,7 +991,7 @@ public:
 
     Property* Copy() const override;
     void Paste(const Property& from) override;
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
 
 protected:
     bool getPyValue(PyObject* py) const override;
@@ -1042,7 +1042,7 @@ public:
     Property* Copy() const override;
     void Paste(const Property& from) override;
 
-    unsigned int getMemSize() const override
+    std::size_t getMemSize() const override
     {
         return sizeof(Base::Color);
     }
@@ -1077,6 +1077,10 @@ public:
      */
     ~PropertyColorList() override;
 
+    using PropertyListsT<Base::Color>::setValues;
+    /// Takes over \a values without copying them
+    void setValues(std::vector<Base::Color>&& values);
+
     PyObject* getPyObject() override;
 
     void Save(Base::Writer& writer) const override;
@@ -1087,7 +1091,7 @@ public:
 
     Property* Copy() const override;
     void Paste(const Property& from) override;
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
 
 protected:
     Base::Color getPyValue(PyObject* py) const override;
@@ -1156,7 +1160,7 @@ public:
     Property* Copy() const override;
     void Paste(const Property& from) override;
 
-    unsigned int getMemSize() const override
+    std::size_t getMemSize() const override
     {
         return sizeof(_cMat);
     }
@@ -1271,7 +1275,7 @@ public:
 
     Property* Copy() const override;
     void Paste(const Property& from) override;
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
 
 protected:
     Material getPyValue(PyObject* py) const override;
@@ -1318,7 +1322,7 @@ public:
 
     Property* Copy() const override;
     void Paste(const Property& from) override;
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
 
     std::shared_ptr<Base::Persistence> getObject() const
     {
@@ -114,9 +114,17 @@ int Transaction::getLastID()
     return _TransactionID;
 }
 
-unsigned int Transaction::getMemSize() const
+std::size_t Transaction::getMemSize() const
 {
-    return 0;
+    std::size_t size = 0;
+    for (const auto& It : _Objects.get<0>()) {
+        size += It.second->getMemSize();
+        // a removed object is kept alive by the transaction
+        if (It.second->status == TransactionObject::New && !It.first->isAttachedToDocument()) {
+            size += It.first->getMemSize();
+        }
+    }
+    return size;
 }
 
 void Transaction::Save(Base::Writer& /*writer*/) const
@@ -471,9 +479,17 @@ void TransactionObject::addOrRemoveProperty(const Property* pcProp, bool add)
     }
 }
 
-unsigned int TransactionObject::getMemSize() const
+std::size_t TransactionObject::getMemSize() const
 {
-    return 0;
+    // Note: Property copies may share their data with the document, e.g. for meshes, so that
+    // the returned size is an upper limit of the memory held by this object
+    std::size_t size = 0;
+    for (const auto& v : _PropChangeMap) {
+        if (v.second.nameOrig.empty() && v.second.property) {
+            size += v.second.property->getMemSize();
+        }
+    }
+    return size;
 }
 
 void TransactionObject::Save(Base::Writer& /*writer*/) const
@@ -30,6 +30,8 @@
 #include <map>
 #include <string>
 #include <memory>
+#include <mutex>
+#include <set>
 #include <vector>
 #include <unordered_map>
 #include <unordered_set>
@@ -90,8 +92,13 @@ struct DocumentP
     bool opentransaction {false};
     std::bitset<32> StatusBits;
     int iUndoMode {0};
-    unsigned int UndoMemSize {0};
+    std::size_t UndoMemLimit {0};
     unsigned int UndoMaxStackSize {20};
+    int changeBatchLevel {0};
+    bool deliveringChanges {false};
+    // object IDs and property names of the held back changes in the order of the first change
+    std::vector<std::pair<long, std::string>> pendingChanges;
+    std::set<std::pair<long, std::string>> pendingChangeSet;
     std::string programVersion;
     mutable HasherMap hashers;
     std::multimap<const App::DocumentObject*, std::unique_ptr<App::DocumentObjectExecReturn>>
@@ -102,6 +109,12 @@ struct DocumentP
 
     Document::PreRecomputeHook _preRecomputeHook;
 
+    // Used by the parallel recompute to serialize the recompute log and
+    // property change notifications coming from worker threads
+    std::mutex recomputeLogMutex;
+    std::recursive_mutex notificationMutex;
+    bool parallelRecompute {false};
+
     DocumentP();
 
     void addRecomputeLog(const char* why, App::DocumentObject* obj)
@@ -120,6 +133,7 @@ struct DocumentP
             delete returnCode;
             return;
         }
+        std::lock_guard<std::mutex> lock(recomputeLogMutex);
         _RecomputeLog.emplace(returnCode->Which,
                               std::unique_ptr<DocumentObjectExecReturn>(returnCode));
         returnCode->Which->setStatus(ObjectStatus::Error, true);
@@ -0,0 +1,212 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 The FreeCAD Project Association                     *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#ifndef BASE_FLATGRID_H
+#define BASE_FLATGRID_H
+
+#include <algorithm>
+#include <cstddef>
+#include <future>
+#include <vector>
+
+
+namespace Base
+{
+
+/**
+ * The FlatGrid class stores the element indices of a uniform 3D grid in one contiguous
+ * array. The elements of cell \c c are at <tt>indices[offsets[c]..offsets[c+1])</tt> and
+ * are sorted in ascending order, like the std::set per cell that it replaces.
+ *
+ * The grid is filled in a single step with build() that uses a counting sort: a first
+ * pass counts the elements of each cell, a prefix sum yields the offsets and a second
+ * pass writes the indices. Both passes can be split over several threads.
+ */
+template<typename IndexT>
+class FlatGrid
+{
+public:
+    using const_iterator = typename std::vector<IndexT>::const_iterator;
+
+    /// Read-only view of the elements of a single cell
+    class Cell
+    {
+    public:
+        Cell(const_iterator first, const_iterator last)
+            : first(first)
+            , last(last)
+        {}
+        const_iterator begin() const
+        {
+            return first;
+        }
+        const_iterator end() const
+        {
+            return last;
+        }
+        std::size_t size() const
+        {
+            return static_cast<std::size_t>(last - first);
+        }
+        bool empty() const
+        {
+            return first == last;
+        }
+
+    private:
+        const_iterator first;
+        const_iterator last;
+    };
+
+    /// Sets the number of cells per axis and removes all elements
+    void resize(std::size_t ulX, std::size_t ulY, std::size_t ulZ)
+    {
+        ctX = ulX;
+        ctY = ulY;
+        ctZ = ulZ;
+        offsets.assign(ctX * ctY * ctZ + 1, 0);
+        indices.clear();
+    }
+    /// Removes all cells and elements and releases the memory
+    void clear()
+    {
+        ctX = ctY = ctZ = 0;
+        std::vector<std::size_t>().swap(offsets);
+        std::vector<IndexT>().swap(indices);
+    }
+    /// Returns the elements of the cell at the given grid position
+    Cell operator()(std::size_t ulX, std::size_t ulY, std::size_t ulZ) const
+    {
+        std::size_t cell = cellIndex(ulX, ulY, ulZ);
+        return Cell(indices.begin() + static_cast<std::ptrdiff_t>(offsets[cell]),
+                    indices.begin() + static_cast<std::ptrdiff_t>(offsets[cell + 1]));
+    }
+    /// Returns the number of cells
+    std::size_t countCells() const
+    {
+        return ctX * ctY * ctZ;
+    }
+    /// Returns the total number of stored indices
+    std::size_t countEntries() const
+    {
+        return indices.size();
+    }
+    /// Returns the number of bytes allocated by the grid
+    std::size_t memoryUsage() const
+    {
+        return offsets.capacity() * sizeof(std::size_t) + indices.capacity() * sizeof(IndexT);
+    }
+
+    /**
+     * Fills the grid with the elements 0..numElements-1. For each element \a visit is
+     * called as \c visit(index, add) and must call <tt>add(ulX, ulY, ulZ)</tt> once for
+     * each cell the element belongs to. \a visit is called twice per element and, if
+     * \a threads is greater than one, concurrently from several threads.
+     */
+    template<typename Visitor>
+    void build(std::size_t numElements, Visitor visit, int threads = 1)
+    {
+        const std::size_t numCells = countCells();
+        std::fill(offsets.begin(), offsets.end(), 0);
+        indices.clear();
+        if (numCells == 0) {
+            return;
+        }
+
+        // Each thread handles a contiguous range of elements and keeps its own counters,
+        // so that the indices of a cell end up in ascending order without any locking
+        // Every chunk needs one counter per cell, so only split the work if there are
+        // clearly more elements than cells
+        std::size_t numChunks = std::min<std::size_t>(std::max(threads, 1), numElements / numCells);
+        numChunks = std::max<std::size_t>(numChunks, 1);
+        std::size_t chunkSize = (numElements + numChunks - 1) / numChunks;
+        std::vector<std::vector<std::size_t>> cursors(numChunks,
+                                                      std::vector<std::size_t>(numCells, 0));
+
+        auto forChunks = [&](auto&& func) {
+            std::vector<std::future<void>> futures;
+            for (std::size_t chunk = 1; chunk < numChunks; ++chunk) {
+                futures.push_back(std::async(std::launch::async, func, chunk));
+            }
+            func(0);
+            for (auto& future : futures) {
+                future.get();
+            }
+        };
+
+        // count pass
+        forChunks([&](std::size_t chunk) {
+            std::vector<std::size_t>& counts = cursors[chunk];
+            std::size_t last = std::min(numElements, (chunk + 1) * chunkSize);
+            for (std::size_t index = chunk * chunkSize; index < last; ++index) {
+                visit(static_cast<IndexT>(index),
+                      [this, &counts](std::size_t ulX, std::size_t ulY, std::size_t ulZ) {
+                          ++counts[cellIndex(ulX, ulY, ulZ)];
+                      });
+            }
+        });
+
+        // prefix sum, turns the counters into write positions
+        std::size_t total = 0;
+        for (std::size_t cell = 0; cell < numCells; ++cell) {
+            offsets[cell] = total;
+            for (auto& counts : cursors) {
+                std::size_t count = counts[cell];
+                counts[cell] = total;
+                total += count;
+            }
+        }
+        offsets[numCells] = total;
+        indices.resize(total);
+
+        // fill pass
+        forChunks([&](std::size_t chunk) {
+            std::vector<std::size_t>& positions = cursors[chunk];
+            std::size_t last = std::min(numElements, (chunk + 1) * chunkSize);
+            for (std::size_t index = chunk * chunkSize; index < last; ++index) {
+                visit(static_cast<IndexT>(index),
+                      [this, &positions, index](std::size_t ulX, std::size_t ulY, std::size_t ulZ) {
+                          indices[positions[cellIndex(ulX, ulY, ulZ)]++] =
+                              static_cast<IndexT>(index);
+                      });
+            }
+        });
+    }
+
+private:
+    std::size_t cellIndex(std::size_t ulX, std::size_t ulY, std::size_t ulZ) const
+    {
+        return (ulX * ctY + ulY) * ctZ + ulZ;
+    }
+
+private:
+    std::size_t ctX {0};
+    std::size_t ctY {0};
+    std::size_t ctZ {0};
+    std::vector<std::size_t> offsets {0};
+    std::vector<IndexT> indices;
+};
+
+}  // namespace Base
+
+#endif  // BASE_FLATGRID_H
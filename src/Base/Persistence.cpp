@@ -49,7 +49,7 @@ TYPESYSTEM_SOURCE_ABSTRACT(Base::Persistence, Base::BaseClass)
 //**************************************************************************
 // separator for other implementation aspects
 
-unsigned int Persistence::getMemSize() const
+std::size_t Persistence::getMemSize() const
 {
     // you have to implement this method in all descending classes!
     assert(0);
@@ -74,6 +74,16 @@ void Persistence::SaveDocFile(Writer& /*writer*/) const
 void Persistence::RestoreDocFile(Reader& /*reader*/)
 {}
 
+bool Persistence::canParseDocFile() const
+{
+    return false;
+}
+
+std::function<void()> Persistence::parseDocFile(Reader& /*reader*/)
+{
+    return {};
+}
+
 std::string Persistence::encodeAttribute(const std::string& str)
 {
     std::string tmp;
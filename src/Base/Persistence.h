@@ -24,6 +24,9 @@
 #ifndef APP_PERSISTENCE_H
 #define APP_PERSISTENCE_H
 
+#include <cstddef>
+#include <functional>
+
 #include "BaseClass.h"
 
 namespace Base
@@ -45,7 +48,7 @@ public:
      * It is not meant to have the exact size, it is more or less a fast
      * estimation to tell whether it is two bytes or a GB.
      */
-    virtual unsigned int getMemSize() const = 0;
+    virtual std::size_t getMemSize() const = 0;
 
     /** This method is used to save properties to an XML document.
      * A good example you'll find in PropertyStandard.cpp, e.g. the vector:
@@ -145,6 +148,20 @@ public:
      * @see Base::Reader,Base::XMLReader
      */
     virtual void RestoreDocFile(Reader& /*reader*/);
+    /** Returns true if the data of RestoreDocFile() can be restored with parseDocFile().
+     * The default implementation returns false.
+     */
+    virtual bool canParseDocFile() const;
+    /** This method is used to restore the data of RestoreDocFile() in two steps.
+     * The method itself only parses the data and may be called from a worker thread
+     * in parallel to other objects. Thus, it must neither modify the object nor access
+     * any state that is shared with other objects.
+     * It returns a function that applies the parsed data to the object. This function
+     * is called in the main thread and in the order of the files in the archive.
+     * The default implementation does nothing and returns an empty function.
+     * @see canParseDocFile(), Base::XMLReader::setParallelRestore()
+     */
+    virtual std::function<void()> parseDocFile(Reader& /*reader*/);
     /// Encodes an attribute upon saving.
     static std::string encodeAttribute(const std::string&);
 
@@ -21,6 +21,9 @@
  *                                                                          *
  ***************************************************************************/
 
+#ifndef BASE_PROFILER_H
+#define BASE_PROFILER_H
+
 #ifdef TRACY_ENABLE
 #include <tracy/Tracy.hpp>
 #else
@@ -132,3 +135,5 @@
 #define TracyFiberEnterHint(x, y)
 #define TracyFiberLeave
 #endif
+
+#endif  // BASE_PROFILER_H
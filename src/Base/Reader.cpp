@@ -24,7 +24,11 @@
 #include "PreCompiled.h"
 
 #ifndef _PreComp_
+#include <algorithm>
+#include <deque>
+#include <future>
 #include <map>
+#include <sstream>
 #include <vector>
 #include <iostream>
 #include <string>
@@ -41,8 +45,10 @@
 #include "Exception.h"
 #include "InputSource.h"
 #include "Persistence.h"
+#include "Profiler.h"
 #include "Sequencer.h"
 #include "Stream.h"
+#include "TimeInfo.h"
 #include "XMLTools.h"
 
 #ifdef _MSC_VER
@@ -440,6 +446,8 @@ void Base::XMLReader::readBinFile(const char* filename)
 
 void Base::XMLReader::readFiles(zipios::ZipInputStream& zipstream) const
 {
+    ZoneScoped;
+
     // It's possible that not all objects inside the document could be created, e.g. if a module
     // is missing that would know these object types. So, there may be data files inside the zip
     // file that cannot be read. We simply ignore these files.
@@ -457,6 +465,43 @@ void Base::XMLReader::readFiles(zipios::ZipInputStream& zipstream) const
         // project file was created without GUI
         return;
     }
+    // Files of objects that support it are parsed in worker threads while the next entries
+    // are inflated. The parsed data is applied in the order of the files.
+    struct ParsedFile
+    {
+        std::string fileName;
+        std::string entryName;
+        double inflateTime {};
+        std::future<std::pair<std::function<void()>, double>> result;
+    };
+    std::deque<ParsedFile> parsedFiles;
+    const std::size_t maxParsedFiles = std::size_t(std::max(RestoreThreads, 0));
+
+    auto applyParsedFile = [this, &parsedFiles]() {
+        ZoneScopedN("ApplyDocFile");
+        ParsedFile& file = parsedFiles.front();
+        ZoneText(file.fileName.c_str(), file.fileName.size());
+        try {
+            auto result = file.result.get();
+            TimeElapsed start;
+            if (result.first) {
+                result.first();
+            }
+            Base::Console().log("Restored embedded file %s: inflate %.3f s, parse %.3f s, "
+                                "apply %.3f s\n",
+                                file.fileName.c_str(),
+                                file.inflateTime,
+                                result.second,
+                                TimeElapsed::diffTimeF(start));
+        }
+        catch (...) {
+            Base::Console().error("Reading failed from embedded file: %s\n",
+                                  file.entryName.c_str());
+            FailedFiles.push_back(file.fileName);
+        }
+        parsedFiles.pop_front();
+    };
+
     std::vector<FileEntry>::const_iterator it = FileList.begin();
     Base::SequencerLauncher seq("Importing project files...", FileList.size());
     while (entry->isValid() && it != FileList.end()) {
@@ -468,13 +513,68 @@ void Base::XMLReader::readFiles(zipios::ZipInputStream& zipstream) const
         }
         // If this condition is true both file names match and we can read-in the data, otherwise
         // no file name for the current entry in the zip was registered.
-        if (jt != FileList.end()) {
+        if (jt != FileList.end() && maxParsedFiles > 0 && jt->Object->canParseDocFile()) {
+            if (parsedFiles.size() >= maxParsedFiles) {
+                applyParsedFile();
+            }
+
+            ZoneScopedN("InflateDocFile");
+            TimeElapsed start;
+            ParsedFile file;
+            file.fileName = jt->FileName;
+            file.entryName = entry->toString();
+            std::string data;
             try {
+                Base::Reader reader(zipstream, jt->FileName, FileVersion);
+                data.assign(std::istreambuf_iterator<char>(reader),
+                            std::istreambuf_iterator<char>());
+            }
+            catch (...) {
+                Base::Console().error("Reading failed from embedded file: %s\n",
+                                      file.entryName.c_str());
+                FailedFiles.push_back(jt->FileName);
+                file.fileName.clear();
+            }
+            file.inflateTime = TimeElapsed::diffTimeF(start);
+
+            if (!file.fileName.empty()) {
+                auto parse = [object = jt->Object,
+                              name = jt->FileName,
+                              version = FileVersion,
+                              data = std::move(data)]() mutable {
+                    ZoneScopedN("ParseDocFile");
+                    ZoneText(name.c_str(), name.size());
+                    TimeElapsed start;
+                    std::istringstream str(std::move(data));
+                    Base::Reader reader(str, name, version);
+                    std::function<void()> apply = object->parseDocFile(reader);
+                    double parseTime = TimeElapsed::diffTimeF(start);
+                    return std::make_pair(std::move(apply), parseTime);
+                };
+                file.result = std::async(std::launch::async, std::move(parse));
+                parsedFiles.push_back(std::move(file));
+            }
+            // Go to the next registered file name
+            it = jt + 1;
+        }
+        else if (jt != FileList.end()) {
+            // keep the order of the files
+            while (!parsedFiles.empty()) {
+                applyParsedFile();
+            }
+
+            try {
+                ZoneScopedN("RestoreDocFile");
+                ZoneText(jt->FileName.c_str(), jt->FileName.size());
+                TimeElapsed start;
                 Base::Reader reader(zipstream, jt->FileName, FileVersion);
                 jt->Object->RestoreDocFile(reader);
                 if (reader.getLocalReader()) {
                     reader.getLocalReader()->readFiles(zipstream);
                 }
+                Base::Console().log("Restored embedded file %s: %.3f s\n",
+                                    jt->FileName.c_str(),
+                                    TimeElapsed::diffTimeF(start));
             }
             catch (...) {
                 // For any exception we just continue with the next file.
@@ -501,6 +601,15 @@ void Base::XMLReader::readFiles(zipios::ZipInputStream& zipstream) const
             break;
         }
     }
+
+    while (!parsedFiles.empty()) {
+        applyParsedFile();
+    }
+}
+
+void Base::XMLReader::setParallelRestore(int threads)
+{
+    RestoreThreads = threads > 1 ? threads : 0;
 }
 
 const char* Base::XMLReader::addFile(const char* Name, Base::Persistence* Object)
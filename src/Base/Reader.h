@@ -285,6 +285,10 @@ public:
     const char* addFile(const char* Name, Base::Persistence* Object);
     /// process the requested file writes
     void readFiles(zipios::ZipInputStream& zipstream) const;
+    /** Sets the number of threads that readFiles() uses to parse the files of objects
+     * supporting Persistence::parseDocFile(). A value < 2 reads all files sequentially.
+     */
+    void setParallelRestore(int threads);
     /// Returns whether reader has any registered filenames
     bool hasFilenames() const;
     /// returns true if reading the file \a filename has failed
@@ -399,6 +403,7 @@ public:
 
 private:
     mutable std::vector<std::string> FailedFiles;
+    int RestoreThreads {0};
 
     std::bitset<32> StatusBits;
 
@@ -39,6 +39,7 @@
 #include "Exception.h"
 #include "FileInfo.h"
 #include "Persistence.h"
+#include "Profiler.h"
 #include "Stream.h"
 #include "Tools.h"
 
@@ -351,11 +352,15 @@ void ZipWriter::putNextEntry(const char* file, const char* obj)
 
 void ZipWriter::writeFiles()
 {
+    ZoneScoped;
+
     // use a while loop because it is possible that while
     // processing the files new ones can be added
     size_t index = 0;
     while (index < FileList.size()) {
+        ZoneScopedN("SaveDocFile");
         FileEntry entry = FileList[index];
+        ZoneText(entry.FileName.c_str(), entry.FileName.size());
         putNextEntry(entry.FileName.c_str());
         indent = 0;
         indBuf[0] = 0;
@@ -2917,6 +2917,8 @@ static void doSelect(void* ud, SoEventCallback * cb)
             Gui::Selection().clearSelection(doc->getName());
         }
 
+        // a box may cover thousands of elements, so notify the observers only once
+        std::vector<App::SubObjectT> sels;
         const std::vector<App::DocumentObject*> objects = doc->getObjects();
         for(auto obj : objects) {
             if(App::GeoFeatureGroupExtension::getGroupOfObject(obj))
@@ -2928,8 +2930,9 @@ static void doSelect(void* ud, SoEventCallback * cb)
 
             Base::Matrix4D mat;
             for(auto &sub : getBoxSelection(vp,selectionMode,selectElement,proj,polygon,mat))
-                Gui::Selection().addSelection(doc->getName(), obj->getNameInDocument(), sub.c_str());
+                sels.emplace_back(obj, sub.c_str());
         }
+        Gui::Selection().addSelectionBatch(sels);
     }
 }
 
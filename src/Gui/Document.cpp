@@ -124,6 +124,7 @@ struct DocumentP
     Connection connectNewObject;
     Connection connectDelObject;
     Connection connectCngObject;
+    Connection connectCngObjects;
     Connection connectRenObject;
     Connection connectActObject;
     Connection connectSaveDocument;
@@ -457,6 +458,8 @@ Document::Document(App::Document* pcDocument,Application * app)
         (std::bind(&Gui::Document::slotDeletedObject, this, sp::_1));
     d->connectCngObject = pcDocument->signalChangedObject.connect
         (std::bind(&Gui::Document::slotChangedObject, this, sp::_1, sp::_2));
+    d->connectCngObjects = pcDocument->signalChangedObjects.connect
+        (std::bind(&Gui::Document::slotChangedObjects, this, sp::_1, sp::_2));
     d->connectRenObject = pcDocument->signalRelabelObject.connect
         (std::bind(&Gui::Document::slotRelabelObject, this, sp::_1));
     d->connectActObject = pcDocument->signalActivatedObject.connect
@@ -519,6 +522,9 @@ Document::Document(App::Document* pcDocument,Application * app)
         d->_pcDocument->setUndoMode(1);
         // set the maximum stack size
         d->_pcDocument->setMaxUndoStackSize(hGrp->GetInt("MaxUndoSize",20));
+        // set the memory limit of the stack in MB
+        std::size_t maxMemory = hGrp->GetUnsigned("MaxUndoMemory",0);
+        d->_pcDocument->setUndoLimit(maxMemory * 1024 * 1024);
     }
 
     d->_changeViewTouchDocument = hGrp->GetBool("ChangeViewProviderTouchDocument", true);
@@ -531,6 +537,7 @@ Document::~Document()
     d->connectNewObject.disconnect();
     d->connectDelObject.disconnect();
     d->connectCngObject.disconnect();
+    d->connectCngObjects.disconnect();
     d->connectRenObject.disconnect();
     d->connectActObject.disconnect();
     d->connectSaveDocument.disconnect();
@@ -1043,8 +1050,12 @@ void Document::slotChangedObject(const App::DocumentObject& Obj, const App::Prop
 {
     ViewProvider* viewProvider = getViewProvider(&Obj);
     if (viewProvider) {
+        bool batched = Obj.getDocument()->isDeliveringChangeBatch()
+            && viewProvider->canUpdateDataBatch();
         try {
-            viewProvider->update(&Prop);
+            // view providers taking batches already got the change in slotChangedObjects()
+            if (!batched)
+                viewProvider->update(&Prop);
             if(d->_editingViewer
                     && d->_editingObject
                     && d->_editViewProviderParent
@@ -1075,7 +1086,8 @@ void Document::slotChangedObject(const App::DocumentObject& Obj, const App::Prop
             FC_ERR("Cannot update representation for " << Obj.getFullName());
         }
 
-        handleChildren3D(viewProvider);
+        if (!batched)
+            handleChildren3D(viewProvider);
 
         if (viewProvider->isDerivedFrom<ViewProviderDocumentObject>())
             signalChangedObject(static_cast<ViewProviderDocumentObject&>(*viewProvider), Prop);
@@ -1090,6 +1102,44 @@ void Document::slotChangedObject(const App::DocumentObject& Obj, const App::Prop
     getMainWindow()->updateActions(true);
 }
 
+void Document::slotChangedObjects(const App::Document&,
+        const std::vector<std::pair<const App::DocumentObject*, const App::Property*>>& changes)
+{
+    // group the properties by object, keeping the order of the first change
+    std::vector<std::pair<const App::DocumentObject*, std::vector<const App::Property*>>> objs;
+    std::map<const App::DocumentObject*, std::size_t> index;
+    for (const auto& [obj, prop] : changes) {
+        auto res = index.emplace(obj, objs.size());
+        if (res.second)
+            objs.emplace_back(obj, std::vector<const App::Property*>());
+        objs[res.first->second].second.push_back(prop);
+    }
+
+    for (const auto& [obj, props] : objs) {
+        ViewProvider* viewProvider = getViewProvider(obj);
+        if (!viewProvider || !viewProvider->canUpdateDataBatch())
+            continue;
+        try {
+            viewProvider->updateBatch(props);
+        }
+        catch(const Base::MemoryException& e) {
+            FC_ERR("Memory exception in " << obj->getFullName() << " thrown: " << e.what());
+        }
+        catch(Base::Exception& e){
+            e.reportException();
+        }
+        catch(const std::exception& e){
+            FC_ERR("C++ exception in " << obj->getFullName() << " thrown " << e.what());
+        }
+        catch (...) {
+            FC_ERR("Cannot update representation for " << obj->getFullName());
+        }
+
+        // the 3D children are claimed once for all changed properties
+        handleChildren3D(viewProvider);
+    }
+}
+
 void Document::slotRelabelObject(const App::DocumentObject& Obj)
 {
     ViewProvider* viewProvider = getViewProvider(&Obj);
@@ -1610,9 +1660,9 @@ bool Document::saveCopy()
     }
 }
 
-unsigned int Document::getMemSize () const
+std::size_t Document::getMemSize () const
 {
-    unsigned int size = 0;
+    std::size_t size = 0;
 
     // size of the view providers in the document
     std::map<const App::DocumentObject*,ViewProviderDocumentObject*>::const_iterator it;
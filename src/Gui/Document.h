@@ -85,6 +85,8 @@ protected:
     void slotNewObject(const App::DocumentObject&);
     void slotDeletedObject(const App::DocumentObject&);
     void slotChangedObject(const App::DocumentObject&, const App::Property&);
+    void slotChangedObjects(const App::Document&,
+        const std::vector<std::pair<const App::DocumentObject*, const App::Property*>>&);
     void slotRelabelObject(const App::DocumentObject&);
     void slotTransactionAppend(const App::DocumentObject&, App::Transaction*);
     void slotTransactionRemove(const App::DocumentObject&, App::Transaction*);
@@ -149,7 +151,7 @@ public:
 
     /** @name I/O of the document */
     //@{
-    unsigned int getMemSize () const override;
+    std::size_t getMemSize () const override;
     /// Save the document
     bool save();
     /// Save the document under a new file name
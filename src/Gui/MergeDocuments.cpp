@@ -93,7 +93,7 @@ MergeDocuments::~MergeDocuments()
     connectImport.disconnect();
 }
 
-unsigned int MergeDocuments::getMemSize () const
+std::size_t MergeDocuments::getMemSize () const
 {
     return 0;
 }
@@ -44,7 +44,7 @@ class GuiExport MergeDocuments : public Base::Persistence
 public:
     explicit MergeDocuments(App::Document* doc);
     ~MergeDocuments() override;
-    unsigned int getMemSize () const override;
+    std::size_t getMemSize () const override;
     std::vector<App::DocumentObject*> importObjects(std::istream&);
     void importObject(const std::vector<App::DocumentObject*>& o, Base::XMLReader & r);
     void exportObject(const std::vector<App::DocumentObject*>& o, Base::Writer & w);
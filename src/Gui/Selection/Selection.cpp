@@ -418,7 +418,7 @@ std::vector<SelectionObject> SelectionSingleton::getPickedListEx(const char* pDo
 }
 
 std::vector<SelectionObject> SelectionSingleton::getObjectList(const char* pDocName, Base::Type typeId,
-                                                               std::list<_SelObj> &objList,
+                                                               SelObjList &objList,
                                                                ResolveMode resolve, bool single) const
 {
     std::vector<SelectionObject> temp;
@@ -1009,27 +1009,145 @@ void SelectionSingleton::_SelObj::log(bool remove, bool clearPreselect) {
     Application::Instance->macroManager()->addLine(MacroManager::Cmt, ss.str().c_str());
 }
 
+std::string SelectionSingleton::SelObjList::objectKey(const std::string &docName,
+                                                      const std::string &objName)
+{
+    std::string key;
+    key.reserve(docName.size() + objName.size() + 1);
+    key += docName;
+    key += '#';
+    key += objName;
+    return key;
+}
+
+std::string SelectionSingleton::SelObjList::elementKey(const std::string &newName,
+                                                       const std::string &subName)
+{
+    // new and old style names live in the same map, hence the tag
+    return newName.empty() ? 'S' + subName : 'N' + newName;
+}
+
+void SelectionSingleton::SelObjList::push_back(const _SelObj &sel)
+{
+    auto it = items.insert(items.end(), sel);
+    objects[objectKey(sel.DocName, sel.FeatName)].emplace(sel.SubName, it);
+    if (sel.pResolvedObject) {
+        resolved[sel.pResolvedObject].emplace(elementKey(sel.elementName.newName, sel.SubName), it);
+    }
+}
+
+SelectionSingleton::SelObjList::iterator SelectionSingleton::SelObjList::erase(iterator it)
+{
+    auto removeEntry = [it](auto &index, const auto &key, const std::string &name) {
+        auto entry = index.find(key);
+        if (entry == index.end()) {
+            return;
+        }
+        auto range = entry->second.equal_range(name);
+        for (auto pos = range.first; pos != range.second; ++pos) {
+            if (pos->second == it) {
+                entry->second.erase(pos);
+                break;
+            }
+        }
+        if (entry->second.empty()) {
+            index.erase(entry);
+        }
+    };
+
+    removeEntry(objects, objectKey(it->DocName, it->FeatName), it->SubName);
+    if (it->pResolvedObject) {
+        removeEntry(resolved, it->pResolvedObject,
+                    elementKey(it->elementName.newName, it->SubName));
+    }
+    return items.erase(it);
+}
+
+void SelectionSingleton::SelObjList::clear()
+{
+    items.clear();
+    objects.clear();
+    resolved.clear();
+}
+
+bool SelectionSingleton::SelObjList::contains(const std::string &docName,
+                                              const std::string &objName,
+                                              const std::string &subName) const
+{
+    auto entry = objects.find(objectKey(docName, objName));
+    return entry != objects.end() && entry->second.count(subName) > 0;
+}
+
+std::vector<SelectionSingleton::SelObjList::iterator>
+SelectionSingleton::SelObjList::findObject(const std::string &docName,
+                                           const std::string &objName,
+                                           const std::string &prefix) const
+{
+    std::vector<iterator> result;
+    auto entry = objects.find(objectKey(docName, objName));
+    if (entry == objects.end()) {
+        return result;
+    }
+    // the sub-names sharing a prefix are adjacent in the sorted map
+    for (auto it = entry->second.lower_bound(prefix);
+         it != entry->second.end() && boost::starts_with(it->first, prefix); ++it) {
+        result.push_back(it->second);
+    }
+    return result;
+}
+
+std::vector<SelectionSingleton::SelObjList::iterator>
+SelectionSingleton::SelObjList::findResolved(const App::DocumentObject *obj) const
+{
+    std::vector<iterator> result;
+    auto entry = resolved.find(obj);
+    if (entry != resolved.end()) {
+        result.reserve(entry->second.size());
+        for (const auto &it : entry->second) {
+            result.push_back(it.second);
+        }
+    }
+    return result;
+}
+
+bool SelectionSingleton::SelObjList::containsElement(const App::DocumentObject *obj,
+                                                     const App::ElementNamePair &element) const
+{
+    auto entry = resolved.find(obj);
+    if (entry == resolved.end()) {
+        return false;
+    }
+    if (!element.newName.empty() && entry->second.count(elementKey(element.newName, {})) > 0) {
+        return true;
+    }
+    return entry->second.count(elementKey({}, element.oldName)) > 0;
+}
+
+void SelectionSingleton::setPickedList(const std::vector<SelObj> &pickedList)
+{
+    _PickedList.clear();
+    for(const auto &sel : pickedList) {
+        _SelObj s;
+        s.DocName = sel.DocName;
+        s.FeatName = sel.FeatName;
+        s.SubName = sel.SubName;
+        s.TypeName = sel.TypeName;
+        s.pObject = sel.pObject;
+        s.pDoc = sel.pDoc;
+        s.x = sel.x;
+        s.y = sel.y;
+        s.z = sel.z;
+        _PickedList.push_back(s);
+    }
+    notify(SelectionChanges(SelectionChanges::PickedListChanged));
+}
+
 bool SelectionSingleton::addSelection(const char* pDocName, const char* pObjectName,
         const char* pSubName, float x, float y, float z,
         const std::vector<SelObj> *pickedList, bool clearPreselect)
 {
-    if(pickedList) {
-        _PickedList.clear();
-        for(const auto &sel : *pickedList) {
-            _PickedList.emplace_back();
-            auto &s = _PickedList.back();
-            s.DocName = sel.DocName;
-            s.FeatName = sel.FeatName;
-            s.SubName = sel.SubName;
-            s.TypeName = sel.TypeName;
-            s.pObject = sel.pObject;
-            s.pDoc = sel.pDoc;
-            s.x = sel.x;
-            s.y = sel.y;
-            s.z = sel.z;
-        }
-        notify(SelectionChanges(SelectionChanges::PickedListChanged));
-    }
+    if(pickedList)
+        setPickedList(*pickedList);
 
     _SelObj temp;
     int ret = checkSelection(pDocName, pObjectName, pSubName, ResolveMode::NoResolve, temp);
@@ -1194,7 +1312,7 @@ std::vector<SelectionObject> SelectionSingleton::selStackGet(const char* pDocNam
         item = &_SelStackBack[_SelStackForward.size()-1-index];
     }
 
-    std::list<_SelObj> selList;
+    SelObjList selList;
     for(auto &sobjT : *item) {
         _SelObj sel;
         if(checkSelection(sobjT.getDocumentName().c_str(),
@@ -1246,6 +1364,64 @@ bool SelectionSingleton::addSelections(const char* pDocName, const char* pObject
     return true;
 }
 
+bool SelectionSingleton::addSelectionBatch(const char* pDocName, const char* pObjectName,
+                                           const std::vector<std::string>& pSubNames, bool clearPreselect)
+{
+    App::Document *pDoc = getDocument(pDocName);
+    if(!pDoc || !pObjectName)
+        return false;
+
+    std::vector<App::SubObjectT> objs;
+    objs.reserve(pSubNames.size());
+    for(const auto & pSubName : pSubNames)
+        objs.emplace_back(pDoc->getName(), pObjectName, pSubName.c_str());
+    return addSelectionBatch(objs, clearPreselect);
+}
+
+bool SelectionSingleton::addSelectionBatch(const std::vector<App::SubObjectT>& objs, bool clearPreselect)
+{
+    std::set<std::string> docNames;
+    for(const auto & objT : objs) {
+        _SelObj temp;
+        int ret = checkSelection(objT.getDocumentName().c_str(), objT.getObjectName().c_str(),
+                                 objT.getSubName().c_str(), ResolveMode::NoResolve, temp);
+        if (ret!=0)
+            continue;
+
+        // elements rejected by the gate are silently skipped
+        if (ActiveGate) {
+            const char *subelement = nullptr;
+            auto pObject = getObjectOfType(temp,App::DocumentObject::getClassTypeId(),gateResolve,&subelement);
+            if (!ActiveGate->allow(pObject?pObject->getDocument():temp.pDoc,pObject,subelement)) {
+                ActiveGate->notAllowedReason.clear();
+                continue;
+            }
+        }
+
+        if(!logDisabled)
+            temp.log(false,clearPreselect);
+
+        docNames.insert(temp.DocName);
+        _SelList.push_back(temp);
+    }
+
+    if(docNames.empty())
+        return false;
+
+    _SelStackForward.clear();
+    if(clearPreselect)
+        rmvPreselect();
+
+    FC_LOG("Add Selection batch of " << objs.size());
+
+    for(const auto &docName : docNames)
+        notify(SelectionChanges(SelectionChanges::SetSelection, docName));
+    getMainWindow()->updateActions();
+
+    rmvPreselect(true);
+    return true;
+}
+
 bool SelectionSingleton::updateSelection(bool show, const char* pDocName,
                             const char* pObjectName, const char* pSubName)
 {
@@ -1311,23 +1487,8 @@ bool SelectionSingleton::addSelection(const SelectionObject& obj, bool clearPres
 void SelectionSingleton::rmvSelection(const char* pDocName, const char* pObjectName, const char* pSubName,
         const std::vector<SelObj> *pickedList)
 {
-    if(pickedList) {
-        _PickedList.clear();
-        for(const auto &sel : *pickedList) {
-            _PickedList.emplace_back();
-            auto &s = _PickedList.back();
-            s.DocName = sel.DocName;
-            s.FeatName = sel.FeatName;
-            s.SubName = sel.SubName;
-            s.TypeName = sel.TypeName;
-            s.pObject = sel.pObject;
-            s.pDoc = sel.pDoc;
-            s.x = sel.x;
-            s.y = sel.y;
-            s.z = sel.z;
-        }
-        notify(SelectionChanges(SelectionChanges::PickedListChanged));
-    }
+    if(pickedList)
+        setPickedList(*pickedList);
 
     if(!pDocName)
         return;
@@ -1337,27 +1498,7 @@ void SelectionSingleton::rmvSelection(const char* pDocName, const char* pObjectN
     if (ret<0)
         return;
 
-    std::vector<SelectionChanges> changes;
-    for(auto It=_SelList.begin(),ItNext=It;It!=_SelList.end();It=ItNext) {
-        ++ItNext;
-        if(It->DocName!=temp.DocName || It->FeatName!=temp.FeatName)
-            continue;
-        // if no subname is specified, remove all subobjects of the matching object
-        if(!temp.SubName.empty()) {
-            // otherwise, match subojects with common prefix, separated by '.'
-            if(!boost::starts_with(It->SubName,temp.SubName) ||
-               (It->SubName.length()!=temp.SubName.length() && It->SubName[temp.SubName.length()-1]!='.'))
-                continue;
-        }
-
-        It->log(true);
-
-        changes.emplace_back(SelectionChanges::RmvSelection,
-                It->DocName,It->FeatName,It->SubName,It->TypeName);
-
-        // destroy the _SelObj item
-        _SelList.erase(It);
-    }
+    std::vector<SelectionChanges> changes = eraseSelection(temp);
 
     // NOTE: It can happen that there are nested calls of rmvSelection()
     // so that it's not safe to invoke the notifications inside the loop
@@ -1373,6 +1514,64 @@ void SelectionSingleton::rmvSelection(const char* pDocName, const char* pObjectN
     }
 }
 
+std::vector<SelectionChanges> SelectionSingleton::eraseSelection(const _SelObj &sel)
+{
+    std::vector<SelectionChanges> changes;
+    // if no subname is specified, remove all subobjects of the matching object
+    for(auto It : _SelList.findObject(sel.DocName, sel.FeatName, sel.SubName)) {
+        // otherwise, match subojects with common prefix, separated by '.'
+        if(!sel.SubName.empty() && It->SubName.length()!=sel.SubName.length()
+                && It->SubName[sel.SubName.length()-1]!='.')
+            continue;
+
+        It->log(true);
+
+        changes.emplace_back(SelectionChanges::RmvSelection,
+                It->DocName,It->FeatName,It->SubName,It->TypeName);
+
+        // destroy the _SelObj item
+        _SelList.erase(It);
+    }
+    return changes;
+}
+
+void SelectionSingleton::rmvSelectionBatch(const char* pDocName, const char* pObjectName,
+                                           const std::vector<std::string>& pSubNames)
+{
+    App::Document *pDoc = getDocument(pDocName);
+    if(!pDoc || !pObjectName)
+        return;
+
+    std::vector<App::SubObjectT> objs;
+    objs.reserve(pSubNames.size());
+    for(const auto & pSubName : pSubNames)
+        objs.emplace_back(pDoc->getName(), pObjectName, pSubName.c_str());
+    rmvSelectionBatch(objs);
+}
+
+void SelectionSingleton::rmvSelectionBatch(const std::vector<App::SubObjectT>& objs)
+{
+    std::set<std::string> docNames;
+    for(const auto & objT : objs) {
+        _SelObj temp;
+        int ret = checkSelection(objT.getDocumentName().c_str(), objT.getObjectName().c_str(),
+                                 objT.getSubName().c_str(), ResolveMode::NoResolve, temp);
+        if (ret<0)
+            continue;
+        if(!eraseSelection(temp).empty())
+            docNames.insert(temp.DocName);
+    }
+
+    if(docNames.empty())
+        return;
+
+    FC_LOG("Rmv Selection batch of " << objs.size());
+
+    for(const auto &docName : docNames)
+        notify(SelectionChanges(SelectionChanges::SetSelection, docName));
+    getMainWindow()->updateActions();
+}
+
 struct SelInfo {
     std::string DocName;
     std::string FeatName;
@@ -1615,7 +1814,7 @@ bool SelectionSingleton::isSelected(App::DocumentObject* pObject, const char* pS
 }
 
 int SelectionSingleton::checkSelection(const char *pDocName, const char *pObjectName, const char *pSubName,
-                                       ResolveMode resolve, _SelObj &sel, const std::list<_SelObj> *selList) const
+                                       ResolveMode resolve, _SelObj &sel, const SelObjList *selList) const
 {
     sel.pDoc = getDocument(pDocName);
     if(!sel.pDoc) {
@@ -1671,37 +1870,26 @@ int SelectionSingleton::checkSelection(const char *pDocName, const char *pObject
     if(!pSubName)
         pSubName = "";
 
-    for (auto &s : *selList) {
-        if (s.DocName==pDocName && s.FeatName==sel.FeatName) {
-            if(s.SubName==pSubName)
-                return 1;
-            if (resolve > ResolveMode::OldStyleElement && boost::starts_with(s.SubName,prefix))
-                return 1;
-        }
-    }
+    if (selList->contains(sel.DocName, sel.FeatName, pSubName))
+        return 1;
+    if (resolve > ResolveMode::OldStyleElement
+            && !selList->findObject(sel.DocName, sel.FeatName, prefix).empty())
+        return 1;
     if (resolve == ResolveMode::OldStyleElement) {
-        for(auto &s : *selList) {
-            if(s.pResolvedObject != sel.pResolvedObject)
-                continue;
-            if(!pSubName[0])
-                return 1;
-            if (!s.elementName.newName.empty()) {
-                if (s.elementName.newName == sel.elementName.newName)
-                    return 1;
-            }
-            else if(s.SubName == sel.elementName.oldName)
-                return 1;
-        }
+        if(!pSubName[0])
+            return selList->findResolved(sel.pResolvedObject).empty() ? 0 : 1;
+        if(selList->containsElement(sel.pResolvedObject, sel.elementName))
+            return 1;
     }
     return 0;
 }
 
 const char *SelectionSingleton::getSelectedElement(App::DocumentObject *obj, const char* pSubName) const
 {
-    if (!obj)
+    if (!obj || !obj->isAttachedToDocument())
         return nullptr;
 
-    for(list<_SelObj>::const_iterator It = _SelList.begin();It != _SelList.end();++It) {
+    for(auto It : _SelList.findObject(obj->getDocument()->getName(), obj->getNameInDocument())) {
         if (It->pObject == obj) {
             auto len = It->SubName.length();
             if(!len)
@@ -1726,13 +1914,15 @@ void SelectionSingleton::slotDeletedObject(const App::DocumentObject& Obj)
     // Remove also from the selection, if selected
     // We don't walk down the hierarchy for each selection, so there may be stray selection
     std::vector<SelectionChanges> changes;
-    for(auto it=_SelList.begin(),itNext=it;it!=_SelList.end();it=itNext) {
-        ++itNext;
-        if(it->pResolvedObject == &Obj || it->pObject==&Obj) {
-            changes.emplace_back(SelectionChanges::RmvSelection,
-                    it->DocName,it->FeatName,it->SubName,it->TypeName);
-            _SelList.erase(it);
-        }
+    auto entries = _SelList.findObject(Obj.getDocument()->getName(), Obj.getNameInDocument());
+    for(auto it : _SelList.findResolved(&Obj)) {
+        if(it->pObject != &Obj)
+            entries.push_back(it);
+    }
+    for(auto it : entries) {
+        changes.emplace_back(SelectionChanges::RmvSelection,
+                it->DocName,it->FeatName,it->SubName,it->TypeName);
+        _SelList.erase(it);
     }
     if(!changes.empty()) {
         for(auto &Chng : changes) {
@@ -1844,6 +2034,7 @@ PyMethodDef SelectionSingleton::Methods[] = {
      "subName : str\n    Name of the subelement to update."},
     {"removeSelection",      (PyCFunction) SelectionSingleton::sRemoveSelection, METH_VARARGS,
      "removeSelection(obj, subName) -> None\n"
+     "removeSelection(obj, subNames) -> None\n"
      "removeSelection(docName, objName, subName) -> None\n"
      "\n"
      "Remove an object from the selection.\n"
@@ -1851,7 +2042,25 @@ PyMethodDef SelectionSingleton::Methods[] = {
      "docName : str\n    Name of the `App.Document`.\n"
      "objName : str\n    Name of the `App.DocumentObject` to remove.\n"
      "obj : App.DocumentObject\n    Object to remove.\n"
-     "subName : str\n    Name of the subelement to remove."},
+     "subName : str\n    Name of the subelement to remove.\n"
+     "subNames : list of str\n    List of subelement names to remove."},
+    {"addSelectionBatch",    (PyCFunction) SelectionSingleton::sAddSelectionBatch, METH_VARARGS,
+     "addSelectionBatch(obj, subNames, clear=True) -> None\n"
+     "\n"
+     "Add several subelements of an object to the selection. Unlike\n"
+     "addSelection() the observers are notified only once with setSelection.\n"
+     "\n"
+     "obj : App.DocumentObject\n    Object to add.\n"
+     "subNames : list of str\n    List of subelement names.\n"
+     "clear : bool\n    Clear preselection."},
+    {"removeSelectionBatch", (PyCFunction) SelectionSingleton::sRemoveSelectionBatch, METH_VARARGS,
+     "removeSelectionBatch(obj, subNames) -> None\n"
+     "\n"
+     "Remove several subelements of an object from the selection. Unlike\n"
+     "removeSelection() the observers are notified only once with setSelection.\n"
+     "\n"
+     "obj : App.DocumentObject\n    Object to remove.\n"
+     "subNames : list of str\n    List of subelement names to remove."},
     {"clearSelection"  ,     (PyCFunction) SelectionSingleton::sClearSelection, METH_VARARGS,
      "clearSelection(docName, clearPreSelect=True) -> None\n"
      "clearSelection(clearPreSelect=True) -> None\n"
@@ -2141,7 +2350,61 @@ PyObject *SelectionSingleton::sRemoveSelection(PyObject * /*self*/, PyObject *ar
     PyErr_Clear();
     PyObject *object;
     subname = nullptr;
-    if (!PyArg_ParseTuple(args, "O!|s", &(App::DocumentObjectPy::Type),&object,&subname))
+    if (PyArg_ParseTuple(args, "O!|s", &(App::DocumentObjectPy::Type),&object,&subname)) {
+        auto docObjPy = static_cast<App::DocumentObjectPy*>(object);
+        App::DocumentObject* docObj = docObjPy->getDocumentObjectPtr();
+        if (!docObj || !docObj->isAttachedToDocument()) {
+            PyErr_SetString(Base::PyExc_FC_GeneralError, "Cannot check invalid object");
+            return nullptr;
+        }
+
+        Selection().rmvSelection(docObj->getDocument()->getName(),
+                                 docObj->getNameInDocument(),
+                                 subname);
+
+        Py_Return;
+    }
+
+    PyErr_Clear();
+    PyObject *sequence;
+    if (PyArg_ParseTuple(args, "O!O", &(App::DocumentObjectPy::Type),&object,&sequence)) {
+        auto docObjPy = static_cast<App::DocumentObjectPy*>(object);
+        App::DocumentObject* docObj = docObjPy->getDocumentObjectPtr();
+        if (!docObj || !docObj->isAttachedToDocument()) {
+            PyErr_SetString(Base::PyExc_FC_GeneralError, "Cannot check invalid object");
+            return nullptr;
+        }
+
+        try {
+            if (PyTuple_Check(sequence) || PyList_Check(sequence)) {
+                Py::Sequence list(sequence);
+                for (Py::Sequence::iterator it = list.begin(); it != list.end(); ++it) {
+                    std::string subname = static_cast<std::string>(Py::String(*it));
+                    Selection().rmvSelection(docObj->getDocument()->getName(),
+                                             docObj->getNameInDocument(),
+                                             subname.c_str());
+                }
+                Py_Return;
+            }
+        }
+        catch (const Py::Exception&) {
+            // do nothing here
+        }
+    }
+
+    PyErr_SetString(PyExc_ValueError, "type must be 'DocumentObject[,subname]' or 'DocumentObject, list or tuple of subnames'");
+
+    return nullptr;
+}
+
+PyObject *SelectionSingleton::sAddSelectionBatch(PyObject * /*self*/, PyObject *args)
+{
+    SelectionLogDisabler disabler(true);
+    PyObject *object;
+    PyObject *sequence;
+    PyObject *clearPreselect = Py_True;
+    if (!PyArg_ParseTuple(args, "O!O|O!", &(App::DocumentObjectPy::Type),&object,
+                &sequence,&PyBool_Type,&clearPreselect))
         return nullptr;
 
     auto docObjPy = static_cast<App::DocumentObjectPy*>(object);
@@ -2151,11 +2414,44 @@ PyObject *SelectionSingleton::sRemoveSelection(PyObject * /*self*/, PyObject *ar
         return nullptr;
     }
 
-    Selection().rmvSelection(docObj->getDocument()->getName(),
-                             docObj->getNameInDocument(),
-                             subname);
+    PY_TRY {
+        std::vector<std::string> subnames;
+        Py::Sequence list(sequence);
+        for (Py::Sequence::iterator it = list.begin(); it != list.end(); ++it)
+            subnames.push_back(static_cast<std::string>(Py::String(*it)));
+        Selection().addSelectionBatch(docObj->getDocument()->getName(),
+                                      docObj->getNameInDocument(),
+                                      subnames, Base::asBoolean(clearPreselect));
+        Py_Return;
+    }
+    PY_CATCH;
+}
 
-    Py_Return;
+PyObject *SelectionSingleton::sRemoveSelectionBatch(PyObject * /*self*/, PyObject *args)
+{
+    SelectionLogDisabler disabler(true);
+    PyObject *object;
+    PyObject *sequence;
+    if (!PyArg_ParseTuple(args, "O!O", &(App::DocumentObjectPy::Type),&object,&sequence))
+        return nullptr;
+
+    auto docObjPy = static_cast<App::DocumentObjectPy*>(object);
+    App::DocumentObject* docObj = docObjPy->getDocumentObjectPtr();
+    if (!docObj || !docObj->isAttachedToDocument()) {
+        PyErr_SetString(Base::PyExc_FC_GeneralError, "Cannot check invalid object");
+        return nullptr;
+    }
+
+    PY_TRY {
+        std::vector<std::string> subnames;
+        Py::Sequence list(sequence);
+        for (Py::Sequence::iterator it = list.begin(); it != list.end(); ++it)
+            subnames.push_back(static_cast<std::string>(Py::String(*it)));
+        Selection().rmvSelectionBatch(docObj->getDocument()->getName(),
+                                      docObj->getNameInDocument(), subnames);
+        Py_Return;
+    }
+    PY_CATCH;
 }
 
 PyObject *SelectionSingleton::sClearSelection(PyObject * /*self*/, PyObject *args)
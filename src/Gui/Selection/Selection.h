@@ -26,7 +26,9 @@
 
 #include <deque>
 #include <list>
+#include <map>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <App/DocumentObject.h>
@@ -315,11 +317,26 @@ public:
     bool addSelection(const SelectionObject&, bool clearPreSelect=true);
     /// Add to selection with several sub-elements
     bool addSelections(const char* pDocName, const char* pObjectName, const std::vector<std::string>& pSubNames);
+    /** Add several sub-elements of one object to the selection
+     * Unlike addSelections() the observers get a single SetSelection message
+     * for the whole batch instead of one AddSelection message per element.
+     * Only use it where all interested observers resync on SetSelection.
+     */
+    bool addSelectionBatch(const char* pDocName, const char* pObjectName, const std::vector<std::string>& pSubNames,
+            bool clearPreselect=true);
+    /// Add several (sub-)objects to the selection with a single SetSelection message per document
+    bool addSelectionBatch(const std::vector<App::SubObjectT>& objs, bool clearPreselect=true);
     /// Update a selection
     bool updateSelection(bool show, const char* pDocName, const char* pObjectName=nullptr, const char* pSubName=nullptr);
     /// Remove from selection (for internal use)
     void rmvSelection(const char* pDocName, const char* pObjectName=nullptr, const char* pSubName=nullptr,
             const std::vector<SelObj> *pickedList = nullptr);
+    /** Remove several sub-elements of one object from the selection
+     * The observers get a single SetSelection message for the whole batch.
+     */
+    void rmvSelectionBatch(const char* pDocName, const char* pObjectName, const std::vector<std::string>& pSubNames);
+    /// Remove several (sub-)objects from the selection with a single SetSelection message per document
+    void rmvSelectionBatch(const std::vector<App::SubObjectT>& objs);
     /// Set the selection for a document
     void setSelection(const char* pDocName, const std::vector<App::DocumentObject*>&);
     /// Clear the selection of document \a pDocName. If the document name is not given the selection of the active document is cleared.
@@ -613,6 +630,8 @@ protected:
     static PyObject *sAddSelection        (PyObject *self,PyObject *args);
     static PyObject *sUpdateSelection     (PyObject *self,PyObject *args);
     static PyObject *sRemoveSelection     (PyObject *self,PyObject *args);
+    static PyObject *sAddSelectionBatch   (PyObject *self,PyObject *args);
+    static PyObject *sRemoveSelectionBatch(PyObject *self,PyObject *args);
     static PyObject *sClearSelection      (PyObject *self,PyObject *args);
     static PyObject *sIsSelected          (PyObject *self,PyObject *args);
     static PyObject *sCountObjectsOfType  (PyObject *self,PyObject *args);
@@ -676,9 +695,60 @@ protected:
 
         void log(bool remove=false, bool clearPreselect=true);
     };
-    mutable std::list<_SelObj> _SelList;
 
-    mutable std::list<_SelObj> _PickedList;
+    /** The selection entries in the order of selection
+     * The entries are additionally indexed by document, object and sub-name
+     * and by the resolved object, so that the lookups done for every
+     * selection change don't need to scan the whole list.
+     */
+    class SelObjList {
+    public:
+        using iterator = std::list<_SelObj>::iterator;
+        using const_iterator = std::list<_SelObj>::const_iterator;
+
+        SelObjList() = default;
+        // the indices hold iterators into the list
+        SelObjList(const SelObjList&) = delete;
+        SelObjList& operator=(const SelObjList&) = delete;
+
+        iterator begin() { return items.begin(); }
+        iterator end() { return items.end(); }
+        const_iterator begin() const { return items.begin(); }
+        const_iterator end() const { return items.end(); }
+        bool empty() const { return items.empty(); }
+        std::size_t size() const { return items.size(); }
+
+        void push_back(const _SelObj &sel);
+        iterator erase(iterator it);
+        void clear();
+
+        /// Check for an entry with exactly this sub-name
+        bool contains(const std::string &docName, const std::string &objName,
+                      const std::string &subName) const;
+        /// Returns the entries of an object whose sub-name starts with \a prefix
+        std::vector<iterator> findObject(const std::string &docName, const std::string &objName,
+                                         const std::string &prefix = std::string()) const;
+        /// Returns the entries that resolve to \a obj
+        std::vector<iterator> findResolved(const App::DocumentObject *obj) const;
+        /** Check for an entry that resolves to \a obj and the given element
+         * An empty element name matches any entry of the resolved object.
+         */
+        bool containsElement(const App::DocumentObject *obj, const App::ElementNamePair &element) const;
+
+    private:
+        static std::string objectKey(const std::string &docName, const std::string &objName);
+        static std::string elementKey(const std::string &newName, const std::string &subName);
+
+        std::list<_SelObj> items;
+        // DocName#FeatName -> SubName
+        std::unordered_map<std::string, std::multimap<std::string, iterator>> objects;
+        // resolved object -> new style element name or sub-name
+        std::unordered_map<const App::DocumentObject*,
+                           std::unordered_multimap<std::string, iterator>> resolved;
+    };
+    mutable SelObjList _SelList;
+
+    mutable SelObjList _PickedList;
     bool _needPickedList{false};
 
     using SelStackItem = std::set<App::SubObjectT>;
@@ -686,9 +756,13 @@ protected:
     std::deque<SelStackItem> _SelStackForward;
 
     int checkSelection(const char *pDocName, const char *pObjectName,
-            const char *pSubName, ResolveMode resolve, _SelObj &sel, const std::list<_SelObj> *selList=nullptr) const;
+            const char *pSubName, ResolveMode resolve, _SelObj &sel, const SelObjList *selList=nullptr) const;
+
+    std::vector<Gui::SelectionObject> getObjectList(const char* pDocName,Base::Type typeId, SelObjList &objs, ResolveMode resolve, bool single=false) const;
 
-    std::vector<Gui::SelectionObject> getObjectList(const char* pDocName,Base::Type typeId, std::list<_SelObj> &objs, ResolveMode resolve, bool single=false) const;
+    void setPickedList(const std::vector<SelObj> &pickedList);
+    /// Removes the matching entries and returns the change messages to be sent
+    std::vector<SelectionChanges> eraseSelection(const _SelObj &sel);
 
     static App::DocumentObject *getObjectOfType(_SelObj &sel, Base::Type type,
             ResolveMode resolve, const char **subelement=nullptr);
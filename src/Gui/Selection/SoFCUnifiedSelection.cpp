@@ -396,45 +396,8 @@ void SoFCUnifiedSelection::doAction(SoAction *action)
             // selection changes inside the 3d view are handled in handleEvent()
             App::Document* doc = App::GetApplication().getDocument(selectionAction->SelChange.pDocName);
             App::DocumentObject* obj = doc->getObject(selectionAction->SelChange.pObjectName);
-            ViewProvider*vp = Application::Instance->getViewProvider(obj);
-            if (vp && (useNewSelection.getValue()||vp->useNewSelectionModel()) && vp->isSelectable()) {
-                SoDetail *detail = nullptr;
-                detailPath->truncate(0);
-                auto subName = selectionAction->SelChange.pSubName;
-                App::ElementNamePair elementName;;
-                App::GeoFeature::resolveElement(obj, subName, elementName);
-                if (Data::isMappedElement(subName)
-                    && !elementName.oldName.empty()) {      // If we have a shortened element name
-                    subName = elementName.oldName.c_str();  // use it.
-                }
-                if(!selectionAction->SelChange.pSubName || !selectionAction->SelChange.pSubName[0] ||
-                    vp->getDetailPath(subName,detailPath,true,detail))
-                {
-                    SoSelectionElementAction::Type type = SoSelectionElementAction::None;
-                    if (selectionAction->SelChange.Type == SelectionChanges::AddSelection) {
-                        if (detail)
-                            type = SoSelectionElementAction::Append;
-                        else
-                            type = SoSelectionElementAction::All;
-                    }
-                    else {
-                        if (detail)
-                            type = SoSelectionElementAction::Remove;
-                        else
-                            type = SoSelectionElementAction::None;
-                    }
-
-                    SoSelectionElementAction selectionAction(type);
-                    selectionAction.setColor(this->colorSelection.getValue());
-                    selectionAction.setElement(detail);
-                    if(detailPath->getLength())
-                        selectionAction.apply(detailPath);
-                    else
-                        selectionAction.apply(vp->getRoot());
-                }
-                detailPath->truncate(0);
-                delete detail;
-            }
+            applySelection(obj, selectionAction->SelChange.pSubName,
+                           selectionAction->SelChange.Type == SelectionChanges::AddSelection);
         }
         else if (selectionAction->SelChange.Type == SelectionChanges::ClrSelection) {
             SoSelectionElementAction selectionAction(SoSelectionElementAction::None);
@@ -450,7 +413,8 @@ void SoFCUnifiedSelection::doAction(SoAction *action)
                 auto vpd = static_cast<ViewProviderDocumentObject*>(vp);
                 if (useNewSelection.getValue() || vpd->useNewSelectionModel()) {
                     SoSelectionElementAction::Type type;
-                    if(Selection().isSelected(vpd->getObject()) && vpd->isSelectable())
+                    if(Selection().isSelected(vpd->getObject(), nullptr, ResolveMode::NoResolve)
+                            && vpd->isSelectable())
                         type = SoSelectionElementAction::All;
                     else
                         type = SoSelectionElementAction::None;
@@ -460,6 +424,12 @@ void SoFCUnifiedSelection::doAction(SoAction *action)
                     selectionAction.apply(vpd->getRoot());
                 }
             }
+            // a batched selection change may carry sub-elements, too
+            auto sels = Selection().getSelection(selectionAction->SelChange.pDocName, ResolveMode::NoResolve);
+            for (const auto& sel : sels) {
+                if (sel.SubName && sel.SubName[0])
+                    applySelection(sel.pObject, sel.SubName, true);
+            }
         }
         else if (selectionAction->SelChange.Type == SelectionChanges::SetPreselectSignal) {
             // selection changes inside the 3d view are handled in handleEvent()
@@ -781,6 +751,49 @@ SoFCUnifiedSelection::handleEvent(SoHandleEventAction * action)
     inherited::handleEvent(action);
 }
 
+void SoFCUnifiedSelection::applySelection(App::DocumentObject *obj, const char *subname, bool add)
+{
+    ViewProvider*vp = Application::Instance->getViewProvider(obj);
+    if (!vp || !(useNewSelection.getValue()||vp->useNewSelectionModel()) || !vp->isSelectable())
+        return;
+
+    SoDetail *detail = nullptr;
+    detailPath->truncate(0);
+    auto subName = subname;
+    App::ElementNamePair elementName;
+    App::GeoFeature::resolveElement(obj, subName, elementName);
+    if (Data::isMappedElement(subName)
+        && !elementName.oldName.empty()) {      // If we have a shortened element name
+        subName = elementName.oldName.c_str();  // use it.
+    }
+    if(!subname || !subname[0] || vp->getDetailPath(subName,detailPath,true,detail))
+    {
+        SoSelectionElementAction::Type type = SoSelectionElementAction::None;
+        if (add) {
+            if (detail)
+                type = SoSelectionElementAction::Append;
+            else
+                type = SoSelectionElementAction::All;
+        }
+        else {
+            if (detail)
+                type = SoSelectionElementAction::Remove;
+            else
+                type = SoSelectionElementAction::None;
+        }
+
+        SoSelectionElementAction selectionAction(type);
+        selectionAction.setColor(this->colorSelection.getValue());
+        selectionAction.setElement(detail);
+        if(detailPath->getLength())
+            selectionAction.apply(detailPath);
+        else
+            selectionAction.apply(vp->getRoot());
+    }
+    detailPath->truncate(0);
+    delete detail;
+}
+
 void SoFCUnifiedSelection::GLRenderBelowPath(SoGLRenderAction * action)
 {
     inherited::GLRenderBelowPath(action);
@@ -41,6 +41,9 @@ class SoFullPath;
 class SoPickedPoint;
 class SoDetail;
 
+namespace App {
+class DocumentObject;
+}
 
 namespace Gui {
 
@@ -104,6 +107,7 @@ private:
     bool setPreselect(SoFullPath *path, const SoDetail *det,
             ViewProviderDocumentObject *vpd, const char *element, float x, float y, float z);
     bool setSelection(const std::vector<PickedInfo> &, bool ctrlDown=false);
+    void applySelection(App::DocumentObject *obj, const char *subname, bool add);
 
     std::vector<PickedInfo> getPickedList(SoHandleEventAction* action, bool singlePick) const;
 
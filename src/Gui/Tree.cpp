@@ -4533,7 +4533,7 @@ static unsigned int countExpandedItem(const QTreeWidgetItem* item) {
     return size;
 }
 
-unsigned int DocumentItem::getMemSize() const {
+std::size_t DocumentItem::getMemSize() const {
     return countExpandedItem(this);
 }
 
@@ -329,7 +329,7 @@ public:
 
     bool isObjectShowable(App::DocumentObject *obj);
 
-    unsigned int getMemSize () const override;
+    std::size_t getMemSize () const override;
     void Save (Base::Writer &) const override;
     void Restore(Base::XMLReader &) override;
 
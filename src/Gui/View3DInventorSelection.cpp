@@ -99,6 +99,14 @@ void View3DInventorSelection::checkGroupOnTop(const SelectionChanges &Reason)
         clearGroupOnTop();
         if(Reason.Type == SelectionChanges::ClrSelection)
             return;
+        // a batched selection change carries no object, replay the current selection
+        if(!Reason.pObjectName || !Reason.pObjectName[0]) {
+            for(const auto &sel : Selection().getSelection(Reason.pDocName, ResolveMode::NoResolve)) {
+                checkGroupOnTop(SelectionChanges(SelectionChanges::AddSelection,
+                                                 sel.DocName, sel.FeatName, sel.SubName));
+            }
+            return;
+        }
     }
     if(Reason.Type == SelectionChanges::RmvPreselect ||
        Reason.Type == SelectionChanges::RmvPreselectSignal)
@@ -318,6 +318,28 @@ void ViewProvider::update(const App::Property* prop)
     if (vis) ViewProvider::show();
 }
 
+bool ViewProvider::canUpdateDataBatch() const
+{
+    return false;
+}
+
+void ViewProvider::updateDataBatch(const std::vector<const App::Property*>& props)
+{
+    for (auto prop : props)
+        updateData(prop);
+}
+
+void ViewProvider::updateBatch(const std::vector<const App::Property*>& props)
+{
+    // Hide the object only once for the whole batch
+    if (!isUpdatesEnabled())
+        return;
+    bool vis = ViewProvider::isShow();
+    if (vis) ViewProvider::hide();
+    updateDataBatch(props);
+    if (vis) ViewProvider::show();
+}
+
 QIcon ViewProvider::getIcon() const
 {
     return mergeGreyableOverlayIcons (Gui::BitmapFactory().pixmap(sPixmap));
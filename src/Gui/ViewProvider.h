@@ -401,6 +401,16 @@ public:
      */
     virtual void update(const App::Property*);
     virtual void updateData(const App::Property*);
+    /** Opt in to batched updates
+     * If true, the property changes collected in a change batch of the document
+     * (see App::Document::beginChangeBatch()) are passed in one call of
+     * updateDataBatch() instead of one updateData() call per property.
+     */
+    virtual bool canUpdateDataBatch() const;
+    /// Updates for several changed properties, by default calls updateData() for each one
+    virtual void updateDataBatch(const std::vector<const App::Property*>& props);
+    /// Like update() but for the properties of a change batch
+    virtual void updateBatch(const std::vector<const App::Property*>& props);
     bool isUpdatesEnabled () const;
     void setUpdatesEnabled (bool enable);
 
@@ -384,6 +384,25 @@ void ViewProviderDocumentObject::update(const App::Property* prop)
     }
 }
 
+void ViewProviderDocumentObject::updateBatch(const std::vector<const App::Property*>& props)
+{
+    std::vector<const App::Property*> others;
+    others.reserve(props.size());
+    for (auto prop : props) {
+        if (prop == &getObject()->Visibility)
+            update(prop);
+        else
+            others.push_back(prop);
+    }
+    if (others.empty())
+        return;
+
+    // Disable object visibility syncing
+    Base::ObjectStatusLocker<App::Property::Status,App::Property>
+        guard(App::Property::User1, &Visibility);
+    ViewProvider::updateBatch(others);
+}
+
 Gui::Document* ViewProviderDocumentObject::getDocument() const
 {
     if(!pcObject)
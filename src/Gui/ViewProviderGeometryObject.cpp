@@ -166,20 +166,12 @@ void ViewProviderGeometryObject::attach(App::DocumentObject* pcObj)
 void ViewProviderGeometryObject::updateData(const App::Property* prop)
 {
     if (prop->isDerivedFrom<App::PropertyComplexGeoData>()) {
-        Base::BoundBox3d box =
-            static_cast<const App::PropertyComplexGeoData*>(prop)->getBoundingBox();
-        pcBoundingBox->minBounds.setValue(box.MinX, box.MinY, box.MinZ);
-        pcBoundingBox->maxBounds.setValue(box.MaxX, box.MaxY, box.MaxZ);
+        updateBoundingBox(static_cast<const App::PropertyComplexGeoData*>(prop));
     }
     else if (prop->isDerivedFrom<App::PropertyPlacement>()) {
         auto geometry = getObject<App::GeoFeature>();
         if (geometry && prop == &geometry->Placement) {
-            const App::PropertyComplexGeoData* data = geometry->getPropertyOfGeometry();
-            if (data) {
-                Base::BoundBox3d box = data->getBoundingBox();
-                pcBoundingBox->minBounds.setValue(box.MinX, box.MinY, box.MinZ);
-                pcBoundingBox->maxBounds.setValue(box.MaxX, box.MaxY, box.MaxZ);
-            }
+            updateBoundingBox(geometry->getPropertyOfGeometry());
         }
     }
     else if (std::string(prop->getName()) == "ShapeMaterial") {
@@ -204,6 +196,40 @@ void ViewProviderGeometryObject::updateData(const App::Property* prop)
     ViewProviderDragger::updateData(prop);
 }
 
+bool ViewProviderGeometryObject::canUpdateDataBatch() const
+{
+    return true;
+}
+
+void ViewProviderGeometryObject::updateDataBatch(const std::vector<const App::Property*>& props)
+{
+    // A shape and its placement changed in the same batch would calculate
+    // the (possibly expensive) bounding box twice
+    pendingBoundingBox = nullptr;
+    {
+        Base::FlagToggler<> flag(deferBoundingBox);
+        ViewProviderDragger::updateDataBatch(props);
+    }
+    auto data = pendingBoundingBox;
+    pendingBoundingBox = nullptr;
+    updateBoundingBox(data);
+}
+
+void ViewProviderGeometryObject::updateBoundingBox(const App::PropertyComplexGeoData* data)
+{
+    if (!data) {
+        return;
+    }
+    if (deferBoundingBox) {
+        pendingBoundingBox = data;
+        return;
+    }
+
+    Base::BoundBox3d box = data->getBoundingBox();
+    pcBoundingBox->minBounds.setValue(box.MinX, box.MinY, box.MinZ);
+    pcBoundingBox->maxBounds.setValue(box.MaxX, box.MaxY, box.MaxZ);
+}
+
 SoPickedPointList ViewProviderGeometryObject::getPickedPoints(const SbVec2s& pos,
                                                               const View3DInventorViewer& viewer,
                                                               bool pickAll) const
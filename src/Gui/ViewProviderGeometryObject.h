@@ -34,6 +34,11 @@ class SoSensor;
 class SbVec2s;
 class SoBaseColor;
 
+namespace App
+{
+class PropertyComplexGeoData;
+}
+
 namespace Gui
 {
 
@@ -68,6 +73,9 @@ public:
      */
     void attach(App::DocumentObject* pcObject) override;
     void updateData(const App::Property*) override;
+    /// Takes change batches, the bounding box is calculated once per batch
+    bool canUpdateDataBatch() const override;
+    void updateDataBatch(const std::vector<const App::Property*>& props) override;
 
     bool isSelectable() const override
     {
@@ -111,6 +119,11 @@ protected:
 
 private:
     bool isSelectionEnabled() const;
+    void updateBoundingBox(const App::PropertyComplexGeoData* data);
+
+    // set while a change batch is passed to updateData()
+    bool deferBoundingBox {false};
+    const App::PropertyComplexGeoData* pendingBoundingBox {nullptr};
 
 protected:
     SoMaterial* pcShapeMaterial {nullptr};
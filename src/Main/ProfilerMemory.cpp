@@ -0,0 +1,114 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 The FreeCAD Project Association                     *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+// Global allocation operators that report every heap allocation of the process
+// to the Tracy profiler. Only linked into the executables when the CMake option
+// BUILD_TRACY_MEMORY_PROFILER is set. Over-aligned allocations keep using the
+// default operators and are not tracked.
+
+#ifdef TRACY_ENABLE
+
+#include <cstdlib>
+#include <new>
+
+#include <Base/Profiler.h>
+
+namespace
+{
+
+void* trackedAlloc(std::size_t size)
+{
+    void* ptr = std::malloc(size == 0 ? 1 : size);
+    if (ptr) {
+        TracySecureAlloc(ptr, size);
+    }
+    return ptr;
+}
+
+void trackedFree(void* ptr) noexcept
+{
+    if (ptr) {
+        TracySecureFree(ptr);
+        std::free(ptr);
+    }
+}
+
+}  // namespace
+
+void* operator new(std::size_t size)
+{
+    if (void* ptr = trackedAlloc(size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+    if (void* ptr = trackedAlloc(size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, const std::nothrow_t& /*unused*/) noexcept
+{
+    return trackedAlloc(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t& /*unused*/) noexcept
+{
+    return trackedAlloc(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    trackedFree(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    trackedFree(ptr);
+}
+
+void operator delete(void* ptr, std::size_t /*size*/) noexcept
+{
+    trackedFree(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t /*size*/) noexcept
+{
+    trackedFree(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t& /*unused*/) noexcept
+{
+    trackedFree(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t& /*unused*/) noexcept
+{
+    trackedFree(ptr);
+}
+
+#endif  // TRACY_ENABLE
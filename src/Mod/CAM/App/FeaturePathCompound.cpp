@@ -53,16 +53,14 @@ App::DocumentObjectExecReturn* FeatureCompound::execute()
 
     for (std::vector<DocumentObject*>::const_iterator it = Paths.begin(); it != Paths.end(); ++it) {
         if ((*it)->isDerivedFrom<Path::Feature>()) {
-            const std::vector<Command*>& cmds =
-                static_cast<Path::Feature*>(*it)->Path.getValue().getCommands();
+            const Path::Toolpath& path = static_cast<Path::Feature*>(*it)->Path.getValue();
             const Base::Placement pl = static_cast<Path::Feature*>(*it)->Placement.getValue();
-            for (std::vector<Command*>::const_iterator it2 = cmds.begin(); it2 != cmds.end();
-                 ++it2) {
+            for (unsigned int i = 0; i < path.getSize(); i++) {
                 if (UsePlacements.getValue()) {
-                    result.addCommand((*it2)->transform(pl));
+                    result.addCommand(path.getCommand(i).transform(pl));
                 }
                 else {
-                    result.addCommand(**it2);
+                    result.addCommand(path.getCommand(i));
                 }
             }
         }
@@ -0,0 +1,503 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 The FreeCAD Project Association                     *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+#ifndef _PreComp_
+#include <algorithm>
+#include <bit>
+#include <istream>
+#include <ostream>
+#endif
+
+#include <Base/Exception.h>
+#include <Base/Rotation.h>
+#include <Base/Stream.h>
+
+#include "PackedToolpath.h"
+
+
+using namespace Path;
+
+namespace
+{
+
+// set in the mask of commands that have parameters with names longer than one letter
+constexpr std::uint32_t ExtraBit = 1u << 31;
+constexpr std::uint32_t SlotBits = (1u << PackedToolpath::SlotCount) - 1;
+
+// a leading zero byte never starts a G-code file
+constexpr char Magic[] = {'\0', 'F', 'C', 'T', 'P'};
+constexpr std::uint32_t BinaryVersion = 1;
+
+constexpr int slotX = 'X' - 'A';
+constexpr int slotY = 'Y' - 'A';
+constexpr int slotZ = 'Z' - 'A';
+constexpr int slotA = 0;
+constexpr int slotB = 1;
+constexpr int slotC = 2;
+constexpr int slotI = 'I' - 'A';
+constexpr int slotJ = 'J' - 'A';
+constexpr int slotK = 'K' - 'A';
+
+CommandKind classify(const std::string& name)
+{
+    static const std::unordered_map<std::string, CommandKind> table = {
+        {"G0", CommandKind::Rapid},
+        {"G00", CommandKind::Rapid},
+        {"G1", CommandKind::Feed},
+        {"G01", CommandKind::Feed},
+        {"G2", CommandKind::ArcCW},
+        {"G02", CommandKind::ArcCW},
+        {"G3", CommandKind::ArcCCW},
+        {"G03", CommandKind::ArcCCW},
+        {"G90", CommandKind::Absolute},
+        {"G91", CommandKind::Relative},
+        {"G90.1", CommandKind::AbsoluteCenter},
+        {"G91.1", CommandKind::RelativeCenter},
+        {"G73", CommandKind::Drill},
+        {"G81", CommandKind::Drill},
+        {"G82", CommandKind::Drill},
+        {"G83", CommandKind::Drill},
+        {"G84", CommandKind::Drill},
+        {"G85", CommandKind::Drill},
+        {"G86", CommandKind::Drill},
+        {"G89", CommandKind::Drill},
+        {"G38.2", CommandKind::Probe},
+        {"G38.3", CommandKind::Probe},
+        {"G38.4", CommandKind::Probe},
+        {"G38.5", CommandKind::Probe},
+        {"G17", CommandKind::PlaneXY},
+        {"G18", CommandKind::PlaneXZ},
+        {"G19", CommandKind::PlaneYZ},
+        {"G98", CommandKind::RetractInitial},
+        {"G99", CommandKind::RetractR},
+    };
+    auto it = table.find(name);
+    return it == table.end() ? CommandKind::Other : it->second;
+}
+
+void writeString(Base::OutputStream& str, const std::string& s)
+{
+    str << static_cast<std::uint32_t>(s.size());
+    str.write(s.data(), static_cast<int>(s.size()));
+}
+
+std::string readString(Base::InputStream& str)
+{
+    std::uint32_t len = 0;
+    str >> len;
+    std::string s(len, '\0');
+    str.read(s.data(), static_cast<int>(len));
+    return s;
+}
+
+}  // namespace
+
+int PackedToolpath::slotOf(const std::string& name)
+{
+    return name.size() == 1 ? slotOf(name[0]) : -1;
+}
+
+PackedToolpath::PackedToolpath()
+    : offsets(1, 0)
+{}
+
+void PackedToolpath::clear()
+{
+    names.clear();
+    kinds.clear();
+    nameIndex.clear();
+    opcodes.clear();
+    masks.clear();
+    offsets.assign(1, 0);
+    values.clear();
+    extras.clear();
+}
+
+void PackedToolpath::reserve(std::size_t commands, std::size_t vals)
+{
+    opcodes.reserve(commands);
+    masks.reserve(commands);
+    offsets.reserve(commands + 1);
+    values.reserve(vals);
+}
+
+std::uint32_t PackedToolpath::intern(const std::string& name)
+{
+    auto it = nameIndex.find(name);
+    if (it != nameIndex.end()) {
+        return it->second;
+    }
+    auto id = static_cast<std::uint32_t>(names.size());
+    names.push_back(name);
+    kinds.push_back(classify(name));
+    nameIndex.emplace(name, id);
+    return id;
+}
+
+void PackedToolpath::pack(const Command& cmd,
+                          std::uint32_t& mask,
+                          std::vector<double>& vals,
+                          Extra& extra)
+{
+    // Command::Parameters is sorted, so single letters come out in slot order
+    mask = 0;
+    for (const auto& it : cmd.Parameters) {
+        int slot = slotOf(it.first);
+        if (slot >= 0) {
+            mask |= 1u << slot;
+            vals.push_back(it.second);
+        }
+        else {
+            extra.emplace_back(it.first, it.second);
+        }
+    }
+    if (!extra.empty()) {
+        mask |= ExtraBit;
+    }
+}
+
+void PackedToolpath::append(const Command& cmd)
+{
+    std::uint32_t mask = 0;
+    Extra extra;
+    opcodes.push_back(intern(cmd.Name));
+    pack(cmd, mask, values, extra);
+    masks.push_back(mask);
+    offsets.push_back(static_cast<std::uint32_t>(values.size()));
+    if (!extra.empty()) {
+        extras.emplace(opcodes.size() - 1, std::move(extra));
+    }
+}
+
+void PackedToolpath::append(const PackedToolpath& other)
+{
+    if (&other == this) {
+        PackedToolpath copy(other);
+        append(copy);
+        return;
+    }
+
+    std::vector<std::uint32_t> remap(other.names.size());
+    for (std::size_t i = 0; i < other.names.size(); ++i) {
+        remap[i] = intern(other.names[i]);
+    }
+
+    std::size_t first = size();
+    reserve(first + other.size(), values.size() + other.values.size());
+    auto base = static_cast<std::uint32_t>(values.size());
+    for (std::size_t i = 0; i < other.size(); ++i) {
+        opcodes.push_back(remap[other.opcodes[i]]);
+        masks.push_back(other.masks[i]);
+        offsets.push_back(base + other.offsets[i + 1]);
+    }
+    values.insert(values.end(), other.values.begin(), other.values.end());
+    for (const auto& it : other.extras) {
+        extras.emplace(first + it.first, it.second);
+    }
+}
+
+void PackedToolpath::shiftExtras(std::size_t pos, bool inserted)
+{
+    if (extras.empty()) {
+        return;
+    }
+    std::map<std::size_t, Extra> shifted;
+    for (auto& it : extras) {
+        std::size_t index = it.first;
+        if (index >= pos) {
+            index = inserted ? index + 1 : index - 1;
+        }
+        shifted.emplace(index, std::move(it.second));
+    }
+    extras.swap(shifted);
+}
+
+void PackedToolpath::insert(std::size_t pos, const Command& cmd)
+{
+    if (pos >= size()) {
+        append(cmd);
+        return;
+    }
+
+    std::uint32_t mask = 0;
+    std::vector<double> vals;
+    Extra extra;
+    std::uint32_t op = intern(cmd.Name);
+    pack(cmd, mask, vals, extra);
+
+    std::uint32_t start = offsets[pos];
+    auto count = static_cast<std::uint32_t>(vals.size());
+    values.insert(values.begin() + start, vals.begin(), vals.end());
+    for (std::size_t i = pos + 1; i < offsets.size(); ++i) {
+        offsets[i] += count;
+    }
+    offsets.insert(offsets.begin() + pos + 1, start + count);
+    opcodes.insert(opcodes.begin() + pos, op);
+    masks.insert(masks.begin() + pos, mask);
+
+    shiftExtras(pos, true);
+    if (!extra.empty()) {
+        extras.emplace(pos, std::move(extra));
+    }
+}
+
+void PackedToolpath::erase(std::size_t pos)
+{
+    if (pos >= size()) {
+        throw Base::IndexError("Index not in range");
+    }
+
+    std::uint32_t start = offsets[pos];
+    std::uint32_t count = offsets[pos + 1] - start;
+    values.erase(values.begin() + start, values.begin() + start + count);
+    offsets.erase(offsets.begin() + pos + 1);
+    for (std::size_t i = pos + 1; i < offsets.size(); ++i) {
+        offsets[i] -= count;
+    }
+    opcodes.erase(opcodes.begin() + pos);
+    masks.erase(masks.begin() + pos);
+
+    extras.erase(pos);
+    shiftExtras(pos + 1, false);
+}
+
+Command PackedToolpath::command(std::size_t pos) const
+{
+    Command cmd;
+    cmd.Name = names[opcodes[pos]];
+    std::uint32_t mask = masks[pos];
+    std::uint32_t index = offsets[pos];
+    for (int slot = 0; slot < SlotCount; ++slot) {
+        if (mask & (1u << slot)) {
+            cmd.Parameters.emplace(std::string(1, static_cast<char>('A' + slot)),
+                                   values[index++]);
+        }
+    }
+    if (mask & ExtraBit) {
+        for (const auto& it : extras.at(pos)) {
+            cmd.Parameters.emplace(it.first, it.second);
+        }
+    }
+    return cmd;
+}
+
+double PackedToolpath::value(std::size_t pos, int slot, double fallback) const
+{
+    std::uint32_t mask = masks[pos];
+    std::uint32_t bit = 1u << slot;
+    if (!(mask & bit)) {
+        return fallback;
+    }
+    // the values of the lower slots come first
+    return values[offsets[pos] + std::popcount(mask & (bit - 1))];
+}
+
+Base::Vector3d PackedToolpath::position(std::size_t pos, const Base::Vector3d& last) const
+{
+    return Base::Vector3d(value(pos, slotX, last.x),
+                          value(pos, slotY, last.y),
+                          value(pos, slotZ, last.z));
+}
+
+Base::Vector3d PackedToolpath::center(std::size_t pos) const
+{
+    return Base::Vector3d(value(pos, slotI), value(pos, slotJ), value(pos, slotK));
+}
+
+Base::Placement PackedToolpath::placement(std::size_t pos, const Base::Vector3d& last) const
+{
+    Base::Rotation rot;
+    rot.setYawPitchRoll(value(pos, slotA), value(pos, slotB), value(pos, slotC));
+    return Base::Placement(position(pos, last), rot);
+}
+
+void PackedToolpath::scaleBy(double factor)
+{
+    static const std::uint32_t scaled = (1u << slotX) | (1u << slotY) | (1u << slotZ)
+        | (1u << slotI) | (1u << slotJ) | (1u << ('R' - 'A')) | (1u << ('Q' - 'A'))
+        | (1u << ('F' - 'A'));
+
+    for (std::size_t pos = 0; pos < size(); ++pos) {
+        std::uint32_t mask = masks[pos];
+        std::uint32_t index = offsets[pos];
+        for (int slot = 0; slot < SlotCount; ++slot) {
+            if (mask & (1u << slot)) {
+                if (scaled & (1u << slot)) {
+                    values[index] *= factor;
+                }
+                ++index;
+            }
+        }
+    }
+
+    // Command::scaleBy() only looks at the first letter of a name
+    for (auto& it : extras) {
+        for (auto& param : it.second) {
+            int slot = slotOf(param.first[0]);
+            if (slot >= 0 && (scaled & (1u << slot))) {
+                param.second *= factor;
+            }
+        }
+    }
+}
+
+void PackedToolpath::toGCode(std::ostream& str, std::size_t pos, int precision, bool padzero) const
+{
+    std::uint32_t mask = masks[pos];
+    if (mask & ExtraBit) {
+        // names longer than a letter sort in between the letters, let Command handle it
+        str << command(pos).toGCode(precision, padzero);
+        return;
+    }
+
+    str << names[opcodes[pos]];
+    std::uint32_t index = offsets[pos];
+    for (int slot = 0; slot < SlotCount; ++slot) {
+        if (!(mask & (1u << slot))) {
+            continue;
+        }
+        double val = values[index++];
+        if (slot == 'N' - 'A') {
+            continue;
+        }
+        str << ' ' << static_cast<char>('A' + slot);
+        Command::writeValue(str, val, precision, padzero);
+    }
+}
+
+std::size_t PackedToolpath::getMemSize() const
+{
+    std::size_t memsize = opcodes.capacity() * sizeof(std::uint32_t)
+        + masks.capacity() * sizeof(std::uint32_t) + offsets.capacity() * sizeof(std::uint32_t)
+        + values.capacity() * sizeof(double);
+    for (const auto& it : names) {
+        memsize += sizeof(std::string) + it.capacity() + sizeof(CommandKind);
+    }
+    return memsize;
+}
+
+void PackedToolpath::saveBinary(Base::OutputStream& str) const
+{
+    str.write(Magic, sizeof(Magic));
+    str << BinaryVersion;
+
+    str << static_cast<std::uint32_t>(names.size());
+    for (const auto& it : names) {
+        writeString(str, it);
+    }
+
+    str << static_cast<std::uint64_t>(size());
+    for (std::uint32_t op : opcodes) {
+        str << op;
+    }
+    for (std::uint32_t mask : masks) {
+        str << mask;
+    }
+    str << static_cast<std::uint64_t>(values.size());
+    for (double val : values) {
+        str << val;
+    }
+
+    str << static_cast<std::uint32_t>(extras.size());
+    for (const auto& it : extras) {
+        str << static_cast<std::uint64_t>(it.first);
+        str << static_cast<std::uint32_t>(it.second.size());
+        for (const auto& param : it.second) {
+            writeString(str, param.first);
+            str << param.second;
+        }
+    }
+}
+
+void PackedToolpath::restoreBinary(Base::InputStream& str)
+{
+    clear();
+
+    char magic[sizeof(Magic)];
+    str.read(magic, sizeof(Magic));
+    std::uint32_t version = 0;
+    str >> version;
+    if (!std::equal(magic, magic + sizeof(Magic), Magic) || version > BinaryVersion) {
+        throw Base::BadFormatError("Unsupported binary toolpath");
+    }
+
+    std::uint32_t nameCount = 0;
+    str >> nameCount;
+    for (std::uint32_t i = 0; i < nameCount; ++i) {
+        intern(readString(str));
+    }
+    if (names.size() != nameCount) {
+        throw Base::BadFormatError("Duplicate command name in binary toolpath");
+    }
+
+    std::uint64_t count = 0;
+    str >> count;
+    opcodes.resize(count);
+    masks.resize(count);
+    for (auto& op : opcodes) {
+        str >> op;
+        if (op >= nameCount) {
+            throw Base::BadFormatError("Invalid command name in binary toolpath");
+        }
+    }
+    offsets.reserve(count + 1);
+    for (auto& mask : masks) {
+        str >> mask;
+        offsets.push_back(offsets.back() + std::popcount(mask & SlotBits));
+    }
+
+    std::uint64_t valueCount = 0;
+    str >> valueCount;
+    if (valueCount != offsets.back()) {
+        throw Base::BadFormatError("Value count mismatch in binary toolpath");
+    }
+    values.resize(valueCount);
+    for (double& val : values) {
+        str >> val;
+    }
+
+    std::uint32_t extraCount = 0;
+    str >> extraCount;
+    for (std::uint32_t i = 0; i < extraCount; ++i) {
+        std::uint64_t pos = 0;
+        std::uint32_t paramCount = 0;
+        str >> pos >> paramCount;
+        Extra extra;
+        for (std::uint32_t j = 0; j < paramCount; ++j) {
+            std::string key = readString(str);
+            double val = 0.0;
+            str >> val;
+            extra.emplace_back(std::move(key), val);
+        }
+        if (pos >= count || !(masks[pos] & ExtraBit)) {
+            throw Base::BadFormatError("Invalid parameter in binary toolpath");
+        }
+        extras.emplace(pos, std::move(extra));
+    }
+}
+
+bool PackedToolpath::isBinary(std::istream& str)
+{
+    return str.peek() == Magic[0];
+}
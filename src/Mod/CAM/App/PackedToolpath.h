@@ -0,0 +1,183 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 The FreeCAD Project Association                     *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+
+#ifndef PATH_PACKEDTOOLPATH_H
+#define PATH_PACKEDTOOLPATH_H
+
+#include <cstdint>
+#include <iosfwd>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <Base/Placement.h>
+#include <Base/Vector3D.h>
+
+#include "Command.h"
+
+
+namespace Base
+{
+class InputStream;
+class OutputStream;
+}  // namespace Base
+
+namespace Path
+{
+
+/** What the walkers and emitters need to know about a command name. It is computed once per
+ * interned name, so that per-command dispatch is a switch instead of string compares.
+ */
+enum class CommandKind : std::uint8_t
+{
+    Other,
+    Rapid,           // G0, G00
+    Feed,            // G1, G01
+    ArcCW,           // G2, G02
+    ArcCCW,          // G3, G03
+    Absolute,        // G90
+    Relative,        // G91
+    AbsoluteCenter,  // G90.1
+    RelativeCenter,  // G91.1
+    Drill,           // G73, G81 .. G86, G89
+    Probe,           // G38.2 .. G38.5
+    PlaneXY,         // G17
+    PlaneXZ,         // G18
+    PlaneYZ,         // G19
+    RetractInitial,  // G98
+    RetractR,        // G99
+};
+
+/** Structure-of-arrays storage of a toolpath.
+ *
+ * Command names are interned into a table and each command only keeps the index of its name
+ * (the opcode). Single letter parameters A-Z map to fixed slots; a 32 bit mask per command tells
+ * which slots are set, and the set values are stored in slot order in one contiguous array of
+ * doubles. Parameters with longer names, which can only be created from Python, are kept aside
+ * per command.
+ *
+ * Path::Command stays the interface for building and inspecting single commands; command()
+ * materializes one on demand.
+ */
+class PathExport PackedToolpath
+{
+public:
+    static constexpr int SlotCount = 26;
+
+    /// Returns the slot of a single letter parameter name, or -1 for any other name
+    static int slotOf(const std::string& name);
+    static constexpr int slotOf(char letter)
+    {
+        return (letter >= 'A' && letter <= 'Z') ? letter - 'A' : -1;
+    }
+
+    PackedToolpath();
+
+    void clear();
+    void reserve(std::size_t commands, std::size_t values);
+    std::size_t size() const
+    {
+        return opcodes.size();
+    }
+    bool empty() const
+    {
+        return opcodes.empty();
+    }
+
+    void append(const Command& cmd);
+    void insert(std::size_t pos, const Command& cmd);
+    void erase(std::size_t pos);
+    /// Appends all commands of another toolpath
+    void append(const PackedToolpath& other);
+
+    /// Returns a stand-alone copy of the command at \a pos
+    Command command(std::size_t pos) const;
+
+    /** @name Direct access */
+    //@{
+    std::uint32_t opcode(std::size_t pos) const
+    {
+        return opcodes[pos];
+    }
+    const std::string& name(std::size_t pos) const
+    {
+        return names[opcodes[pos]];
+    }
+    CommandKind kind(std::size_t pos) const
+    {
+        return kinds[opcodes[pos]];
+    }
+    bool has(std::size_t pos, int slot) const
+    {
+        return (masks[pos] & (1u << slot)) != 0;
+    }
+    double value(std::size_t pos, int slot, double fallback = 0.0) const;
+    /// Same as Command::getPlacement(last).getPosition() without building a placement
+    Base::Vector3d position(std::size_t pos, const Base::Vector3d& last) const;
+    Base::Vector3d center(std::size_t pos) const;
+    Base::Placement placement(std::size_t pos, const Base::Vector3d& last) const;
+    //@}
+
+    /// Scales the length and feed parameters of all commands, see Command::scaleBy()
+    void scaleBy(double factor);
+    /// Writes the G-code of the command at \a pos to \a str, see Command::toGCode()
+    void toGCode(std::ostream& str, std::size_t pos, int precision = 6, bool padzero = true) const;
+
+    std::size_t getMemSize() const;
+
+    /** @name Binary format */
+    //@{
+    void saveBinary(Base::OutputStream& str) const;
+    void restoreBinary(Base::InputStream& str);
+    /// Checks without consuming anything whether \a str starts with the binary format
+    static bool isBinary(std::istream& str);
+    //@}
+
+private:
+    using Extra = std::vector<std::pair<std::string, double>>;
+
+    std::uint32_t intern(const std::string& name);
+    void pack(const Command& cmd, std::uint32_t& mask, std::vector<double>& vals, Extra& extra);
+    void shiftExtras(std::size_t pos, bool inserted);
+
+private:
+    // name table
+    std::vector<std::string> names;
+    std::vector<CommandKind> kinds;
+    std::unordered_map<std::string, std::uint32_t> nameIndex;
+
+    // one entry per command
+    std::vector<std::uint32_t> opcodes;
+    std::vector<std::uint32_t> masks;
+    std::vector<std::uint32_t> offsets;  // size() + 1 entries into values
+
+    std::vector<double> values;
+    std::map<std::size_t, Extra> extras;
+};
+
+}  // namespace Path
+
+#endif  // PATH_PACKEDTOOLPATH_H
@@ -21,6 +21,9 @@
  ***************************************************************************/
 
 #include "PreCompiled.h"
+#ifndef _PreComp_
+#include <sstream>
+#endif
 
 #include <App/Application.h>
 #include <Base/Console.h>
@@ -41,16 +44,15 @@ Toolpath::Toolpath()
 {}
 
 Toolpath::Toolpath(const Toolpath& otherPath)
-    : vpcCommands(otherPath.vpcCommands.size())
+    : store(otherPath.store)
     , center(otherPath.center)
 {
-    *this = otherPath;
     recalculate();
 }
 
 Toolpath::~Toolpath()
 {
-    clear();
+    clearCommandCache();
 }
 
 Toolpath& Toolpath::operator=(const Toolpath& otherPath)
@@ -59,32 +61,44 @@ Toolpath& Toolpath::operator=(const Toolpath& otherPath)
         return *this;
     }
 
-    clear();
-    vpcCommands.resize(otherPath.vpcCommands.size());
-    int i = 0;
-    for (std::vector<Command*>::const_iterator it = otherPath.vpcCommands.begin();
-         it != otherPath.vpcCommands.end();
-         ++it, i++) {
-        vpcCommands[i] = new Command(**it);
-    }
+    clearCommandCache();
+    store = otherPath.store;
     center = otherPath.center;
     recalculate();
     return *this;
 }
 
-void Toolpath::clear()
+void Toolpath::clearCommandCache() const
 {
-    for (std::vector<Command*>::iterator it = vpcCommands.begin(); it != vpcCommands.end(); ++it) {
-        delete (*it);
+    for (Command* cmd : vpcCommands) {
+        delete cmd;
     }
     vpcCommands.clear();
+}
+
+const std::vector<Command*>& Toolpath::getCommands() const
+{
+    if (vpcCommands.size() != store.size()) {
+        clearCommandCache();
+        vpcCommands.reserve(store.size());
+        for (std::size_t i = 0; i < store.size(); i++) {
+            vpcCommands.push_back(new Command(store.command(i)));
+        }
+    }
+    return vpcCommands;
+}
+
+void Toolpath::clear()
+{
+    clearCommandCache();
+    store.clear();
     recalculate();
 }
 
 void Toolpath::addCommand(const Command& Cmd)
 {
-    Command* tmp = new Command(Cmd);
-    vpcCommands.push_back(tmp);
+    clearCommandCache();
+    store.append(Cmd);
     recalculate();
 }
 
@@ -93,9 +107,9 @@ void Toolpath::insertCommand(const Command& Cmd, int pos)
     if (pos == -1) {
         addCommand(Cmd);
     }
-    else if (pos <= static_cast<int>(vpcCommands.size())) {
-        Command* tmp = new Command(Cmd);
-        vpcCommands.insert(vpcCommands.begin() + pos, tmp);
+    else if (pos <= static_cast<int>(store.size())) {
+        clearCommandCache();
+        store.insert(pos, Cmd);
     }
     else {
         throw Base::IndexError("Index not in range");
@@ -106,11 +120,12 @@ void Toolpath::insertCommand(const Command& Cmd, int pos)
 void Toolpath::deleteCommand(int pos)
 {
     if (pos == -1) {
-        // delete(*vpcCommands.rbegin()); // causes crash
-        vpcCommands.pop_back();
+        clearCommandCache();
+        store.erase(store.size() - 1);
     }
-    else if (pos <= static_cast<int>(vpcCommands.size())) {
-        vpcCommands.erase(vpcCommands.begin() + pos);
+    else if (pos < static_cast<int>(store.size())) {
+        clearCommandCache();
+        store.erase(pos);
     }
     else {
         throw Base::IndexError("Index not in range");
@@ -120,24 +135,23 @@ void Toolpath::deleteCommand(int pos)
 
 double Toolpath::getLength()
 {
-    if (vpcCommands.empty()) {
+    if (store.empty()) {
         return 0;
     }
     double l = 0;
     Vector3d last(0, 0, 0);
     Vector3d next;
-    for (std::vector<Command*>::const_iterator it = vpcCommands.begin(); it != vpcCommands.end();
-         ++it) {
-        std::string name = (*it)->Name;
-        next = (*it)->getPlacement(last).getPosition();
-        if ((name == "G0") || (name == "G00") || (name == "G1") || (name == "G01")) {
+    for (std::size_t i = 0; i < store.size(); i++) {
+        CommandKind kind = store.kind(i);
+        next = store.position(i, last);
+        if (kind == CommandKind::Rapid || kind == CommandKind::Feed) {
             // straight line
             l += (next - last).Length();
             last = next;
         }
-        else if ((name == "G2") || (name == "G02") || (name == "G3") || (name == "G03")) {
+        else if (kind == CommandKind::ArcCW || kind == CommandKind::ArcCCW) {
             // arc
-            Vector3d center = (*it)->getCenter();
+            Vector3d center = store.center(i);
             double radius = (last - center).Length();
             double angle = (next - center).GetAngle(last - center);
             l += angle * radius;
@@ -167,7 +181,7 @@ double Toolpath::getCycleTime(double hFeed, double vFeed, double hRapid, double
         vRapid = vFeed;
     }
 
-    if (vpcCommands.empty()) {
+    if (store.empty()) {
         return 0;
     }
     double l = 0;
@@ -175,22 +189,21 @@ double Toolpath::getCycleTime(double hFeed, double vFeed, double hRapid, double
     bool verticalMove = false;
     Vector3d last(0, 0, 0);
     Vector3d next;
-    for (std::vector<Command*>::const_iterator it = vpcCommands.begin(); it != vpcCommands.end();
-         ++it) {
-        std::string name = (*it)->Name;
-        float feedrate = (*it)->getParam("F");
+    for (std::size_t i = 0; i < store.size(); i++) {
+        CommandKind kind = store.kind(i);
+        float feedrate;
 
         l = 0;
         verticalMove = false;
         feedrate = hFeed;
-        next = (*it)->getPlacement(last).getPosition();
+        next = store.position(i, last);
 
         if (last.z != next.z) {
             verticalMove = true;
             feedrate = vFeed;
         }
 
-        if ((name == "G0") || (name == "G00")) {
+        if (kind == CommandKind::Rapid) {
             // Rapid Move
             l += (next - last).Length();
             feedrate = hRapid;
@@ -198,13 +211,13 @@ double Toolpath::getCycleTime(double hFeed, double vFeed, double hRapid, double
                 feedrate = vRapid;
             }
         }
-        else if ((name == "G1") || (name == "G01")) {
+        else if (kind == CommandKind::Feed) {
             // Feed Move
             l += (next - last).Length();
         }
-        else if ((name == "G2") || (name == "G02") || (name == "G3") || (name == "G03")) {
+        else if (kind == CommandKind::ArcCW || kind == CommandKind::ArcCCW) {
             // Arc Move
-            Vector3d center = (*it)->getCenter();
+            Vector3d center = store.center(i);
             double radius = (last - center).Length();
             double angle = (next - center).GetAngle(last - center);
             l += angle * radius;
@@ -305,23 +318,20 @@ Base::BoundBox3d Toolpath::getBoundBox() const
 }
 
 static void
-bulkAddCommand(const std::string& gcodestr, std::vector<Command*>& commands, bool& inches)
+bulkAddCommand(const std::string& gcodestr, Command& cmd, PackedToolpath& commands, bool& inches)
 {
-    Command* cmd = new Command();
-    cmd->setFromGCode(gcodestr);
-    if ("G20" == cmd->Name) {
+    cmd.setFromGCode(gcodestr);
+    if ("G20" == cmd.Name) {
         inches = true;
-        delete cmd;
     }
-    else if ("G21" == cmd->Name) {
+    else if ("G21" == cmd.Name) {
         inches = false;
-        delete cmd;
     }
     else {
         if (inches) {
-            cmd->scaleBy(25.4);
+            cmd.scaleBy(25.4);
         }
-        commands.push_back(cmd);
+        commands.append(cmd);
     }
 }
 
@@ -339,13 +349,15 @@ void Toolpath::setFromGCode(const std::string instr)
     std::size_t found = str.find_first_of("(gGmM");
     int last = -1;
     bool inches = false;
+    // reused for every command to avoid reallocating the parameter map
+    Command cmd;
     while (found != std::string::npos) {
         if (str[found] == '(') {
             // start of comment
             if ((last > -1) && (mode == "command")) {
                 // before opening a comment, add the last found command
                 std::string gcodestr = str.substr(last, found - last);
-                bulkAddCommand(gcodestr, vpcCommands, inches);
+                bulkAddCommand(gcodestr, cmd, store, inches);
             }
             mode = "comment";
             last = found;
@@ -354,7 +366,7 @@ void Toolpath::setFromGCode(const std::string instr)
         else if (str[found] == ')') {
             // end of comment
             std::string gcodestr = str.substr(last, found - last + 1);
-            bulkAddCommand(gcodestr, vpcCommands, inches);
+            bulkAddCommand(gcodestr, cmd, store, inches);
             last = -1;
             found = str.find_first_of("(gGmM", found + 1);
             mode = "command";
@@ -363,7 +375,7 @@ void Toolpath::setFromGCode(const std::string instr)
             // command
             if (last > -1) {
                 std::string gcodestr = str.substr(last, found - last);
-                bulkAddCommand(gcodestr, vpcCommands, inches);
+                bulkAddCommand(gcodestr, cmd, store, inches);
             }
             last = found;
             found = str.find_first_of("(gGmM", found + 1);
@@ -373,7 +385,7 @@ void Toolpath::setFromGCode(const std::string instr)
     if (last > -1) {
         if (mode == "command") {
             std::string gcodestr = str.substr(last, std::string::npos);
-            bulkAddCommand(gcodestr, vpcCommands, inches);
+            bulkAddCommand(gcodestr, cmd, store, inches);
         }
     }
     recalculate();
@@ -381,19 +393,18 @@ void Toolpath::setFromGCode(const std::string instr)
 
 std::string Toolpath::toGCode() const
 {
-    std::string result;
-    for (std::vector<Command*>::const_iterator it = vpcCommands.begin(); it != vpcCommands.end();
-         ++it) {
-        result += (*it)->toGCode();
-        result += "\n";
+    std::ostringstream result;
+    for (std::size_t i = 0; i < store.size(); i++) {
+        store.toGCode(result, i);
+        result << "\n";
     }
-    return result;
+    return result.str();
 }
 
 void Toolpath::recalculate()  // recalculates the path cache
 {
 
-    if (vpcCommands.empty()) {
+    if (store.empty()) {
         return;
     }
 
@@ -456,9 +467,9 @@ void Toolpath::recalculate()  // recalculates the path cache
 
 // reimplemented from base class
 
-unsigned int Toolpath::getMemSize() const
+std::size_t Toolpath::getMemSize() const
 {
-    return toGCode().size();
+    return store.getMemSize();
 }
 
 void Toolpath::setCenter(const Base::Vector3d& c)
@@ -467,6 +478,14 @@ void Toolpath::setCenter(const Base::Vector3d& c)
     recalculate();
 }
 
+// Binary toolpath files are opt-in, because older versions can only read G-code
+static bool saveBinary()
+{
+    ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/CAM");
+    return hGrp->GetBool("SaveBinaryToolpath", false);
+}
+
 static void saveCenter(Writer& writer, const Base::Vector3d& center)
 {
     writer.Stream() << writer.ind() << "<Center x=\"" << center.x << "\" y=\"" << center.y
@@ -481,13 +500,13 @@ void Toolpath::Save(Writer& writer) const
         writer.incInd();
         saveCenter(writer, center);
         for (unsigned int i = 0; i < getSize(); i++) {
-            vpcCommands[i]->Save(writer);
+            getCommand(i).Save(writer);
         }
         writer.decInd();
     }
     else {
-        writer.Stream() << writer.ind() << "<Path file=\""
-                        << writer.addFile((writer.ObjectName + ".nc").c_str(), this)
+        std::string file = writer.ObjectName + (saveBinary() ? ".bin" : ".nc");
+        writer.Stream() << writer.ind() << "<Path file=\"" << writer.addFile(file.c_str(), this)
                         << "\" version=\"" << SchemaVersion << "\">" << std::endl;
         writer.incInd();
         saveCenter(writer, center);
@@ -498,10 +517,18 @@ void Toolpath::Save(Writer& writer) const
 
 void Toolpath::SaveDocFile(Base::Writer& writer) const
 {
-    if (toGCode().empty()) {
+    if (store.empty()) {
         return;
     }
-    writer.Stream() << toGCode();
+    if (saveBinary()) {
+        Base::OutputStream str(writer.Stream());
+        store.saveBinary(str);
+        return;
+    }
+    for (std::size_t i = 0; i < store.size(); i++) {
+        store.toGCode(writer.Stream(), i);
+        writer.Stream() << "\n";
+    }
 }
 
 void Toolpath::Restore(XMLReader& reader)
@@ -517,6 +544,14 @@ void Toolpath::Restore(XMLReader& reader)
 
 void Toolpath::RestoreDocFile(Base::Reader& reader)
 {
+    if (PackedToolpath::isBinary(reader)) {
+        clearCommandCache();
+        Base::InputStream str(reader);
+        store.restoreBinary(str);
+        recalculate();
+        return;
+    }
+
     std::string gcode;
     std::string line;
     while (reader >> line) {
@@ -28,6 +28,7 @@
 #include <Base/Vector3D.h>
 
 #include "Command.h"
+#include "PackedToolpath.h"
 
 
 namespace Path
@@ -47,7 +48,7 @@ public:
     Toolpath& operator=(const Toolpath&);
 
     // from base class
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     void Save(Base::Writer& /*writer*/) const override;
     void Restore(Base::XMLReader& /*reader*/) override;
     void SaveDocFile(Base::Writer& writer) const override;
@@ -69,15 +70,17 @@ public:
     // shortcut functions
     unsigned int getSize() const
     {
-        return vpcCommands.size();
+        return static_cast<unsigned int>(store.size());
     }
-    const std::vector<Command*>& getCommands() const
+    // compatibility view, builds a Command object for every command on first use
+    const std::vector<Command*>& getCommands() const;
+    Command getCommand(unsigned int pos) const
     {
-        return vpcCommands;
+        return store.command(pos);
     }
-    const Command& getCommand(unsigned int pos) const
+    const PackedToolpath& getPackedCommands() const
     {
-        return *vpcCommands[pos];
+        return store;
     }
 
     // support for rotation
@@ -90,7 +93,11 @@ public:
     static const int SchemaVersion = 2;
 
 protected:
-    std::vector<Command*> vpcCommands;
+    void clearCommandCache() const;
+
+protected:
+    PackedToolpath store;
+    mutable std::vector<Command*> vpcCommands;
     Base::Vector3d center;
     // KDL::Path_Composite *pcPath;
 
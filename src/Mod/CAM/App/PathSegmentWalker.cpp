@@ -32,6 +32,15 @@
 
 #define ARC_MIN_SEGMENTS 20.0  // minimum # segments to interpolate an arc
 
+constexpr int slotX = Path::PackedToolpath::slotOf('X');
+constexpr int slotY = Path::PackedToolpath::slotOf('Y');
+constexpr int slotZ = Path::PackedToolpath::slotOf('Z');
+constexpr int slotA = Path::PackedToolpath::slotOf('A');
+constexpr int slotB = Path::PackedToolpath::slotOf('B');
+constexpr int slotC = Path::PackedToolpath::slotOf('C');
+constexpr int slotQ = Path::PackedToolpath::slotOf('Q');
+constexpr int slotR = Path::PackedToolpath::slotOf('R');
+
 
 namespace Path
 {
@@ -147,12 +156,12 @@ void PathSegmentWalker::walk(PathSegmentVisitor& cb, const Base::Vector3d& start
 
     cb.setup(last);
 
+    const PackedToolpath& cmds = tp.getPackedCommands();
     for (unsigned int i = 0; i < tp.getSize(); i++) {
         std::deque<Base::Vector3d> points;
 
-        const Path::Command& cmd = tp.getCommand(i);
-        const std::string& name = cmd.Name;
-        Base::Vector3d next = cmd.getPlacement().getPosition();
+        const CommandKind kind = cmds.kind(i);
+        Base::Vector3d next = cmds.position(i, Base::Vector3d());
         double a = A;
         double b = B;
         double c = C;
@@ -160,30 +169,24 @@ void PathSegmentWalker::walk(PathSegmentVisitor& cb, const Base::Vector3d& start
         if (!absolute) {
             next = last + next;
         }
-        if (!cmd.has("X")) {
+        if (!cmds.has(i, slotX)) {
             next.x = last.x;
         }
-        if (!cmd.has("Y")) {
+        if (!cmds.has(i, slotY)) {
             next.y = last.y;
         }
-        if (!cmd.has("Z")) {
+        if (!cmds.has(i, slotZ)) {
             next.z = last.z;
         }
-        if (cmd.has("A")) {
-            a = cmd.getValue("A");
-        }
-        if (cmd.has("B")) {
-            b = cmd.getValue("B");
-        }
-        if (cmd.has("C")) {
-            c = cmd.getValue("C");
-        }
+        a = cmds.value(i, slotA, a);
+        b = cmds.value(i, slotB, b);
+        c = cmds.value(i, slotC, c);
 
         Base::Rotation nrot = yawPitchRoll(a, b, c);
 
         Base::Vector3d rnext = compensateRotation(next, nrot, rotCenter);
 
-        if ((name == "G0") || (name == "G00") || (name == "G1") || (name == "G01")) {
+        if (kind == CommandKind::Rapid || kind == CommandKind::Feed) {
             // straight line
             if (nrot != lrot) {
                 double amax = std::max(fmod(fabs(a - A), 360),
@@ -207,7 +210,7 @@ void PathSegmentWalker::walk(PathSegmentVisitor& cb, const Base::Vector3d& start
                 }
             }
 
-            if ("G0" == name || "G00" == name) {
+            if (kind == CommandKind::Rapid) {
                 cb.g0(i, last, rnext, points);
             }
             else {
@@ -220,12 +223,12 @@ void PathSegmentWalker::walk(PathSegmentVisitor& cb, const Base::Vector3d& start
             C = c;
             lrot = nrot;
         }
-        else if ((name == "G2") || (name == "G02") || (name == "G3") || (name == "G03")) {
+        else if (kind == CommandKind::ArcCW || kind == CommandKind::ArcCCW) {
             // arc
             Base::Vector3d norm;
             Base::Vector3d center;
 
-            if ((name == "G2") || (name == "G02")) {
+            if (kind == CommandKind::ArcCW) {
                 norm.*pz = -1.0;
             }
             else {
@@ -233,10 +236,10 @@ void PathSegmentWalker::walk(PathSegmentVisitor& cb, const Base::Vector3d& start
             }
 
             if (absolutecenter) {
-                center = cmd.getCenter();
+                center = cmds.center(i);
             }
             else {
-                center = (last + cmd.getCenter());
+                center = (last + cmds.center(i));
             }
             Base::Vector3d next0(next);
             next0.*pz = 0.0;
@@ -249,12 +252,12 @@ void PathSegmentWalker::walk(PathSegmentVisitor& cb, const Base::Vector3d& start
             // GetAngle will always return the minor angle. Switch if needed
             Base::Vector3d anorm = (last0 - center0) % (next0 - center0);
             if (anorm.*pz < 0) {
-                if (name == "G3" || name == "G03") {
+                if (kind == CommandKind::ArcCCW) {
                     angle = std::numbers::pi * 2 - angle;
                 }
             }
             else if (anorm.*pz > 0) {
-                if (name == "G2" || name == "G02") {
+                if (kind == CommandKind::ArcCW) {
                     angle = std::numbers::pi * 2 - angle;
                 }
             }
@@ -297,29 +300,25 @@ void PathSegmentWalker::walk(PathSegmentVisitor& cb, const Base::Vector3d& start
             C = c;
             lrot = nrot;
         }
-        else if (name == "G90") {
+        else if (kind == CommandKind::Absolute) {
             // absolute mode
             absolute = true;
         }
-        else if (name == "G91") {
+        else if (kind == CommandKind::Relative) {
             // relative mode
             absolute = false;
         }
-        else if (name == "G90.1") {
+        else if (kind == CommandKind::AbsoluteCenter) {
             // absolute mode
             absolutecenter = true;
         }
-        else if (name == "G91.1") {
+        else if (kind == CommandKind::RelativeCenter) {
             // relative mode
             absolutecenter = false;
         }
-        else if ((name == "G73") || (name == "G81") || (name == "G82") || (name == "G83")
-                 || (name == "G84") || (name == "G85") || (name == "G86") || (name == "G89")) {
+        else if (kind == CommandKind::Drill) {
             // drill,tap,bore
-            double r = 0;
-            if (cmd.has("R")) {
-                r = cmd.getValue("R");
-            }
+            double r = cmds.value(i, slotR);
 
             std::deque<Base::Vector3d> plist;
             std::deque<Base::Vector3d> qlist;
@@ -355,8 +354,8 @@ void PathSegmentWalker::walk(PathSegmentVisitor& cb, const Base::Vector3d& start
             Base::Vector3d p2r = compensateRotation(p2, nrot, rotCenter);
 
             double q;
-            if (cmd.has("Q")) {
-                q = cmd.getValue("Q");
+            if (cmds.has(i, slotQ)) {
+                q = cmds.value(i, slotQ);
                 if (q > 0) {
                     Base::Vector3d temp(next);
                     for (temp.*pz = r; temp.*pz > next.*pz; temp.*pz -= q) {
@@ -389,24 +388,24 @@ void PathSegmentWalker::walk(PathSegmentVisitor& cb, const Base::Vector3d& start
             C = c;
             lrot = nrot;
         }
-        else if ((name == "G38.2") || (name == "G38.3") || (name == "G38.4") || (name == "G38.5")) {
+        else if (kind == CommandKind::Probe) {
             // Straight probe
             cb.g38(i, last, next);
             last = next;
         }
-        else if (name == "G17") {
+        else if (kind == CommandKind::PlaneXY) {
             pz = &Base::Vector3d::z;
         }
-        else if (name == "G18") {
+        else if (kind == CommandKind::PlaneXZ) {
             pz = &Base::Vector3d::y;
         }
-        else if (name == "G19") {
+        else if (kind == CommandKind::PlaneYZ) {
             pz = &Base::Vector3d::x;
         }
-        else if (name == "G98") {
+        else if (kind == CommandKind::RetractInitial) {
             retract_mode = 98;
         }
-        else if (name == "G99") {
+        else if (kind == CommandKind::RetractR) {
             retract_mode = 99;
         }
     }
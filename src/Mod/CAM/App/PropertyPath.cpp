@@ -90,7 +90,7 @@ void PropertyPath::Paste(const App::Property& from)
     hasSetValue();
 }
 
-unsigned int PropertyPath::getMemSize() const
+std::size_t PropertyPath::getMemSize() const
 {
     return _Path.getMemSize();
 }
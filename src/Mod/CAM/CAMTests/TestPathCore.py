@@ -134,3 +134,46 @@ G0 Z0.500000
         path = Path.Path(commands)
 
         self.assertEqual(path.Length, 2)
+
+    def test60(self):
+        """Test Path insert and delete keep the parameters of each command"""
+        p = Path.Path()
+        p.addCommands(Path.Command("G1", {"X": 1, "Y": 2}))
+        p.addCommands(Path.Command("G2", {"X": 3, "I": 1, "J": 0}))
+        p.insertCommand(Path.Command("G0", {"Z": 5, "FOO": 7}), 1)
+        self.assertEqual(
+            str(p.Commands),
+            "[Command G1 [ X:1 Y:2 ], Command G0 [ FOO:7 Z:5 ], Command G2 [ I:1 J:0 X:3 ]]",
+        )
+
+        p.deleteCommand(0)
+        self.assertEqual(str(p.Commands), "[Command G0 [ FOO:7 Z:5 ], Command G2 [ I:1 J:0 X:3 ]]")
+        self.assertEqual(p.Commands[0].Parameters["FOO"], 7)
+
+    def test70(self):
+        """Test Path restores from a binary document file"""
+        import os
+        import tempfile
+
+        hGrp = FreeCAD.ParamGet("User parameter:BaseApp/Preferences/Mod/CAM")
+        binary = hGrp.GetBool("SaveBinaryToolpath", False)
+        hGrp.SetBool("SaveBinaryToolpath", True)
+
+        doc = FreeCAD.newDocument("TestPathBinary")
+        obj = doc.addObject("Path::Feature", "Path")
+        path = Path.Path()
+        path.setFromGCode("G0 Z5\nG1 X1.5 Y-2 F100\nG2 X3 Y0 I1 J0\n(done)\n")
+        path.addCommands(Path.Command("G1", {"X": 4, "FOO": 1}))
+        obj.Path = path
+        gcode = obj.Path.toGCode()
+
+        fileName = os.path.join(tempfile.gettempdir(), "TestPathBinary.FCStd")
+        try:
+            doc.saveAs(fileName)
+            FreeCAD.closeDocument(doc.Name)
+            doc = FreeCAD.openDocument(fileName)
+            self.assertEqual(doc.getObject("Path").Path.toGCode(), gcode)
+        finally:
+            hGrp.SetBool("SaveBinaryToolpath", binary)
+            FreeCAD.closeDocument(doc.Name)
+            os.remove(fileName)
@@ -24,15 +24,15 @@
 
 #ifndef _PreComp_
 #include <Python.h>
+#include <array>
+#include <cstdint>
 #include <cstdlib>
 #include <memory>
 
-#include <BRepBndLib.hxx>
-#include <BRepBuilderAPI_MakeVertex.hxx>
-#include <BRepExtrema_DistShapeShape.hxx>
 #include <BRep_Tool.hxx>
-#include <Bnd_Box.hxx>
+#include <SMDS_MeshCell.hxx>
 #include <SMDS_MeshGroup.hxx>
+#include <SMDS_MeshInfo.hxx>
 #include <SMESHDS_Group.hxx>
 #include <SMESHDS_GroupBase.hxx>
 #include <SMESHDS_Mesh.hxx>
@@ -71,6 +71,7 @@
 #include <Mod/Mesh/App/Core/Iterator.h>
 
 #include "FemMesh.h"
+#include "FemShapeClassifier.h"
 #include <FemMeshPy.h>
 
 #ifdef FC_USE_VTK
@@ -346,7 +347,7 @@ std::set<long> FemMesh::getSurfaceNodes(long /*ElemId*/, short /*FaceId*/, float
 std::list<std::pair<int, int>> FemMesh::getVolumesByFace(const TopoDS_Face& face) const
 {
     std::list<std::pair<int, int>> result;
-    std::set<int> nodes_on_face = getNodesByFace(face);
+    std::vector<int> nodes_on_face = getNodesByFace(face);
 
     // SMDS_MeshVolume::facesIterator() is broken with SMESH7 as it is impossible
     // to iterate volume faces
@@ -414,7 +415,7 @@ std::list<int> FemMesh::getFacesByFace(const TopoDS_Face& face) const
 {
     // TODO: This function is broken with SMESH7 as it is impossible to iterate volume faces
     std::list<int> result;
-    std::set<int> nodes_on_face = getNodesByFace(face);
+    std::vector<int> nodes_on_face = getNodesByFace(face);
 
     SMDS_FaceIteratorPtr face_iter = myMesh->GetMeshDS()->facesIterator();
     while (face_iter->more()) {
@@ -446,7 +447,7 @@ std::list<int> FemMesh::getFacesByFace(const TopoDS_Face& face) const
 std::list<int> FemMesh::getEdgesByEdge(const TopoDS_Edge& edge) const
 {
     std::list<int> result;
-    std::set<int> nodes_on_edge = getNodesByEdge(edge);
+    std::vector<int> nodes_on_edge = getNodesByEdge(edge);
 
     SMDS_EdgeIteratorPtr edge_iter = myMesh->GetMeshDS()->edgesIterator();
     while (edge_iter->more()) {
@@ -481,7 +482,7 @@ std::list<int> FemMesh::getEdgesByEdge(const TopoDS_Edge& edge) const
 std::map<int, int> FemMesh::getccxVolumesByFace(const TopoDS_Face& face) const
 {
     std::map<int, int> result;
-    std::set<int> nodes_on_face = getNodesByFace(face);
+    std::vector<int> nodes_on_face = getNodesByFace(face);
 
     static std::map<int, std::vector<int>> elem_order;
     if (elem_order.empty()) {
@@ -493,7 +494,6 @@ std::map<int, int> FemMesh::getccxVolumesByFace(const TopoDS_Face& face) const
     }
 
     SMDS_VolumeIteratorPtr vol_iter = myMesh->GetMeshDS()->volumesIterator();
-    std::set<int> element_nodes;
     int num_of_nodes;
     while (vol_iter->more()) {
         const SMDS_MeshVolume* vol = vol_iter->next();
@@ -512,13 +512,11 @@ std::map<int, int> FemMesh::getccxVolumesByFace(const TopoDS_Face& face) const
 
         // Get volume nodes on face
         std::vector<int> element_face_nodes;
-        std::set<int> element_nodes;
-        element_nodes.insert(apair.second.begin(), apair.second.end());
-        std::set_intersection(nodes_on_face.begin(),
-                              nodes_on_face.end(),
-                              element_nodes.begin(),
-                              element_nodes.end(),
-                              std::back_insert_iterator<std::vector<int>>(element_face_nodes));
+        for (int vid : apair.second) {
+            if (std::binary_search(nodes_on_face.begin(), nodes_on_face.end(), vid)) {
+                element_face_nodes.push_back(vid);
+            }
+        }
 
         if ((element_face_nodes.size() == 3 && num_of_nodes == 4)
             || (element_face_nodes.size() == 6 && num_of_nodes == 10)) {
@@ -561,200 +559,91 @@ std::map<int, int> FemMesh::getccxVolumesByFace(const TopoDS_Face& face) const
     return result;
 }
 
-std::set<int> FemMesh::getNodesBySolid(const TopoDS_Solid& solid) const
+void FemMesh::getTransformedNodes(std::vector<int>& ids,
+                                  std::vector<Base::Vector3d>& points) const
 {
-    std::set<int> result;
-
-    Bnd_Box box;
-    BRepBndLib::Add(solid, box);
-
-    // limit where the mesh node belongs to the solid
-    TopAbs_ShapeEnum shapetype = TopAbs_SHAPE;
-    ShapeAnalysis_ShapeTolerance analysis;
-    double limit = analysis.Tolerance(solid, 1, shapetype);
-    Base::Console().log("The limit if a node is in or out: %.12lf in scientific: %.4e \n",
-                        limit,
-                        limit);
-
     // get the current transform of the FemMesh
     const Base::Matrix4D Mtrx(getTransform());
 
-    std::vector<const SMDS_MeshNode*> nodes;
-    SMDS_NodeIteratorPtr aNodeIter = myMesh->GetMeshDS()->nodesIterator();
+    const SMESHDS_Mesh* data = myMesh->GetMeshDS();
+    ids.reserve(data->NbNodes());
+    points.reserve(data->NbNodes());
+
+    SMDS_NodeIteratorPtr aNodeIter = data->nodesIterator();
     while (aNodeIter->more()) {
         const SMDS_MeshNode* aNode = aNodeIter->next();
-        nodes.push_back(aNode);
-    }
-
-#pragma omp parallel for schedule(dynamic)
-    for (size_t i = 0; i < nodes.size(); ++i) {
-        const SMDS_MeshNode* aNode = nodes[i];
         double xyz[3];
         aNode->GetXYZ(xyz);
         Base::Vector3d vec(xyz[0], xyz[1], xyz[2]);
         // Apply the matrix to hold the BoundBox in absolute space.
-        vec = Mtrx * vec;
-
-        if (!box.IsOut(gp_Pnt(vec.x, vec.y, vec.z))) {
-            // create a vertex
-            BRepBuilderAPI_MakeVertex aBuilder(gp_Pnt(vec.x, vec.y, vec.z));
-            TopoDS_Shape s = aBuilder.Vertex();
-            // measure distance
-            BRepExtrema_DistShapeShape measure(solid, s);
-            measure.Perform();
-            if (!measure.IsDone() || measure.NbSolution() < 1) {
-                continue;
-            }
-
-            if (measure.Value() < limit)
-#pragma omp critical
-            {
-                result.insert(aNode->GetID());
-            }
-        }
+        ids.push_back(aNode->GetID());
+        points.push_back(Mtrx * vec);
     }
-    return result;
 }
 
-std::set<int> FemMesh::getNodesByFace(const TopoDS_Face& face) const
+std::vector<int> FemMesh::getNodesByShape(const TopoDS_Shape& shape, double tolerance) const
 {
-    std::set<int> result;
-
-    Bnd_Box box;
-    BRepBndLib::Add(
-        face,
-        box,
-        Standard_False);  // https://forum.freecad.org/viewtopic.php?f=18&t=21571&start=70#p221591
-    // limit where the mesh node belongs to the face:
-    double limit = BRep_Tool::Tolerance(face);
-    box.Enlarge(limit);
-
-    // get the current transform of the FemMesh
-    const Base::Matrix4D Mtrx(getTransform());
+    std::vector<int> ids;
+    std::vector<Base::Vector3d> points;
+    getTransformedNodes(ids, points);
 
-    std::vector<const SMDS_MeshNode*> nodes;
-    SMDS_NodeIteratorPtr aNodeIter = myMesh->GetMeshDS()->nodesIterator();
-    while (aNodeIter->more()) {
-        const SMDS_MeshNode* aNode = aNodeIter->next();
-        nodes.push_back(aNode);
+    ShapeClassifier classifier(shape, tolerance);
+    std::vector<int> result;
+    for (std::size_t index : classifier.classify(points)) {
+        result.push_back(ids[index]);
     }
 
-#pragma omp parallel for schedule(dynamic)
-    for (size_t i = 0; i < nodes.size(); ++i) {
-        const SMDS_MeshNode* aNode = nodes[i];
-        double xyz[3];
-        aNode->GetXYZ(xyz);
-        Base::Vector3d vec(xyz[0], xyz[1], xyz[2]);
-        // Apply the matrix to hold the BoundBox in absolute space.
-        vec = Mtrx * vec;
-
-        if (!box.IsOut(gp_Pnt(vec.x, vec.y, vec.z))) {
-            // create a vertex
-            BRepBuilderAPI_MakeVertex aBuilder(gp_Pnt(vec.x, vec.y, vec.z));
-            TopoDS_Shape s = aBuilder.Vertex();
-            // measure distance
-            BRepExtrema_DistShapeShape measure(face, s);
-            measure.Perform();
-            if (!measure.IsDone() || measure.NbSolution() < 1) {
-                continue;
-            }
+    std::sort(result.begin(), result.end());
+    return result;
+}
 
-            if (measure.Value() < limit)
-#pragma omp critical
-            {
-                result.insert(aNode->GetID());
-            }
-        }
-    }
+std::vector<int> FemMesh::getNodesBySolid(const TopoDS_Solid& solid) const
+{
+    // limit where the mesh node belongs to the solid
+    TopAbs_ShapeEnum shapetype = TopAbs_SHAPE;
+    ShapeAnalysis_ShapeTolerance analysis;
+    double limit = analysis.Tolerance(solid, 1, shapetype);
+    Base::Console().log("The limit if a node is in or out: %.12lf in scientific: %.4e \n",
+                        limit,
+                        limit);
 
-    return result;
+    return getNodesByShape(solid, limit);
 }
 
-std::set<int> FemMesh::getNodesByEdge(const TopoDS_Edge& edge) const
+std::vector<int> FemMesh::getNodesByFace(const TopoDS_Face& face) const
 {
-    std::set<int> result;
+    // limit where the mesh node belongs to the face:
+    double limit = BRep_Tool::Tolerance(face);
+    return getNodesByShape(face, limit);
+}
 
-    Bnd_Box box;
-    BRepBndLib::Add(edge, box);
+std::vector<int> FemMesh::getNodesByEdge(const TopoDS_Edge& edge) const
+{
     // limit where the mesh node belongs to the edge:
     double limit = BRep_Tool::Tolerance(edge);
-    box.Enlarge(limit);
-
-    // get the current transform of the FemMesh
-    const Base::Matrix4D Mtrx(getTransform());
-
-    std::vector<const SMDS_MeshNode*> nodes;
-    SMDS_NodeIteratorPtr aNodeIter = myMesh->GetMeshDS()->nodesIterator();
-    while (aNodeIter->more()) {
-        const SMDS_MeshNode* aNode = aNodeIter->next();
-        nodes.push_back(aNode);
-    }
-
-#pragma omp parallel for schedule(dynamic)
-    for (size_t i = 0; i < nodes.size(); ++i) {
-        const SMDS_MeshNode* aNode = nodes[i];
-        double xyz[3];
-        aNode->GetXYZ(xyz);
-        Base::Vector3d vec(xyz[0], xyz[1], xyz[2]);
-        // Apply the matrix to hold the BoundBox in absolute space.
-        vec = Mtrx * vec;
-
-        if (!box.IsOut(gp_Pnt(vec.x, vec.y, vec.z))) {
-            // create a vertex
-            BRepBuilderAPI_MakeVertex aBuilder(gp_Pnt(vec.x, vec.y, vec.z));
-            TopoDS_Shape s = aBuilder.Vertex();
-            // measure distance
-            BRepExtrema_DistShapeShape measure(edge, s);
-            measure.Perform();
-            if (!measure.IsDone() || measure.NbSolution() < 1) {
-                continue;
-            }
-
-            if (measure.Value() < limit)
-#pragma omp critical
-            {
-                result.insert(aNode->GetID());
-            }
-        }
-    }
-
-    return result;
+    return getNodesByShape(edge, limit);
 }
 
-std::set<int> FemMesh::getNodesByVertex(const TopoDS_Vertex& vertex) const
+std::vector<int> FemMesh::getNodesByVertex(const TopoDS_Vertex& vertex) const
 {
-    std::set<int> result;
+    std::vector<int> result;
 
     double limit = BRep_Tool::Tolerance(vertex);
     limit *= limit;  // use square to improve speed
     gp_Pnt pnt = BRep_Tool::Pnt(vertex);
     Base::Vector3d node(pnt.X(), pnt.Y(), pnt.Z());
 
-    // get the current transform of the FemMesh
-    const Base::Matrix4D Mtrx(getTransform());
-
-    std::vector<const SMDS_MeshNode*> nodes;
-    SMDS_NodeIteratorPtr aNodeIter = myMesh->GetMeshDS()->nodesIterator();
-    while (aNodeIter->more()) {
-        const SMDS_MeshNode* aNode = aNodeIter->next();
-        nodes.push_back(aNode);
-    }
+    std::vector<int> ids;
+    std::vector<Base::Vector3d> points;
+    getTransformedNodes(ids, points);
 
-#pragma omp parallel for schedule(dynamic)
-    for (size_t i = 0; i < nodes.size(); ++i) {
-        const SMDS_MeshNode* aNode = nodes[i];
-        double xyz[3];
-        aNode->GetXYZ(xyz);
-        Base::Vector3d vec(xyz[0], xyz[1], xyz[2]);
-        vec = Mtrx * vec;
-
-        if (Base::DistanceP2(node, vec) <= limit)
-#pragma omp critical
-        {
-            result.insert(aNode->GetID());
+    for (std::size_t i = 0; i < points.size(); ++i) {
+        if (Base::DistanceP2(node, points[i]) <= limit) {
+            result.push_back(ids[i]);
         }
     }
 
+    std::sort(result.begin(), result.end());
     return result;
 }
 
@@ -2305,9 +2194,13 @@ void FemMesh::write(const char* FileName) const
 
 // ==== Base class implementer ==============================================================
 
-unsigned int FemMesh::getMemSize() const
+std::size_t FemMesh::getMemSize() const
 {
-    return 0;
+    // Estimated from the node and element counters of SMESH, the connectivity stored in the
+    // VTK grid is not included
+    const SMDS_MeshInfo& info = myMesh->GetMeshDS()->GetMeshInfo();
+    return std::size_t(info.NbNodes()) * (sizeof(SMDS_MeshNode) + 3 * sizeof(double))
+        + std::size_t(info.NbElements()) * sizeof(SMDS_MeshCell);
 }
 
 void FemMesh::Save(Base::Writer& writer) const
@@ -2315,7 +2208,7 @@ void FemMesh::Save(Base::Writer& writer) const
     if (!writer.isForceXML()) {
         // See SaveDocFile(), RestoreDocFile()
         writer.Stream() << writer.ind() << "<FemMesh file=\"";
-        writer.Stream() << writer.addFile("FemMesh.unv", this) << "\"";
+        writer.Stream() << writer.addFile("FemMesh.bin", this) << "\"";
         writer.Stream() << " a11=\"" << _Mtrx[0][0] << "\" a12=\"" << _Mtrx[0][1] << "\" a13=\""
                         << _Mtrx[0][2] << "\" a14=\"" << _Mtrx[0][3] << "\"";
         writer.Stream() << " a21=\"" << _Mtrx[1][0] << "\" a22=\"" << _Mtrx[1][1] << "\" a23=\""
@@ -2372,31 +2265,239 @@ void FemMesh::Restore(Base::XMLReader& reader)
     }
 }
 
-void FemMesh::SaveDocFile(Base::Writer& writer) const
+namespace
 {
-    // create a temporary file and copy the content to the zip stream
-    Base::FileInfo fi(App::Application::getTempFileName().c_str());
+// Leading tag of the binary format. Older documents store the mesh as UNV file
+// which always starts with a "-1" separator line.
+constexpr std::array<char, 8> binaryTag {'F', 'C', 'F', 'E', 'M', 'B', 'I', 'N'};
+constexpr uint32_t binaryVersion = 1;
+
+void writeString(std::ostream& out, Base::OutputStream& str, const std::string& text)
+{
+    str << static_cast<uint32_t>(text.size());
+    out.write(text.data(), static_cast<std::streamsize>(text.size()));
+}
 
-    myMesh->ExportUNV(fi.filePath().c_str());
+std::string readString(std::istream& in, Base::InputStream& str)
+{
+    uint32_t size {};
+    str >> size;
+    std::string text(size, '\0');
+    in.read(text.data(), size);
+    return text;
+}
+}  // namespace
 
-    Base::ifstream file(fi, std::ios::in | std::ios::binary);
-    if (file) {
-        std::streambuf* buf = file.rdbuf();
-        writer.Stream() << buf;
+void FemMesh::writeBinary(std::ostream& out) const
+{
+    Base::OutputStream str(out);
+    str.setByteOrder(Base::Stream::LittleEndian);
+
+    out.write(binaryTag.data(), binaryTag.size());
+    str << binaryVersion;
+
+    // 1. nodes
+    SMESHDS_Mesh* meshDS = myMesh->GetMeshDS();
+    str << static_cast<uint32_t>(meshDS->NbNodes());
+    SMDS_NodeIteratorPtr nodeIt = meshDS->nodesIterator();
+    while (nodeIt->more()) {
+        const SMDS_MeshNode* node = nodeIt->next();
+        str << static_cast<int32_t>(node->GetID()) << node->X() << node->Y() << node->Z();
     }
 
-    file.close();
-    // remove temp file
-    fi.deleteFile();
+    // 2. elements
+    std::vector<const SMDS_MeshElement*> elements;
+    SMDS_ElemIteratorPtr elemIt = meshDS->elementsIterator();
+    while (elemIt->more()) {
+        const SMDS_MeshElement* elem = elemIt->next();
+        if (elem->GetType() != SMDSAbs_Node) {
+            elements.push_back(elem);
+        }
+    }
+
+    str << static_cast<uint32_t>(elements.size());
+    for (const SMDS_MeshElement* elem : elements) {
+        str << static_cast<int32_t>(elem->GetID()) << static_cast<int32_t>(elem->GetType())
+            << static_cast<int32_t>(elem->GetEntityType()) << elem->IsPoly();
+        str << static_cast<int32_t>(elem->NbNodes());
+        SMDS_ElemIteratorPtr nIt = elem->nodesIterator();
+        while (nIt->more()) {
+            str << static_cast<int32_t>(nIt->next()->GetID());
+        }
+
+        if (elem->GetEntityType() == SMDSEntity_Polyhedra) {
+#if SMESH_VERSION_MAJOR >= 9
+            auto quantities = static_cast<const SMDS_MeshVolume*>(elem)->GetQuantities();
+#else
+            auto quantities = static_cast<const SMDS_VtkVolume*>(elem)->GetQuantities();
+#endif
+            str << static_cast<int32_t>(quantities.size());
+            for (auto it : quantities) {
+                str << static_cast<int32_t>(it);
+            }
+        }
+        else if (elem->GetEntityType() == SMDSEntity_Ball) {
+            str << static_cast<double>(static_cast<const SMDS_BallElement*>(elem)->GetDiameter());
+        }
+    }
+
+    // 3. groups
+    std::vector<SMESH_Group*> groups;
+    SMESH_Mesh::GroupIteratorPtr gIt = myMesh->GetGroups();
+    while (gIt->more()) {
+        groups.push_back(gIt->next());
+    }
+
+    str << static_cast<uint32_t>(groups.size());
+    for (SMESH_Group* group : groups) {
+        const SMESHDS_GroupBase* groupDS = group->GetGroupDS();
+        writeString(out, str, group->GetName());
+        str << static_cast<int32_t>(groupDS->GetType());
+        str << static_cast<uint32_t>(groupDS->Extent());
+        SMDS_ElemIteratorPtr eIt = groupDS->GetElements();
+        while (eIt->more()) {
+            str << static_cast<int32_t>(eIt->next()->GetID());
+        }
+    }
+}
+
+void FemMesh::readBinary(std::istream& in)
+{
+    Base::InputStream str(in);
+    str.setByteOrder(Base::Stream::LittleEndian);
+
+    uint32_t version {};
+    str >> version;
+    if (version > binaryVersion) {
+        throw Base::BadFormatError("Unsupported version of FEM mesh data");
+    }
+
+    // 1. nodes
+    SMESHDS_Mesh* meshDS = myMesh->GetMeshDS();
+    uint32_t numNodes {};
+    str >> numNodes;
+    for (uint32_t i = 0; i < numNodes; i++) {
+        int32_t id {};
+        double x {}, y {}, z {};
+        str >> id >> x >> y >> z;
+        if (!str) {
+            throw Base::BadFormatError("Unexpected end of FEM mesh data");
+        }
+        meshDS->AddNodeWithID(x, y, z, id);
+    }
+
+    auto findNode = [meshDS](int32_t id) {
+        const SMDS_MeshNode* node = meshDS->FindNode(id);
+        if (!node) {
+            throw Base::BadFormatError("Invalid node id in FEM mesh data");
+        }
+        return node;
+    };
+
+    // 2. elements
+    SMESH_MeshEditor editor(myMesh);
+    std::vector<const SMDS_MeshNode*> nodes;
+    uint32_t numElements {};
+    str >> numElements;
+    for (uint32_t i = 0; i < numElements; i++) {
+        int32_t id {}, type {}, entity {}, numElemNodes {};
+        bool isPoly {};
+        str >> id >> type >> entity >> isPoly >> numElemNodes;
+        if (!str || numElemNodes < 0) {
+            throw Base::BadFormatError("Unexpected end of FEM mesh data");
+        }
+
+        nodes.resize(numElemNodes);
+        for (auto& it : nodes) {
+            int32_t nodeId {};
+            str >> nodeId;
+            it = findNode(nodeId);
+        }
+
+        switch (entity) {
+            case SMDSEntity_Polyhedra: {
+                int32_t numQuantities {};
+                str >> numQuantities;
+                std::vector<int> quantities(std::max(numQuantities, 0));
+                for (auto& it : quantities) {
+                    int32_t value {};
+                    str >> value;
+                    it = value;
+                }
+                meshDS->AddPolyhedralVolumeWithID(nodes, quantities, id);
+                break;
+            }
+            case SMDSEntity_Ball: {
+                double diameter {};
+                str >> diameter;
+                SMESH_MeshEditor::ElemFeatures elemFeat;
+                elemFeat.Init(diameter);
+                elemFeat.SetID(id);
+                editor.AddElement(nodes, elemFeat);
+                break;
+            }
+            default: {
+                SMESH_MeshEditor::ElemFeatures elemFeat(static_cast<SMDSAbs_ElementType>(type),
+                                                        isPoly);
+                elemFeat.SetID(id);
+                editor.AddElement(nodes, elemFeat);
+                break;
+            }
+        }
+    }
+
+    // 3. groups
+    uint32_t numGroups {};
+    str >> numGroups;
+    for (uint32_t i = 0; i < numGroups; i++) {
+        std::string name = readString(in, str);
+        int32_t type {};
+        uint32_t numIds {};
+        str >> type >> numIds;
+        if (!str) {
+            throw Base::BadFormatError("Unexpected end of FEM mesh data");
+        }
+
+        auto groupType = static_cast<SMDSAbs_ElementType>(type);
+        int aId = -1;
+        SMESH_Group* group = myMesh->AddGroup(groupType, name.c_str(), aId);
+        auto groupDS = dynamic_cast<SMESHDS_Group*>(group->GetGroupDS());
+        for (uint32_t j = 0; j < numIds; j++) {
+            int32_t id {};
+            str >> id;
+            const SMDS_MeshElement* elem = groupType == SMDSAbs_Node
+                ? static_cast<const SMDS_MeshElement*>(meshDS->FindNode(id))
+                : meshDS->FindElement(id);
+            if (groupDS && elem) {
+                groupDS->SMDSGroup().Add(elem);
+            }
+        }
+    }
+
+    meshDS->Modified();
+}
+
+void FemMesh::SaveDocFile(Base::Writer& writer) const
+{
+    writeBinary(writer.Stream());
 }
 
 void FemMesh::RestoreDocFile(Base::Reader& reader)
 {
-    // create a temporary file and copy the content from the zip stream
+    std::array<char, binaryTag.size()> tag {};
+    reader.read(tag.data(), tag.size());
+    if (reader.gcount() == std::streamsize(tag.size()) && tag == binaryTag) {
+        readBinary(reader);
+        return;
+    }
+
+    // Older documents store the mesh as UNV file.
+    // Create a temporary file and copy the content from the zip stream
     Base::FileInfo fi(App::Application::getTempFileName().c_str());
 
     // read in the ASCII file and write back to the file stream
     Base::ofstream file(fi, std::ios::out | std::ios::binary);
+    file.write(tag.data(), reader.gcount());
     if (reader) {
         reader >> file.rdbuf();
     }
@@ -23,6 +23,7 @@
 #ifndef FEM_FEMMESH_H
 #define FEM_FEMMESH_H
 
+#include <iosfwd>
 #include <list>
 #include <memory>
 #include <vector>
@@ -101,7 +102,7 @@ public:
     void compute();
 
     // from base class
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     void Save(Base::Writer& /*writer*/) const override;
     void Restore(Base::XMLReader& /*reader*/) override;
     void SaveDocFile(Base::Writer& writer) const override;
@@ -128,14 +129,14 @@ public:
     //@{
     /// retrieving by region growing
     std::set<long> getSurfaceNodes(long ElemId, short FaceId, float Angle = 360) const;
-    /// retrieving by solid
-    std::set<int> getNodesBySolid(const TopoDS_Solid& solid) const;
-    /// retrieving by face
-    std::set<int> getNodesByFace(const TopoDS_Face& face) const;
-    /// retrieving by edge
-    std::set<int> getNodesByEdge(const TopoDS_Edge& edge) const;
-    /// retrieving by vertex
-    std::set<int> getNodesByVertex(const TopoDS_Vertex& vertex) const;
+    /// retrieving by solid, the IDs are sorted
+    std::vector<int> getNodesBySolid(const TopoDS_Solid& solid) const;
+    /// retrieving by face, the IDs are sorted
+    std::vector<int> getNodesByFace(const TopoDS_Face& face) const;
+    /// retrieving by edge, the IDs are sorted
+    std::vector<int> getNodesByEdge(const TopoDS_Edge& edge) const;
+    /// retrieving by vertex, the IDs are sorted
+    std::vector<int> getNodesByVertex(const TopoDS_Vertex& vertex) const;
     /// retrieving node IDs by element ID
     std::list<int> getElementNodes(int id) const;
     /// retrieving elements IDs by node ID
@@ -219,6 +220,11 @@ private:
     void readNastran95(const std::string& Filename);
     void readZ88(const std::string& Filename);
     void readAbaqus(const std::string& Filename);
+    void writeBinary(std::ostream& out) const;
+    void readBinary(std::istream& in);
+    /// returns the node IDs and their positions with the placement applied
+    void getTransformedNodes(std::vector<int>& ids, std::vector<Base::Vector3d>& points) const;
+    std::vector<int> getNodesByShape(const TopoDS_Shape& shape, double tolerance) const;
 
 private:
     /// positioning matrix
@@ -57,10 +57,23 @@ void PropertyFemMesh::setValuePtr(FemMesh* mesh)
 void PropertyFemMesh::setValue(const FemMesh& sh)
 {
     aboutToSetValue();
-    *_FemMesh = sh;
+    if (_FemMesh.getRefCount() > 1) {
+        _FemMesh = new FemMesh(sh);
+    }
+    else {
+        *_FemMesh = sh;
+    }
     hasSetValue();
 }
 
+void PropertyFemMesh::detachMesh()
+{
+    // Copy() shares the mesh, e.g. with an undo record, so it must not be modified in place
+    if (_FemMesh.getRefCount() > 1) {
+        _FemMesh = new FemMesh(*_FemMesh);
+    }
+}
+
 const FemMesh& PropertyFemMesh::getValue() const
 {
     return *_FemMesh;
@@ -78,6 +91,7 @@ Base::BoundBox3d PropertyFemMesh::getBoundingBox() const
 
 void PropertyFemMesh::setTransform(const Base::Matrix4D& rclTrf)
 {
+    // Note: The placement is kept in sync by the owner, so a shared mesh is not detached here
     _FemMesh->setTransform(rclTrf);
 }
 
@@ -89,6 +103,7 @@ Base::Matrix4D PropertyFemMesh::getTransform() const
 void PropertyFemMesh::transformGeometry(const Base::Matrix4D& rclMat)
 {
     aboutToSetValue();
+    detachMesh();
     _FemMesh->transformGeometry(rclMat);
     hasSetValue();
 }
@@ -131,7 +146,7 @@ void PropertyFemMesh::Paste(const App::Property& from)
     hasSetValue();
 }
 
-unsigned int PropertyFemMesh::getMemSize() const
+std::size_t PropertyFemMesh::getMemSize() const
 {
     return _FemMesh->getMemSize();
 }
@@ -143,6 +158,7 @@ void PropertyFemMesh::Save(Base::Writer& writer) const
 
 void PropertyFemMesh::Restore(Base::XMLReader& reader)
 {
+    detachMesh();
     _FemMesh->Restore(reader);
 }
 
@@ -154,6 +170,7 @@ void PropertyFemMesh::SaveDocFile(Base::Writer& writer) const
 void PropertyFemMesh::RestoreDocFile(Base::Reader& reader)
 {
     aboutToSetValue();
+    detachMesh();
     _FemMesh->RestoreDocFile(reader);
     hasSetValue();
 }
@@ -83,7 +83,7 @@ public:
 
     App::Property* Copy() const override;
     void Paste(const App::Property& from) override;
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     const char* getEditorName() const override
     {
         return "FemGui::PropertyFemMeshItem";
@@ -91,6 +91,9 @@ public:
     //@}
 
 private:
+    /// Takes a private copy of the mesh if it is shared with a copy of this property
+    void detachMesh();
+
     Base::Reference<FemMesh> _FemMesh;
 };
 
@@ -0,0 +1,496 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 The FreeCAD Project Association                     *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+
+#ifndef _PreComp_
+#include <algorithm>
+#include <cmath>
+
+#include <BRepAdaptor_Curve.hxx>
+#include <BRepBndLib.hxx>
+#include <BRepBuilderAPI_Copy.hxx>
+#include <BRepBuilderAPI_MakeVertex.hxx>
+#include <BRepClass3d_SolidClassifier.hxx>
+#include <BRepExtrema_DistShapeShape.hxx>
+#include <BRepMesh_IncrementalMesh.hxx>
+#include <BRep_Tool.hxx>
+#include <Bnd_Box.hxx>
+#include <GCPnts_TangentialDeflection.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Edge.hxx>
+#include <TopoDS_Face.hxx>
+#include <gp_Pnt.hxx>
+#endif
+
+#include <Mod/Part/App/Tools.h>
+
+#include "FemShapeClassifier.h"
+
+
+using namespace Fem;
+
+namespace
+{
+// number of primitives in a leaf of the tree
+constexpr int maxLeafSize = 4;
+// a point closer than this to an edge of a triangle makes a crossing ambiguous
+constexpr double crossingEpsilon = 1e-9;
+
+// Christer Ericson, Real-Time Collision Detection, 5.1.5
+Base::Vector3d closestPointOnTriangle(const Base::Vector3d& p,
+                                      const Base::Vector3d& a,
+                                      const Base::Vector3d& b,
+                                      const Base::Vector3d& c)
+{
+    Base::Vector3d ab = b - a;
+    Base::Vector3d ac = c - a;
+    Base::Vector3d ap = p - a;
+    double d1 = ab * ap;
+    double d2 = ac * ap;
+    if (d1 <= 0.0 && d2 <= 0.0) {
+        return a;
+    }
+
+    Base::Vector3d bp = p - b;
+    double d3 = ab * bp;
+    double d4 = ac * bp;
+    if (d3 >= 0.0 && d4 <= d3) {
+        return b;
+    }
+
+    double vc = d1 * d4 - d3 * d2;
+    if (vc <= 0.0 && d1 >= 0.0 && d3 <= 0.0) {
+        return a + ab * (d1 / (d1 - d3));
+    }
+
+    Base::Vector3d cp = p - c;
+    double d5 = ab * cp;
+    double d6 = ac * cp;
+    if (d6 >= 0.0 && d5 <= d6) {
+        return c;
+    }
+
+    double vb = d5 * d2 - d1 * d6;
+    if (vb <= 0.0 && d2 >= 0.0 && d6 <= 0.0) {
+        return a + ac * (d2 / (d2 - d6));
+    }
+
+    double va = d3 * d6 - d5 * d4;
+    if (va <= 0.0 && (d4 - d3) >= 0.0 && (d5 - d6) >= 0.0) {
+        return b + (c - b) * ((d4 - d3) / ((d4 - d3) + (d5 - d6)));
+    }
+
+    double denom = va + vb + vc;
+    if (denom <= 0.0) {
+        // degenerated triangle
+        return a;
+    }
+    return a + ab * (vb / denom) + ac * (vc / denom);
+}
+
+Base::Vector3d closestPointOnSegment(const Base::Vector3d& p,
+                                     const Base::Vector3d& a,
+                                     const Base::Vector3d& b)
+{
+    Base::Vector3d ab = b - a;
+    double len2 = ab.Sqr();
+    if (len2 <= 0.0) {
+        return a;
+    }
+    double t = std::clamp(((p - a) * ab) / len2, 0.0, 1.0);
+    return a + ab * t;
+}
+
+double distance2ToBox(const Base::Vector3d& p, const Base::BoundBox3d& box)
+{
+    double dx = std::max({box.MinX - p.x, 0.0, p.x - box.MaxX});
+    double dy = std::max({box.MinY - p.y, 0.0, p.y - box.MaxY});
+    double dz = std::max({box.MinZ - p.z, 0.0, p.z - box.MaxZ});
+    return dx * dx + dy * dy + dz * dz;
+}
+
+bool rayHitsBox(const Base::Vector3d& p, const Base::Vector3d& invDir, const Base::BoundBox3d& box)
+{
+    double tx1 = (box.MinX - p.x) * invDir.x;
+    double tx2 = (box.MaxX - p.x) * invDir.x;
+    double ty1 = (box.MinY - p.y) * invDir.y;
+    double ty2 = (box.MaxY - p.y) * invDir.y;
+    double tz1 = (box.MinZ - p.z) * invDir.z;
+    double tz2 = (box.MaxZ - p.z) * invDir.z;
+    double tmin = std::max({std::min(tx1, tx2), std::min(ty1, ty2), std::min(tz1, tz2)});
+    double tmax = std::min({std::max(tx1, tx2), std::max(ty1, ty2), std::max(tz1, tz2)});
+    return tmax >= std::max(tmin, 0.0);
+}
+}  // namespace
+
+ShapeClassifier::ShapeClassifier(const TopoDS_Shape& shape, double tolerance)
+    : shape(shape)
+    , tolerance(tolerance)
+{
+    isSolid = !shape.IsNull() && shape.ShapeType() == TopAbs_SOLID;
+    tessellate();
+    buildTree();
+}
+
+void ShapeClassifier::tessellate()
+{
+    if (shape.IsNull()) {
+        return;
+    }
+
+    Bnd_Box box;
+    BRepBndLib::Add(shape, box, Standard_False);
+    if (box.IsVoid()) {
+        return;
+    }
+
+    box.Enlarge(tolerance);
+    double xMin, yMin, zMin, xMax, yMax, zMax;
+    box.Get(xMin, yMin, zMin, xMax, yMax, zMax);
+    bounds = Base::BoundBox3d(xMin, yMin, zMin, xMax, yMax, zMax);
+    deflection = std::max(bounds.CalcDiagonalLength() * 0.001, tolerance);
+
+    // mesh a copy to not change the triangulation of the passed shape
+    BRepBuilderAPI_Copy copy(shape, Standard_True, Standard_False);
+    TopoDS_Shape mesh = copy.Shape();
+    BRepMesh_IncrementalMesh(mesh, deflection, Standard_False, 0.5, Standard_False);
+
+    for (TopExp_Explorer xp(mesh, TopAbs_FACE); xp.More(); xp.Next()) {
+        std::vector<gp_Pnt> points;
+        std::vector<Poly_Triangle> facets;
+        if (!Part::Tools::getTriangulation(TopoDS::Face(xp.Current()), points, facets)) {
+            incomplete = true;
+            continue;
+        }
+
+        int offset = static_cast<int>(vertices.size());
+        for (const auto& pnt : points) {
+            vertices.emplace_back(pnt.X(), pnt.Y(), pnt.Z());
+        }
+        for (const auto& facet : facets) {
+            int n1 {}, n2 {}, n3 {};
+            facet.Get(n1, n2, n3);
+            triangles.push_back({offset + n1, offset + n2, offset + n3});
+        }
+    }
+
+    if (!triangles.empty() || incomplete) {
+        return;
+    }
+
+    for (TopExp_Explorer xp(shape, TopAbs_EDGE); xp.More(); xp.Next()) {
+        const TopoDS_Edge& edge = TopoDS::Edge(xp.Current());
+        if (BRep_Tool::Degenerated(edge)) {
+            continue;
+        }
+
+        BRepAdaptor_Curve curve(edge);
+        GCPnts_TangentialDeflection discretizer(curve, 0.5, deflection);
+        int numPoints = discretizer.NbPoints();
+        if (numPoints < 2) {
+            incomplete = true;
+            continue;
+        }
+
+        int offset = static_cast<int>(vertices.size());
+        for (int i = 1; i <= numPoints; i++) {
+            gp_Pnt pnt = discretizer.Value(i);
+            vertices.emplace_back(pnt.X(), pnt.Y(), pnt.Z());
+        }
+        for (int i = 1; i < numPoints; i++) {
+            segments.push_back({offset + i - 1, offset + i});
+        }
+    }
+}
+
+void ShapeClassifier::buildTree()
+{
+    int count = static_cast<int>(triangles.size() + segments.size());
+    if (count == 0) {
+        // without a tessellation all points inside the bounding box must be checked exactly
+        incomplete = true;
+        return;
+    }
+
+    std::vector<Base::BoundBox3d> boxes;
+    boxes.reserve(count);
+    primitives.reserve(count);
+    for (int i = 0; i < count; i++) {
+        boxes.push_back(primitiveBox(i));
+        primitives.push_back(i);
+    }
+
+    nodes.reserve(2 * (count / maxLeafSize + 1));
+    nodes.emplace_back();
+    buildNode(0, 0, count, boxes);
+
+    // the exact geometry and its tessellation differ by up to the deflection
+    bounds.Add(nodes.front().box);
+    bounds.Enlarge(tolerance + 2.0 * deflection);
+}
+
+void ShapeClassifier::buildNode(int index,
+                                int first,
+                                int count,
+                                const std::vector<Base::BoundBox3d>& boxes)
+{
+    Base::BoundBox3d box;
+    for (int i = first; i < first + count; i++) {
+        box.Add(boxes[primitives[i]]);
+    }
+    nodes[index].box = box;
+
+    if (count <= maxLeafSize) {
+        nodes[index].first = first;
+        nodes[index].count = count;
+        return;
+    }
+
+    // split at the median of the box centers along the longest axis
+    int axis = 0;
+    if (box.LengthY() > box.LengthX()) {
+        axis = 1;
+    }
+    if (box.LengthZ() > std::max(box.LengthX(), box.LengthY())) {
+        axis = 2;
+    }
+
+    auto center = [&boxes, axis](int prim) {
+        Base::Vector3d c = boxes[prim].GetCenter();
+        return axis == 0 ? c.x : (axis == 1 ? c.y : c.z);
+    };
+
+    int mid = first + count / 2;
+    std::nth_element(primitives.begin() + first,
+                     primitives.begin() + mid,
+                     primitives.begin() + first + count,
+                     [&center](int a, int b) {
+                         return center(a) < center(b);
+                     });
+
+    int child = static_cast<int>(nodes.size());
+    nodes.emplace_back();
+    nodes.emplace_back();
+    nodes[index].first = child;
+    nodes[index].count = 0;
+
+    buildNode(child, first, mid - first, boxes);
+    buildNode(child + 1, mid, first + count - mid, boxes);
+}
+
+Base::BoundBox3d ShapeClassifier::primitiveBox(int index) const
+{
+    Base::BoundBox3d box;
+    int numTriangles = static_cast<int>(triangles.size());
+    if (index < numTriangles) {
+        for (int v : triangles[index]) {
+            box.Add(vertices[v]);
+        }
+    }
+    else {
+        for (int v : segments[index - numTriangles]) {
+            box.Add(vertices[v]);
+        }
+    }
+    return box;
+}
+
+double ShapeClassifier::distance2(const Base::Vector3d& point, int index) const
+{
+    int numTriangles = static_cast<int>(triangles.size());
+    Base::Vector3d closest;
+    if (index < numTriangles) {
+        const auto& tria = triangles[index];
+        closest = closestPointOnTriangle(point,
+                                         vertices[tria[0]],
+                                         vertices[tria[1]],
+                                         vertices[tria[2]]);
+    }
+    else {
+        const auto& segm = segments[index - numTriangles];
+        closest = closestPointOnSegment(point, vertices[segm[0]], vertices[segm[1]]);
+    }
+    return Base::DistanceP2(point, closest);
+}
+
+bool ShapeClassifier::isNear(const Base::Vector3d& point, double radius) const
+{
+    double radius2 = radius * radius;
+    std::vector<int> stack;
+    stack.push_back(0);
+    while (!stack.empty()) {
+        const Node& node = nodes[stack.back()];
+        stack.pop_back();
+        if (distance2ToBox(point, node.box) > radius2) {
+            continue;
+        }
+
+        if (node.count > 0) {
+            for (int i = node.first; i < node.first + node.count; i++) {
+                if (distance2(point, primitives[i]) <= radius2) {
+                    return true;
+                }
+            }
+        }
+        else {
+            stack.push_back(node.first);
+            stack.push_back(node.first + 1);
+        }
+    }
+
+    return false;
+}
+
+int ShapeClassifier::countCrossings(const Base::Vector3d& point) const
+{
+    // an arbitrary direction that isn't parallel to any axis or diagonal
+    static const Base::Vector3d dir = Base::Vector3d(0.3, 0.5, 0.8).Normalize();
+    static const Base::Vector3d invDir(1.0 / dir.x, 1.0 / dir.y, 1.0 / dir.z);
+
+    int crossings = 0;
+    std::vector<int> stack;
+    stack.push_back(0);
+    while (!stack.empty()) {
+        const Node& node = nodes[stack.back()];
+        stack.pop_back();
+        if (!rayHitsBox(point, invDir, node.box)) {
+            continue;
+        }
+
+        if (node.count == 0) {
+            stack.push_back(node.first);
+            stack.push_back(node.first + 1);
+            continue;
+        }
+
+        for (int i = node.first; i < node.first + node.count; i++) {
+            // Möller-Trumbore intersection
+            const auto& tria = triangles[primitives[i]];
+            const Base::Vector3d& v0 = vertices[tria[0]];
+            Base::Vector3d e1 = vertices[tria[1]] - v0;
+            Base::Vector3d e2 = vertices[tria[2]] - v0;
+            Base::Vector3d pvec = dir % e2;
+            double det = e1 * pvec;
+            double area = (e1 % e2).Length();
+            if (area <= 0.0) {
+                // a degenerated triangle cannot be crossed
+                continue;
+            }
+            if (std::fabs(det) <= crossingEpsilon * area) {
+                // the ray is parallel to the triangle
+                return -1;
+            }
+
+            double invDet = 1.0 / det;
+            Base::Vector3d tvec = point - v0;
+            double u = (tvec * pvec) * invDet;
+            if (u < -crossingEpsilon || u > 1.0 + crossingEpsilon) {
+                continue;
+            }
+            Base::Vector3d qvec = tvec % e1;
+            double v = (dir * qvec) * invDet;
+            if (v < -crossingEpsilon || u + v > 1.0 + crossingEpsilon) {
+                continue;
+            }
+            double t = (e2 * qvec) * invDet;
+            if (t <= 0.0) {
+                continue;
+            }
+            // hitting an edge or a vertex may count the crossing twice
+            if (u < crossingEpsilon || v < crossingEpsilon || u + v > 1.0 - crossingEpsilon) {
+                return -1;
+            }
+            crossings++;
+        }
+    }
+
+    return crossings;
+}
+
+bool ShapeClassifier::isOnExact(const Base::Vector3d& point) const
+{
+    // create a vertex
+    BRepBuilderAPI_MakeVertex aBuilder(gp_Pnt(point.x, point.y, point.z));
+    TopoDS_Shape s = aBuilder.Vertex();
+    // measure distance
+    BRepExtrema_DistShapeShape measure(shape, s);
+    measure.Perform();
+    if (!measure.IsDone() || measure.NbSolution() < 1) {
+        return false;
+    }
+
+    return measure.Value() < tolerance;
+}
+
+bool ShapeClassifier::isInsideExact(const Base::Vector3d& point) const
+{
+    BRepClass3d_SolidClassifier classifier(shape, gp_Pnt(point.x, point.y, point.z), tolerance);
+    return classifier.State() == TopAbs_IN || classifier.State() == TopAbs_ON;
+}
+
+bool ShapeClassifier::isOn(const Base::Vector3d& point) const
+{
+    if (!bounds.IsInBox(point)) {
+        return false;
+    }
+
+    if (incomplete) {
+        return isOnExact(point);
+    }
+
+    // the exact geometry and its tessellation differ by up to the deflection
+    if (isNear(point, tolerance + 2.0 * deflection)) {
+        return isOnExact(point);
+    }
+
+    if (!isSolid) {
+        return false;
+    }
+
+    // the point is away from the boundary, so it's either inside or outside
+    int crossings = countCrossings(point);
+    if (crossings < 0) {
+        return isInsideExact(point);
+    }
+    return crossings % 2 == 1;
+}
+
+std::vector<std::size_t> ShapeClassifier::classify(const std::vector<Base::Vector3d>& points) const
+{
+    std::vector<char> inside(points.size(), 0);
+
+#pragma omp parallel for schedule(dynamic, 256)
+    for (size_t i = 0; i < points.size(); ++i) {
+        inside[i] = isOn(points[i]) ? 1 : 0;
+    }
+
+    std::vector<std::size_t> result;
+    for (std::size_t i = 0; i < inside.size(); ++i) {
+        if (inside[i]) {
+            result.push_back(i);
+        }
+    }
+    return result;
+}
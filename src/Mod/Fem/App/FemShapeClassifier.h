@@ -0,0 +1,96 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 The FreeCAD Project Association                     *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+
+#ifndef FEM_SHAPECLASSIFIER_H
+#define FEM_SHAPECLASSIFIER_H
+
+#include <array>
+#include <vector>
+
+#include <TopoDS_Shape.hxx>
+
+#include <Base/BoundBox.h>
+#include <Base/Vector3D.h>
+#include <Mod/Fem/FemGlobal.h>
+
+
+namespace Fem
+{
+
+/**
+ * Checks which points lie on a solid, face or edge, or inside of a solid.
+ * The shape is tessellated once and the triangles (or segments of an edge) are kept in a
+ * bounding volume hierarchy. Points that are farther away from the tessellation than its
+ * deflection are decided with it, only the remaining ones are checked against the exact
+ * geometry.
+ */
+class FemExport ShapeClassifier
+{
+public:
+    /// \a tolerance is the maximum distance of a point that lies on the shape
+    ShapeClassifier(const TopoDS_Shape& shape, double tolerance);
+
+    /// Returns true if \a point lies on the shape or inside of a solid
+    bool isOn(const Base::Vector3d& point) const;
+    /// Returns the sorted indices of all \a points that lie on the shape or inside of a solid
+    std::vector<std::size_t> classify(const std::vector<Base::Vector3d>& points) const;
+
+private:
+    struct Node
+    {
+        Base::BoundBox3d box;
+        // for leaves the range of primitives, otherwise the index of the first child
+        int first {};
+        int count {};
+    };
+
+    void tessellate();
+    void buildTree();
+    void buildNode(int index, int first, int count, const std::vector<Base::BoundBox3d>& boxes);
+    Base::BoundBox3d primitiveBox(int index) const;
+    double distance2(const Base::Vector3d& point, int index) const;
+    bool isNear(const Base::Vector3d& point, double radius) const;
+    int countCrossings(const Base::Vector3d& point) const;
+    bool isOnExact(const Base::Vector3d& point) const;
+    bool isInsideExact(const Base::Vector3d& point) const;
+
+private:
+    TopoDS_Shape shape;
+    double tolerance;
+    double deflection {};
+    bool isSolid {false};
+    // set if parts of the shape couldn't be tessellated
+    bool incomplete {false};
+    Base::BoundBox3d bounds;
+    std::vector<Base::Vector3d> vertices;
+    std::vector<std::array<int, 3>> triangles;
+    std::vector<std::array<int, 2>> segments;
+    std::vector<int> primitives;
+    std::vector<Node> nodes;
+};
+
+}  // namespace Fem
+
+
+#endif  // FEM_SHAPECLASSIFIER_H
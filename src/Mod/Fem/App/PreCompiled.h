@@ -58,8 +58,10 @@
 
 // Salomesh
 #include <SMDSAbs_ElementType.hxx>
+#include <SMDS_MeshCell.hxx>
 #include <SMDS_MeshElement.hxx>
 #include <SMDS_MeshGroup.hxx>
+#include <SMDS_MeshInfo.hxx>
 #include <SMDS_MeshNode.hxx>
 #include <SMDS_PolyhedralVolumeOfNodes.hxx>
 #include <SMESHDS_Group.hxx>
@@ -118,12 +120,15 @@
 #include <BRepBndLib.hxx>
 #include <BRepBuilderAPI_Copy.hxx>
 #include <BRepBuilderAPI_MakeVertex.hxx>
+#include <BRepClass3d_SolidClassifier.hxx>
 #include <BRepClass_FaceClassifier.hxx>
 #include <BRepExtrema_DistShapeShape.hxx>
 #include <BRepGProp.hxx>
 #include <BRepGProp_Face.hxx>
+#include <BRepMesh_IncrementalMesh.hxx>
 #include <BRepTools.hxx>
 #include <GCPnts_AbscissaPoint.hxx>
+#include <GCPnts_TangentialDeflection.hxx>
 #include <GProp_GProps.hxx>
 #include <GeomAPI_IntCS.hxx>
 #include <GeomAPI_ProjectPointOnCurve.hxx>
@@ -140,6 +145,7 @@
 #include <Standard_Real.hxx>
 #include <Standard_Version.hxx>
 #include <TColgp_Array2OfPnt.hxx>
+#include <TopExp_Explorer.hxx>
 #include <TopoDS.hxx>
 #include <TopoDS_Edge.hxx>
 #include <TopoDS_Face.hxx>
@@ -262,7 +262,7 @@ void PropertyPostDataObject::Paste(const App::Property& from)
     hasSetValue();
 }
 
-unsigned int PropertyPostDataObject::getMemSize() const
+std::size_t PropertyPostDataObject::getMemSize() const
 {
     return m_dataObject ? m_dataObject->GetActualMemorySize() : 0;
 }
@@ -74,7 +74,7 @@ public:
 
     App::Property* Copy() const override;
     void Paste(const App::Property& from) override;
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     //@}
 
     /// Get valid paths for this property; used by auto completer
@@ -156,6 +156,108 @@ class TestMeshCommon(unittest.TestCase):
             "Nodes order of quadratic volume element is unexpected",
         )
 
+    # ********************************************************************************************
+    def test_document_save_load(self):
+        tetra10 = Fem.FemMesh()
+        tetra10.addNode(6, 12, 18, 1)
+        tetra10.addNode(0, 0, 18, 2)
+        tetra10.addNode(12, 0, 18, 3)
+        tetra10.addNode(6, 6, 0, 4)
+
+        tetra10.addNode(3, 6, 18, 5)
+        tetra10.addNode(6, 0, 18, 6)
+        tetra10.addNode(9, 6, 18, 7)
+
+        tetra10.addNode(6, 9, 9, 8)
+        tetra10.addNode(3, 3, 9, 9)
+        tetra10.addNode(9, 3, 9, 10)
+        tetra10.addVolume([1, 2, 3, 4, 5, 6, 7, 8, 9, 10], 5)
+        tetra10.addFace([1, 2, 3, 5, 6, 7], 7)
+        grp = tetra10.addGroup("MyVolumeGroup", "Volume")
+        tetra10.addGroupElements(grp, [5])
+
+        obj = self.document.addObject("Fem::FemMeshObject", "Mesh")
+        obj.FemMesh = tetra10
+        fcstd_file = join(
+            testtools.get_fem_test_tmp_dir("mesh_common_document_save"), "mesh_save_load.FCStd"
+        )
+        self.document.saveAs(fcstd_file)
+        FreeCAD.closeDocument(self.document.Name)
+
+        self.document = FreeCAD.openDocument(fcstd_file)
+        newmesh = self.document.getObject("Mesh").FemMesh
+        self.assertEqual(newmesh.Nodes, tetra10.Nodes, "Nodes of restored mesh are unexpected")
+        self.assertEqual(newmesh.Volumes, (5,), "Volumes of restored mesh are unexpected")
+        self.assertEqual(newmesh.Faces, (7,), "Faces of restored mesh are unexpected")
+        self.assertEqual(
+            newmesh.getElementNodes(5),
+            (1, 2, 3, 4, 5, 6, 7, 8, 9, 10),
+            "Nodes order of quadratic volume element is unexpected",
+        )
+        self.assertEqual(newmesh.GroupCount, 1, "Groups of restored mesh are unexpected")
+        grp = newmesh.Groups[0]
+        self.assertEqual(newmesh.getGroupName(grp), "MyVolumeGroup")
+        self.assertEqual(newmesh.getGroupElements(grp), (5,))
+
+    # ********************************************************************************************
+    def test_nodes_by_shape(self):
+        import Part
+
+        box = Part.makeBox(10, 10, 10)
+        coords = [-2.5, 0.0, 2.5, 5.0, 7.5, 10.0, 12.5]
+        mesh = Fem.FemMesh()
+        points = {}
+        node_id = 1
+        for x in coords:
+            for y in coords:
+                for z in coords:
+                    mesh.addNode(x, y, z, node_id)
+                    points[node_id] = (x, y, z)
+                    node_id += 1
+
+        def inside(value):
+            return 0.0 <= value <= 10.0
+
+        expected = [i for i, (x, y, z) in points.items() if inside(x) and inside(y) and inside(z)]
+        self.assertEqual(mesh.getNodesBySolid(box.Solids[0]), expected)
+
+        face = [f for f in box.Faces if abs(f.CenterOfMass.z) < 1e-7][0]
+        expected = [i for i, (x, y, z) in points.items() if inside(x) and inside(y) and z == 0.0]
+        self.assertEqual(mesh.getNodesByFace(face), expected)
+
+        edge = [
+            e
+            for e in box.Edges
+            if abs(e.CenterOfMass.y) < 1e-7 and abs(e.CenterOfMass.z) < 1e-7
+        ][0]
+        expected = [i for i, (x, y, z) in points.items() if inside(x) and y == 0.0 and z == 0.0]
+        self.assertEqual(mesh.getNodesByEdge(edge), expected)
+
+        vertex = Part.Vertex(FreeCAD.Vector(10, 10, 10))
+        expected = [i for i, p in points.items() if p == (10.0, 10.0, 10.0)]
+        self.assertEqual(mesh.getNodesByVertex(vertex), expected)
+
+    # ********************************************************************************************
+    def test_nodes_by_curved_face(self):
+        import math
+        import Part
+
+        cylinder = Part.makeCylinder(5, 10)
+        face = [f for f in cylinder.Faces if f.Surface.TypeId == "Part::GeomCylinder"][0]
+        mesh = Fem.FemMesh()
+        expected = []
+        node_id = 1
+        for i in range(36):
+            angle = math.radians(i * 10)
+            for radius in (4.0, 5.0, 6.0):
+                mesh.addNode(radius * math.cos(angle), radius * math.sin(angle), 5.0, node_id)
+                if radius == 5.0:
+                    expected.append(node_id)
+                node_id += 1
+
+        self.assertEqual(mesh.getNodesByFace(face), expected)
+        self.assertEqual(len(mesh.getNodesBySolid(cylinder.Solids[0])), 72)
+
     # ********************************************************************************************
     def test_writeAbaqus_precision(self):
         # https://forum.freecad.org/viewtopic.php?f=18&t=22759#p176669
@@ -47,6 +47,7 @@
 #include <Base/Stream.h>
 
 #include <Mod/Mesh/App/Core/Algorithm.h>
+#include <Mod/Mesh/App/Core/BVH.h>
 #include <Mod/Mesh/App/Core/Grid.h>
 #include <Mod/Mesh/App/Core/Iterator.h>
 #include <Mod/Mesh/App/Core/MeshKernel.h>
@@ -200,7 +201,8 @@ protected:
         assert((rulX < _ulCtGridsX) && (rulY < _ulCtGridsY) && (rulZ < _ulCtGridsZ));
     }
 
-    void AddFacet(const MeshCore::MeshGeomFacet& rclFacet, unsigned long ulFacetIndex)
+    template<typename Func>
+    void AddFacet(const MeshCore::MeshGeomFacet& rclFacet, Func&& add) const
     {
         unsigned long ulX1;
         unsigned long ulY1;
@@ -223,21 +225,19 @@ protected:
                 for (unsigned long ulY = ulY1; ulY <= ulY2; ulY++) {
                     for (unsigned long ulZ = ulZ1; ulZ <= ulZ2; ulZ++) {
                         if (rclFacet.IntersectBoundingBox(GetBoundBox(ulX, ulY, ulZ))) {
-                            _aulGrid[ulX][ulY][ulZ].insert(ulFacetIndex);
+                            add(ulX, ulY, ulZ);
                         }
                     }
                 }
             }
         }
         else {
-            _aulGrid[ulX1][ulY1][ulZ1].insert(ulFacetIndex);
+            add(ulX1, ulY1, ulZ1);
         }
     }
 
     void InitGrid() override
     {
-        unsigned long i, j;
-
         Base::BoundBox3f clBBMesh = _pclMesh->GetBoundBox().Transformed(_transform);
 
         float fLengthX = clBBMesh.LengthX();
@@ -253,14 +253,7 @@ protected:
         _fGridLenZ = (1.0f + fLengthZ) / float(_ulCtGridsZ);
         _fMinZ = clBBMesh.MinZ - 0.5f;
 
-        _aulGrid.clear();
-        _aulGrid.resize(_ulCtGridsX);
-        for (i = 0; i < _ulCtGridsX; i++) {
-            _aulGrid[i].resize(_ulCtGridsY);
-            for (j = 0; j < _ulCtGridsY; j++) {
-                _aulGrid[i][j].resize(_ulCtGridsZ);
-            }
-        }
+        _aulGrid.resize(_ulCtGridsX, _ulCtGridsY, _ulCtGridsZ);
     }
 
     void RebuildGrid() override
@@ -268,12 +261,16 @@ protected:
         _ulCtElements = _pclMesh->CountFacets();
         InitGrid();
 
-        unsigned long i = 0;
-        MeshCore::MeshFacetIterator clFIter(*_pclMesh);
-        clFIter.Transform(_transform);
-        for (clFIter.Init(); clFIter.More(); clFIter.Next()) {
-            AddFacet(*clFIter, i++);
-        }
+        _aulGrid.build(
+            _ulCtElements,
+            [this](MeshCore::ElementIndex ulFacetIndex, auto&& add) {
+                MeshCore::MeshGeomFacet facet = _pclMesh->GetFacet(ulFacetIndex);
+                for (auto& pnt : facet._aclPoints) {
+                    pnt = _transform * pnt;
+                }
+                AddFacet(facet, add);
+            },
+            GetBuildThreads());
     }
 
 private:
@@ -288,30 +285,15 @@ InspectNominalMesh::InspectNominalMesh(const Mesh::MeshObject& rMesh, float offs
     _clTrf = rMesh.getTransform();
     _bApply = _clTrf != tmp;
 
-    // Max. limit of grid elements
-    float fMaxGridElements = 8000000.0f;
-    Base::BoundBox3f box = _mesh.GetBoundBox().Transformed(rMesh.getTransform());
-
-    // estimate the minimum allowed grid length
-    float fMinGridLen =
-        (float)pow((box.LengthX() * box.LengthY() * box.LengthZ() / fMaxGridElements), 0.3333f);
-    float fGridLen = 5.0f * MeshCore::MeshAlgorithm(_mesh).GetAverageEdgeLength();
-
-    // We want to avoid to get too small grid elements otherwise building up the grid structure
-    // would take too much time and memory. Having quite a dense grid speeds up more the following
-    // algorithms extremely. Due to the issue above it's always a compromise between speed and
-    // memory usage.
-    fGridLen = std::max<float>(fMinGridLen, fGridLen);
-
-    // build up grid structure to speed up algorithms
-    _pGrid = new MeshInspectGrid(_mesh, fGridLen, rMesh.getTransform());
-    _box = box;
+    // Unlike a uniform grid the hierarchy doesn't degrade if the density of the facets varies
+    _pBVH = new MeshCore::MeshFacetBVH(_mesh, _clTrf);
+    _box = _mesh.GetBoundBox().Transformed(_clTrf);
     _box.Enlarge(offset);
 }
 
 InspectNominalMesh::~InspectNominalMesh()
 {
-    delete this->_pGrid;
+    delete this->_pBVH;
 }
 
 float InspectNominalMesh::getDistance(const Base::Vector3f& point) const
@@ -320,29 +302,18 @@ float InspectNominalMesh::getDistance(const Base::Vector3f& point) const
         return std::numeric_limits<float>::max();  // must be inside bbox
     }
 
-    std::vector<unsigned long> indices;
-    //_pGrid->GetElements(point, indices);
-    if (indices.empty()) {
-        std::set<unsigned long> inds;
-        _pGrid->MeshGrid::SearchNearestFromPoint(point, inds);
-        indices.insert(indices.begin(), inds.begin(), inds.end());
-    }
-
+    MeshCore::FacetIndex index {};
     float fMinDist = std::numeric_limits<float>::max();
-    bool positive = true;
-    for (unsigned long it : indices) {
-        MeshCore::MeshGeomFacet geomFace = _mesh.GetFacet(it);
-        if (_bApply) {
-            geomFace.Transform(_clTrf);
-        }
+    if (!_pBVH->NearestFacetToPoint(point, fMinDist, index, fMinDist)) {
+        return fMinDist;
+    }
 
-        float fDist = geomFace.DistanceToPoint(point);
-        if (fabs(fDist) < fabs(fMinDist)) {
-            fMinDist = fDist;
-            positive = point.DistanceToPlane(geomFace._aclPoints[0], geomFace.GetNormal()) > 0;
-        }
+    MeshCore::MeshGeomFacet geomFace = _mesh.GetFacet(index);
+    if (_bApply) {
+        geomFace.Transform(_clTrf);
     }
 
+    bool positive = point.DistanceToPlane(geomFace._aclPoints[0], geomFace.GetNormal()) > 0;
     if (!positive) {
         fMinDist = -fMinDist;
     }
@@ -690,9 +661,9 @@ void PropertyDistanceList::Paste(const App::Property& from)
     hasSetValue();
 }
 
-unsigned int PropertyDistanceList::getMemSize() const
+std::size_t PropertyDistanceList::getMemSize() const
 {
-    return static_cast<unsigned int>(_lValueList.size() * sizeof(float));
+    return _lValueList.size() * sizeof(float);
 }
 
 // ----------------------------------------------------------------
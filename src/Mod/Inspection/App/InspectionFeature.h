@@ -37,6 +37,7 @@ class gp_Pnt;
 namespace MeshCore
 {
 class MeshKernel;
+class MeshFacetBVH;
 class MeshGrid;
 }  // namespace MeshCore
 
@@ -125,7 +126,7 @@ public:
 
 private:
     const MeshCore::MeshKernel& _mesh;
-    MeshCore::MeshGrid* _pGrid;
+    MeshCore::MeshFacetBVH* _pBVH;
     Base::BoundBox3f _box;
     bool _bApply;
     Base::Matrix4D _clTrf;
@@ -228,7 +229,7 @@ public:
 
     Property* Copy() const override;
     void Paste(const Property& from) override;
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
 
 private:
     std::vector<float> _lValueList;
@@ -78,7 +78,7 @@ public:
     Property* Copy() const override;
     void Paste(const Property& from) override;
 
-    unsigned int getMemSize() const override
+    std::size_t getMemSize() const override
     {
         return sizeof(_material);
     }
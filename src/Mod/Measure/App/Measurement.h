@@ -82,7 +82,7 @@ public:
 
     // from base class
     PyObject* getPyObject() override;
-    virtual unsigned int getMemSize() const;
+    virtual std::size_t getMemSize() const;
 
     // Methods for distances (edge length, two points, edge and a point
     double length() const;
@@ -36,6 +36,7 @@
 #include <Base/PyWrapParseTupleAndKeywords.h>
 #include <Base/VectorPy.h>
 #include "Core/Approximation.h"
+#include "Core/Decimation.h"
 #include "Core/Evaluation.h"
 #include "Core/Iterator.h"
 #include "Core/MeshIO.h"
@@ -112,6 +113,14 @@ public:
             "volume oriented box containing all points. The return value is a\n"
             "tuple of seven items:\n"
             "    center, u, v, w directions and the lengths of the three vectors.\n");
+        add_varargs_method(
+            "decimateFile",
+            &Module::decimateFile,
+            "decimateFile(input, output, tolerance, reduction) or\n"
+            "decimateFile(input, output, targetSize)\n"
+            "Decimates a binary STL file and writes the result to a binary STL file.\n"
+            "The mesh is processed in chunks and never loaded as a whole, so the\n"
+            "file may be bigger than the available memory.\n");
         initialize("The functions in this module allow working with mesh objects.\n"
                    "A set of functions are provided for reading in registered mesh\n"
                    "file formats to either a new or existing document.\n"
@@ -564,6 +573,50 @@ private:
 
         return dict;  // NOLINT
     }
+    Py::Object decimateFile(const Py::Tuple& args)
+    {
+        char* inName {};
+        char* outName {};
+        float tolerance {};
+        float reduction {};
+        int targetSize {};
+        bool useTarget = false;
+        if (!PyArg_ParseTuple(args.ptr(),
+                              "etetff",
+                              "utf-8",
+                              &inName,
+                              "utf-8",
+                              &outName,
+                              &tolerance,
+                              &reduction)) {
+            PyErr_Clear();
+            if (!PyArg_ParseTuple(args.ptr(),
+                                  "eteti",
+                                  "utf-8",
+                                  &inName,
+                                  "utf-8",
+                                  &outName,
+                                  &targetSize)) {
+                throw Py::TypeError("decimateFile(input, output, tolerance=float, reduction=float)"
+                                    " or decimateFile(input, output, targetSize=int)");
+            }
+            useTarget = true;
+        }
+
+        std::string input(inName);
+        std::string output(outName);
+        PyMem_Free(inName);
+        PyMem_Free(outName);
+
+        MeshCore::MeshStreamSimplify simplify;
+        bool ok = useTarget
+            ? simplify.simplify(input, output, static_cast<std::size_t>(std::max(targetSize, 0)))
+            : simplify.simplify(input, output, tolerance, reduction);
+        if (!ok) {
+            throw Py::RuntimeError("Failed to decimate " + input);
+        }
+        return Py::None();
+    }
     Py::Object minimumVolumeOrientedBox(const Py::Tuple& args)
     {
         PyObject* input {};
@@ -25,6 +25,7 @@
 #ifndef _PreComp_
 #include <algorithm>
 #include <limits>
+#include <thread>
 #endif
 
 #include <Base/Console.h>
@@ -687,8 +688,8 @@ bool MeshAlgorithm::FillupHole(const std::vector<PointIndex>& boundary,
     PointIndex refPoint0 = *(boundary.begin());
     PointIndex refPoint1 = *(boundary.begin() + 1);
     if (pP2FStructure) {
-        const std::set<FacetIndex>& ring1 = (*pP2FStructure)[refPoint0];
-        const std::set<FacetIndex>& ring2 = (*pP2FStructure)[refPoint1];
+        MeshIndexRange ring1 = (*pP2FStructure)[refPoint0];
+        MeshIndexRange ring2 = (*pP2FStructure)[refPoint1];
         std::vector<FacetIndex> f_int;
         std::set_intersection(ring1.begin(),
                               ring1.end(),
@@ -1831,25 +1832,65 @@ float MeshAlgorithm::CalculateMinimumGridLength(float fLength,
 
 // ----------------------------------------------------
 
-void MeshRefPointToFacets::Rebuild()
+void MeshIndexAdjacency::insert(ElementIndex row, ElementIndex index)
 {
-    _map.clear();
+    Row& r = rows[row];
+    auto first = indices.begin() + static_cast<std::ptrdiff_t>(r.start);
+    auto last = first + r.size;
+    auto pos = std::lower_bound(first, last, index) - first;
+    if (first + pos != last && first[pos] == index) {
+        return;
+    }
 
-    const MeshPointArray& rPoints = _rclMesh.GetPoints();
-    const MeshFacetArray& rFacets = _rclMesh.GetFacets();
-    _map.resize(rPoints.size());
+    if (r.size == r.capacity) {
+        // move the row to the end with some space to grow, its former section stays unused
+        std::size_t start = indices.size();
+        std::uint32_t capacity = std::max<std::uint32_t>(2 * r.capacity, 4);
+        indices.resize(start + capacity);
+        std::copy_n(indices.begin() + static_cast<std::ptrdiff_t>(r.start),
+                    r.size,
+                    indices.begin() + static_cast<std::ptrdiff_t>(start));
+        r.start = start;
+        r.capacity = capacity;
+    }
+
+    first = indices.begin() + static_cast<std::ptrdiff_t>(r.start);
+    std::copy_backward(first + pos, first + r.size, first + r.size + 1);
+    first[pos] = index;
+    r.size++;
+}
 
-    auto pFBegin = rFacets.begin();
-    for (auto pFIter = rFacets.begin(); pFIter != rFacets.end(); ++pFIter) {
-        _map[pFIter->_aulPoints[0]].insert(pFIter - pFBegin);
-        _map[pFIter->_aulPoints[1]].insert(pFIter - pFBegin);
-        _map[pFIter->_aulPoints[2]].insert(pFIter - pFBegin);
+void MeshIndexAdjacency::erase(ElementIndex row, ElementIndex index)
+{
+    Row& r = rows[row];
+    auto first = indices.begin() + static_cast<std::ptrdiff_t>(r.start);
+    auto last = first + r.size;
+    auto it = std::lower_bound(first, last, index);
+    if (it != last && *it == index) {
+        std::copy(it + 1, last, it);
+        r.size--;
     }
 }
 
+// ----------------------------------------------------
+
+void MeshRefPointToFacets::Rebuild()
+{
+    const MeshFacetArray& rFacets = _rclMesh.GetFacets();
+    _map.build(
+        _rclMesh.CountPoints(),
+        rFacets.size(),
+        [&rFacets](FacetIndex index, auto&& add) {
+            for (PointIndex ptIndex : rFacets[index]._aulPoints) {
+                add(ptIndex, index);
+            }
+        },
+        int(std::thread::hardware_concurrency()));
+}
+
 Base::Vector3f MeshRefPointToFacets::GetNormal(PointIndex pos) const
 {
-    const std::set<FacetIndex>& n = _map[pos];
+    MeshIndexRange n = _map[pos];
     Base::Vector3f normal;
     MeshGeomFacet f;
     for (FacetIndex it : n) {
@@ -1871,7 +1912,7 @@ std::set<PointIndex> MeshRefPointToFacets::NeighbourPoints(const std::vector<Poi
     for (int i = 0; i < level; i++) {
         std::set<PointIndex> cur;
         for (PointIndex it : lp) {
-            const std::set<FacetIndex>& ft = (*this)[it];
+            MeshIndexRange ft = (*this)[it];
             for (FacetIndex jt : ft) {
                 for (PointIndex index : f_it[jt]._aulPoints) {
                     if (cp.find(index) == cp.end() && nb.find(index) == nb.end()) {
@@ -1893,7 +1934,7 @@ std::set<PointIndex> MeshRefPointToFacets::NeighbourPoints(const std::vector<Poi
 std::set<PointIndex> MeshRefPointToFacets::NeighbourPoints(PointIndex pos) const
 {
     std::set<PointIndex> p;
-    const std::set<FacetIndex>& vf = _map[pos];
+    MeshIndexRange vf = _map[pos];
     for (FacetIndex it : vf) {
         PointIndex p1 {}, p2 {}, p3 {};
         _rclMesh.GetFacetPoints(it, p1, p2, p3);
@@ -1941,7 +1982,7 @@ void MeshRefPointToFacets::SearchNeighbours(const MeshFacetArray& rFacets,
     visited.insert(index);
     collect.Append(_rclMesh, index);
     for (PointIndex ptIndex : face._aulPoints) {
-        const std::set<FacetIndex>& f = (*this)[ptIndex];
+        MeshIndexRange f = (*this)[ptIndex];
 
         for (FacetIndex j : f) {
             SearchNeighbours(rFacets, j, rclCenter, fMaxDist2, visited, collect);
@@ -1954,7 +1995,7 @@ MeshFacetArray::_TConstIterator MeshRefPointToFacets::GetFacet(FacetIndex index)
     return _rclMesh.GetFacets().begin() + index;
 }
 
-const std::set<FacetIndex>& MeshRefPointToFacets::operator[](PointIndex pos) const
+MeshIndexRange MeshRefPointToFacets::operator[](PointIndex pos) const
 {
     return _map[pos];
 }
@@ -1963,8 +2004,8 @@ std::vector<FacetIndex> MeshRefPointToFacets::GetIndices(PointIndex pos1, PointI
 {
     std::vector<FacetIndex> intersection;
     std::back_insert_iterator<std::vector<FacetIndex>> result(intersection);
-    const std::set<FacetIndex>& set1 = _map[pos1];
-    const std::set<FacetIndex>& set2 = _map[pos2];
+    MeshIndexRange set1 = _map[pos1];
+    MeshIndexRange set2 = _map[pos2];
     std::set_intersection(set1.begin(), set1.end(), set2.begin(), set2.end(), result);
     return intersection;
 }
@@ -1975,19 +2016,19 @@ MeshRefPointToFacets::GetIndices(PointIndex pos1, PointIndex pos2, PointIndex po
     std::vector<FacetIndex> intersection;
     std::back_insert_iterator<std::vector<FacetIndex>> result(intersection);
     std::vector<FacetIndex> set1 = GetIndices(pos1, pos2);
-    const std::set<FacetIndex>& set2 = _map[pos3];
+    MeshIndexRange set2 = _map[pos3];
     std::set_intersection(set1.begin(), set1.end(), set2.begin(), set2.end(), result);
     return intersection;
 }
 
 void MeshRefPointToFacets::AddNeighbour(PointIndex pos, FacetIndex facet)
 {
-    _map[pos].insert(facet);
+    _map.insert(pos, facet);
 }
 
 void MeshRefPointToFacets::RemoveNeighbour(PointIndex pos, FacetIndex facet)
 {
-    _map[pos].erase(facet);
+    _map.erase(pos, facet);
 }
 
 void MeshRefPointToFacets::RemoveFacet(FacetIndex facetIndex)
@@ -1995,9 +2036,9 @@ void MeshRefPointToFacets::RemoveFacet(FacetIndex facetIndex)
     PointIndex p0 {}, p1 {}, p2 {};
     _rclMesh.GetFacetPoints(facetIndex, p0, p1, p2);
 
-    _map[p0].erase(facetIndex);
-    _map[p1].erase(facetIndex);
-    _map[p2].erase(facetIndex);
+    _map.erase(p0, facetIndex);
+    _map.erase(p1, facetIndex);
+    _map.erase(p2, facetIndex);
 }
 
 //----------------------------------------------------------------------------
@@ -2006,22 +2047,23 @@ void MeshRefFacetToFacets::Rebuild()
 {
     _map.clear();
 
-    const MeshFacetArray& rFacets = _rclMesh.GetFacets();
-    _map.resize(rFacets.size());
-
+    // all facets around a point are neighbours of each other
     MeshRefPointToFacets vertexFace(_rclMesh);
-    auto pFBegin = rFacets.begin();
-    for (auto pFIter = pFBegin; pFIter != rFacets.end(); ++pFIter) {
-        for (PointIndex ptIndex : pFIter->_aulPoints) {
-            const std::set<FacetIndex>& faces = vertexFace[ptIndex];
+    _map.build(
+        _rclMesh.CountFacets(),
+        _rclMesh.CountPoints(),
+        [&vertexFace](PointIndex index, auto&& add) {
+            MeshIndexRange faces = vertexFace[index];
             for (FacetIndex face : faces) {
-                _map[pFIter - pFBegin].insert(face);
+                for (FacetIndex other : faces) {
+                    add(face, other);
+                }
             }
-        }
-    }
+        },
+        int(std::thread::hardware_concurrency()));
 }
 
-const std::set<FacetIndex>& MeshRefFacetToFacets::operator[](FacetIndex pos) const
+MeshIndexRange MeshRefFacetToFacets::operator[](FacetIndex pos) const
 {
     return _map[pos];
 }
@@ -2030,8 +2072,8 @@ std::vector<FacetIndex> MeshRefFacetToFacets::GetIndices(FacetIndex pos1, FacetI
 {
     std::vector<FacetIndex> intersection;
     std::back_insert_iterator<std::vector<FacetIndex>> result(intersection);
-    const std::set<FacetIndex>& set1 = _map[pos1];
-    const std::set<FacetIndex>& set2 = _map[pos2];
+    MeshIndexRange set1 = _map[pos1];
+    MeshIndexRange set2 = _map[pos2];
     std::set_intersection(set1.begin(), set1.end(), set2.begin(), set2.end(), result);
     return intersection;
 }
@@ -2040,24 +2082,23 @@ std::vector<FacetIndex> MeshRefFacetToFacets::GetIndices(FacetIndex pos1, FacetI
 
 void MeshRefPointToPoints::Rebuild()
 {
-    _map.clear();
-
-    const MeshPointArray& rPoints = _rclMesh.GetPoints();
-    _map.resize(rPoints.size());
-
     const MeshFacetArray& rFacets = _rclMesh.GetFacets();
-    for (const auto& rFacet : rFacets) {
-        PointIndex ulP0 = rFacet._aulPoints[0];
-        PointIndex ulP1 = rFacet._aulPoints[1];
-        PointIndex ulP2 = rFacet._aulPoints[2];
-
-        _map[ulP0].insert(ulP1);
-        _map[ulP0].insert(ulP2);
-        _map[ulP1].insert(ulP0);
-        _map[ulP1].insert(ulP2);
-        _map[ulP2].insert(ulP0);
-        _map[ulP2].insert(ulP1);
-    }
+    _map.build(
+        _rclMesh.CountPoints(),
+        rFacets.size(),
+        [&rFacets](FacetIndex index, auto&& add) {
+            PointIndex ulP0 = rFacets[index]._aulPoints[0];
+            PointIndex ulP1 = rFacets[index]._aulPoints[1];
+            PointIndex ulP2 = rFacets[index]._aulPoints[2];
+
+            add(ulP0, ulP1);
+            add(ulP0, ulP2);
+            add(ulP1, ulP0);
+            add(ulP1, ulP2);
+            add(ulP2, ulP0);
+            add(ulP2, ulP1);
+        },
+        int(std::thread::hardware_concurrency()));
 }
 
 Base::Vector3f MeshRefPointToPoints::GetNormal(PointIndex pos) const
@@ -2066,7 +2107,7 @@ Base::Vector3f MeshRefPointToPoints::GetNormal(PointIndex pos) const
     MeshCore::PlaneFit pf;
     pf.AddPoint(rPoints[pos]);
     MeshCore::MeshPoint center = rPoints[pos];
-    const std::set<PointIndex>& cv = _map[pos];
+    MeshIndexRange cv = _map[pos];
     for (PointIndex cv_it : cv) {
         pf.AddPoint(rPoints[cv_it]);
         center += rPoints[cv_it];
@@ -2083,7 +2124,7 @@ float MeshRefPointToPoints::GetAverageEdgeLength(PointIndex index) const
 {
     const MeshPointArray& rPoints = _rclMesh.GetPoints();
     float len = 0.0F;
-    const std::set<PointIndex>& n = (*this)[index];
+    MeshIndexRange n = (*this)[index];
     const Base::Vector3f& p = rPoints[index];
     for (PointIndex it : n) {
         len += Base::Distance(p, rPoints[it]);
@@ -2091,49 +2132,91 @@ float MeshRefPointToPoints::GetAverageEdgeLength(PointIndex index) const
     return (len / n.size());
 }
 
-const std::set<PointIndex>& MeshRefPointToPoints::operator[](PointIndex pos) const
+MeshIndexRange MeshRefPointToPoints::operator[](PointIndex pos) const
 {
     return _map[pos];
 }
 
 void MeshRefPointToPoints::AddNeighbour(PointIndex pos, PointIndex facet)
 {
-    _map[pos].insert(facet);
+    _map.insert(pos, facet);
 }
 
 void MeshRefPointToPoints::RemoveNeighbour(PointIndex pos, PointIndex facet)
 {
-    _map[pos].erase(facet);
+    _map.erase(pos, facet);
 }
 
 //----------------------------------------------------------------------------
 
 void MeshRefEdgeToFacets::Rebuild()
 {
-    _map.clear();
-
     const MeshFacetArray& rFacets = _rclMesh.GetFacets();
+    const std::size_t numPoints = _rclMesh.CountPoints();
+
+    // group the directed edges by their start point, edges of invalid facets are skipped
+    std::vector<std::size_t> offsets(numPoints + 1, 0);
+    for (const auto& rFacet : rFacets) {
+        for (PointIndex ptIndex : rFacet._aulPoints) {
+            if (ptIndex < numPoints) {
+                offsets[ptIndex + 1]++;
+            }
+        }
+    }
+    for (std::size_t i = 0; i < numPoints; i++) {
+        offsets[i + 1] += offsets[i];
+    }
+
+    // as the facets are added in ascending order sorting the pairs keeps them in that order
+    std::vector<std::pair<PointIndex, FacetIndex>> edges(offsets[numPoints]);
+    std::vector<std::size_t> pos(offsets.begin(), offsets.end() - 1);
     FacetIndex index = 0;
     for (auto it = rFacets.begin(); it != rFacets.end(); ++it, ++index) {
         for (int i = 0; i < 3; i++) {
-            MeshEdge e;
-            e.first = it->_aulPoints[i];
-            e.second = it->_aulPoints[(i + 1) % 3];
-            auto jt = _map.find(e);
-            if (jt == _map.end()) {
-                _map[e].first = index;
-                _map[e].second = FACET_INDEX_MAX;
+            PointIndex start = it->_aulPoints[i];
+            if (start < numPoints) {
+                edges[pos[start]++] = std::make_pair(it->_aulPoints[(i + 1) % 3], index);
+            }
+        }
+    }
+
+    // merge equal edges, the first facet is kept and the last one becomes the second
+    _offsets.assign(numPoints + 1, 0);
+    _edges.clear();
+    _edges.reserve(edges.size());
+    for (std::size_t i = 0; i < numPoints; i++) {
+        auto begin = edges.begin() + static_cast<std::ptrdiff_t>(offsets[i]);
+        auto end = edges.begin() + static_cast<std::ptrdiff_t>(offsets[i + 1]);
+        std::sort(begin, end);
+        for (auto it = begin; it != end; ++it) {
+            if (_edges.size() > _offsets[i] && _edges.back().end == it->first) {
+                _edges.back().facets.second = it->second;
             }
             else {
-                _map[e].second = index;
+                _edges.push_back({it->first, std::make_pair(it->second, FACET_INDEX_MAX)});
             }
         }
+        _offsets[i + 1] = _edges.size();
     }
+    _edges.shrink_to_fit();
 }
 
 const std::pair<FacetIndex, FacetIndex>& MeshRefEdgeToFacets::operator[](const MeshEdge& edge) const
 {
-    return _map.find(edge)->second;
+    static const MeshFacetPair none(FACET_INDEX_MAX, FACET_INDEX_MAX);
+    if (edge.first + 1 >= _offsets.size()) {
+        return none;
+    }
+
+    auto begin = _edges.begin() + static_cast<std::ptrdiff_t>(_offsets[edge.first]);
+    auto end = _edges.begin() + static_cast<std::ptrdiff_t>(_offsets[edge.first + 1]);
+    auto it = std::lower_bound(begin, end, edge.second, [](const EdgeFacets& e, PointIndex p) {
+        return e.end < p;
+    });
+    if (it == end || it->end != edge.second) {
+        return none;
+    }
+    return it->facets;
 }
 
 //----------------------------------------------------------------------------
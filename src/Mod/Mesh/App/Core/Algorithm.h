@@ -23,11 +23,15 @@
 #ifndef MESHALGORITHM_H
 #define MESHALGORITHM_H
 
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
 #include <map>
 #include <set>
 #include <vector>
 
 #include "Elements.h"
+#include "Functional.h"
 #include "MeshKernel.h"
 
 
@@ -465,6 +469,183 @@ private:
     std::vector<FacetIndex>& indices;
 };
 
+/**
+ * The MeshIndexRange class is a read-only view of the sorted indices that a MeshIndexAdjacency
+ * stores for one mesh element. It offers the lookup functions of the std::set it replaces.
+ */
+class MeshIndexRange
+{
+public:
+    using value_type = ElementIndex;
+    using const_iterator = const ElementIndex*;
+
+    MeshIndexRange() = default;
+    MeshIndexRange(const_iterator first, const_iterator last)
+        : first(first)
+        , last(last)
+    {}
+    const_iterator begin() const
+    {
+        return first;
+    }
+    const_iterator end() const
+    {
+        return last;
+    }
+    std::size_t size() const
+    {
+        return static_cast<std::size_t>(last - first);
+    }
+    bool empty() const
+    {
+        return first == last;
+    }
+    /// Returns the position of \a index or end() if it is not part of the range
+    const_iterator find(ElementIndex index) const
+    {
+        const_iterator it = std::lower_bound(first, last, index);
+        return (it != last && *it == index) ? it : last;
+    }
+    std::size_t count(ElementIndex index) const
+    {
+        return find(index) != last ? 1 : 0;
+    }
+
+private:
+    const_iterator first {nullptr};
+    const_iterator last {nullptr};
+};
+
+/**
+ * The MeshIndexAdjacency class keeps a sorted list of element indices for each mesh element
+ * in compressed row storage: all indices are stored in one contiguous array and each row
+ * refers to a section of it. Compared to one std::set per element this needs a fraction
+ * of the memory and keeps the neighbours of an element close together.
+ *
+ * Rows can still be modified with insert() and erase(). A row that runs out of space is
+ * moved to the end of the array, so that a modification never has to shift other rows.
+ */
+class MeshExport MeshIndexAdjacency
+{
+public:
+    /// Returns the number of rows
+    std::size_t size() const
+    {
+        return rows.size();
+    }
+    /// Returns the sorted indices of row \a row
+    MeshIndexRange operator[](ElementIndex row) const
+    {
+        const Row& r = rows[row];
+        const ElementIndex* first = indices.data() + r.start;
+        return {first, first + r.size};
+    }
+    /// Removes all rows and releases the memory
+    void clear()
+    {
+        std::vector<Row>().swap(rows);
+        std::vector<ElementIndex>().swap(indices);
+    }
+    /// Returns the number of bytes allocated by the structure
+    std::size_t memoryUsage() const
+    {
+        return rows.capacity() * sizeof(Row) + indices.capacity() * sizeof(ElementIndex);
+    }
+    /// Adds \a index to the row \a row if it is not yet part of it
+    void insert(ElementIndex row, ElementIndex index);
+    /// Removes \a index from the row \a row
+    void erase(ElementIndex row, ElementIndex index);
+
+    /**
+     * Fills \a numRows rows from the items 0..numItems-1. For each item \a visit is called
+     * as \c visit(item, add) and must call <tt>add(row, index)</tt> for each index it adds
+     * to a row. Duplicates are removed and the rows are sorted afterwards. \a visit is called
+     * twice per item and, if \a threads is greater than one, concurrently from several
+     * threads.
+     */
+    template<typename Visitor>
+    void build(std::size_t numRows, std::size_t numItems, Visitor visit, int threads = 1);
+
+private:
+    struct Row
+    {
+        std::size_t start;
+        std::uint32_t size;
+        std::uint32_t capacity;
+    };
+    std::vector<Row> rows;
+    std::vector<ElementIndex> indices;
+};
+
+template<typename Visitor>
+void MeshIndexAdjacency::build(std::size_t numRows,
+                               std::size_t numItems,
+                               Visitor visit,
+                               int threads)
+{
+    clear();
+    rows.resize(numRows);
+
+    // small structures are not worth the overhead of a thread
+    const int itemThreads = parallel_threads(threads, numItems);
+    const int rowThreads = parallel_threads(threads, numRows);
+
+    // count pass
+    std::vector<std::atomic<std::uint32_t>> counts(numRows);
+    parallel_for(numItems, itemThreads, [&](std::size_t first, std::size_t last) {
+        for (std::size_t item = first; item < last; ++item) {
+            visit(static_cast<ElementIndex>(item), [&counts](ElementIndex row, ElementIndex) {
+                counts[row].fetch_add(1, std::memory_order_relaxed);
+            });
+        }
+    });
+
+    std::vector<std::size_t> offsets(numRows + 1, 0);
+    for (std::size_t row = 0; row < numRows; ++row) {
+        offsets[row + 1] = offsets[row] + counts[row].load(std::memory_order_relaxed);
+        counts[row].store(0, std::memory_order_relaxed);
+    }
+
+    // fill pass, the order inside a row depends on the thread scheduling
+    std::vector<ElementIndex> entries(offsets[numRows]);
+    parallel_for(numItems, itemThreads, [&](std::size_t first, std::size_t last) {
+        for (std::size_t item = first; item < last; ++item) {
+            visit(static_cast<ElementIndex>(item),
+                  [&counts, &offsets, &entries](ElementIndex row, ElementIndex index) {
+                      std::size_t pos = counts[row].fetch_add(1, std::memory_order_relaxed);
+                      entries[offsets[row] + pos] = index;
+                  });
+        }
+    });
+
+    // sorting the rows makes the result independent of the number of threads
+    parallel_for(numRows, rowThreads, [&](std::size_t first, std::size_t last) {
+        for (std::size_t row = first; row < last; ++row) {
+            auto begin = entries.begin() + static_cast<std::ptrdiff_t>(offsets[row]);
+            auto end = entries.begin() + static_cast<std::ptrdiff_t>(offsets[row + 1]);
+            std::sort(begin, end);
+            rows[row].size = static_cast<std::uint32_t>(std::unique(begin, end) - begin);
+            rows[row].capacity = rows[row].size;
+        }
+    });
+
+    // compact the rows without the removed duplicates
+    std::size_t total = 0;
+    for (Row& row : rows) {
+        row.start = total;
+        total += row.size;
+    }
+    indices.resize(total);
+    parallel_for(numRows, rowThreads, [&](std::size_t first, std::size_t last) {
+        for (std::size_t row = first; row < last; ++row) {
+            auto begin = entries.begin() + static_cast<std::ptrdiff_t>(offsets[row]);
+            std::copy(begin,
+                      begin + rows[row].size,
+                      indices.begin() + static_cast<std::ptrdiff_t>(rows[row].start));
+        }
+    });
+}
+
 /**
  * The MeshRefPointToFacets builds up a structure to have access to all facets indexing
  * a point.
@@ -483,7 +664,7 @@ public:
 
     /// Rebuilds up data structure
     void Rebuild();
-    const std::set<FacetIndex>& operator[](PointIndex) const;
+    MeshIndexRange operator[](PointIndex) const;
     std::vector<FacetIndex> GetIndices(PointIndex, PointIndex) const;
     std::vector<FacetIndex> GetIndices(PointIndex, PointIndex, PointIndex) const;
     MeshFacetArray::_TConstIterator GetFacet(FacetIndex) const;
@@ -494,6 +675,11 @@ public:
     void AddNeighbour(PointIndex, FacetIndex);
     void RemoveNeighbour(PointIndex, FacetIndex);
     void RemoveFacet(FacetIndex);
+    /// Returns the number of bytes allocated by the structure
+    std::size_t GetMemoryUsage() const
+    {
+        return _map.memoryUsage();
+    }
 
 protected:
     void SearchNeighbours(const MeshFacetArray& rFacets,
@@ -505,7 +691,7 @@ protected:
 
 private:
     const MeshKernel& _rclMesh; /**< The mesh kernel. */
-    std::vector<std::set<FacetIndex>> _map;
+    MeshIndexAdjacency _map;
 };
 
 /**
@@ -528,13 +714,18 @@ public:
 
     /// Returns a set of facets sharing one or more points with the facet with
     /// index \a ulFacetIndex.
-    const std::set<FacetIndex>& operator[](FacetIndex) const;
+    MeshIndexRange operator[](FacetIndex) const;
     /// Returns an array of common facets of the passed facet indexes.
     std::vector<FacetIndex> GetIndices(FacetIndex, FacetIndex) const;
+    /// Returns the number of bytes allocated by the structure
+    std::size_t GetMemoryUsage() const
+    {
+        return _map.memoryUsage();
+    }
 
 private:
     const MeshKernel& _rclMesh; /**< The mesh kernel. */
-    std::vector<std::set<FacetIndex>> _map;
+    MeshIndexAdjacency _map;
 };
 
 /**
@@ -555,15 +746,20 @@ public:
 
     /// Rebuilds up data structure
     void Rebuild();
-    const std::set<PointIndex>& operator[](PointIndex) const;
+    MeshIndexRange operator[](PointIndex) const;
     Base::Vector3f GetNormal(PointIndex) const;
     float GetAverageEdgeLength(PointIndex) const;
     void AddNeighbour(PointIndex, PointIndex);
     void RemoveNeighbour(PointIndex, PointIndex);
+    /// Returns the number of bytes allocated by the structure
+    std::size_t GetMemoryUsage() const
+    {
+        return _map.memoryUsage();
+    }
 
 private:
     const MeshKernel& _rclMesh; /**< The mesh kernel. */
-    std::vector<std::set<PointIndex>> _map;
+    MeshIndexAdjacency _map;
 };
 
 /**
@@ -584,30 +780,28 @@ public:
 
     /// Rebuilds up data structure
     void Rebuild();
+    /**
+     * Returns the first and the last facet of the directed edge. If the edge belongs to one
+     * facet only the second index is FACET_INDEX_MAX, if it doesn't exist both are.
+     */
     const std::pair<FacetIndex, FacetIndex>& operator[](const MeshEdge&) const;
+    /// Returns the number of bytes allocated by the structure
+    std::size_t GetMemoryUsage() const
+    {
+        return _offsets.capacity() * sizeof(std::size_t) + _edges.capacity() * sizeof(EdgeFacets);
+    }
 
 private:
-    class EdgeOrder
+    using MeshFacetPair = std::pair<FacetIndex, FacetIndex>;
+    struct EdgeFacets
     {
-    public:
-        bool operator()(const MeshEdge& e1, const MeshEdge& e2) const
-        {
-            if (e1.first < e2.first) {
-                return true;
-            }
-            if (e1.first > e2.first) {
-                return false;
-            }
-            if (e1.second < e2.second) {
-                return true;
-            }
-
-            return false;
-        }
+        PointIndex end;
+        MeshFacetPair facets;
     };
-    using MeshFacetPair = std::pair<FacetIndex, FacetIndex>;
     const MeshKernel& _rclMesh; /**< The mesh kernel. */
-    std::map<MeshEdge, MeshFacetPair, EdgeOrder> _map;
+    // the edges are grouped by their start point and sorted by their end point
+    std::vector<std::size_t> _offsets;
+    std::vector<EdgeFacets> _edges;
 };
 
 /**
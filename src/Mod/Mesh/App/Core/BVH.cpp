@@ -0,0 +1,721 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 The FreeCAD Project Association                     *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+#ifndef _PreComp_
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <thread>
+#endif
+
+#include "BVH.h"
+#include "Elements.h"
+#include "Functional.h"
+#include "MeshKernel.h"
+
+
+using namespace MeshCore;
+
+namespace
+{
+// facets per leaf below that no split is tried
+constexpr std::size_t MinLeafSize = 2;
+// facets per leaf above that a split is enforced
+constexpr std::size_t MaxLeafSize = 16;
+// number of buckets to estimate the surface area heuristic
+constexpr int NumBins = 16;
+// from this depth on the facets are split in the middle to limit the depth of the hierarchy
+constexpr int MaxSahDepth = 48;
+// the traversal stacks must hold the deepest path of the hierarchy
+constexpr int StackSize = 128;
+// cost of traversing a node relative to intersecting a facet
+constexpr float TraversalCost = 1.0F;
+
+struct Box
+{
+    float min[3] {std::numeric_limits<float>::max(),  // NOLINT
+                  std::numeric_limits<float>::max(),
+                  std::numeric_limits<float>::max()};
+    float max[3] {-std::numeric_limits<float>::max(),  // NOLINT
+                  -std::numeric_limits<float>::max(),
+                  -std::numeric_limits<float>::max()};
+
+    void add(const Base::Vector3f& pnt)
+    {
+        min[0] = std::min(min[0], pnt.x);
+        min[1] = std::min(min[1], pnt.y);
+        min[2] = std::min(min[2], pnt.z);
+        max[0] = std::max(max[0], pnt.x);
+        max[1] = std::max(max[1], pnt.y);
+        max[2] = std::max(max[2], pnt.z);
+    }
+    void add(const Box& box)
+    {
+        for (int i = 0; i < 3; i++) {
+            min[i] = std::min(min[i], box.min[i]);
+            max[i] = std::max(max[i], box.max[i]);
+        }
+    }
+    float area() const
+    {
+        float dx = max[0] - min[0];
+        float dy = max[1] - min[1];
+        float dz = max[2] - min[2];
+        if (dx < 0.0F || dy < 0.0F || dz < 0.0F) {
+            return 0.0F;
+        }
+        return 2.0F * (dx * dy + dy * dz + dz * dx);
+    }
+};
+
+float coord(const Base::Vector3f& pnt, int axis)
+{
+    return axis == 0 ? pnt.x : (axis == 1 ? pnt.y : pnt.z);
+}
+
+/*
+ * Intersects the ray with the slabs of the node box. The parameter range [0, tmax] is clipped
+ * and tnear holds the entry parameter.
+ */
+template<class Node>
+inline bool hitBox(const Node& node,
+                   const float org[3],  // NOLINT
+                   const float inv[3],  // NOLINT
+                   float tmax,
+                   float& tnear)
+{
+    float t0 = 0.0F;
+    float t1 = tmax;
+    for (int i = 0; i < 3; i++) {
+        float ta = (node.min[i] - org[i]) * inv[i];
+        float tb = (node.max[i] - org[i]) * inv[i];
+        if (ta > tb) {
+            std::swap(ta, tb);
+        }
+        t0 = std::max(t0, ta);
+        t1 = std::min(t1, tb);
+    }
+
+    tnear = t0;
+    return t0 <= t1;
+}
+
+/*
+ * The edges and the normal of a facet as needed by the ray test.
+ */
+struct RayTriangle
+{
+    Base::Vector3f base, edge1, edge2, normal;
+    float normal2;
+
+    template<class Triangle>
+    explicit RayTriangle(const Triangle& tria)
+        : base(tria.points[0])
+        , edge1(tria.points[1] - tria.points[0])
+        , edge2(tria.points[2] - tria.points[0])
+        , normal(edge1 % edge2)
+        , normal2(normal * normal)
+    {}
+
+    /*
+     * Computes the ray parameter of the intersection with the facet. Like
+     * MeshGeomFacet::Foraminate() rays nearly parallel to the facet are ignored.
+     */
+    bool intersect(const Base::Vector3f& org, const Base::Vector3f& dir, float& param) const
+    {
+        const float eps = 1e-06F;
+        float nd = normal * dir;
+        if ((nd * nd) <= (eps * (dir * dir) * normal2)) {
+            return false;
+        }
+
+        Base::Vector3f pvec = dir % edge2;
+        float inv = 1.0F / (edge1 * pvec);
+        Base::Vector3f tvec = org - base;
+        float u = (tvec * pvec) * inv;
+        if (u < 0.0F || u > 1.0F) {
+            return false;
+        }
+
+        Base::Vector3f qvec = tvec % edge1;
+        float v = (dir * qvec) * inv;
+        if (v < 0.0F || u + v > 1.0F) {
+            return false;
+        }
+
+        param = (edge2 * qvec) * inv;
+        return param >= 0.0F;
+    }
+};
+
+void setupRay(const Base::Vector3f& pnt,
+              const Base::Vector3f& dir,
+              float org[3],  // NOLINT
+              float inv[3])  // NOLINT
+{
+    org[0] = pnt.x;
+    org[1] = pnt.y;
+    org[2] = pnt.z;
+    inv[0] = 1.0F / dir.x;
+    inv[1] = 1.0F / dir.y;
+    inv[2] = 1.0F / dir.z;
+}
+}  // namespace
+
+struct MeshFacetBVH::BuildItem
+{
+    Box box;
+    Base::Vector3f center;
+    uint32_t index;
+};
+
+MeshFacetBVH::MeshFacetBVH() = default;
+
+MeshFacetBVH::MeshFacetBVH(const MeshKernel& mesh)
+{
+    Rebuild(mesh);
+}
+
+MeshFacetBVH::MeshFacetBVH(const MeshKernel& mesh, const Base::Matrix4D& mat)
+{
+    Rebuild(mesh, mat);
+}
+
+MeshFacetBVH::~MeshFacetBVH() = default;
+
+void MeshFacetBVH::Rebuild(const MeshKernel& mesh)
+{
+    Rebuild(mesh, Base::Matrix4D());
+}
+
+void MeshFacetBVH::Rebuild(const MeshKernel& mesh, const Base::Matrix4D& mat)
+{
+    Clear();
+
+    const MeshPointArray& points = mesh.GetPoints();
+    const MeshFacetArray& meshFacets = mesh.GetFacets();
+    std::size_t count = meshFacets.size();
+    if (count == 0) {
+        return;
+    }
+
+    bool transform = mat != Base::Matrix4D();
+    std::vector<Triangle> source(count);
+    std::vector<BuildItem> items(count);
+    for (std::size_t i = 0; i < count; i++) {
+        Triangle& tria = source[i];
+        BuildItem& item = items[i];
+        for (int j = 0; j < 3; j++) {
+            const Base::Vector3f& pnt = points[meshFacets[i]._aulPoints[j]];
+            tria.points[j] = transform ? mat * pnt : pnt;
+            item.box.add(tria.points[j]);
+        }
+        item.center = (tria.points[0] + tria.points[1] + tria.points[2]) / 3.0F;
+        item.index = uint32_t(i);
+    }
+
+    nodes.reserve(2 * count / MinLeafSize);
+    Build(items, 0, count, 0);
+    nodes.shrink_to_fit();
+
+    // store the facets in the order of the leaves
+    triangles.resize(count);
+    facets.resize(count);
+    for (std::size_t i = 0; i < count; i++) {
+        triangles[i] = source[items[i].index];
+        facets[i] = items[i].index;
+    }
+}
+
+void MeshFacetBVH::Build(std::vector<BuildItem>& items,
+                         std::size_t first,
+                         std::size_t last,
+                         int depth)
+{
+    const std::size_t nodeIndex = nodes.size();
+    nodes.emplace_back();
+
+    Box box;
+    Box centers;
+    for (std::size_t i = first; i < last; i++) {
+        box.add(items[i].box);
+        centers.add(items[i].center);
+    }
+
+    for (int i = 0; i < 3; i++) {
+        nodes[nodeIndex].min[i] = box.min[i];
+        nodes[nodeIndex].max[i] = box.max[i];
+    }
+
+    const std::size_t count = last - first;
+    auto makeLeaf = [&]() {
+        nodes[nodeIndex].index = uint32_t(first);
+        nodes[nodeIndex].count = uint32_t(count);
+    };
+
+    if (count <= MinLeafSize) {
+        makeLeaf();
+        return;
+    }
+
+    // find the cheapest split of the buckets along any axis
+    int bestAxis = -1;
+    int bestBin = 0;
+    float bestCost = std::numeric_limits<float>::max();
+    if (depth < MaxSahDepth) {
+        for (int axis = 0; axis < 3; axis++) {
+            float extent = centers.max[axis] - centers.min[axis];
+            if (extent <= 0.0F) {
+                continue;
+            }
+
+            Box binBoxes[NumBins];            // NOLINT
+            std::size_t binCounts[NumBins] {};  // NOLINT
+            float scale = float(NumBins) / extent;
+            for (std::size_t i = first; i < last; i++) {
+                auto bin = int((coord(items[i].center, axis) - centers.min[axis]) * scale);
+                bin = std::min(bin, NumBins - 1);
+                binBoxes[bin].add(items[i].box);
+                binCounts[bin]++;
+            }
+
+            float rightCost[NumBins] {};  // NOLINT
+            Box right;
+            std::size_t rightCount = 0;
+            for (int bin = NumBins - 1; bin > 0; bin--) {
+                right.add(binBoxes[bin]);
+                rightCount += binCounts[bin];
+                rightCost[bin] = right.area() * float(rightCount);
+            }
+
+            Box left;
+            std::size_t leftCount = 0;
+            for (int bin = 0; bin < NumBins - 1; bin++) {
+                left.add(binBoxes[bin]);
+                leftCount += binCounts[bin];
+                float cost = left.area() * float(leftCount) + rightCost[bin + 1];
+                if (leftCount > 0 && leftCount < count && cost < bestCost) {
+                    bestCost = cost;
+                    bestAxis = axis;
+                    bestBin = bin;
+                }
+            }
+        }
+    }
+
+    auto begin = items.begin() + std::ptrdiff_t(first);
+    auto end = items.begin() + std::ptrdiff_t(last);
+    auto middle = begin;
+    float leafCost = box.area() * float(count);
+    if (bestAxis >= 0 && TraversalCost * box.area() + bestCost < leafCost) {
+        float extent = centers.max[bestAxis] - centers.min[bestAxis];
+        float scale = float(NumBins) / extent;
+        float minimum = centers.min[bestAxis];
+        middle = std::partition(begin, end, [=](const BuildItem& item) {
+            auto bin = int((coord(item.center, bestAxis) - minimum) * scale);
+            return std::min(bin, NumBins - 1) <= bestBin;
+        });
+    }
+    else if (count <= MaxLeafSize) {
+        makeLeaf();
+        return;
+    }
+
+    if (middle == begin || middle == end) {
+        // split in the middle of the axis with the largest extent
+        int axis = 0;
+        for (int i = 1; i < 3; i++) {
+            if (centers.max[i] - centers.min[i] > centers.max[axis] - centers.min[axis]) {
+                axis = i;
+            }
+        }
+        middle = begin + std::ptrdiff_t(count / 2);
+        std::nth_element(begin, middle, end, [axis](const BuildItem& a, const BuildItem& b) {
+            return coord(a.center, axis) < coord(b.center, axis);
+        });
+    }
+
+    std::size_t mid = first + std::size_t(middle - begin);
+    Build(items, first, mid, depth + 1);
+    nodes[nodeIndex].index = uint32_t(nodes.size());
+    nodes[nodeIndex].count = 0;
+    Build(items, mid, last, depth + 1);
+}
+
+void MeshFacetBVH::Clear()
+{
+    nodes.clear();
+    triangles.clear();
+    facets.clear();
+}
+
+Base::BoundBox3f MeshFacetBVH::GetBoundBox() const
+{
+    Base::BoundBox3f box;
+    if (!nodes.empty()) {
+        const Node& root = nodes.front();
+        box.Add(Base::Vector3f(root.min[0], root.min[1], root.min[2]));
+        box.Add(Base::Vector3f(root.max[0], root.max[1], root.max[2]));
+    }
+    return box;
+}
+
+std::size_t MeshFacetBVH::GetMemoryUsage() const
+{
+    return nodes.capacity() * sizeof(Node) + triangles.capacity() * sizeof(Triangle)
+        + facets.capacity() * sizeof(FacetIndex);
+}
+
+bool MeshFacetBVH::Intersect(const Ray& ray, float maxAngle, float& dist, uint32_t& tria) const
+{
+    if (nodes.empty()) {
+        return false;
+    }
+
+    float org[3];  // NOLINT
+    float inv[3];  // NOLINT
+    setupRay(ray.point, ray.dir, org, inv);
+    bool checkAngle = maxAngle < Mathf::PI;
+
+    bool found = false;
+    dist = std::numeric_limits<float>::max();
+    std::pair<uint32_t, float> stack[StackSize];  // NOLINT
+    int top = 0;
+    float tnear {};
+    if (hitBox(nodes.front(), org, inv, dist, tnear)) {
+        stack[top++] = std::make_pair(0, tnear);
+    }
+
+    while (top > 0) {
+        auto [index, entry] = stack[--top];
+        if (entry > dist) {
+            continue;
+        }
+
+        const Node& node = nodes[index];
+        if (node.count > 0) {
+            for (uint32_t i = node.index; i < node.index + node.count; i++) {
+                RayTriangle facet(triangles[i]);
+                float param {};
+                if (!facet.intersect(ray.point, ray.dir, param)) {
+                    continue;
+                }
+                if (checkAngle && ray.dir.GetAngle(facet.normal) > maxAngle) {
+                    continue;
+                }
+                // on equal distance the lower facet index wins to be independent of the order
+                if (param < dist || (param == dist && found && facets[i] < facets[tria])) {
+                    dist = param;
+                    tria = i;
+                    found = true;
+                }
+            }
+        }
+        else {
+            // visit the nearer child first
+            uint32_t left = index + 1;
+            uint32_t right = node.index;
+            float tleft {};
+            float tright {};
+            bool hitLeft = hitBox(nodes[left], org, inv, dist, tleft);
+            bool hitRight = hitBox(nodes[right], org, inv, dist, tright);
+            if (hitLeft && hitRight && tleft < tright) {
+                stack[top++] = std::make_pair(right, tright);
+                stack[top++] = std::make_pair(left, tleft);
+            }
+            else if (hitLeft && hitRight) {
+                stack[top++] = std::make_pair(left, tleft);
+                stack[top++] = std::make_pair(right, tright);
+            }
+            else if (hitLeft) {
+                stack[top++] = std::make_pair(left, tleft);
+            }
+            else if (hitRight) {
+                stack[top++] = std::make_pair(right, tright);
+            }
+        }
+    }
+
+    return found;
+}
+
+bool MeshFacetBVH::NearestFacetOnRay(const Base::Vector3f& rclPt,
+                                     const Base::Vector3f& rclDir,
+                                     Base::Vector3f& rclRes,
+                                     FacetIndex& rulFacet) const
+{
+    return NearestFacetOnRay(rclPt, rclDir, Mathf::PI, rclRes, rulFacet);
+}
+
+bool MeshFacetBVH::NearestFacetOnRay(const Base::Vector3f& rclPt,
+                                     const Base::Vector3f& rclDir,
+                                     float fMaxAngle,
+                                     Base::Vector3f& rclRes,
+                                     FacetIndex& rulFacet) const
+{
+    float dist {};
+    uint32_t tria {};
+    if (Intersect(Ray {rclPt, rclDir}, fMaxAngle, dist, tria)) {
+        rclRes = rclPt + dist * rclDir;
+        rulFacet = facets[tria];
+        return true;
+    }
+
+    return false;
+}
+
+void MeshFacetBVH::IntersectPacket(const Ray* rays, int count, RayHit* hits) const
+{
+    // The rays of the packet share the traversal. The loops over the rays have no early exit
+    // so that the compiler can vectorize them.
+    float orgX[PacketSize], orgY[PacketSize], orgZ[PacketSize];  // NOLINT
+    float invX[PacketSize], invY[PacketSize], invZ[PacketSize];  // NOLINT
+    float dist[PacketSize];                                      // NOLINT
+    uint32_t tria[PacketSize];                                   // NOLINT
+    bool active[PacketSize];                                     // NOLINT
+    for (int r = 0; r < count; r++) {
+        orgX[r] = rays[r].point.x;
+        orgY[r] = rays[r].point.y;
+        orgZ[r] = rays[r].point.z;
+        invX[r] = 1.0F / rays[r].dir.x;
+        invY[r] = 1.0F / rays[r].dir.y;
+        invZ[r] = 1.0F / rays[r].dir.z;
+        dist[r] = std::numeric_limits<float>::max();
+        tria[r] = std::numeric_limits<uint32_t>::max();
+    }
+
+    auto hitPacket = [&](const Node& node) {
+        bool any = false;
+        for (int r = 0; r < count; r++) {
+            float ax = (node.min[0] - orgX[r]) * invX[r];
+            float bx = (node.max[0] - orgX[r]) * invX[r];
+            float ay = (node.min[1] - orgY[r]) * invY[r];
+            float by = (node.max[1] - orgY[r]) * invY[r];
+            float az = (node.min[2] - orgZ[r]) * invZ[r];
+            float bz = (node.max[2] - orgZ[r]) * invZ[r];
+            float t0 = std::max(std::max(0.0F, std::min(ax, bx)),
+                                std::max(std::min(ay, by), std::min(az, bz)));
+            float t1 = std::min(std::min(dist[r], std::max(ax, bx)),
+                                std::min(std::max(ay, by), std::max(az, bz)));
+            active[r] = t0 <= t1;
+            any = any || active[r];
+        }
+        return any;
+    };
+
+    // the children are visited in the order of the first ray
+    const Base::Vector3f& dir = rays[0].dir;
+    uint32_t stack[StackSize];  // NOLINT
+    int top = 0;
+    stack[top++] = 0;
+    while (top > 0) {
+        uint32_t index = stack[--top];
+        const Node& node = nodes[index];
+        if (!hitPacket(node)) {
+            continue;
+        }
+
+        if (node.count > 0) {
+            for (uint32_t i = node.index; i < node.index + node.count; i++) {
+                RayTriangle facet(triangles[i]);
+                for (int r = 0; r < count; r++) {
+                    float param {};
+                    if (!active[r] || !facet.intersect(rays[r].point, rays[r].dir, param)) {
+                        continue;
+                    }
+                    bool found = tria[r] != std::numeric_limits<uint32_t>::max();
+                    if (param < dist[r]
+                        || (param == dist[r] && found && facets[i] < facets[tria[r]])) {
+                        dist[r] = param;
+                        tria[r] = i;
+                    }
+                }
+            }
+        }
+        else {
+            uint32_t left = index + 1;
+            uint32_t right = node.index;
+            const Node& nodeL = nodes[left];
+            const Node& nodeR = nodes[right];
+            float diff = (nodeL.min[0] + nodeL.max[0] - nodeR.min[0] - nodeR.max[0]) * dir.x
+                + (nodeL.min[1] + nodeL.max[1] - nodeR.min[1] - nodeR.max[1]) * dir.y
+                + (nodeL.min[2] + nodeL.max[2] - nodeR.min[2] - nodeR.max[2]) * dir.z;
+            if (diff > 0.0F) {
+                stack[top++] = left;
+                stack[top++] = right;
+            }
+            else {
+                stack[top++] = right;
+                stack[top++] = left;
+            }
+        }
+    }
+
+    for (int r = 0; r < count; r++) {
+        if (tria[r] != std::numeric_limits<uint32_t>::max()) {
+            hits[r].facet = facets[tria[r]];
+            hits[r].point = rays[r].point + dist[r] * rays[r].dir;
+        }
+    }
+}
+
+std::vector<MeshFacetBVH::RayHit> MeshFacetBVH::NearestFacetsOnRays(const std::vector<Ray>& rays,
+                                                                     int threads) const
+{
+    std::vector<RayHit> hits(rays.size());
+    if (nodes.empty() || rays.empty()) {
+        return hits;
+    }
+
+    std::size_t numPackets = (rays.size() + PacketSize - 1) / PacketSize;
+    if (threads < 1) {
+        threads = int(std::thread::hardware_concurrency());
+    }
+    // a few packets are not worth the overhead of spawning threads
+    const std::size_t minPackets = 64;
+    threads = std::max(1, std::min<int>(threads, int(numPackets / minPackets)));
+
+    parallel_for(numPackets, threads, [&](std::size_t first, std::size_t last) {
+        for (std::size_t packet = first; packet < last; packet++) {
+            std::size_t start = packet * PacketSize;
+            int count = int(std::min<std::size_t>(PacketSize, rays.size() - start));
+            IntersectPacket(&rays[start], count, &hits[start]);
+        }
+    });
+
+    return hits;
+}
+
+bool MeshFacetBVH::NearestFacetToPoint(const Base::Vector3f& rclPt,
+                                       float fMaxDist,
+                                       FacetIndex& rulFacet,
+                                       float& rfDist) const
+{
+    if (nodes.empty()) {
+        return false;
+    }
+
+    auto boxDistance2 = [&rclPt](const Node& node) {
+        float pnt[3] = {rclPt.x, rclPt.y, rclPt.z};  // NOLINT
+        float dist2 = 0.0F;
+        for (int i = 0; i < 3; i++) {
+            float d = std::max({node.min[i] - pnt[i], 0.0F, pnt[i] - node.max[i]});
+            dist2 += d * d;
+        }
+        return dist2;
+    };
+
+    bool found = false;
+    float dist = fMaxDist;
+    uint32_t tria = 0;
+    std::pair<uint32_t, float> stack[StackSize];  // NOLINT
+    int top = 0;
+    stack[top++] = std::make_pair(0, boxDistance2(nodes.front()));
+    while (top > 0) {
+        auto [index, dist2] = stack[--top];
+        if (dist2 > dist * dist) {
+            continue;
+        }
+
+        const Node& node = nodes[index];
+        if (node.count > 0) {
+            for (uint32_t i = node.index; i < node.index + node.count; i++) {
+                const Triangle& t = triangles[i];
+                MeshGeomFacet facet(t.points[0], t.points[1], t.points[2]);
+                float d = facet.DistanceToPoint(rclPt);
+                if (d < dist || (d == dist && (!found || facets[i] < facets[tria]))) {
+                    dist = d;
+                    tria = i;
+                    found = true;
+                }
+            }
+        }
+        else {
+            // visit the nearer child first
+            uint32_t left = index + 1;
+            uint32_t right = node.index;
+            float distL = boxDistance2(nodes[left]);
+            float distR = boxDistance2(nodes[right]);
+            if (distL < distR) {
+                stack[top++] = std::make_pair(right, distR);
+                stack[top++] = std::make_pair(left, distL);
+            }
+            else {
+                stack[top++] = std::make_pair(left, distL);
+                stack[top++] = std::make_pair(right, distR);
+            }
+        }
+    }
+
+    if (found) {
+        rulFacet = facets[tria];
+        rfDist = dist;
+    }
+
+    return found;
+}
+
+void MeshFacetBVH::Inside(const Base::BoundBox3f& rclBB, std::vector<FacetIndex>& raulFacets) const
+{
+    if (nodes.empty()) {
+        return;
+    }
+
+    auto overlaps = [&rclBB](const float* min, const float* max) {
+        return min[0] <= rclBB.MaxX && max[0] >= rclBB.MinX && min[1] <= rclBB.MaxY
+            && max[1] >= rclBB.MinY && min[2] <= rclBB.MaxZ && max[2] >= rclBB.MinZ;
+    };
+
+    std::size_t first = raulFacets.size();
+    uint32_t stack[StackSize];  // NOLINT
+    int top = 0;
+    stack[top++] = 0;
+    while (top > 0) {
+        const Node& node = nodes[stack[--top]];
+        if (!overlaps(node.min, node.max)) {
+            continue;
+        }
+
+        if (node.count > 0) {
+            for (uint32_t i = node.index; i < node.index + node.count; i++) {
+                const Triangle& t = triangles[i];
+                float min[3] {};  // NOLINT
+                float max[3] {};  // NOLINT
+                for (int j = 0; j < 3; j++) {
+                    min[j] = std::min({t.points[0][j], t.points[1][j], t.points[2][j]});
+                    max[j] = std::max({t.points[0][j], t.points[1][j], t.points[2][j]});
+                }
+                if (overlaps(min, max)) {
+                    raulFacets.push_back(facets[i]);
+                }
+            }
+        }
+        else {
+            stack[top++] = node.index;
+            stack[top++] = uint32_t(&node - nodes.data()) + 1;
+        }
+    }
+
+    std::sort(raulFacets.begin() + std::ptrdiff_t(first), raulFacets.end());
+}
@@ -0,0 +1,178 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 The FreeCAD Project Association                     *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#ifndef MESH_BVH_H
+#define MESH_BVH_H
+
+#include <cstdint>
+#include <vector>
+
+#include <Base/BoundBox.h>
+#include <Base/Matrix.h>
+#include <Base/Vector3D.h>
+
+#include "Definitions.h"
+
+
+namespace MeshCore
+{
+class MeshKernel;
+
+/**
+ * The MeshFacetBVH class is a bounding volume hierarchy over the facets of a mesh. Unlike the
+ * uniform MeshFacetGrid it adapts to the distribution of the facets, so it keeps its speed on
+ * meshes with very different facet densities, as is typical for scans.
+ *
+ * The hierarchy is built with the surface area heuristic (SAH) and stores a copy of the
+ * facet corners in the order of its leaves. Therefore it doesn't depend on the mesh after
+ * construction, but it must be rebuilt when the mesh changes.
+ *
+ * Rays are half-lines: only intersections in direction of the ray are reported.
+ */
+class MeshExport MeshFacetBVH
+{
+public:
+    struct Ray
+    {
+        Base::Vector3f point;
+        Base::Vector3f dir;
+    };
+
+    struct RayHit
+    {
+        /** The intersected facet or FACET_INDEX_MAX if the ray misses the mesh. */
+        FacetIndex facet {FACET_INDEX_MAX};
+        /** The intersection point. */
+        Base::Vector3f point;
+    };
+
+    /** @name Construction */
+    //@{
+    MeshFacetBVH();
+    explicit MeshFacetBVH(const MeshKernel& mesh);
+    /** Builds the hierarchy over the facets of \a mesh transformed by \a mat. */
+    MeshFacetBVH(const MeshKernel& mesh, const Base::Matrix4D& mat);
+    ~MeshFacetBVH();
+
+    MeshFacetBVH(const MeshFacetBVH&) = default;
+    MeshFacetBVH(MeshFacetBVH&&) = default;
+    MeshFacetBVH& operator=(const MeshFacetBVH&) = default;
+    MeshFacetBVH& operator=(MeshFacetBVH&&) = default;
+    //@}
+
+    /** Rebuilds the hierarchy for \a mesh. */
+    void Rebuild(const MeshKernel& mesh);
+    /** Rebuilds the hierarchy for \a mesh transformed by \a mat. */
+    void Rebuild(const MeshKernel& mesh, const Base::Matrix4D& mat);
+    /** Removes all facets. */
+    void Clear();
+    bool IsEmpty() const
+    {
+        return nodes.empty();
+    }
+    /** Returns the bounding box of all facets. */
+    Base::BoundBox3f GetBoundBox() const;
+    /** Returns the number of nodes of the hierarchy. */
+    std::size_t CountNodes() const
+    {
+        return nodes.size();
+    }
+    /** Returns the number of bytes used by the hierarchy. */
+    std::size_t GetMemoryUsage() const;
+
+    /** @name Queries */
+    //@{
+    /**
+     * Searches for the nearest facet hit by the ray (\a rclPt, \a rclDir). The point \a rclRes
+     * holds the intersection point and \a rulFacet the index of the facet.
+     */
+    bool NearestFacetOnRay(const Base::Vector3f& rclPt,
+                           const Base::Vector3f& rclDir,
+                           Base::Vector3f& rclRes,
+                           FacetIndex& rulFacet) const;
+    /**
+     * Does the same as above but ignores facets where the angle between the ray and the
+     * facet normal is higher than \a fMaxAngle.
+     */
+    bool NearestFacetOnRay(const Base::Vector3f& rclPt,
+                           const Base::Vector3f& rclDir,
+                           float fMaxAngle,
+                           Base::Vector3f& rclRes,
+                           FacetIndex& rulFacet) const;
+    /**
+     * Computes the nearest hit for each of the \a rays. Neighbouring rays are traced as a
+     * packet through the hierarchy, so coherent rays like those of a projection along one
+     * direction are much faster than single queries. The packets are distributed over \a
+     * threads threads, a value < 1 uses all cores. The result doesn't depend on the number of
+     * threads and is the same as calling NearestFacetOnRay() for each ray.
+     */
+    std::vector<RayHit> NearestFacetsOnRays(const std::vector<Ray>& rays, int threads = 0) const;
+    /**
+     * Searches for the facet with the smallest distance to \a rclPt that is not farther away
+     * than \a fMaxDist. \a rulFacet holds the index of the facet and \a rfDist its distance.
+     */
+    bool NearestFacetToPoint(const Base::Vector3f& rclPt,
+                             float fMaxDist,
+                             FacetIndex& rulFacet,
+                             float& rfDist) const;
+    /**
+     * Appends the indices of all facets whose bounding boxes intersect \a rclBB to \a
+     * raulFacets. The indices are sorted in ascending order.
+     */
+    void Inside(const Base::BoundBox3f& rclBB, std::vector<FacetIndex>& raulFacets) const;
+    //@}
+
+    /** The maximum number of rays traced together by NearestFacetsOnRays(). */
+    static constexpr int PacketSize = 8;
+
+private:
+    struct Node
+    {
+        float min[3];  // NOLINT
+        /** The index of the right child for inner nodes or of the first facet for leaves. */
+        uint32_t index;
+        float max[3];  // NOLINT
+        /** The number of facets for leaves, 0 for inner nodes. The left child follows the node. */
+        uint32_t count;
+    };
+
+    struct Triangle
+    {
+        Base::Vector3f points[3];  // NOLINT
+    };
+
+    struct BuildItem;
+    void Build(std::vector<BuildItem>& items, std::size_t first, std::size_t last, int depth);
+    bool Intersect(const Ray& ray, float maxAngle, float& dist, uint32_t& tria) const;
+    void IntersectPacket(const Ray* rays, int count, RayHit* hits) const;
+
+private:
+    std::vector<Node> nodes;
+    std::vector<Triangle> triangles;
+    std::vector<FacetIndex> facets;
+};
+
+}  // namespace MeshCore
+
+
+#endif  // MESH_BVH_H
@@ -0,0 +1,1208 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 The FreeCAD Project Association                     *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+#ifndef _PreComp_
+#include <algorithm>
+#include <array>
+#include <cfloat>
+#include <cmath>
+#include <limits>
+#include <mutex>
+#include <numbers>
+#include <numeric>
+#include <thread>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#endif
+
+#include "BVH.h"
+#include "Boolean.h"
+#include "Functional.h"
+#include "MeshKernel.h"
+
+
+using namespace MeshCore;
+
+namespace
+{
+
+// --------------------------------------------------------------------------------------------
+// Adaptive exact arithmetic after J. R. Shewchuk, "Adaptive Precision Floating-Point
+// Arithmetic and Fast Robust Geometric Predicates". An expansion is a sum of non-overlapping
+// doubles sorted by increasing magnitude.
+
+using Expansion = std::vector<double>;
+using Point = std::array<double, 3>;
+
+constexpr double Epsilon = DBL_EPSILON / 2.0;
+constexpr double Orient3dBound = (7.0 + 56.0 * Epsilon) * Epsilon;
+constexpr double Det2Bound = (3.0 + 16.0 * Epsilon) * Epsilon;
+
+inline void twoSum(double a, double b, double& x, double& y)
+{
+    x = a + b;
+    double bv = x - a;
+    double av = x - bv;
+    y = (a - av) + (b - bv);
+}
+
+inline void twoProduct(double a, double b, double& x, double& y)
+{
+    x = a * b;
+    y = std::fma(a, b, -x);
+}
+
+Expansion grow(const Expansion& e, double b)
+{
+    Expansion h;
+    h.reserve(e.size() + 1);
+    double q = b;
+    for (double it : e) {
+        double x {};
+        double y {};
+        twoSum(q, it, x, y);
+        if (y != 0.0) {
+            h.push_back(y);
+        }
+        q = x;
+    }
+    if (q != 0.0 || h.empty()) {
+        h.push_back(q);
+    }
+    return h;
+}
+
+Expansion add(Expansion e, const Expansion& f)
+{
+    for (double it : f) {
+        e = grow(e, it);
+    }
+    return e;
+}
+
+Expansion scale(const Expansion& e, double b)
+{
+    Expansion h {0.0};
+    for (double it : e) {
+        double x {};
+        double y {};
+        twoProduct(it, b, x, y);
+        h = grow(grow(h, y), x);
+    }
+    return h;
+}
+
+Expansion multiply(const Expansion& e, const Expansion& f)
+{
+    Expansion h {0.0};
+    for (double it : f) {
+        h = add(std::move(h), scale(e, it));
+    }
+    return h;
+}
+
+Expansion negate(Expansion e)
+{
+    for (double& it : e) {
+        it = -it;
+    }
+    return e;
+}
+
+Expansion difference(double a, double b)
+{
+    double x {};
+    double y {};
+    twoSum(a, -b, x, y);
+    return y == 0.0 ? Expansion {x} : Expansion {y, x};
+}
+
+int sign(const Expansion& e)
+{
+    double value = e.back();
+    return (value > 0.0) - (value < 0.0);
+}
+
+int sign(double value)
+{
+    return (value > 0.0) - (value < 0.0);
+}
+
+// The determinant of the 2x2 matrix [u1 u2; v1 v2]
+Expansion det2(const Expansion& u1, const Expansion& u2, const Expansion& v1, const Expansion& v2)
+{
+    return add(multiply(u1, v2), negate(multiply(u2, v1)));
+}
+
+// Sign of det[b - a, c - a, d - a], i.e. positive if d lies on the side of the plane through
+// a, b and c the normal (b - a) x (c - a) points to
+int orient3d(const Point& a, const Point& b, const Point& c, const Point& d)
+{
+    double ux = b[0] - a[0];
+    double uy = b[1] - a[1];
+    double uz = b[2] - a[2];
+    double vx = c[0] - a[0];
+    double vy = c[1] - a[1];
+    double vz = c[2] - a[2];
+    double wx = d[0] - a[0];
+    double wy = d[1] - a[1];
+    double wz = d[2] - a[2];
+
+    double det = ux * (vy * wz - vz * wy) - uy * (vx * wz - vz * wx) + uz * (vx * wy - vy * wx);
+    double permanent = std::abs(ux) * (std::abs(vy * wz) + std::abs(vz * wy))
+        + std::abs(uy) * (std::abs(vx * wz) + std::abs(vz * wx))
+        + std::abs(uz) * (std::abs(vx * wy) + std::abs(vy * wx));
+    if (std::abs(det) > Orient3dBound * permanent) {
+        return sign(det);
+    }
+
+    std::array<Expansion, 3> u;
+    std::array<Expansion, 3> v;
+    std::array<Expansion, 3> w;
+    for (int i = 0; i < 3; i++) {
+        u[i] = difference(b[i], a[i]);
+        v[i] = difference(c[i], a[i]);
+        w[i] = difference(d[i], a[i]);
+    }
+    Expansion result = multiply(u[0], det2(v[1], v[2], w[1], w[2]));
+    result = add(std::move(result), negate(multiply(u[1], det2(v[0], v[2], w[0], w[2]))));
+    result = add(std::move(result), multiply(u[2], det2(v[0], v[1], w[0], w[1])));
+    return sign(result);
+}
+
+// Sign of the component axis of (q - p) x (c - d)
+int crossSign(const Point& p, const Point& q, const Point& c, const Point& d, int axis)
+{
+    int i = (axis + 1) % 3;
+    int j = (axis + 2) % 3;
+    double left = (q[i] - p[i]) * (c[j] - d[j]);
+    double right = (q[j] - p[j]) * (c[i] - d[i]);
+    double det = left - right;
+    if (std::abs(det) > Det2Bound * (std::abs(left) + std::abs(right))) {
+        return sign(det);
+    }
+
+    return sign(det2(difference(q[i], p[i]),
+                     difference(q[j], p[j]),
+                     difference(c[i], d[i]),
+                     difference(c[j], d[j])));
+}
+
+// --------------------------------------------------------------------------------------------
+// Simulation of simplicity: the second mesh is translated by t = e * (1, e, e^2) with an
+// infinitesimal e > 0. A zero determinant is then decided by the first non-vanishing term of
+// its expansion in e.
+
+// Side of the point p with respect to the plane of the facet (a, b, c). If exactly one of
+// them is moved it's the facet if facetMoved is true.
+int orientPoint(const Point& a, const Point& b, const Point& c, const Point& p, bool facetMoved)
+{
+    int result = orient3d(a, b, c, p);
+    if (result != 0) {
+        return result;
+    }
+    for (int axis = 0; axis < 3; axis++) {
+        result = crossSign(a, b, c, a, axis);
+        if (result != 0) {
+            return facetMoved ? -result : result;
+        }
+    }
+    return 0;
+}
+
+// Orientation of the edges (p, q) and (c, d) that belong to different meshes. The edge
+// (p, q) is the moved one if edgeMoved is true.
+int orientEdges(const Point& p, const Point& q, const Point& c, const Point& d, bool edgeMoved)
+{
+    int result = orient3d(p, q, c, d);
+    if (result != 0) {
+        return result;
+    }
+    for (int axis = 0; axis < 3; axis++) {
+        result = crossSign(p, q, c, d, axis);
+        if (result != 0) {
+            return edgeMoved ? -result : result;
+        }
+    }
+    return 0;
+}
+
+// --------------------------------------------------------------------------------------------
+
+// The intersection point of an edge of one mesh with a facet of the other mesh. The points
+// of the edge are ordered to make the key unique.
+struct PointKey
+{
+    int side;
+    PointIndex edge[2];
+    FacetIndex facet;
+
+    bool operator<(const PointKey& other) const
+    {
+        return std::tie(side, edge[0], edge[1], facet)
+            < std::tie(other.side, other.edge[0], other.edge[1], other.facet);
+    }
+    bool operator==(const PointKey& other) const
+    {
+        return side == other.side && edge[0] == other.edge[0] && edge[1] == other.edge[1]
+            && facet == other.facet;
+    }
+};
+
+struct Segment
+{
+    PointKey ends[2];
+    FacetIndex facets[2];
+};
+
+// A part of a facet that is bounded by its edges and the intersection segments
+struct Region
+{
+    int side;
+    FacetIndex facet;
+};
+
+struct Piece
+{
+    std::array<PointIndex, 3> points;
+    std::size_t region;
+};
+
+// A part of an edge of the original mesh that bounds a region
+struct RegionEdge
+{
+    std::array<PointIndex, 2> points;
+    std::size_t region;
+};
+
+struct FacetParts
+{
+    std::size_t numRegions {0};
+    std::vector<Piece> pieces;
+    std::vector<RegionEdge> edges;
+};
+
+class BooleanContext
+{
+public:
+    BooleanContext(const MeshKernel& mesh1, const MeshKernel& mesh2, int threads)
+        : meshes {&mesh1, &mesh2}
+        , threads(threads)
+    {
+        offset[0] = 0;
+        offset[1] = mesh1.CountPoints();
+        points.reserve(mesh1.CountPoints() + mesh2.CountPoints());
+        for (const MeshKernel* mesh : meshes) {
+            for (const auto& it : mesh->GetPoints()) {
+                points.push_back(Point {double(it.x), double(it.y), double(it.z)});
+            }
+        }
+    }
+
+    void computeSegments();
+    void computePoints();
+    void cutFacets();
+    void classify();
+    void assemble(SetOperations::OperationType opType, MeshKernel& result) const;
+
+    std::size_t countSegments() const
+    {
+        return segments.size();
+    }
+    std::size_t countFailures() const
+    {
+        return failures;
+    }
+
+private:
+    const Point& point(int side, PointIndex index) const
+    {
+        return points[offset[side] + index];
+    }
+    std::array<const Point*, 3> corners(int side, FacetIndex index) const
+    {
+        const MeshFacet& facet = meshes[side]->GetFacets()[index];
+        return {&point(side, facet._aulPoints[0]),
+                &point(side, facet._aulPoints[1]),
+                &point(side, facet._aulPoints[2])};
+    }
+    PointIndex pointId(const PointKey& key) const
+    {
+        auto it = std::lower_bound(keys.begin(), keys.end(), key);
+        return PointIndex(offset[1] + meshes[1]->CountPoints() + (it - keys.begin()));
+    }
+    bool intersect(FacetIndex index1, FacetIndex index2, std::vector<PointKey>& ends) const;
+    bool cutFacet(int side,
+                  FacetIndex index,
+                  const std::vector<std::size_t>& segs,
+                  FacetParts& result) const;
+    std::vector<double> windingNumbers(int side, const std::vector<Point>& queries) const;
+
+private:
+    std::array<const MeshKernel*, 2> meshes;
+    std::array<std::size_t, 2> offset {};
+    int threads;
+    std::vector<Point> points;
+    std::vector<Segment> segments;
+    std::vector<PointKey> keys;
+    std::vector<Region> regions;
+    std::vector<Piece> pieces;
+    std::vector<RegionEdge> regionEdges;
+    std::vector<bool> inside;
+    std::size_t failures {0};
+};
+
+// Tests the facet index1 of the first mesh against the facet index2 of the second mesh and
+// collects the intersection points. Generically there are either none or two of them.
+bool BooleanContext::intersect(FacetIndex index1,
+                               FacetIndex index2,
+                               std::vector<PointKey>& ends) const
+{
+    ends.clear();
+    std::array<FacetIndex, 2> index {index1, index2};
+    std::array<std::array<const Point*, 3>, 2> tria {corners(0, index1), corners(1, index2)};
+    std::array<std::array<int, 3>, 2> sides {};
+    for (int side = 0; side < 2; side++) {
+        const auto& plane = tria[1 - side];
+        for (int i = 0; i < 3; i++) {
+            sides[side][i] =
+                orientPoint(*plane[0], *plane[1], *plane[2], *tria[side][i], side == 0);
+        }
+        if (sides[side][0] == sides[side][1] && sides[side][1] == sides[side][2]) {
+            return true;
+        }
+    }
+
+    for (int side = 0; side < 2; side++) {
+        const MeshFacet& facet = meshes[side]->GetFacets()[index[side]];
+        const auto& other = tria[1 - side];
+        for (int i = 0; i < 3; i++) {
+            int j = (i + 1) % 3;
+            if (sides[side][i] == sides[side][j]) {
+                continue;
+            }
+            PointIndex u = facet._aulPoints[i];
+            PointIndex v = facet._aulPoints[j];
+            if (u > v) {
+                std::swap(u, v);
+            }
+            const Point& p = point(side, u);
+            const Point& q = point(side, v);
+            bool moved = side == 1;
+            int s0 = orientEdges(p, q, *other[0], *other[1], moved);
+            int s1 = orientEdges(p, q, *other[1], *other[2], moved);
+            int s2 = orientEdges(p, q, *other[2], *other[0], moved);
+            if (s0 != 0 && s0 == s1 && s1 == s2) {
+                ends.push_back(PointKey {side, {u, v}, index[1 - side]});
+            }
+        }
+    }
+
+    return ends.empty() || ends.size() == 2;
+}
+
+void BooleanContext::computeSegments()
+{
+    MeshFacetBVH bvh(*meshes[1]);
+    const MeshFacetArray& facets = meshes[0]->GetFacets();
+
+    std::mutex mutex;
+    parallel_for(facets.size(), threads, [&](std::size_t begin, std::size_t end) {
+        std::vector<Segment> local;
+        std::vector<FacetIndex> candidates;
+        std::vector<PointKey> ends;
+        std::size_t errors = 0;
+        for (std::size_t index = begin; index < end; index++) {
+            Base::BoundBox3f box;
+            for (PointIndex it : facets[index]._aulPoints) {
+                box.Add(meshes[0]->GetPoint(it));
+            }
+            candidates.clear();
+            bvh.Inside(box, candidates);
+            for (FacetIndex it : candidates) {
+                if (!intersect(FacetIndex(index), it, ends)) {
+                    errors++;
+                }
+                else if (ends.size() == 2) {
+                    local.push_back(Segment {{ends[0], ends[1]}, {FacetIndex(index), it}});
+                }
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        segments.insert(segments.end(), local.begin(), local.end());
+        failures += errors;
+    });
+}
+
+void BooleanContext::computePoints()
+{
+    keys.reserve(2 * segments.size());
+    for (const auto& it : segments) {
+        keys.push_back(it.ends[0]);
+        keys.push_back(it.ends[1]);
+    }
+    std::sort(keys.begin(), keys.end());
+    keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+
+    // the intersection of the edge with the plane of the facet
+    points.resize(offset[1] + meshes[1]->CountPoints() + keys.size());
+    std::size_t first = offset[1] + meshes[1]->CountPoints();
+    parallel_for(keys.size(), threads, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t index = begin; index < end; index++) {
+            const PointKey& key = keys[index];
+            const Point& p = point(key.side, key.edge[0]);
+            const Point& q = point(key.side, key.edge[1]);
+            auto tria = corners(1 - key.side, key.facet);
+            Point u {};
+            Point v {};
+            for (int i = 0; i < 3; i++) {
+                u[i] = (*tria[1])[i] - (*tria[0])[i];
+                v[i] = (*tria[2])[i] - (*tria[0])[i];
+            }
+            Point normal {u[1] * v[2] - u[2] * v[1],
+                          u[2] * v[0] - u[0] * v[2],
+                          u[0] * v[1] - u[1] * v[0]};
+            double dp = 0.0;
+            double dq = 0.0;
+            for (int i = 0; i < 3; i++) {
+                dp += normal[i] * (p[i] - (*tria[0])[i]);
+                dq += normal[i] * (q[i] - (*tria[0])[i]);
+            }
+            double param = dp != dq ? std::clamp(dp / (dp - dq), 0.0, 1.0) : 0.5;
+            Point& result = points[first + index];
+            for (int i = 0; i < 3; i++) {
+                result[i] = p[i] + param * (q[i] - p[i]);
+            }
+        }
+    });
+}
+
+// --------------------------------------------------------------------------------------------
+
+using Point2 = std::array<double, 2>;
+
+double cross2(const Point2& a, const Point2& b, const Point2& c)
+{
+    return (b[0] - a[0]) * (c[1] - a[1]) - (b[1] - a[1]) * (c[0] - a[0]);
+}
+
+double signedArea(const std::vector<Point2>& poly)
+{
+    double area = 0.0;
+    for (std::size_t i = 0, j = poly.size() - 1; i < poly.size(); j = i++) {
+        area += poly[j][0] * poly[i][1] - poly[i][0] * poly[j][1];
+    }
+    return 0.5 * area;
+}
+
+bool insidePolygon(const std::vector<Point2>& poly, const Point2& pnt)
+{
+    bool inside = false;
+    for (std::size_t i = 0, j = poly.size() - 1; i < poly.size(); j = i++) {
+        if ((poly[i][1] > pnt[1]) != (poly[j][1] > pnt[1])) {
+            double x = poly[j][0]
+                + (pnt[1] - poly[j][1]) * (poly[i][0] - poly[j][0]) / (poly[i][1] - poly[j][1]);
+            if (pnt[0] < x) {
+                inside = !inside;
+            }
+        }
+    }
+    return inside;
+}
+
+bool segmentsCross(const Point2& a, const Point2& b, const Point2& c, const Point2& d)
+{
+    double d1 = cross2(a, b, c);
+    double d2 = cross2(a, b, d);
+    double d3 = cross2(c, d, a);
+    double d4 = cross2(c, d, b);
+    return ((d1 > 0.0 && d2 < 0.0) || (d1 < 0.0 && d2 > 0.0))
+        && ((d3 > 0.0 && d4 < 0.0) || (d3 < 0.0 && d4 > 0.0));
+}
+
+// Triangulates the simple polygon (possibly with bridge edges) by ear clipping. Intersection
+// points that are only separated by the symbolic perturbation may coincide numerically, so
+// flat ears are accepted if there is no proper ear. If no valid ear is found at all the most
+// convex corner is clipped and false is returned.
+bool triangulate(std::vector<PointIndex> poly,
+                 const std::unordered_map<PointIndex, Point2>& coords,
+                 double tolerance,
+                 std::vector<std::array<PointIndex, 3>>& result)
+{
+    auto at = [&coords](PointIndex index) {
+        return coords.at(index);
+    };
+    // a proper ear must not touch any other point, a flat ear must not contain one
+    auto isEar = [&](std::size_t i, bool flat) {
+        std::size_t n = poly.size();
+        PointIndex a = poly[(i + n - 1) % n];
+        PointIndex b = poly[i];
+        PointIndex c = poly[(i + 1) % n];
+        Point2 pa = at(a);
+        Point2 pb = at(b);
+        Point2 pc = at(c);
+        if (cross2(pa, pb, pc) <= (flat ? -tolerance : tolerance)) {
+            return false;
+        }
+        double limit = flat ? tolerance : -tolerance;
+        for (PointIndex it : poly) {
+            Point2 pt = at(it);
+            if (it == a || it == b || it == c || pt == pa || pt == pb || pt == pc) {
+                continue;
+            }
+            if (cross2(pa, pb, pt) > limit && cross2(pb, pc, pt) > limit
+                && cross2(pc, pa, pt) > limit) {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    bool ok = true;
+    std::size_t start = 0;
+    while (poly.size() > 3) {
+        std::size_t n = poly.size();
+        std::size_t ear = n;
+        for (bool flat : {false, true}) {
+            for (std::size_t k = 0; k < n && ear == n; k++) {
+                std::size_t i = (start + k) % n;
+                if (isEar(i, flat)) {
+                    ear = i;
+                }
+            }
+        }
+        if (ear == n) {
+            ok = false;
+            double best = -std::numeric_limits<double>::max();
+            for (std::size_t i = 0; i < n; i++) {
+                double value =
+                    cross2(at(poly[(i + n - 1) % n]), at(poly[i]), at(poly[(i + 1) % n]));
+                if (value > best) {
+                    best = value;
+                    ear = i;
+                }
+            }
+        }
+
+        result.push_back({poly[(ear + n - 1) % n], poly[ear], poly[(ear + 1) % n]});
+        poly.erase(poly.begin() + std::ptrdiff_t(ear));
+        start = ear > 0 ? ear - 1 : 0;
+    }
+
+    if (cross2(at(poly[0]), at(poly[1]), at(poly[2])) < -tolerance) {
+        ok = false;
+    }
+    result.push_back({poly[0], poly[1], poly[2]});
+    return ok;
+}
+
+// Cuts a facet along the intersection segments and triangulates the parts. The segments form
+// either chains between two points on the boundary or closed loops inside the facet.
+bool BooleanContext::cutFacet(int side,
+                              FacetIndex index,
+                              const std::vector<std::size_t>& segs,
+                              FacetParts& result) const
+{
+    const MeshFacet& facet = meshes[side]->GetFacets()[index];
+    std::array<PointIndex, 3> corner {};
+    for (int i = 0; i < 3; i++) {
+        corner[i] = PointIndex(offset[side] + facet._aulPoints[i]);
+    }
+
+    // project onto the plane with the dominant normal direction and keep the orientation
+    auto tria = corners(side, index);
+    Point normal {};
+    for (int i = 0; i < 3; i++) {
+        int j = (i + 1) % 3;
+        int k = (i + 2) % 3;
+        normal[i] = ((*tria[1])[j] - (*tria[0])[j]) * ((*tria[2])[k] - (*tria[0])[k])
+            - ((*tria[1])[k] - (*tria[0])[k]) * ((*tria[2])[j] - (*tria[0])[j]);
+    }
+    int axis = 0;
+    for (int i = 1; i < 3; i++) {
+        if (std::abs(normal[i]) > std::abs(normal[axis])) {
+            axis = i;
+        }
+    }
+    int axisX = (axis + 1) % 3;
+    int axisY = (axis + 2) % 3;
+    if (normal[axis] < 0.0) {
+        std::swap(axisX, axisY);
+    }
+
+    std::unordered_map<PointIndex, Point2> coords;
+    auto addPoint = [&](PointIndex id) {
+        const Point& pnt = points[id];
+        coords[id] = Point2 {pnt[axisX], pnt[axisY]};
+    };
+    for (PointIndex it : corner) {
+        addPoint(it);
+    }
+
+    // the intersection points on the edges of the facet and the adjacency of all points
+    std::array<std::vector<std::pair<double, PointIndex>>, 3> edgePoints;
+    std::unordered_map<PointIndex, std::vector<PointIndex>> adjacency;
+    for (std::size_t it : segs) {
+        const Segment& seg = segments[it];
+        std::array<PointIndex, 2> ids {};
+        for (int i = 0; i < 2; i++) {
+            const PointKey& key = seg.ends[i];
+            ids[i] = pointId(key);
+            if (coords.find(ids[i]) != coords.end()) {
+                continue;
+            }
+            addPoint(ids[i]);
+            if (key.side != side) {
+                continue;
+            }
+            for (int j = 0; j < 3; j++) {
+                PointIndex u = facet._aulPoints[j];
+                PointIndex v = facet._aulPoints[(j + 1) % 3];
+                if (std::min(u, v) == key.edge[0] && std::max(u, v) == key.edge[1]) {
+                    const Point& p = point(side, key.edge[0]);
+                    const Point& q = point(side, key.edge[1]);
+                    const Point& x = points[ids[i]];
+                    double len = 0.0;
+                    double dot = 0.0;
+                    for (int k = 0; k < 3; k++) {
+                        len += (q[k] - p[k]) * (q[k] - p[k]);
+                        dot += (x[k] - p[k]) * (q[k] - p[k]);
+                    }
+                    double param = len > 0.0 ? dot / len : 0.0;
+                    edgePoints[j].emplace_back(u < v ? param : 1.0 - param, ids[i]);
+                }
+            }
+        }
+        adjacency[ids[0]].push_back(ids[1]);
+        adjacency[ids[1]].push_back(ids[0]);
+    }
+
+    std::vector<PointIndex> ring;
+    std::unordered_set<PointIndex> boundary;
+    for (int i = 0; i < 3; i++) {
+        ring.push_back(corner[i]);
+        auto& list = edgePoints[i];
+        std::sort(list.begin(), list.end());
+        for (const auto& it : list) {
+            ring.push_back(it.second);
+            boundary.insert(it.second);
+        }
+    }
+    for (const auto& it : adjacency) {
+        std::size_t degree = boundary.count(it.first) > 0 ? 1 : 2;
+        if (it.second.size() != degree) {
+            return false;
+        }
+    }
+
+    // split the facet into regions along the chains, then insert the loops
+    std::vector<std::vector<PointIndex>> regions {ring};
+    std::unordered_map<PointIndex, bool> visited;
+    auto walk = [&](PointIndex first) {
+        std::vector<PointIndex> path {first};
+        visited[first] = true;
+        PointIndex prev = first;
+        PointIndex next = adjacency[first].front();
+        while (!visited[next]) {
+            path.push_back(next);
+            visited[next] = true;
+            const auto& neighbours = adjacency[next];
+            PointIndex other = neighbours.front() == prev ? neighbours.back() : neighbours.front();
+            prev = next;
+            next = other;
+        }
+        return path;
+    };
+
+    for (const auto& it : ring) {
+        if (boundary.count(it) == 0 || visited[it]) {
+            continue;
+        }
+        std::vector<PointIndex> chain = walk(it);
+        PointIndex u = chain.front();
+        PointIndex w = chain.back();
+        if (chain.size() < 2 || boundary.count(w) == 0) {
+            return false;
+        }
+
+        bool split = false;
+        for (std::size_t r = 0; r < regions.size() && !split; r++) {
+            auto& region = regions[r];
+            auto iu = std::find(region.begin(), region.end(), u);
+            auto iw = std::find(region.begin(), region.end(), w);
+            if (iu == region.end() || iw == region.end()) {
+                continue;
+            }
+            std::size_t n = region.size();
+            std::size_t a = iu - region.begin();
+            std::size_t b = iw - region.begin();
+            std::vector<PointIndex> first;
+            std::vector<PointIndex> second;
+            for (std::size_t i = a; i != b; i = (i + 1) % n) {
+                first.push_back(region[i]);
+            }
+            first.push_back(region[b]);
+            first.insert(first.end(), chain.rbegin() + 1, chain.rend() - 1);
+            for (std::size_t i = b; i != a; i = (i + 1) % n) {
+                second.push_back(region[i]);
+            }
+            second.push_back(region[a]);
+            second.insert(second.end(), chain.begin() + 1, chain.end() - 1);
+            region = std::move(first);
+            regions.push_back(std::move(second));
+            split = true;
+        }
+        if (!split) {
+            return false;
+        }
+    }
+
+    auto toPolygon = [&coords](const std::vector<PointIndex>& ids) {
+        std::vector<Point2> poly;
+        poly.reserve(ids.size());
+        for (PointIndex it : ids) {
+            poly.push_back(coords.at(it));
+        }
+        return poly;
+    };
+
+    std::vector<std::pair<double, std::vector<PointIndex>>> loops;
+    for (const auto& it : adjacency) {
+        if (!visited[it.first]) {
+            std::vector<PointIndex> loop = walk(it.first);
+            double area = signedArea(toPolygon(loop));
+            if (area < 0.0) {
+                std::reverse(loop.begin(), loop.end());
+            }
+            loops.emplace_back(std::abs(area), std::move(loop));
+        }
+    }
+    std::sort(loops.begin(), loops.end(), [](const auto& a, const auto& b) {
+        return a.first > b.first;
+    });
+
+    for (auto& it : loops) {
+        std::vector<PointIndex>& loop = it.second;
+        std::vector<Point2> hole = toPolygon(loop);
+        std::size_t r = 0;
+        while (r < regions.size() && !insidePolygon(toPolygon(regions[r]), hole.front())) {
+            r++;
+        }
+        if (r == regions.size() || loop.size() < 3) {
+            return false;
+        }
+
+        // connect the rightmost point of the loop with the nearest visible point of the region
+        std::vector<PointIndex>& region = regions[r];
+        std::vector<Point2> outer = toPolygon(region);
+        std::size_t m = 0;
+        for (std::size_t i = 1; i < hole.size(); i++) {
+            if (hole[i][0] > hole[m][0]) {
+                m = i;
+            }
+        }
+        std::vector<std::size_t> order(region.size());
+        std::iota(order.begin(), order.end(), 0);
+        auto distance = [&](std::size_t i) {
+            return std::hypot(outer[i][0] - hole[m][0], outer[i][1] - hole[m][1]);
+        };
+        std::sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b) {
+            return distance(a) < distance(b);
+        });
+        auto visible = [&](std::size_t i) {
+            auto crosses = [&](const std::vector<Point2>& poly) {
+                for (std::size_t k = 0, l = poly.size() - 1; k < poly.size(); l = k++) {
+                    if (segmentsCross(hole[m], outer[i], poly[l], poly[k])) {
+                        return true;
+                    }
+                }
+                return false;
+            };
+            return !crosses(outer) && !crosses(hole);
+        };
+        auto bridge = std::find_if(order.begin(), order.end(), visible);
+        if (bridge == order.end()) {
+            return false;
+        }
+
+        std::size_t b = *bridge;
+        std::vector<PointIndex> merged(region.begin(), region.begin() + std::ptrdiff_t(b) + 1);
+        for (std::size_t k = 0; k <= loop.size(); k++) {
+            merged.push_back(loop[(m + loop.size() - k) % loop.size()]);
+        }
+        merged.insert(merged.end(), region.begin() + std::ptrdiff_t(b), region.end());
+        region = std::move(merged);
+        regions.push_back(std::move(loop));
+    }
+
+    // the rounding error of the intersection points scales with their magnitude
+    double minX = std::numeric_limits<double>::max();
+    double maxX = -minX;
+    double minY = minX;
+    double maxY = -minX;
+    double magnitude = 0.0;
+    for (const auto& it : coords) {
+        minX = std::min(minX, it.second[0]);
+        maxX = std::max(maxX, it.second[0]);
+        minY = std::min(minY, it.second[1]);
+        maxY = std::max(maxY, it.second[1]);
+        magnitude = std::max({magnitude, std::abs(it.second[0]), std::abs(it.second[1])});
+    }
+    double size = std::max(maxX - minX, maxY - minY);
+    double tolerance = 64.0 * DBL_EPSILON * magnitude * size;
+
+    // the regions are connected to the neighbour facets only by the parts of the facet edges
+    std::vector<std::pair<PointIndex, PointIndex>> ringEdges;
+    for (std::size_t i = 0; i < ring.size(); i++) {
+        ringEdges.emplace_back(ring[i], ring[(i + 1) % ring.size()]);
+    }
+    std::sort(ringEdges.begin(), ringEdges.end());
+
+    bool ok = true;
+    std::vector<std::array<PointIndex, 3>> triangles;
+    for (std::size_t r = 0; r < regions.size(); r++) {
+        const auto& region = regions[r];
+        for (std::size_t i = 0; i < region.size(); i++) {
+            auto edge = std::make_pair(region[i], region[(i + 1) % region.size()]);
+            if (std::binary_search(ringEdges.begin(), ringEdges.end(), edge)) {
+                result.edges.push_back(RegionEdge {{edge.first, edge.second}, r});
+            }
+        }
+        triangles.clear();
+        ok = triangulate(region, coords, tolerance, triangles) && ok;
+        for (const auto& it : triangles) {
+            result.pieces.push_back(Piece {it, r});
+        }
+    }
+    result.numRegions = regions.size();
+    return ok;
+}
+
+void BooleanContext::cutFacets()
+{
+    // the segments of each facet
+    std::array<std::vector<std::pair<FacetIndex, std::size_t>>, 2> facetSegments;
+    for (std::size_t i = 0; i < segments.size(); i++) {
+        for (int side = 0; side < 2; side++) {
+            facetSegments[side].emplace_back(segments[i].facets[side], i);
+        }
+    }
+
+    for (int side = 0; side < 2; side++) {
+        auto& list = facetSegments[side];
+        std::sort(list.begin(), list.end());
+
+        std::vector<FacetIndex> cut;
+        std::vector<std::vector<std::size_t>> cutSegments;
+        for (const auto& it : list) {
+            if (cut.empty() || cut.back() != it.first) {
+                cut.push_back(it.first);
+                cutSegments.emplace_back();
+            }
+            cutSegments.back().push_back(it.second);
+        }
+
+        std::vector<FacetParts> parts(cut.size());
+        std::mutex mutex;
+        parallel_for(cut.size(), threads, [&](std::size_t begin, std::size_t end) {
+            std::size_t errors = 0;
+            for (std::size_t i = begin; i < end; i++) {
+                if (!cutFacet(side, cut[i], cutSegments[i], parts[i])) {
+                    parts[i] = FacetParts();
+                    errors++;
+                }
+            }
+            std::lock_guard<std::mutex> lock(mutex);
+            failures += errors;
+        });
+
+        // a facet that isn't cut or that failed is kept as a whole
+        const MeshFacetArray& facets = meshes[side]->GetFacets();
+        std::size_t next = 0;
+        for (FacetIndex index = 0; index < facets.size(); index++) {
+            std::size_t first = regions.size();
+            if (next < cut.size() && cut[next] == index) {
+                const FacetParts& part = parts[next++];
+                if (part.numRegions > 0) {
+                    regions.insert(regions.end(), part.numRegions, Region {side, index});
+                    for (Piece it : part.pieces) {
+                        it.region += first;
+                        pieces.push_back(it);
+                    }
+                    for (RegionEdge it : part.edges) {
+                        it.region += first;
+                        regionEdges.push_back(it);
+                    }
+                    continue;
+                }
+            }
+
+            const MeshFacet& facet = facets[index];
+            Piece piece {{}, first};
+            for (int i = 0; i < 3; i++) {
+                piece.points[i] = PointIndex(offset[side] + facet._aulPoints[i]);
+            }
+            for (int i = 0; i < 3; i++) {
+                regionEdges.push_back(
+                    RegionEdge {{piece.points[i], piece.points[(i + 1) % 3]}, first});
+            }
+            regions.push_back(Region {side, index});
+            pieces.push_back(piece);
+        }
+    }
+}
+
+// --------------------------------------------------------------------------------------------
+
+// The generalized winding numbers of the query points with respect to the given mesh
+std::vector<double> BooleanContext::windingNumbers(int side,
+                                                   const std::vector<Point>& queries) const
+{
+    std::vector<double> result(queries.size(), 0.0);
+    const MeshFacetArray& facets = meshes[side]->GetFacets();
+    std::mutex mutex;
+    parallel_for(facets.size(), threads, [&](std::size_t begin, std::size_t end) {
+        std::vector<double> local(queries.size(), 0.0);
+        for (std::size_t index = begin; index < end; index++) {
+            auto tria = corners(side, FacetIndex(index));
+            for (std::size_t q = 0; q < queries.size(); q++) {
+                std::array<Point, 3> v {};
+                std::array<double, 3> len {};
+                for (int i = 0; i < 3; i++) {
+                    for (int k = 0; k < 3; k++) {
+                        v[i][k] = (*tria[i])[k] - queries[q][k];
+                    }
+                    len[i] = std::sqrt(v[i][0] * v[i][0] + v[i][1] * v[i][1] + v[i][2] * v[i][2]);
+                }
+                auto dot = [](const Point& a, const Point& b) {
+                    return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+                };
+                double det = v[0][0] * (v[1][1] * v[2][2] - v[1][2] * v[2][1])
+                    - v[0][1] * (v[1][0] * v[2][2] - v[1][2] * v[2][0])
+                    + v[0][2] * (v[1][0] * v[2][1] - v[1][1] * v[2][0]);
+                double div = len[0] * len[1] * len[2] + dot(v[0], v[1]) * len[2]
+                    + dot(v[0], v[2]) * len[1] + dot(v[1], v[2]) * len[0];
+                local[q] += 2.0 * std::atan2(det, div);
+            }
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        for (std::size_t q = 0; q < queries.size(); q++) {
+            result[q] += local[q];
+        }
+    });
+
+    for (double& it : result) {
+        it /= 4.0 * std::numbers::pi;
+    }
+    return result;
+}
+
+// Groups the regions of each mesh into patches that are bounded by the intersection curves
+// and tests for each patch if it's inside the other mesh
+void BooleanContext::classify()
+{
+    std::vector<std::size_t> parent(regions.size());
+    std::iota(parent.begin(), parent.end(), 0);
+    auto find = [&parent](std::size_t index) {
+        while (parent[index] != index) {
+            parent[index] = parent[parent[index]];
+            index = parent[index];
+        }
+        return index;
+    };
+
+    // the parts of the original edges are shared by exactly the regions of adjacent facets
+    auto lessEdge = [](const RegionEdge& a, const RegionEdge& b) {
+        return std::minmax(a.points[0], a.points[1]) < std::minmax(b.points[0], b.points[1]);
+    };
+    parallel_sort(regionEdges.begin(), regionEdges.end(), lessEdge, threads);
+    for (std::size_t i = 0, j = 0; i < regionEdges.size(); i = j) {
+        while (j < regionEdges.size() && !lessEdge(regionEdges[i], regionEdges[j])) {
+            j++;
+        }
+        for (std::size_t k = i + 1; k < j; k++) {
+            parent[find(regionEdges[k].region)] = find(regionEdges[i].region);
+        }
+    }
+
+    // evaluate the winding number for the largest piece of each patch slightly moved off the
+    // surface into the direction the symbolic perturbation moves it relative to the other mesh
+    Base::BoundBox3f box = meshes[0]->GetBoundBox();
+    box.Add(meshes[1]->GetBoundBox());
+    double delta = 1e-9 * box.CalcDiagonalLength();
+
+    std::vector<double> largest(regions.size(), -1.0);
+    std::vector<std::size_t> representative(regions.size(), pieces.size());
+    for (std::size_t index = 0; index < pieces.size(); index++) {
+        const auto& pts = pieces[index].points;
+        Point u {};
+        Point v {};
+        for (int i = 0; i < 3; i++) {
+            u[i] = points[pts[1]][i] - points[pts[0]][i];
+            v[i] = points[pts[2]][i] - points[pts[0]][i];
+        }
+        Point n {u[1] * v[2] - u[2] * v[1], u[2] * v[0] - u[0] * v[2], u[0] * v[1] - u[1] * v[0]};
+        double area = n[0] * n[0] + n[1] * n[1] + n[2] * n[2];
+        std::size_t root = find(pieces[index].region);
+        if (area > largest[root]) {
+            largest[root] = area;
+            representative[root] = index;
+        }
+    }
+
+    std::array<std::vector<Point>, 2> queries;
+    std::vector<std::size_t> queryIndex(regions.size(), 0);
+    for (std::size_t root = 0; root < regions.size(); root++) {
+        std::size_t index = representative[root];
+        if (index == pieces.size()) {
+            continue;
+        }
+        const Piece& piece = pieces[index];
+        const Region& region = regions[piece.region];
+        Point center {};
+        for (PointIndex it : piece.points) {
+            for (int i = 0; i < 3; i++) {
+                center[i] += points[it][i] / 3.0;
+            }
+        }
+
+        auto tria = corners(region.side, region.facet);
+        Point n {};
+        for (int i = 0; i < 3; i++) {
+            int j = (i + 1) % 3;
+            int k = (i + 2) % 3;
+            n[i] = ((*tria[1])[j] - (*tria[0])[j]) * ((*tria[2])[k] - (*tria[0])[k])
+                - ((*tria[1])[k] - (*tria[0])[k]) * ((*tria[2])[j] - (*tria[0])[j]);
+        }
+        int dir = 0;
+        for (int axis = 0; axis < 3 && dir == 0; axis++) {
+            dir = crossSign(*tria[0], *tria[1], *tria[2], *tria[0], axis);
+        }
+        double len = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+        if (len > 0.0) {
+            double shift = (region.side == 0 ? -1.0 : 1.0) * dir * delta / len;
+            for (int i = 0; i < 3; i++) {
+                center[i] += shift * n[i];
+            }
+        }
+
+        queryIndex[root] = queries[region.side].size();
+        queries[region.side].push_back(center);
+    }
+
+    std::array<std::vector<double>, 2> winding {windingNumbers(1, queries[0]),
+                                                windingNumbers(0, queries[1])};
+    inside.resize(regions.size());
+    for (std::size_t index = 0; index < regions.size(); index++) {
+        std::size_t root = find(index);
+        inside[index] = winding[regions[index].side][queryIndex[root]] > 0.5;
+    }
+}
+
+void BooleanContext::assemble(SetOperations::OperationType opType, MeshKernel& result) const
+{
+    // which pieces to keep and whether to flip them
+    auto keep = [opType](int side, bool inside, bool& flip) {
+        flip = false;
+        switch (opType) {
+            case SetOperations::Union:
+                return !inside;
+            case SetOperations::Intersect:
+                return inside;
+            case SetOperations::Difference:
+                flip = side == 1;
+                return side == 0 ? !inside : inside;
+            case SetOperations::Inner:
+                return side == 0 && inside;
+            case SetOperations::Outer:
+                return side == 0 && !inside;
+        }
+        return false;
+    };
+
+    std::vector<PointIndex> mapping(points.size(), POINT_INDEX_MAX);
+    MeshPointArray rPoints;
+    MeshFacetArray rFacets;
+    for (std::size_t index = 0; index < pieces.size(); index++) {
+        const Piece& piece = pieces[index];
+        bool flip {};
+        if (!keep(regions[piece.region].side, inside[piece.region], flip)) {
+            continue;
+        }
+        MeshFacet facet;
+        for (int i = 0; i < 3; i++) {
+            PointIndex id = piece.points[i];
+            if (mapping[id] == POINT_INDEX_MAX) {
+                mapping[id] = PointIndex(rPoints.size());
+                const Point& pnt = points[id];
+                rPoints.push_back(
+                    MeshPoint(Base::Vector3f(float(pnt[0]), float(pnt[1]), float(pnt[2]))));
+            }
+            facet._aulPoints[i] = mapping[id];
+        }
+        if (flip) {
+            std::swap(facet._aulPoints[1], facet._aulPoints[2]);
+        }
+        rFacets.push_back(facet);
+    }
+
+    result.Adopt(rPoints, rFacets, true);
+}
+
+}  // namespace
+
+// --------------------------------------------------------------------------------------------
+
+MeshBoolean::MeshBoolean(const MeshKernel& mesh1,
+                         const MeshKernel& mesh2,
+                         MeshKernel& result,
+                         SetOperations::OperationType opType)
+    : myMesh1(mesh1)
+    , myMesh2(mesh2)
+    , myResult(result)
+    , myOpType(opType)
+{}
+
+void MeshBoolean::SetThreads(int num)
+{
+    threads = num;
+}
+
+bool MeshBoolean::Do()
+{
+    int numThreads = threads > 0 ? threads : int(std::thread::hardware_concurrency());
+    BooleanContext context(myMesh1, myMesh2, numThreads);
+    context.computeSegments();
+    context.computePoints();
+    context.cutFacets();
+    context.classify();
+    context.assemble(myOpType, myResult);
+
+    numSegments = context.countSegments();
+    numFailed = context.countFailures();
+    return numFailed == 0;
+}
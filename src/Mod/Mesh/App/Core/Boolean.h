@@ -0,0 +1,87 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 The FreeCAD Project Association                     *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+
+#ifndef MESH_BOOLEAN_H
+#define MESH_BOOLEAN_H
+
+#include <Mod/Mesh/MeshGlobal.h>
+
+#include "SetOperations.h"
+
+namespace MeshCore
+{
+class MeshKernel;
+
+/**
+ * The MeshBoolean class computes boolean operations of two closed meshes with exact
+ * predicates.
+ * All decisions about which edge crosses which facet are taken with adaptive exact
+ * arithmetic. Degenerate configurations like touching or coplanar facets are resolved by
+ * simulation of simplicity, i.e. as if the second mesh was moved by an infinitesimal
+ * amount. Thus the topology of the intersection curves is always consistent and unlike
+ * SetOperations no tolerance is needed. The facets are cut along the intersection curves
+ * and the resulting patches are classified with the generalized winding number.
+ * \note Coincident coplanar facets of both meshes are not merged. Depending on the
+ * operation they may remain as a double wall or as a thin sliver.
+ */
+class MeshExport MeshBoolean
+{
+public:
+    MeshBoolean(const MeshKernel& mesh1,
+                const MeshKernel& mesh2,
+                MeshKernel& result,
+                SetOperations::OperationType opType);
+
+    /** Sets the number of threads. A value < 1 uses all cores. */
+    void SetThreads(int num);
+    /** Computes the boolean operation.
+     * \return false if at least one facet couldn't be cut cleanly. Such a facet is kept as
+     * a whole and may leave a small gap in the result.
+     */
+    bool Do();
+    /** Returns the number of intersection segments of the last run. */
+    std::size_t CountIntersections() const
+    {
+        return numSegments;
+    }
+    /** Returns the number of facets of the last run that couldn't be cut cleanly. */
+    std::size_t CountFailedFacets() const
+    {
+        return numFailed;
+    }
+
+private:
+    const MeshKernel& myMesh1;
+    const MeshKernel& myMesh2;
+    MeshKernel& myResult;
+    SetOperations::OperationType myOpType;
+    int threads {0};
+    std::size_t numSegments {0};
+    std::size_t numFailed {0};
+};
+
+}  // namespace MeshCore
+
+
+#endif  // MESH_BOOLEAN_H
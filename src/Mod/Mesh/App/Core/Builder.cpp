@@ -24,6 +24,9 @@
 
 #ifndef _PreComp_
 #include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <thread>
 #endif
 
 #include <Base/Exception.h>
@@ -78,7 +81,7 @@ void MeshBuilder::Initialize(size_t ctFacets, bool deletion)
     }
     else {
         for (const auto& it1 : _meshKernel._aclPointArray) {
-            MeshPointIterator pit = _points.insert(it1);
+            MeshPointIterator pit = _points.insert(std::make_pair(it1, _pointsIterator.size()));
             _pointsIterator.push_back(pit);
         }
         _ptIdx = _points.size();
@@ -143,16 +146,15 @@ void MeshBuilder::AddFacet(Base::Vector3f* facetPoints, unsigned char flag, unsi
     int i = 0;
     for (i = 0; i < 3; i++) {
         MeshPoint pt(facetPoints[i]);
-        std::set<MeshPoint>::iterator p = _points.find(pt);
+        auto p = _points.find(pt);
         if (p == _points.end()) {
             mf._aulPoints[i] = _ptIdx;
-            pt._ulProp = _ptIdx++;
             // keep an iterator to the right vertex
-            MeshPointIterator it = _points.insert(pt);
+            MeshPointIterator it = _points.insert(std::make_pair(pt, _ptIdx++));
             _pointsIterator.push_back(it);
         }
         else {
-            mf._aulPoints[i] = p->_ulProp;
+            mf._aulPoints[i] = p->second;
         }
     }
 
@@ -234,7 +236,7 @@ void MeshBuilder::Finish(bool freeMemory)
     PointIndex i = 0;
     _meshKernel._aclPointArray.resize(_pointsIterator.size());
     for (const auto& it : _pointsIterator) {
-        _meshKernel._aclPointArray[i++] = *(it.first);
+        _meshKernel._aclPointArray[i++] = it.first->first;
     }
 
     // free all memory of the internal structures
@@ -400,3 +402,170 @@ void MeshFastBuilder::Finish()
 
     _meshKernel.Adopt(rPoints, rFacets, true);
 }
+
+// ----------------------------------------------------------------------------
+
+namespace
+{
+uint64_t hashPoint(const Base::Vector3f& pnt)
+{
+    auto bits = [](float value) {
+        // 0.0 and -0.0 compare equal and thus must have the same hash
+        if (value == 0.0F) {
+            value = 0.0F;
+        }
+        uint32_t word {};
+        std::memcpy(&word, &value, sizeof(word));
+        return static_cast<uint64_t>(word);
+    };
+
+    // combine the coordinates and finalize as in splitmix64
+    uint64_t hash = bits(pnt.x);
+    hash = (hash * 0x9E3779B97F4A7C15ULL) ^ bits(pnt.y);
+    hash = (hash * 0x9E3779B97F4A7C15ULL) ^ bits(pnt.z);
+    hash = (hash ^ (hash >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    hash = (hash ^ (hash >> 27)) * 0x94D049BB133111EBULL;
+    return hash ^ (hash >> 31);
+}
+
+bool samePoint(const Base::Vector3f& pnt1, const Base::Vector3f& pnt2)
+{
+    // the same exact comparison as done by MeshFastBuilder
+    return pnt1.x == pnt2.x && pnt1.y == pnt2.y && pnt1.z == pnt2.z;
+}
+}  // namespace
+
+MeshHashBuilder::MeshHashBuilder(MeshKernel& rclM)
+    : _meshKernel(rclM)
+{}
+
+void MeshHashBuilder::SetThreads(int num)
+{
+    _threads = num;
+}
+
+Base::Vector3f* MeshHashBuilder::Initialize(std::size_t ctFacets)
+{
+    _corners.resize(3 * ctFacets);
+    return _corners.data();
+}
+
+void MeshHashBuilder::Finish()
+{
+    const std::size_t numCorners = _corners.size();
+    int threads = _threads > 0 ? _threads : int(std::thread::hardware_concurrency());
+    // small meshes are not worth the overhead of spawning threads
+    const std::size_t minChunkSize = 10000;
+    threads = std::max(1, std::min<int>(threads, int(numCorners / minChunkSize)));
+    const auto numChunks = std::size_t(threads);
+    const std::size_t numParts = numChunks;
+
+    auto chunkBegin = [numCorners, numChunks](std::size_t chunk) {
+        return numCorners * chunk / numChunks;
+    };
+    auto partOf = [numParts](uint64_t hash) {
+        return std::size_t((hash >> 32) % numParts);
+    };
+
+    // Distribute the corners over the partitions by their hash. Inside a partition the corners
+    // keep their ascending order because the chunks are concatenated in order.
+    std::vector<std::size_t> offsets(numChunks * numParts + 1, 0);
+    parallel_for(numChunks, threads, [&](std::size_t first, std::size_t last) {
+        for (std::size_t chunk = first; chunk < last; chunk++) {
+            for (std::size_t i = chunkBegin(chunk); i < chunkBegin(chunk + 1); i++) {
+                offsets[partOf(hashPoint(_corners[i])) * numChunks + chunk + 1]++;
+            }
+        }
+    });
+    for (std::size_t i = 1; i < offsets.size(); i++) {
+        offsets[i] += offsets[i - 1];
+    }
+
+    std::vector<PointIndex> order(numCorners);
+    parallel_for(numChunks, threads, [&](std::size_t first, std::size_t last) {
+        for (std::size_t chunk = first; chunk < last; chunk++) {
+            std::vector<std::size_t> pos(numParts);
+            for (std::size_t part = 0; part < numParts; part++) {
+                pos[part] = offsets[part * numChunks + chunk];
+            }
+            for (std::size_t i = chunkBegin(chunk); i < chunkBegin(chunk + 1); i++) {
+                order[pos[partOf(hashPoint(_corners[i]))]++] = PointIndex(i);
+            }
+        }
+    });
+
+    // Each partition maps its corners to the first corner with the same coordinates using an
+    // open-addressing hash table
+    std::vector<PointIndex> firstOf(numCorners);
+    parallel_for(numParts, threads, [&](std::size_t first, std::size_t last) {
+        const PointIndex empty = POINT_INDEX_MAX;
+        std::vector<PointIndex> table;
+        for (std::size_t part = first; part < last; part++) {
+            std::size_t begin = offsets[part * numChunks];
+            std::size_t end = offsets[(part + 1) * numChunks];
+            std::size_t size = 16;
+            while (size < 2 * (end - begin)) {
+                size *= 2;
+            }
+            const std::size_t mask = size - 1;
+            table.assign(size, empty);
+
+            for (std::size_t j = begin; j < end; j++) {
+                PointIndex index = order[j];
+                const Base::Vector3f& pnt = _corners[index];
+                std::size_t slot = std::size_t(hashPoint(pnt)) & mask;
+                while (table[slot] != empty && !samePoint(_corners[table[slot]], pnt)) {
+                    slot = (slot + 1) & mask;
+                }
+                if (table[slot] == empty) {
+                    table[slot] = index;
+                }
+                firstOf[index] = table[slot];
+            }
+        }
+    });
+
+    order.clear();
+    order.shrink_to_fit();
+
+    // Number the unique points by their first occurrence
+    std::vector<std::size_t> numUnique(numChunks + 1, 0);
+    parallel_for(numChunks, threads, [&](std::size_t first, std::size_t last) {
+        for (std::size_t chunk = first; chunk < last; chunk++) {
+            for (std::size_t i = chunkBegin(chunk); i < chunkBegin(chunk + 1); i++) {
+                if (firstOf[i] == i) {
+                    numUnique[chunk + 1]++;
+                }
+            }
+        }
+    });
+    for (std::size_t i = 1; i < numUnique.size(); i++) {
+        numUnique[i] += numUnique[i - 1];
+    }
+
+    MeshPointArray rPoints(static_cast<PointIndex>(numUnique.back()));
+    MeshFacetArray rFacets(static_cast<FacetIndex>(numCorners / 3));
+    parallel_for(numChunks, threads, [&](std::size_t first, std::size_t last) {
+        for (std::size_t chunk = first; chunk < last; chunk++) {
+            PointIndex next = numUnique[chunk];
+            for (std::size_t i = chunkBegin(chunk); i < chunkBegin(chunk + 1); i++) {
+                if (firstOf[i] == i) {
+                    rPoints[next] = MeshPoint(_corners[i]);
+                    rFacets[i / 3]._aulPoints[i % 3] = next++;
+                }
+            }
+        }
+    });
+    parallel_for(numCorners, threads, [&](std::size_t first, std::size_t last) {
+        for (std::size_t i = first; i < last; i++) {
+            PointIndex index = firstOf[i];
+            if (index != i) {
+                rFacets[i / 3]._aulPoints[i % 3] = rFacets[index / 3]._aulPoints[index % 3];
+            }
+        }
+    });
+
+    _corners.clear();
+    _corners.shrink_to_fit();
+    _meshKernel.Adopt(rPoints, rFacets, true);
+}
@@ -23,6 +23,7 @@
 #ifndef MESH_BUILDER_H
 #define MESH_BUILDER_H
 
+#include <map>
 #include <set>
 #include <vector>
 
@@ -100,11 +101,11 @@ private:
     //@}
 
     MeshKernel& _meshKernel;
-    std::set<MeshPoint> _points;
+    std::map<MeshPoint, PointIndex> _points;
     Base::SequencerLauncher* _seq {nullptr};
 
-    // keep an array of iterators pointing to the vertex inside the set to save memory
-    using MeshPointIterator = std::pair<std::set<MeshPoint>::iterator, bool>;
+    // keep an array of iterators pointing to the vertex inside the map to save memory
+    using MeshPointIterator = std::pair<std::map<MeshPoint, PointIndex>::iterator, bool>;
     std::vector<MeshPointIterator> _pointsIterator;
     size_t _ptIdx {0};
 
@@ -228,6 +229,43 @@ private:
     Private* p;
 };
 
+/**
+ * Class for creating the mesh structure from a triangle soup where the three corner points of
+ * each facet are stored consecutively. Unlike MeshFastBuilder it doesn't sort the points to merge
+ * duplicates but uses hash tables that are distributed over several threads. The points of the
+ * resulting mesh are ordered by their first occurrence in the soup, so the result doesn't depend
+ * on the number of threads.
+ * \code
+ * MeshHashBuilder builder(someMeshReference);
+ * Base::Vector3f* corners = builder.Initialize(numberOfFacets);
+ * ... // write 3 * numberOfFacets points, possibly from several threads
+ * builder.Finish();
+ * \endcode
+ */
+class MeshExport MeshHashBuilder
+{
+public:
+    explicit MeshHashBuilder(MeshKernel& rclM);
+    ~MeshHashBuilder() = default;
+
+    MeshHashBuilder(const MeshHashBuilder&) = delete;
+    MeshHashBuilder(MeshHashBuilder&&) = delete;
+    MeshHashBuilder& operator=(const MeshHashBuilder&) = delete;
+    MeshHashBuilder& operator=(MeshHashBuilder&&) = delete;
+
+    /** Sets the number of threads used to merge the points. A value < 1 uses all cores. */
+    void SetThreads(int num);
+    /** Allocates the corner points for \a ctFacets facets and returns the start of the array. */
+    Base::Vector3f* Initialize(std::size_t ctFacets);
+    /** Merges identical points and adopts the result in the mesh kernel. */
+    void Finish();
+
+private:
+    MeshKernel& _meshKernel;
+    std::vector<Base::Vector3f> _corners;
+    int _threads {0};
+};
+
 }  // namespace MeshCore
 
 #endif
@@ -165,8 +165,8 @@ void MeshCurvature::ComputePerVertex()
 
         int iV0 = i;
         int iV1;
-        const std::set<unsigned long>& nb = pt2p[i];
-        for (std::set<unsigned long>::const_iterator it = nb.begin(); it != nb.end(); ++it) {
+        MeshIndexRange nb = pt2p[i];
+        for (MeshIndexRange::const_iterator it = nb.begin(); it != nb.end(); ++it) {
             iV1 = *it;
 
             // Compute edge from V0 to V1, project to tangent plane of vertex,
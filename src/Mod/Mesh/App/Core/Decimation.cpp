@@ -22,25 +22,35 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
 #include <limits>
+#include <mutex>
+#include <thread>
 #endif
 
+#include <Base/FileInfo.h>
+#include <Base/Stream.h>
+
+#include "Builder.h"
 #include "Decimation.h"
+#include "Elements.h"
+#include "Functional.h"
 #include "MeshKernel.h"
 #include "Simplify.h"
 
 
 using namespace MeshCore;
 
-MeshSimplify::MeshSimplify(MeshKernel& mesh)
-    : myKernel(mesh)
-{}
-
-void MeshSimplify::simplify(float tolerance, float reduction)
+namespace
 {
-    Simplify alg;
-
-    const MeshPointArray& points = myKernel.GetPoints();
+void initAlgorithm(Simplify& alg, const MeshKernel& kernel)
+{
+    const MeshPointArray& points = kernel.GetPoints();
+    alg.vertices.reserve(points.size());
     for (std::size_t i = 0; i < points.size(); i++) {
         Simplify::Vertex v;
         v.tstart = 0;
@@ -50,7 +60,8 @@ void MeshSimplify::simplify(float tolerance, float reduction)
         alg.vertices.push_back(v);
     }
 
-    const MeshFacetArray& facets = myKernel.GetFacets();
+    const MeshFacetArray& facets = kernel.GetFacets();
+    alg.triangles.reserve(facets.size());
     for (std::size_t i = 0; i < facets.size(); i++) {
         Simplify::Triangle t;
         t.deleted = 0;
@@ -63,13 +74,10 @@ void MeshSimplify::simplify(float tolerance, float reduction)
         }
         alg.triangles.push_back(t);
     }
+}
 
-    int target_count = static_cast<int>(static_cast<float>(facets.size()) * (1.0F - reduction));
-
-    // Simplification starts
-    alg.simplify_mesh(target_count, tolerance);
-
-    // Simplification done
+void adoptResult(const Simplify& alg, MeshKernel& kernel)
+{
     MeshPointArray new_points;
     new_points.reserve(alg.vertices.size());
     for (const auto& vertex : alg.vertices) {
@@ -94,64 +102,502 @@ void MeshSimplify::simplify(float tolerance, float reduction)
         }
     }
 
-    myKernel.Adopt(new_points, new_facets, true);
+    kernel.Adopt(new_points, new_facets, true);
 }
 
-void MeshSimplify::simplify(int targetSize)
+// 80 bytes header and the number of facets
+constexpr std::size_t headerSize = 84;
+// normal, three points and 2 bytes attribute
+constexpr std::size_t recordSize = 50;
+// number of STL records that are read at once
+constexpr std::size_t readBlockSize = 4096;
+// number of coordinates that are buffered per temporary file
+constexpr std::size_t spillBlockSize = 2304;
+
+using FacetCoords = std::array<float, 9>;
+
+// Reads the facets of a binary STL file block by block
+class FacetReader
 {
-    Simplify alg;
+public:
+    explicit FacetReader(const std::string& filename)
+        : file(filename)
+        , str(file, std::ios::in | std::ios::binary)
+    {
+        std::error_code ec;
+        auto size = std::filesystem::file_size(Base::FileInfo::stringToPath(filename), ec);
+        std::array<char, headerSize> header {};
+        if (ec || size < headerSize || !str.read(header.data(), header.size())) {
+            return;
+        }
 
-    const MeshPointArray& points = myKernel.GetPoints();
-    for (std::size_t i = 0; i < points.size(); i++) {
-        Simplify::Vertex v;
-        v.tstart = 0;
-        v.tcount = 0;
-        v.border = 0;
-        v.p = points[i];
-        alg.vertices.push_back(v);
+        uint32_t num {};
+        std::memcpy(&num, header.data() + 80, sizeof(num));
+        if (num <= (size - headerSize) / recordSize) {
+            count = num;
+        }
     }
 
-    const MeshFacetArray& facets = myKernel.GetFacets();
-    for (std::size_t i = 0; i < facets.size(); i++) {
-        Simplify::Triangle t;
-        t.deleted = 0;
-        t.dirty = 0;
-        for (double& j : t.err) {
-            j = 0.0;
+    std::size_t size() const
+    {
+        return count;
+    }
+
+    template<class Func>
+    bool forEach(Func&& func)
+    {
+        str.clear();
+        str.seekg(headerSize);
+        std::vector<char> block(readBlockSize * recordSize);
+        for (std::size_t done = 0; done < count;) {
+            std::size_t num = std::min(readBlockSize, count - done);
+            if (!str.read(block.data(), std::streamsize(num * recordSize))) {
+                return false;
+            }
+            for (std::size_t i = 0; i < num; i++) {
+                // skip the normal, it will be recomputed from the points
+                FacetCoords coords {};
+                const char* record = block.data() + i * recordSize + 3 * sizeof(float);
+                std::memcpy(coords.data(), record, sizeof(coords));
+                func(coords);
+            }
+            done += num;
         }
-        for (int j = 0; j < 3; j++) {
-            t.v[j] = facets[i]._aulPoints[j];
+        return true;
+    }
+
+private:
+    Base::FileInfo file;
+    Base::ifstream str;
+    std::size_t count {0};
+};
+
+// Writes facets to a binary STL file and sets the number of facets when closing it
+class FacetWriter
+{
+public:
+    explicit FacetWriter(const std::string& filename)
+        : file(filename)
+        , str(file, std::ios::out | std::ios::trunc | std::ios::binary)
+    {
+        std::array<char, headerSize> header {};
+        str.write(header.data(), header.size());
+    }
+
+    void write(const Simplify& alg)
+    {
+        std::array<char, recordSize> record {};
+        for (const auto& triangle : alg.triangles) {
+            MeshGeomFacet facet(alg.vertices[triangle.v[0]].p,
+                                alg.vertices[triangle.v[1]].p,
+                                alg.vertices[triangle.v[2]].p);
+            Base::Vector3f normal = facet.GetNormal();
+            std::memcpy(record.data(), &normal.x, 3 * sizeof(float));
+            for (std::size_t i = 0; i < 3; i++) {
+                std::memcpy(record.data() + (3 * i + 3) * sizeof(float),
+                            &facet._aclPoints[i].x,
+                            3 * sizeof(float));
+            }
+            str.write(record.data(), record.size());
         }
-        alg.triangles.push_back(t);
+        count += alg.triangles.size();
+    }
+
+    std::size_t size() const
+    {
+        return count;
+    }
+
+    bool close()
+    {
+        auto num = static_cast<uint32_t>(count);
+        str.seekp(80);
+        str.write(reinterpret_cast<const char*>(&num), sizeof(num));
+        str.close();
+        return !str.fail() && count <= std::numeric_limits<uint32_t>::max();
+    }
+
+private:
+    Base::FileInfo file;
+    Base::ofstream str;
+    std::size_t count {0};
+};
+
+// Buffers the coordinates of one chunk and appends them to a temporary file
+class SpillFile
+{
+public:
+    SpillFile()
+        : file(Base::FileInfo::getTempFileName("MeshChunk"))
+    {}
+    ~SpillFile()
+    {
+        file.deleteFile();
+    }
+    SpillFile(const SpillFile&) = delete;
+    SpillFile(SpillFile&&) = delete;
+    SpillFile& operator=(const SpillFile&) = delete;
+    SpillFile& operator=(SpillFile&&) = delete;
+
+    void add(const float* data, std::size_t num)
+    {
+        buffer.insert(buffer.end(), data, data + num);
+        if (buffer.size() >= spillBlockSize) {
+            flush();
+        }
+    }
+
+    bool flush()
+    {
+        if (!buffer.empty()) {
+            Base::ofstream str(file, std::ios::out | std::ios::app | std::ios::binary);
+            str.write(reinterpret_cast<const char*>(buffer.data()),
+                      std::streamsize(buffer.size() * sizeof(float)));
+            failed = failed || str.fail();
+            numCoords += buffer.size();
+            buffer.clear();
+        }
+        return !failed;
+    }
+
+    std::vector<float> read() const
+    {
+        std::vector<float> data(numCoords);
+        if (numCoords > 0) {
+            Base::ifstream str(file, std::ios::in | std::ios::binary);
+            str.read(reinterpret_cast<char*>(data.data()),
+                     std::streamsize(data.size() * sizeof(float)));
+        }
+        return data;
+    }
+
+private:
+    Base::FileInfo file;
+    std::vector<float> buffer;
+    std::size_t numCoords {0};
+    bool failed {false};
+};
+
+// Splits the bounding box into a regular grid of cells and groups the cells along a Morton
+// curve into chunks with a limited number of facets. So, cells of a chunk are close together.
+class ChunkGrid
+{
+public:
+    ChunkGrid(const Base::BoundBox3f& box, std::size_t numFacets, std::size_t chunkSize, bool shift)
+    {
+        // a surface covers roughly size * size cells
+        const std::size_t maxSize = 128;
+        while (size < maxSize && size * size * chunkSize < 16 * numFacets) {
+            size *= 2;
+        }
+
+        const std::array<float, 3> minimum {box.MinX, box.MinY, box.MinZ};
+        const std::array<float, 3> length {box.LengthX(), box.LengthY(), box.LengthZ()};
+        for (std::size_t i = 0; i < 3; i++) {
+            float cell = length[i] / float(size);
+            scale[i] = cell > 0.0F ? 1.0F / cell : 0.0F;
+            origin[i] = minimum[i] - (shift ? 0.5F * cell : 0.0F);
+        }
+        histogram.resize(size * size * size);
+    }
+
+    void addFacet(const FacetCoords& coords)
+    {
+        histogram[cellOfFacet(coords)]++;
+    }
+
+    /*!
+     * Assigns the cells to chunks. If \a shift is true the first chunk gets only half of
+     * the facets so that the borders between chunks differ from the unshifted grid.
+     */
+    void group(std::size_t chunkSize, bool shift)
+    {
+        chunks.resize(histogram.size());
+        std::size_t limit = shift ? chunkSize / 2 : chunkSize;
+        std::size_t filled = 0;
+        uint32_t chunk = 0;
+        for (std::size_t code = 0; code < histogram.size(); code++) {
+            std::size_t cell = cellOfMortonCode(code);
+            std::size_t num = histogram[cell];
+            if (filled > 0 && filled + num > limit) {
+                chunk++;
+                filled = 0;
+                limit = chunkSize;
+            }
+            chunks[cell] = chunk;
+            filled += num;
+        }
+        numChunks = std::size_t(chunk) + 1;
+        histogram.clear();
+        histogram.shrink_to_fit();
+    }
+
+    std::size_t countChunks() const
+    {
+        return numChunks;
+    }
+
+    uint32_t chunkOfPoint(const float* pnt) const
+    {
+        return chunks[cellOfPoint(pnt)];
+    }
+
+    uint32_t chunkOfFacet(const FacetCoords& coords) const
+    {
+        return chunks[cellOfFacet(coords)];
+    }
+
+private:
+    std::size_t cellOfPoint(const float* pnt) const
+    {
+        std::size_t index = 0;
+        for (std::size_t i = 0; i < 3; i++) {
+            float value = (pnt[i] - origin[i]) * scale[i];
+            std::size_t cell = 0;
+            if (value > 0.0F) {
+                cell = std::size_t(std::min(value, float(size - 1)));
+            }
+            index = index * size + cell;
+        }
+        return index;
     }
 
+    std::size_t cellOfFacet(const FacetCoords& coords) const
+    {
+        std::array<float, 3> center {};
+        for (std::size_t i = 0; i < 3; i++) {
+            center[i] = (coords[i] + coords[i + 3] + coords[i + 6]) / 3.0F;
+        }
+        return cellOfPoint(center.data());
+    }
+
+    std::size_t cellOfMortonCode(std::size_t code) const
+    {
+        std::array<std::size_t, 3> xyz {};
+        for (std::size_t bit = 0; (std::size_t(1) << bit) < size; bit++) {
+            for (std::size_t i = 0; i < 3; i++) {
+                xyz[i] |= ((code >> (3 * bit + 2 - i)) & 1) << bit;
+            }
+        }
+        return (xyz[0] * size + xyz[1]) * size + xyz[2];
+    }
+
+private:
+    std::size_t size {1};
+    std::array<float, 3> origin {};
+    std::array<float, 3> scale {};
+    std::vector<std::size_t> histogram;
+    std::vector<uint32_t> chunks;
+    std::size_t numChunks {0};
+};
+
+bool lessPoint(const Base::Vector3f& p1, const Base::Vector3f& p2)
+{
+    if (p1.x != p2.x) {
+        return p1.x < p2.x;
+    }
+    if (p1.y != p2.y) {
+        return p1.y < p2.y;
+    }
+    return p1.z < p2.z;
+}
+}  // namespace
+
+MeshSimplify::MeshSimplify(MeshKernel& mesh)
+    : myKernel(mesh)
+{}
+
+void MeshSimplify::simplify(float tolerance, float reduction)
+{
+    Simplify alg;
+    initAlgorithm(alg, myKernel);
+
+    int target_count =
+        static_cast<int>(static_cast<float>(myKernel.CountFacets()) * (1.0F - reduction));
+
+    // Simplification starts
+    alg.simplify_mesh(target_count, tolerance);
+
+    // Simplification done
+    adoptResult(alg, myKernel);
+}
+
+void MeshSimplify::simplify(int targetSize)
+{
+    Simplify alg;
+    initAlgorithm(alg, myKernel);
+
     // Simplification starts
     alg.simplify_mesh(targetSize, std::numeric_limits<float>::max());
 
     // Simplification done
-    MeshPointArray new_points;
-    new_points.reserve(alg.vertices.size());
-    for (const auto& vertex : alg.vertices) {
-        new_points.push_back(vertex.p);
-    }
+    adoptResult(alg, myKernel);
+}
 
+// ----------------------------------------------------------------------------
+
+void MeshStreamSimplify::SetThreads(int num)
+{
+    threads = num;
+}
+
+void MeshStreamSimplify::SetChunkSize(std::size_t num)
+{
+    chunkSize = std::max<std::size_t>(num, 1);
+}
+
+bool MeshStreamSimplify::simplify(const std::string& input,
+                                  const std::string& output,
+                                  float tolerance,
+                                  float reduction)
+{
+    FacetReader reader(input);
+    auto target = static_cast<std::size_t>(static_cast<double>(reader.size())
+                                           * (1.0 - static_cast<double>(reduction)));
+    return run(input, output, tolerance, target);
+}
+
+bool MeshStreamSimplify::simplify(const std::string& input,
+                                  const std::string& output,
+                                  std::size_t targetSize)
+{
+    return run(input, output, std::numeric_limits<float>::max(), targetSize);
+}
+
+bool MeshStreamSimplify::run(const std::string& input,
+                             const std::string& output,
+                             double tolerance,
+                             std::size_t targetSize)
+{
     std::size_t numFacets = 0;
-    for (const auto& triangle : alg.triangles) {
-        if (!triangle.deleted) {
-            numFacets++;
+    if (!simplifyPass(input, output, tolerance, targetSize, false, numFacets)) {
+        return false;
+    }
+    if (numFacets <= targetSize) {
+        return true;
+    }
+
+    // The points along the borders of the chunks are kept in the first pass. Decimate them
+    // with a shifted grid where they are inside the chunks.
+    Base::FileInfo file(output);
+    Base::FileInfo temp(
+        Base::FileInfo::getTempFileName(file.fileNamePure().c_str(), file.dirPath().c_str()));
+    if (!file.renameFile(temp.filePath().c_str())) {
+        return false;
+    }
+    bool ok = simplifyPass(temp.filePath(), output, tolerance, targetSize, true, numFacets);
+    temp.deleteFile();
+    return ok;
+}
+
+bool MeshStreamSimplify::simplifyPass(const std::string& input,
+                                      const std::string& output,
+                                      double tolerance,
+                                      std::size_t targetSize,
+                                      bool shifted,
+                                      std::size_t& numFacets)
+{
+    FacetReader reader(input);
+    const std::size_t count = reader.size();
+    if (count == 0) {
+        return false;
+    }
+
+    // The input is read three times: for the bounding box, the number of facets per cell
+    // and to distribute the facets over the chunks
+    Base::BoundBox3f box;
+    bool ok = reader.forEach([&box](const FacetCoords& coords) {
+        for (std::size_t i = 0; i < 9; i += 3) {
+            box.Add(Base::Vector3f(coords[i], coords[i + 1], coords[i + 2]));
         }
+    });
+
+    ChunkGrid grid(box, count, chunkSize, shifted);
+    ok = ok && reader.forEach([&grid](const FacetCoords& coords) {
+        grid.addFacet(coords);
+    });
+    if (!ok) {
+        return false;
     }
-    MeshFacetArray new_facets;
-    new_facets.reserve(numFacets);
-    for (const auto& triangle : alg.triangles) {
-        if (!triangle.deleted) {
-            MeshFacet face;
-            face._aulPoints[0] = triangle.v[0];
-            face._aulPoints[1] = triangle.v[1];
-            face._aulPoints[2] = triangle.v[2];
-            new_facets.push_back(face);
+    grid.group(chunkSize, shifted);
+
+    // A facet goes to the chunk of its center. If one of its points lies in another chunk
+    // it's shared with that chunk and thus must be locked in both of them.
+    const std::size_t numChunks = grid.countChunks();
+    std::vector<SpillFile> facetFiles(numChunks);
+    std::vector<SpillFile> lockFiles(numChunks);
+    ok = reader.forEach([&](const FacetCoords& coords) {
+        uint32_t chunk = grid.chunkOfFacet(coords);
+        facetFiles[chunk].add(coords.data(), coords.size());
+        for (std::size_t i = 0; i < 9; i += 3) {
+            uint32_t other = grid.chunkOfPoint(&coords[i]);
+            if (other != chunk) {
+                lockFiles[other].add(&coords[i], 3);
+            }
         }
+    });
+    for (std::size_t i = 0; i < numChunks; i++) {
+        ok = facetFiles[i].flush() && ok;
+        ok = lockFiles[i].flush() && ok;
+    }
+    if (!ok) {
+        return false;
     }
 
-    myKernel.Adopt(new_points, new_facets, true);
+    FacetWriter writer(output);
+    std::mutex mutex;
+    maxChunkFacets = 0;
+
+    // Each thread holds one chunk at a time
+    int numThreads = threads > 0 ? threads : int(std::thread::hardware_concurrency());
+    parallel_for(numChunks, numThreads, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t chunk = begin; chunk < end; chunk++) {
+            std::vector<float> coords = facetFiles[chunk].read();
+            const std::size_t numChunkFacets = coords.size() / 9;
+            if (numChunkFacets == 0) {
+                continue;
+            }
+
+            MeshKernel kernel;
+            MeshHashBuilder builder(kernel);
+            builder.SetThreads(1);
+            Base::Vector3f* corners = builder.Initialize(numChunkFacets);
+            for (std::size_t i = 0; i < 3 * numChunkFacets; i++) {
+                corners[i].Set(coords[3 * i], coords[3 * i + 1], coords[3 * i + 2]);
+            }
+            coords = lockFiles[chunk].read();
+            builder.Finish();
+
+            std::vector<Base::Vector3f> locked;
+            locked.reserve(coords.size() / 3);
+            for (std::size_t i = 0; i + 2 < coords.size(); i += 3) {
+                locked.emplace_back(coords[i], coords[i + 1], coords[i + 2]);
+            }
+            coords.clear();
+            coords.shrink_to_fit();
+            std::sort(locked.begin(), locked.end(), lessPoint);
+
+            Simplify alg;
+            initAlgorithm(alg, kernel);
+            kernel.Clear();
+            for (auto& vertex : alg.vertices) {
+                if (grid.chunkOfPoint(&vertex.p.x) != chunk
+                    || std::binary_search(locked.begin(), locked.end(), vertex.p, lessPoint)) {
+                    vertex.locked = 1;
+                }
+            }
+
+            auto target = static_cast<int>(static_cast<double>(numChunkFacets)
+                                           * static_cast<double>(targetSize)
+                                           / static_cast<double>(count));
+            alg.simplify_mesh(target, tolerance);
+
+            std::lock_guard<std::mutex> lock(mutex);
+            writer.write(alg);
+            maxChunkFacets = std::max(maxChunkFacets, numChunkFacets);
+        }
+    });
+
+    numFacets = writer.size();
+    return writer.close();
 }
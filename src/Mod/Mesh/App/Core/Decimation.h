@@ -24,6 +24,7 @@
 #ifndef MESH_DECIMATION_H
 #define MESH_DECIMATION_H
 
+#include <string>
 #include <Mod/Mesh/MeshGlobal.h>
 
 namespace MeshCore
@@ -41,6 +42,61 @@ private:
     MeshKernel& myKernel;
 };
 
+/**
+ * The MeshStreamSimplify class decimates a binary STL file into another binary STL file
+ * without loading the whole mesh into memory.
+ * The facets are distributed over spatial chunks that are written to temporary files. The
+ * chunks are simplified independently and in parallel while points that are shared with
+ * other chunks are locked. Thus the results fit together without cracks when they are
+ * written to the output file. If the target isn't reached a second pass with shifted chunks
+ * decimates the former seams.
+ */
+class MeshExport MeshStreamSimplify
+{
+public:
+    MeshStreamSimplify() = default;
+    /** Sets the number of threads. A value < 1 uses all cores.
+     * Each thread holds one chunk in memory.
+     */
+    void SetThreads(int num);
+    /** Sets the maximum number of facets per chunk. A chunk only gets more facets if they
+     * all lie in the same grid cell.
+     */
+    void SetChunkSize(std::size_t num);
+    /** Returns the number of facets of the largest chunk of the last pass. */
+    std::size_t GetMaxChunkFacets() const
+    {
+        return maxChunkFacets;
+    }
+    /** Decimates the mesh of the file \a input and writes the result to \a output.
+     * The parameters have the same meaning as for MeshSimplify::simplify().
+     * \return false if \a input is not a binary STL file or if a file cannot be written.
+     */
+    bool simplify(const std::string& input,
+                  const std::string& output,
+                  float tolerance,
+                  float reduction);
+    /** Decimates the mesh of the file \a input to about \a targetSize facets. */
+    bool simplify(const std::string& input, const std::string& output, std::size_t targetSize);
+
+private:
+    bool run(const std::string& input,
+             const std::string& output,
+             double tolerance,
+             std::size_t targetSize);
+    bool simplifyPass(const std::string& input,
+                      const std::string& output,
+                      double tolerance,
+                      std::size_t targetSize,
+                      bool shifted,
+                      std::size_t& numFacets);
+
+private:
+    int threads {0};
+    std::size_t chunkSize {1000000};
+    std::size_t maxChunkFacets {0};
+};
+
 }  // namespace MeshCore
 
 
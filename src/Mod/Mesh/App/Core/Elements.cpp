@@ -81,13 +81,6 @@ void MeshPointArray::ResetFlag(MeshPoint::TFlagType tF) const
     }
 }
 
-void MeshPointArray::SetProperty(unsigned long ulVal) const
-{
-    for (const auto& pP : *this) {
-        pP.SetProperty(ulVal);
-    }
-}
-
 void MeshPointArray::ResetInvalid() const
 {
     for (const auto& pP : *this) {
@@ -90,8 +90,10 @@ struct MeshExport VertexCollapse
 
 /**
  * The MeshPoint class represents a point in the mesh data structure. The class inherits from
- * Vector3f and provides some additional information such as flag state and property value.
+ * Vector3f and provides some additional information such as the flag state.
  * The flags can be modified by the Set() and Reset() and queried by IsFlag().
+ * Together with the flag byte a point takes 16 bytes. Algorithms that need an additional value
+ * per point keep it in a separate array.
  * A point can temporary be in an invalid state (e.g during deletion of several points), but
  * must not be set in general, i.e. always usable within a mesh-internal algorithm.
  *
@@ -120,7 +122,6 @@ public:
     //@{
     MeshPoint()
         : _ucFlag(0)
-        , _ulProp(0)
     {}
     inline MeshPoint(float x, float y, float z);
     inline MeshPoint(const Base::Vector3f& rclPt);  // explicit bombs
@@ -158,10 +159,6 @@ public:
     {
         return !IsFlag(INVALID);
     }
-    void SetProperty(unsigned long uP) const
-    {
-        _ulProp = uP;
-    }
     //@}
 
     // Assignment
@@ -175,7 +172,6 @@ public:
 
 public:
     mutable unsigned char _ucFlag; /**< Flag member */
-    mutable unsigned long _ulProp; /**< Free usable property */
 };
 
 /**
@@ -713,8 +709,6 @@ public:
     void ResetFlag(MeshPoint::TFlagType tF) const;
     /// Sets all points invalid
     void ResetInvalid() const;
-    /// Sets the property for all points
-    void SetProperty(unsigned long ulVal) const;
     //@}
 
     // Assignment
@@ -856,13 +850,11 @@ private:
 inline MeshPoint::MeshPoint(float x, float y, float z)
     : Base::Vector3f(x, y, z)
     , _ucFlag(0)
-    , _ulProp(0)
 {}
 
 inline MeshPoint::MeshPoint(const Base::Vector3f& rclPt)
     : Base::Vector3f(rclPt)
     , _ucFlag(0)
-    , _ulProp(0)
 {}
 
 inline bool MeshPoint::operator==(const MeshPoint& rclPt) const
@@ -481,10 +481,10 @@ bool MeshEvalPointManifolds::Evaluate()
     unsigned long ctPoints = _rclMesh.CountPoints();
     for (PointIndex index = 0; index < ctPoints; index++) {
         // get the local neighbourhood of the point
-        const std::set<FacetIndex>& nf = vf_it[index];
-        const std::set<PointIndex>& np = vv_it[index];
+        MeshIndexRange nf = vf_it[index];
+        MeshIndexRange np = vv_it[index];
 
-        std::set<unsigned long>::size_type sp {}, sf {};
+        std::size_t sp {}, sf {};
         sp = np.size();
         sf = nf.size();
         // for an inner point the number of adjacent points is equal to the number of shared faces
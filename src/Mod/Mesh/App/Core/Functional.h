@@ -24,7 +24,9 @@
 #define MESH_FUNCTIONAL_H
 
 #include <algorithm>
+#include <cstddef>
 #include <future>
+#include <vector>
 
 
 namespace MeshCore
@@ -62,6 +64,50 @@ static void parallel_sort(Iter begin, Iter end, Pred comp, int threads)
     }
 }
 
+/*!
+ * \brief parallel_threads
+ * Returns the number of threads worth using for \a count items: at most \a threads
+ * and at least one, so that each thread gets at least \a minChunkSize items. Small
+ * ranges are not worth the overhead of spawning threads.
+ */
+inline int parallel_threads(int threads, std::size_t count, std::size_t minChunkSize = 4096)
+{
+    std::size_t chunks = std::max<std::size_t>(count / minChunkSize, 1);
+    return int(std::min<std::size_t>(std::max(threads, 1), chunks));
+}
+
+/*!
+ * \brief parallel_for
+ * Splits the index range [0, count) into at most \a threads contiguous chunks of
+ * about the same size and calls \a func(begin, end) for each of them concurrently.
+ * The function returns when all chunks are processed. If one of the calls throws
+ * an exception it is re-thrown in the calling thread.
+ */
+template<class Func>
+static void parallel_for(std::size_t count, int threads, Func&& func)
+{
+    std::size_t chunks = std::min<std::size_t>(std::max(threads, 1), count);
+    if (chunks < 2) {
+        func(std::size_t(0), count);
+        return;
+    }
+
+    std::vector<std::future<void>> futures;
+    futures.reserve(chunks - 1);
+    for (std::size_t i = 1; i < chunks; i++) {
+        std::size_t begin = count * i / chunks;
+        std::size_t end = count * (i + 1) / chunks;
+        futures.push_back(std::async(std::launch::async, [&func, begin, end]() {
+            func(begin, end);
+        }));
+    }
+
+    func(std::size_t(0), count / chunks);
+    for (auto& it : futures) {
+        it.get();
+    }
+}
+
 }  // namespace MeshCore
 
 
@@ -26,6 +26,7 @@
 #include <algorithm>
 #include <cmath>
 #include <limits>
+#include <thread>
 #endif
 
 #include "Algorithm.h"
@@ -130,14 +131,12 @@ void MeshGrid::InitGrid()
     }
 
     // Create data structure
-    _aulGrid.clear();
-    _aulGrid.resize(_ulCtGridsX);
-    for (unsigned long i = 0; i < _ulCtGridsX; i++) {
-        _aulGrid[i].resize(_ulCtGridsY);
-        for (unsigned long j = 0; j < _ulCtGridsY; j++) {
-            _aulGrid[i][j].resize(_ulCtGridsZ);
-        }
-    }
+    _aulGrid.resize(_ulCtGridsX, _ulCtGridsY, _ulCtGridsZ);
+}
+
+int MeshGrid::GetBuildThreads()
+{
+    return std::max(1, int(std::thread::hardware_concurrency()));
 }
 
 unsigned long MeshGrid::Inside(const Base::BoundBox3f& rclBB,
@@ -160,9 +159,8 @@ unsigned long MeshGrid::Inside(const Base::BoundBox3f& rclBB,
     for (auto i = ulMinX; i <= ulMaxX; i++) {
         for (auto j = ulMinY; j <= ulMaxY; j++) {
             for (auto k = ulMinZ; k <= ulMaxZ; k++) {
-                raulElements.insert(raulElements.end(),
-                                    _aulGrid[i][j][k].begin(),
-                                    _aulGrid[i][j][k].end());
+                auto cell = _aulGrid(i, j, k);
+                raulElements.insert(raulElements.end(), cell.begin(), cell.end());
             }
         }
     }
@@ -202,9 +200,8 @@ unsigned long MeshGrid::Inside(const Base::BoundBox3f& rclBB,
         for (auto j = ulMinY; j <= ulMaxY; j++) {
             for (auto k = ulMinZ; k <= ulMaxZ; k++) {
                 if (Base::DistanceP2(GetBoundBox(i, j, k).GetCenter(), rclOrg) < fMinDistP2) {
-                    raulElements.insert(raulElements.end(),
-                                        _aulGrid[i][j][k].begin(),
-                                        _aulGrid[i][j][k].end());
+                    auto cell = _aulGrid(i, j, k);
+                    raulElements.insert(raulElements.end(), cell.begin(), cell.end());
                 }
             }
         }
@@ -239,7 +236,8 @@ unsigned long MeshGrid::Inside(const Base::BoundBox3f& rclBB,
     for (auto i = ulMinX; i <= ulMaxX; i++) {
         for (auto j = ulMinY; j <= ulMaxY; j++) {
             for (auto k = ulMinZ; k <= ulMaxZ; k++) {
-                raulElements.insert(_aulGrid[i][j][k].begin(), _aulGrid[i][j][k].end());
+                auto cell = _aulGrid(i, j, k);
+                raulElements.insert(cell.begin(), cell.end());
             }
         }
     }
@@ -463,7 +461,8 @@ void MeshGrid::SearchNearestFromPoint(const Base::Vector3f& pnt,
                 while (indices.empty() && nX < _ulCtGridsX) {
                     for (unsigned long i = 0; i < _ulCtGridsY; i++) {
                         for (unsigned long j = 0; j < _ulCtGridsZ; j++) {
-                            indices.insert(_aulGrid[nX][i][j].begin(), _aulGrid[nX][i][j].end());
+                            auto cell = _aulGrid(nX, i, j);
+                            indices.insert(cell.begin(), cell.end());
                         }
                     }
                     nX++;
@@ -475,7 +474,8 @@ void MeshGrid::SearchNearestFromPoint(const Base::Vector3f& pnt,
                 while (indices.empty() && nX < _ulCtGridsX) {
                     for (unsigned long i = 0; i < _ulCtGridsY; i++) {
                         for (unsigned long j = 0; j < _ulCtGridsZ; j++) {
-                            indices.insert(_aulGrid[nX][i][j].begin(), _aulGrid[nX][i][j].end());
+                            auto cell = _aulGrid(nX, i, j);
+                            indices.insert(cell.begin(), cell.end());
                         }
                     }
                     nX++;
@@ -487,7 +487,8 @@ void MeshGrid::SearchNearestFromPoint(const Base::Vector3f& pnt,
                 while (indices.empty() && nY < _ulCtGridsY) {
                     for (unsigned long i = 0; i < _ulCtGridsX; i++) {
                         for (unsigned long j = 0; j < _ulCtGridsZ; j++) {
-                            indices.insert(_aulGrid[i][nY][j].begin(), _aulGrid[i][nY][j].end());
+                            auto cell = _aulGrid(i, nY, j);
+                            indices.insert(cell.begin(), cell.end());
                         }
                     }
                     nY++;
@@ -499,7 +500,8 @@ void MeshGrid::SearchNearestFromPoint(const Base::Vector3f& pnt,
                 while (indices.empty() && nY < _ulCtGridsY) {
                     for (unsigned long i = 0; i < _ulCtGridsX; i++) {
                         for (unsigned long j = 0; j < _ulCtGridsZ; j++) {
-                            indices.insert(_aulGrid[i][nY][j].begin(), _aulGrid[i][nY][j].end());
+                            auto cell = _aulGrid(i, nY, j);
+                            indices.insert(cell.begin(), cell.end());
                         }
                     }
                     nY--;
@@ -511,7 +513,8 @@ void MeshGrid::SearchNearestFromPoint(const Base::Vector3f& pnt,
                 while (indices.empty() && nZ < _ulCtGridsZ) {
                     for (unsigned long i = 0; i < _ulCtGridsX; i++) {
                         for (unsigned long j = 0; j < _ulCtGridsY; j++) {
-                            indices.insert(_aulGrid[i][j][nZ].begin(), _aulGrid[i][j][nZ].end());
+                            auto cell = _aulGrid(i, j, nZ);
+                            indices.insert(cell.begin(), cell.end());
                         }
                     }
                     nZ++;
@@ -523,7 +526,8 @@ void MeshGrid::SearchNearestFromPoint(const Base::Vector3f& pnt,
                 while (indices.empty() && nZ < _ulCtGridsZ) {
                     for (unsigned long i = 0; i < _ulCtGridsX; i++) {
                         for (unsigned long j = 0; j < _ulCtGridsY; j++) {
-                            indices.insert(_aulGrid[i][j][nZ].begin(), _aulGrid[i][j][nZ].end());
+                            auto cell = _aulGrid(i, j, nZ);
+                            indices.insert(cell.begin(), cell.end());
                         }
                     }
                     nZ--;
@@ -611,7 +615,7 @@ unsigned long MeshGrid::GetElements(unsigned long ulX,
                                     unsigned long ulZ,
                                     std::set<ElementIndex>& raclInd) const
 {
-    const std::set<ElementIndex>& rclSet = _aulGrid[ulX][ulY][ulZ];
+    auto rclSet = _aulGrid(ulX, ulY, ulZ);
     if (!rclSet.empty()) {
         raclInd.insert(rclSet.begin(), rclSet.end());
         return rclSet.size();
@@ -630,9 +634,8 @@ unsigned long MeshGrid::GetElements(const Base::Vector3f& rclPoint,
         return 0;
     }
 
-    aulFacets.resize(_aulGrid[ulX][ulY][ulZ].size());
-
-    std::copy(_aulGrid[ulX][ulY][ulZ].begin(), _aulGrid[ulX][ulY][ulZ].end(), aulFacets.begin());
+    auto cell = _aulGrid(ulX, ulY, ulZ);
+    aulFacets.assign(cell.begin(), cell.end());
     return aulFacets.size();
 }
 
@@ -749,13 +752,13 @@ void MeshFacetGrid::RebuildGrid()
     InitGrid();
 
     // Fill data structure
-    MeshFacetIterator clFIter(*_pclMesh);
-
-    unsigned long i = 0;
-    for (clFIter.Init(); clFIter.More(); clFIter.Next()) {
-        //    AddFacet(*clFIter, i++, 2.0f);
-        AddFacet(*clFIter, i++);
-    }
+    const MeshKernel& rclMesh = *_pclMesh;
+    _aulGrid.build(
+        _ulCtElements,
+        [this, &rclMesh](ElementIndex ulFacetIndex, auto&& add) {
+            AddFacet(rclMesh.GetFacet(ulFacetIndex), add);
+        },
+        GetBuildThreads());
 }
 
 unsigned long MeshFacetGrid::SearchNearestFromPoint(const Base::Vector3f& rclPt) const
@@ -986,8 +989,7 @@ void MeshFacetGrid::SearchNearestFacetInGrid(unsigned long ulX,
                                              float& rfMinDist,
                                              ElementIndex& rulFacetInd) const
 {
-    const std::set<ElementIndex>& rclSet = _aulGrid[ulX][ulY][ulZ];
-    for (ElementIndex pI : rclSet) {
+    for (ElementIndex pI : _aulGrid(ulX, ulY, ulZ)) {
         float fDist = _pclMesh->GetFacet(pI).DistanceToPoint(rclPt);
         if (fDist < rfMinDist) {
             rfMinDist = fDist;
@@ -1030,18 +1032,6 @@ MeshPointGrid::MeshPointGrid(const MeshKernel& rclM, float fGridLen)
             std::max<unsigned long>(static_cast<unsigned long>(clBBMesh.LengthZ() / fGridLen), 1));
 }
 
-void MeshPointGrid::AddPoint(const MeshPoint& rclPt, ElementIndex ulPtIndex, float fEpsilon)
-{
-    (void)fEpsilon;
-    unsigned long ulX {};
-    unsigned long ulY {};
-    unsigned long ulZ {};
-    Pos(Base::Vector3f(rclPt.x, rclPt.y, rclPt.z), ulX, ulY, ulZ);
-    if ((ulX < _ulCtGridsX) && (ulY < _ulCtGridsY) && (ulZ < _ulCtGridsZ)) {
-        _aulGrid[ulX][ulY][ulZ].insert(ulPtIndex);
-    }
-}
-
 void MeshPointGrid::Validate(const MeshKernel& rclMesh)
 {
     if (_pclMesh != &rclMesh) {
@@ -1095,13 +1085,13 @@ void MeshPointGrid::RebuildGrid()
     InitGrid();
 
     // Fill data structure
-
-    MeshPointIterator cPIter(*_pclMesh);
-
-    unsigned long i = 0;
-    for (cPIter.Init(); cPIter.More(); cPIter.Next()) {
-        AddPoint(*cPIter, i++);
-    }
+    const MeshPointArray& rclPoints = _pclMesh->GetPoints();
+    _aulGrid.build(
+        _ulCtElements,
+        [this, &rclPoints](ElementIndex ulPtIndex, auto&& add) {
+            AddPoint(rclPoints[ulPtIndex], add);
+        },
+        GetBuildThreads());
 }
 
 void MeshPointGrid::Pos(const Base::Vector3f& rclPoint,
@@ -1166,9 +1156,8 @@ bool MeshGridIterator::InitOnRay(const Base::Vector3f& rclPt,
     // point lies within global BB
     if (_rclGrid.GetBoundBox().IsInBox(rclPt)) {  // Determine the voxel by the starting point
         _rclGrid.Position(rclPt, _ulX, _ulY, _ulZ);
-        raulElements.insert(raulElements.end(),
-                            _rclGrid._aulGrid[_ulX][_ulY][_ulZ].begin(),
-                            _rclGrid._aulGrid[_ulX][_ulY][_ulZ].end());
+        auto cell = _rclGrid._aulGrid(_ulX, _ulY, _ulZ);
+        raulElements.insert(raulElements.end(), cell.begin(), cell.end());
         _bValidRay = true;
     }
     else {  // Start point outside
@@ -1183,9 +1172,8 @@ bool MeshGridIterator::InitOnRay(const Base::Vector3f& rclPt,
                 _rclGrid.Position(cP1, _ulX, _ulY, _ulZ);
             }
 
-            raulElements.insert(raulElements.end(),
-                                _rclGrid._aulGrid[_ulX][_ulY][_ulZ].begin(),
-                                _rclGrid._aulGrid[_ulX][_ulY][_ulZ].end());
+            auto cell = _rclGrid._aulGrid(_ulX, _ulY, _ulZ);
+            raulElements.insert(raulElements.end(), cell.begin(), cell.end());
             _bValidRay = true;
         }
     }
@@ -1249,9 +1237,8 @@ bool MeshGridIterator::NextOnRay(std::vector<ElementIndex>& raulElements)
     if (_bValidRay && _rclGrid.CheckPos(_ulX, _ulY, _ulZ)) {
         GridElement pos(_ulX, _ulY, _ulZ);
         _cSearchPositions.insert(pos);
-        raulElements.insert(raulElements.end(),
-                            _rclGrid._aulGrid[_ulX][_ulY][_ulZ].begin(),
-                            _rclGrid._aulGrid[_ulX][_ulY][_ulZ].end());
+        auto cell = _rclGrid._aulGrid(_ulX, _ulY, _ulZ);
+        raulElements.insert(raulElements.end(), cell.begin(), cell.end());
     }
     else {
         _bValidRay = false;  // Beam leaked
@@ -27,6 +27,7 @@
 #include <set>
 
 #include <Base/BoundBox.h>
+#include <Base/FlatGrid.h>
 
 #include "MeshKernel.h"
 
@@ -152,7 +153,12 @@ public:
     /** Returns the number of elements in a given grid. */
     unsigned long GetCtElements(unsigned long ulX, unsigned long ulY, unsigned long ulZ) const
     {
-        return static_cast<unsigned long>(_aulGrid[ulX][ulY][ulZ].size());
+        return static_cast<unsigned long>(_aulGrid(ulX, ulY, ulZ).size());
+    }
+    /** Returns the number of bytes allocated by the grid structure. */
+    std::size_t GetMemoryUsage() const
+    {
+        return _aulGrid.memoryUsage();
     }
     /** Validates the grid structure and rebuilds it if needed. Must be implemented in sub-classes.
      */
@@ -193,11 +199,12 @@ protected:
     virtual void RebuildGrid() = 0;
     /** Returns the number of stored elements. Must be implemented in sub-classes. */
     virtual unsigned long HasElements() const = 0;
+    /** Returns the number of threads used to build the grid structure. */
+    static int GetBuildThreads();
 
 protected:
     // NOLINTBEGIN
-    std::vector<std::vector<std::vector<std::set<ElementIndex>>>>
-        _aulGrid;                /**< Grid data structure. */
+    Base::FlatGrid<ElementIndex> _aulGrid; /**< Grid data structure. */
     const MeshKernel* _pclMesh;  /**< The mesh kernel. */
     unsigned long _ulCtElements; /**< Number of grid elements for validation issues. */
     unsigned long _ulCtGridsX;   /**< Number of grid elements in z. */
@@ -285,11 +292,10 @@ protected:
                              unsigned long& rulX,
                              unsigned long& rulY,
                              unsigned long& rulZ) const;
-    /** Adds a new facet element to the grid structure. \a rclFacet is the geometric facet and \a
-     * ulFacetIndex the corresponding index in the mesh kernel. The facet is added to each grid
-     * element that intersects the facet. */
-    inline void
-    AddFacet(const MeshGeomFacet& rclFacet, ElementIndex ulFacetIndex, float fEpsilon = 0.0F);
+    /** Determines the grid elements of the facet \a rclFacet. For each grid element that
+     * intersects the facet \a add(ulX, ulY, ulZ) is called. */
+    template<typename Func>
+    inline void AddFacet(const MeshGeomFacet& rclFacet, Func&& add) const;
     /** Returns the number of stored elements. */
     unsigned long HasElements() const override
     {
@@ -337,9 +343,10 @@ public:
     bool Verify() const override;
 
 protected:
-    /** Adds a new point element to the grid structure. \a rclPt is the geometric point and \a
-     * ulPtIndex the corresponding index in the mesh kernel. */
-    void AddPoint(const MeshPoint& rclPt, ElementIndex ulPtIndex, float fEpsilon = 0.0F);
+    /** Determines the grid element of the point \a rclPt and passes it to \a add(ulX, ulY, ulZ)
+     * if it lies inside the grid. */
+    template<typename Func>
+    inline void AddPoint(const MeshPoint& rclPt, Func&& add) const;
     /** Returns the grid numbers to the given point \a rclPoint. */
     void Pos(const Base::Vector3f& rclPoint,
              unsigned long& rulX,
@@ -371,9 +378,8 @@ public:
     /** Returns indices of the elements in the current grid. */
     void GetElements(std::vector<ElementIndex>& raulElements) const
     {
-        raulElements.insert(raulElements.end(),
-                            _rclGrid._aulGrid[_ulX][_ulY][_ulZ].begin(),
-                            _rclGrid._aulGrid[_ulX][_ulY][_ulZ].end());
+        auto cell = _rclGrid._aulGrid(_ulX, _ulY, _ulZ);
+        raulElements.insert(raulElements.end(), cell.begin(), cell.end());
     }
     /** Returns the number of elements in the current grid. */
     unsigned long GetCtElements() const
@@ -561,9 +567,8 @@ inline void MeshFacetGrid::PosWithCheck(const Base::Vector3f& rclPoint,
     assert((rulX < _ulCtGridsX) && (rulY < _ulCtGridsY) && (rulZ < _ulCtGridsZ));
 }
 
-inline void MeshFacetGrid::AddFacet(const MeshGeomFacet& rclFacet,
-                                    ElementIndex ulFacetIndex,
-                                    float /*fEpsilon*/)
+template<typename Func>
+inline void MeshFacetGrid::AddFacet(const MeshGeomFacet& rclFacet, Func&& add) const
 {
     unsigned long ulX {};
     unsigned long ulY {};
@@ -605,14 +610,28 @@ inline void MeshFacetGrid::AddFacet(const MeshGeomFacet& rclFacet,
             for (ulY = ulY1; ulY <= ulY2; ulY++) {
                 for (ulZ = ulZ1; ulZ <= ulZ2; ulZ++) {
                     if (rclFacet.IntersectBoundingBox(GetBoundBox(ulX, ulY, ulZ))) {
-                        _aulGrid[ulX][ulY][ulZ].insert(ulFacetIndex);
+                        add(ulX, ulY, ulZ);
                     }
                 }
             }
         }
     }
     else {
-        _aulGrid[ulX1][ulY1][ulZ1].insert(ulFacetIndex);
+        add(ulX1, ulY1, ulZ1);
+    }
+}
+
+// --------------------------------------------------------------
+
+template<typename Func>
+inline void MeshPointGrid::AddPoint(const MeshPoint& rclPt, Func&& add) const
+{
+    unsigned long ulX {};
+    unsigned long ulY {};
+    unsigned long ulZ {};
+    Pos(Base::Vector3f(rclPt.x, rclPt.y, rclPt.z), ulX, ulY, ulZ);
+    if ((ulX < _ulCtGridsX) && (ulY < _ulCtGridsY) && (ulZ < _ulCtGridsZ)) {
+        add(ulX, ulY, ulZ);
     }
 }
 
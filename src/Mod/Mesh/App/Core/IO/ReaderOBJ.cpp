@@ -72,6 +72,12 @@ bool ReaderOBJ::Load(std::istream& str)
     unsigned long segment = 0;
     MeshPointArray meshPoints;
     MeshFacetArray meshFacets;
+    // packed vertex colors, only filled if the file has any
+    std::vector<uint32_t> vertexColors;
+    auto addVertexColor = [&meshPoints, &vertexColors](const Base::Color& c) {
+        vertexColors.resize(meshPoints.size() - 1, 0);
+        vertexColors.push_back(c.getPackedValue());
+    };
 
     std::string line;
     float fX {}, fY {}, fZ {};
@@ -109,9 +115,7 @@ bool ReaderOBJ::Load(std::istream& str)
             float b = std::min<int>(std::atof(what[12].first), 255) / 255.0F;
             meshPoints.push_back(MeshPoint(Base::Vector3f(fX, fY, fZ)));
 
-            Base::Color c(r, g, b);
-            unsigned long prop = static_cast<uint32_t>(c.getPackedValue());
-            meshPoints.back().SetProperty(prop);
+            addVertexColor(Base::Color(r, g, b));
             rgb_value = MeshIO::PER_VERTEX;
         }
         else if (boost::regex_match(line.c_str(), what, rx_t)) {
@@ -123,9 +127,7 @@ bool ReaderOBJ::Load(std::istream& str)
             float b = static_cast<float>(std::atof(what[16].first));
             meshPoints.push_back(MeshPoint(Base::Vector3f(fX, fY, fZ)));
 
-            Base::Color c(r, g, b);
-            unsigned long prop = static_cast<uint32_t>(c.getPackedValue());
-            meshPoints.back().SetProperty(prop);
+            addVertexColor(Base::Color(r, g, b));
             rgb_value = MeshIO::PER_VERTEX;
         }
         else if (boost::regex_match(line.c_str(), what, rx_g)) {
@@ -211,10 +213,10 @@ bool ReaderOBJ::Load(std::istream& str)
             _material->binding = MeshIO::PER_VERTEX;
             _material->diffuseColor.reserve(meshPoints.size());
 
-            for (const auto& it : meshPoints) {
-                unsigned long prop = it._ulProp;
+            vertexColors.resize(meshPoints.size(), 0);
+            for (uint32_t packed : vertexColors) {
                 Base::Color c;
-                c.setPackedValue(static_cast<uint32_t>(prop));
+                c.setPackedValue(packed);
                 _material->diffuseColor.push_back(c);
             }
         }
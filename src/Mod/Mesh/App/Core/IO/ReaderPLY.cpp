@@ -23,12 +23,21 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <algorithm>
+#include <atomic>
+#include <bit>
 #include <boost/lexical_cast.hpp>
+#include <cstring>
 #include <istream>
+#include <thread>
 #endif
 
+#include <QFile>
+
+#include "Core/Functional.h"
 #include "Core/MeshIO.h"
 #include "Core/MeshKernel.h"
+#include <Base/Profiler.h>
 #include <Base/Stream.h>
 #include <Base/Tools.h>
 
@@ -37,6 +46,22 @@
 
 using namespace MeshCore;
 
+namespace
+{
+template<typename T>
+float readNumber(const char* data, bool swap)
+{
+    std::array<char, sizeof(T)> bytes {};
+    std::memcpy(bytes.data(), data, sizeof(T));
+    if (swap) {
+        std::reverse(bytes.begin(), bytes.end());
+    }
+    T value {};
+    std::memcpy(&value, bytes.data(), sizeof(T));
+    return static_cast<float>(value);
+}
+}  // namespace
+
 // http://local.wasp.uwa.edu.au/~pbourke/dataformats/ply/
 ReaderPLY::ReaderPLY(MeshKernel& kernel, Material* material)
     : _kernel(kernel)
@@ -369,6 +394,12 @@ bool ReaderPLY::VerifyColorProperty()
 
 bool ReaderPLY::Load(std::istream& input)
 {
+    return Load(input, std::string());
+}
+
+bool ReaderPLY::Load(std::istream& input, const std::string& filename)
+{
+    ZoneScoped;
     if (!CheckHeader(input)) {
         return false;
     }
@@ -385,10 +416,15 @@ bool ReaderPLY::Load(std::istream& input)
         return false;
     }
 
-    // clang-format off
-    return format == ascii ? LoadAscii(input)
-                           : LoadBinary(input);
-    // clang-format on
+    if (format == ascii) {
+        return LoadAscii(input);
+    }
+
+    if (!filename.empty() && LoadMapped(input, filename)) {
+        return true;
+    }
+
+    return LoadBinary(input);
 }
 
 void ReaderPLY::CleanupMesh()
@@ -518,6 +554,40 @@ void ReaderPLY::addVertexProperty(const PropertyArray& prop)
     }
 }
 
+void ReaderPLY::setVertexProperty(std::size_t index, const PropertyArray& prop)
+{
+    meshPoints[index].Set(prop[coord_x], prop[coord_y], prop[coord_z]);
+
+    if (_material && _material->binding == MeshIO::PER_VERTEX) {
+        // NOLINTBEGIN
+        float r = (prop[color_r]) / 255.0F;
+        float g = (prop[color_g]) / 255.0F;
+        float b = (prop[color_b]) / 255.0F;
+        // NOLINTEND
+        _material->diffuseColor[index] = Base::Color(r, g, b);
+    }
+}
+
+std::size_t ReaderPLY::sizeOfNumber(Number number)
+{
+    switch (number) {
+        case int8:
+        case uint8:
+            return 1;
+        case int16:
+        case uint16:
+            return 2;
+        case int32:
+        case uint32:
+        case float32:
+            return 4;
+        case float64:
+            return 8;
+    }
+
+    return 0;
+}
+
 bool ReaderPLY::ReadVertexes(Base::InputStream& is)
 {
     for (std::size_t i = 0; i < v_count; i++) {
@@ -662,3 +732,137 @@ bool ReaderPLY::LoadBinary(std::istream& input)
     CleanupMesh();
     return true;
 }
+
+bool ReaderPLY::LoadMapped(std::istream& input, const std::string& filename)
+{
+    ZoneScoped;
+    std::streamoff offset = input.tellg();
+    if (offset < 0) {
+        return false;
+    }
+
+    QFile file(QString::fromUtf8(filename.c_str()));
+    if (!file.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+
+    // the mapping is released when the file is destroyed
+    const auto size = static_cast<std::size_t>(file.size());
+    const char* data = reinterpret_cast<const char*>(file.map(0, file.size()));  // NOLINT
+    if (!data) {
+        return false;
+    }
+
+    // the vertex records have a fixed size
+    std::vector<std::size_t> vertex_offsets;
+    std::size_t vertex_size = 0;
+    for (const auto& it : vertex_props) {
+        vertex_offsets.push_back(vertex_size);
+        vertex_size += sizeOfNumber(it.second);
+    }
+
+    const auto vertex_begin = static_cast<std::size_t>(offset);
+    if (vertex_size == 0 || vertex_begin > size
+        || v_count > (size - vertex_begin) / vertex_size) {
+        return false;
+    }
+
+    const bool swap = (format == binary_big_endian) != (std::endian::native == std::endian::big);
+    const int threads = int(std::thread::hardware_concurrency());
+
+    meshPoints.resize(v_count);
+    if (_material && _material->binding == MeshIO::PER_VERTEX) {
+        _material->diffuseColor.resize(v_count);
+    }
+
+    parallel_for(v_count, threads, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            const char* record = data + vertex_begin + i * vertex_size;
+            PropertyArray prop_values {};
+            for (std::size_t j = 0; j < vertex_props.size(); j++) {
+                const char* value = record + vertex_offsets[j];
+                float& prop = prop_values[vertex_props[j].first];
+                switch (vertex_props[j].second) {
+                    case int8:
+                        prop = readNumber<int8_t>(value, swap);
+                        break;
+                    case uint8:
+                        prop = readNumber<uint8_t>(value, swap);
+                        break;
+                    case int16:
+                        prop = readNumber<int16_t>(value, swap);
+                        break;
+                    case uint16:
+                        prop = readNumber<uint16_t>(value, swap);
+                        break;
+                    case int32:
+                        prop = readNumber<int32_t>(value, swap);
+                        break;
+                    case uint32:
+                        prop = readNumber<uint32_t>(value, swap);
+                        break;
+                    case float32:
+                        prop = readNumber<float>(value, swap);
+                        break;
+                    case float64:
+                        prop = readNumber<double>(value, swap);
+                        break;
+                }
+            }
+
+            setVertexProperty(i, prop_values);
+        }
+    });
+
+    // Faces are variable-sized records in general. In the common case of triangles without
+    // further properties they have a fixed size and can be decoded in parallel, too.
+    const std::size_t face_begin = vertex_begin + v_count * vertex_size;
+    const std::size_t face_size = 1 + 3 * sizeof(uint32_t);
+    std::atomic<bool> triangles = face_props.empty() && f_count <= (size - face_begin) / face_size;
+    if (triangles) {
+        meshFacets.resize(f_count);
+        parallel_for(f_count, threads, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end && triangles; i++) {
+                const char* record = data + face_begin + i * face_size;
+                if (static_cast<unsigned char>(record[0]) != 3) {
+                    triangles = false;
+                    break;
+                }
+
+                // out-of-range indices are removed by CleanupMesh()
+                auto& face = meshFacets[i]._aulPoints;
+                for (std::size_t j = 0; j < 3; j++) {
+                    face[j] = static_cast<PointIndex>(
+                        readNumber<uint32_t>(record + 1 + j * sizeof(uint32_t), swap));
+                }
+            }
+        });
+    }
+
+    if (!triangles) {
+        meshFacets.clear();
+        input.seekg(static_cast<std::streamoff>(face_begin), std::ios::beg);
+        Base::InputStream is(input);
+        if (format == binary_little_endian) {
+            is.setByteOrder(Base::Stream::LittleEndian);
+        }
+        else {
+            is.setByteOrder(Base::Stream::BigEndian);
+        }
+
+        if (!ReadFaces(is)) {
+            // let the caller start again from the stream
+            meshPoints.clear();
+            meshFacets.clear();
+            if (_material) {
+                _material->diffuseColor.clear();
+            }
+            input.clear();
+            input.seekg(offset, std::ios::beg);
+            return false;
+        }
+    }
+
+    CleanupMesh();
+    return true;
+}
@@ -53,6 +53,12 @@ public:
      * \return true on success and false otherwise
      */
     bool Load(std::istream& input);
+    /*!
+     * \brief Load the mesh from the input stream that was opened for \a filename.
+     * The body of a binary file is mapped into memory and decoded in parallel.
+     * \return true on success and false otherwise
+     */
+    bool Load(std::istream& input, const std::string& filename);
 
 private:
     bool CheckHeader(std::istream& input) const;
@@ -70,6 +76,7 @@ private:
     bool ReadFaces(Base::InputStream& is);
     bool LoadAscii(std::istream& input);
     bool LoadBinary(std::istream& input);
+    bool LoadMapped(std::istream& input, const std::string& filename);
     void CleanupMesh();
 
 private:
@@ -88,6 +95,7 @@ private:
     static Property propertyOfName(const std::string& name);
     using PropertyArray = std::array<float, num_props>;
     void addVertexProperty(const PropertyArray& prop);
+    void setVertexProperty(std::size_t index, const PropertyArray& prop);
 
     enum Number
     {
@@ -100,6 +108,7 @@ private:
         float32,
         float64
     };
+    static std::size_t sizeOfNumber(Number number);
 
     struct PropertyComp
     {
@@ -0,0 +1,112 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 The FreeCAD Project Association                     *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+#ifndef _PreComp_
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#endif
+
+#include <QFile>
+
+#include "Core/Builder.h"
+#include "Core/Functional.h"
+#include "Core/MeshKernel.h"
+#include <Base/Console.h>
+#include <Base/Profiler.h>
+
+#include "ReaderSTL.h"
+
+
+FC_LOG_LEVEL_INIT("Mesh", true, true)
+
+using namespace MeshCore;
+
+namespace
+{
+// 80 bytes header and the number of facets
+constexpr std::size_t headerSize = 84;
+// normal, three points and 2 bytes attribute
+constexpr std::size_t recordSize = 50;
+}  // namespace
+
+ReaderSTL::ReaderSTL(MeshKernel& kernel)
+    : _kernel(kernel)
+{}
+
+void ReaderSTL::SetThreads(int num)
+{
+    _threads = num;
+}
+
+bool ReaderSTL::LoadBinary(const std::string& filename)
+{
+    ZoneScoped;
+    QFile file(QString::fromUtf8(filename.c_str()));
+    if (!file.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+
+    const auto size = static_cast<std::size_t>(file.size());
+    if (size < headerSize) {
+        return false;
+    }
+
+    // the mapping is released when the file is destroyed
+    const uchar* data = file.map(0, file.size());
+    if (!data) {
+        return false;
+    }
+
+    uint32_t count {};
+    std::memcpy(&count, data + 80, sizeof(count));
+    if (count == 0 || count > (size - headerSize) / recordSize) {
+        return false;
+    }
+
+    FC_TIME_INIT(t);
+    int threads = _threads > 0 ? _threads : int(std::thread::hardware_concurrency());
+
+    MeshHashBuilder builder(_kernel);
+    builder.SetThreads(threads);
+    Base::Vector3f* corners = builder.Initialize(count);
+    parallel_for(count, threads, [data, corners](std::size_t begin, std::size_t end) {
+        std::array<float, 9> coords {};
+        for (std::size_t i = begin; i < end; i++) {
+            // skip the normal, it will be recomputed from the points
+            const uchar* record = data + headerSize + i * recordSize + 3 * sizeof(float);
+            std::memcpy(coords.data(), record, sizeof(coords));
+            for (std::size_t j = 0; j < 3; j++) {
+                corners[3 * i + j].Set(coords[3 * j], coords[3 * j + 1], coords[3 * j + 2]);
+            }
+        }
+    });
+    FC_TIME_LOG(t, "Decode " << count << " STL facets");
+
+    builder.Finish();
+    FC_TIME_LOG(t, "Build mesh");
+
+    return true;
+}
@@ -0,0 +1,66 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 The FreeCAD Project Association                     *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+
+#ifndef MESH_IO_READER_STL_H
+#define MESH_IO_READER_STL_H
+
+#include <Mod/Mesh/MeshGlobal.h>
+#include <string>
+
+namespace MeshCore
+{
+
+class MeshKernel;
+
+/** Loads a binary STL file from disk.
+ * The file is mapped into memory and the fixed-size facet records are decoded in parallel.
+ * Duplicated points are merged with MeshHashBuilder.
+ */
+class MeshExport ReaderSTL
+{
+public:
+    /*!
+     * \brief ReaderSTL
+     */
+    explicit ReaderSTL(MeshKernel& kernel);
+    /*!
+     * \brief Sets the number of threads. A value < 1 uses all cores.
+     */
+    void SetThreads(int num);
+    /*!
+     * \brief Load the mesh from a binary STL file
+     * \return true on success and false if the file cannot be mapped into memory or doesn't
+     * look like a binary STL file. In this case the mesh kernel is left unchanged.
+     */
+    bool LoadBinary(const std::string& filename);
+
+private:
+    MeshKernel& _kernel;
+    int _threads {0};
+};
+
+}  // namespace MeshCore
+
+
+#endif  // MESH_IO_READER_STL_H
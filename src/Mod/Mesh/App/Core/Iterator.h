@@ -344,10 +344,6 @@ public:
     {
         return this->_clIter->IsFlag(tF);
     }
-    void SetProperty(unsigned long uP) const
-    {
-        this->_clIter->SetProperty(uP);
-    }
     //@}
 
 private:
@@ -39,6 +39,7 @@
 #include "IO/Reader3MF.h"
 #include "IO/ReaderOBJ.h"
 #include "IO/ReaderPLY.h"
+#include "IO/ReaderSTL.h"
 #include "IO/Writer3MF.h"
 #include "IO/WriterInventor.h"
 #include "IO/WriterOBJ.h"
@@ -47,6 +48,7 @@
 #include <Base/Exception.h>
 #include <Base/FileInfo.h>
 #include <Base/Placement.h>
+#include <Base/Profiler.h>
 #include <Base/Reader.h>
 #include <Base/Sequencer.h>
 #include <Base/Stream.h>
@@ -222,6 +224,7 @@ MeshIO::Format MeshInput::getFormat(const char* FileName)
 
 bool MeshInput::LoadAny(const char* FileName)
 {
+    ZoneScoped;
     // ask for read permission
     Base::FileInfo fi(FileName);
     if (!fi.exists() || !fi.isFile()) {
@@ -241,7 +244,7 @@ bool MeshInput::LoadAny(const char* FileName)
     // read file
     bool ok = false;
     if (fi.hasExtension({"stl", "ast"})) {
-        ok = LoadSTL(str);
+        ok = LoadSTL(str, FileName);
     }
     else if (fi.hasExtension("iv")) {
         ok = LoadInventor(str);
@@ -271,7 +274,7 @@ bool MeshInput::LoadAny(const char* FileName)
         ok = LoadOFF(str);
     }
     else if (fi.hasExtension("ply")) {
-        ok = LoadPLY(str);
+        ok = LoadPLY(str, FileName);
     }
     else {
         throw Base::FileException("File extension not supported", FileName);
@@ -317,6 +320,12 @@ bool MeshInput::LoadFormat(std::istream& input, MeshIO::Format fmt)
  */
 bool MeshInput::LoadSTL(std::istream& input)
 {
+    return LoadSTL(input, nullptr);
+}
+
+bool MeshInput::LoadSTL(std::istream& input, const char* filename)
+{
+    ZoneScoped;
     char szBuf[200];
 
     if (!input || input.bad()) {
@@ -352,6 +361,13 @@ bool MeshInput::LoadSTL(std::istream& input)
             && !strstr(szBuf, "VERTEX") && !strstr(szBuf, "ENDFACET")
             && !strstr(szBuf, "ENDLOOP")) {
             // probably binary STL
+            if (filename) {
+                ReaderSTL reader(this->_rclMesh);
+                if (reader.LoadBinary(filename)) {
+                    return true;
+                }
+            }
+
             buf->pubseekoff(0, std::ios::beg, std::ios::in);
             return LoadBinarySTL(input);
         }
@@ -394,6 +410,7 @@ bool MeshInput::LoadOBJ(std::istream& input)
 
 bool MeshInput::LoadOBJ(std::istream& input, const char* filename)
 {
+    ZoneScoped;
     ReaderOBJ reader(this->_rclMesh, this->_material);
     if (reader.Load(input)) {
         _groupNames = reader.GetGroupNames();
@@ -664,6 +681,13 @@ bool MeshInput::LoadPLY(std::istream& input)
     return reader.Load(input);
 }
 
+bool MeshInput::LoadPLY(std::istream& input, const char* filename)
+{
+    ZoneScoped;
+    ReaderPLY reader(this->_rclMesh, this->_material);
+    return reader.Load(input, filename);
+}
+
 bool MeshInput::LoadMeshNode(std::istream& input)
 {
     boost::regex rx_p("^v\\s+([-+]?[0-9]*)\\.?([0-9]+([eE][-+]?[0-9]+)?)"
@@ -800,6 +824,7 @@ bool MeshInput::LoadAsciiSTL(std::istream& input)
 /** Loads a binary STL file. */
 bool MeshInput::LoadBinarySTL(std::istream& input)
 {
+    ZoneScoped;
     char szInfo[80];
     Base::Vector3f clVects[4];
     uint16_t usAtt = 0;
@@ -1369,6 +1394,7 @@ MeshIO::Format MeshOutput::GetFormat(const char* FileName)
 /// Save in a file, format is decided by the extension if not explicitly given
 bool MeshOutput::SaveAny(const char* FileName, MeshIO::Format format) const
 {
+    ZoneScoped;
     // ask for write permission
     Base::FileInfo file(FileName);
     Base::FileInfo directory(file.dirPath());
@@ -1627,6 +1653,7 @@ bool MeshOutput::SaveAsciiSTL(std::ostream& output) const
 /** Saves the mesh object into a binary file. */
 bool MeshOutput::SaveBinarySTL(std::ostream& output) const
 {
+    ZoneScoped;
     MeshFacetIterator clIter(_rclMesh), clEnd(_rclMesh);
     clIter.Transform(this->_transform);
     const MeshGeomFacet* pclFacet {};
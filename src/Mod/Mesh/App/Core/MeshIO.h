@@ -127,6 +127,10 @@ public:
      * Therefore the file header gets checked to decide if the file is binary or not.
      */
     bool LoadSTL(std::istream& input);
+    /** Loads an STL file either in binary or ASCII format.
+     * A binary file is mapped into memory and decoded in parallel.
+     */
+    bool LoadSTL(std::istream& input, const char* filename);
     /** Loads an ASCII STL file. */
     bool LoadAsciiSTL(std::istream& input);
     /** Loads a binary STL file. */
@@ -141,6 +145,8 @@ public:
     bool LoadOFF(std::istream& input);
     /** Loads a PLY Mesh file. */
     bool LoadPLY(std::istream& input);
+    /** Loads a PLY Mesh file. The body of a binary file is decoded in parallel. */
+    bool LoadPLY(std::istream& input, const char* filename);
     /** Loads the mesh object from an XML file. */
     void LoadXML(Base::XMLReader& reader);
     /** Loads the mesh object from a 3MF file. */
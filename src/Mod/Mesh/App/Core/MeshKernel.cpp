@@ -505,13 +505,12 @@ bool MeshKernel::DeleteFacet(FacetIndex ulInd)
 
 void MeshKernel::DeleteFacets(const std::vector<FacetIndex>& raulFacets)
 {
-    _aclPointArray.SetProperty(0);
-
     // number of referencing facets per point
+    std::vector<unsigned long> references(_aclPointArray.size(), 0);
     for (const auto& pF : _aclFacetArray) {
-        _aclPointArray[pF._aulPoints[0]]._ulProp++;
-        _aclPointArray[pF._aulPoints[1]]._ulProp++;
-        _aclPointArray[pF._aulPoints[2]]._ulProp++;
+        references[pF._aulPoints[0]]++;
+        references[pF._aulPoints[1]]++;
+        references[pF._aulPoints[2]]++;
     }
 
     // invalidate facet and adjust number of point references
@@ -519,16 +518,16 @@ void MeshKernel::DeleteFacets(const std::vector<FacetIndex>& raulFacets)
     for (FacetIndex index : raulFacets) {
         MeshFacet& rclFacet = _aclFacetArray[index];
         rclFacet.SetInvalid();
-        _aclPointArray[rclFacet._aulPoints[0]]._ulProp--;
-        _aclPointArray[rclFacet._aulPoints[1]]._ulProp--;
-        _aclPointArray[rclFacet._aulPoints[2]]._ulProp--;
+        references[rclFacet._aulPoints[0]]--;
+        references[rclFacet._aulPoints[1]]--;
+        references[rclFacet._aulPoints[2]]--;
     }
 
     // invalidate all unreferenced points
     _aclPointArray.ResetInvalid();
-    for (auto& pP : _aclPointArray) {
-        if (pP._ulProp == 0) {
-            pP.SetInvalid();
+    for (PointIndex index = 0; index < _aclPointArray.size(); index++) {
+        if (references[index] == 0) {
+            _aclPointArray[index].SetInvalid();
         }
     }
 
@@ -589,27 +588,27 @@ void MeshKernel::DeletePoints(const std::vector<PointIndex>& raulPoints)
     }
 
     // delete facets if at least one corner point is invalid
-    _aclPointArray.SetProperty(0);
+    std::vector<unsigned long> references(_aclPointArray.size(), 0);
     for (auto& pF : _aclFacetArray) {
-        MeshPoint& rclP0 = _aclPointArray[pF._aulPoints[0]];
-        MeshPoint& rclP1 = _aclPointArray[pF._aulPoints[1]];
-        MeshPoint& rclP2 = _aclPointArray[pF._aulPoints[2]];
+        const MeshPoint& rclP0 = _aclPointArray[pF._aulPoints[0]];
+        const MeshPoint& rclP1 = _aclPointArray[pF._aulPoints[1]];
+        const MeshPoint& rclP2 = _aclPointArray[pF._aulPoints[2]];
 
         if (!rclP0.IsValid() || !rclP1.IsValid() || !rclP2.IsValid()) {
             pF.SetInvalid();
         }
         else {
             pF.ResetInvalid();
-            rclP0._ulProp++;
-            rclP1._ulProp++;
-            rclP2._ulProp++;
+            references[pF._aulPoints[0]]++;
+            references[pF._aulPoints[1]]++;
+            references[pF._aulPoints[2]]++;
         }
     }
 
     // invalidate all unreferenced points to delete them
-    for (auto& pP : _aclPointArray) {
-        if (pP._ulProp == 0) {
-            pP.SetInvalid();
+    for (PointIndex index = 0; index < _aclPointArray.size(); index++) {
+        if (references[index] == 0) {
+            _aclPointArray[index].SetInvalid();
         }
     }
 
@@ -1049,8 +1048,20 @@ void MeshKernel::Read(std::istream& rclIn)
         if (ratio < 2.5F) {
             // the stored mesh kernel might be empty
             if (uCtPts > 0) {
-                pointArray.resize(uCtPts);
-                rclIn.read((char*)pointArray.data(), uCtPts * sizeof(MeshPoint));
+                // the points were written as raw memory of the former point layout
+                struct LegacyPoint
+                {
+                    float x, y, z;
+                    unsigned char flag;
+                    unsigned long prop;
+                };
+                std::vector<LegacyPoint> legacyPoints(uCtPts);
+                rclIn.read((char*)legacyPoints.data(), uCtPts * sizeof(LegacyPoint));
+                pointArray.reserve(uCtPts);
+                for (const auto& it : legacyPoints) {
+                    pointArray.emplace_back(it.x, it.y, it.z);
+                    pointArray.back()._ucFlag = it.flag;
+                }
             }
             if (uCtFts > 0) {
                 facetArray.resize(uCtFts);
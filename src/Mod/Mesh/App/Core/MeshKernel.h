@@ -97,10 +97,10 @@ public:
         return static_cast<unsigned long>(_aclPointArray.size());
     }
     /// Returns the number of required memory in bytes
-    unsigned int GetMemSize() const
+    std::size_t GetMemSize() const
     {
-        return static_cast<unsigned int>(_aclPointArray.size() * sizeof(MeshPoint)
-                                         + _aclFacetArray.size() * sizeof(MeshFacet));
+        return _aclPointArray.size() * sizeof(MeshPoint)
+            + _aclFacetArray.size() * sizeof(MeshFacet);
     }
     /// Determines the bounding box
     const Base::BoundBox3f& GetBoundBox() const
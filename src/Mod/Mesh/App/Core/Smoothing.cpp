@@ -22,13 +22,17 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <algorithm>
 #include <cmath>
+#include <thread>
 #endif
 
+#include <Base/Sequencer.h>
 #include <Base/Tools.h>
 
 #include "Algorithm.h"
 #include "Approximation.h"
+#include "Functional.h"
 #include "Iterator.h"
 #include "MeshKernel.h"
 #include "Smoothing.h"
@@ -49,119 +53,153 @@ void AbstractSmoothing::initialize(Component comp, Continuity cont)
     this->continuity = cont;
 }
 
-PlaneFitSmoothing::PlaneFitSmoothing(MeshKernel& m)
-    : AbstractSmoothing(m)
-{}
-
-void PlaneFitSmoothing::Smooth(unsigned int iterations)
+void AbstractSmoothing::SetThreads(int num)
 {
-    MeshCore::MeshPoint center;
-    MeshCore::MeshPointArray PointArray = kernel.GetPoints();
+    threads = num;
+}
 
-    MeshCore::MeshPointIterator v_it(kernel);
-    MeshCore::MeshRefPointToPoints vv_it(kernel);
-    MeshCore::MeshPointArray::_TConstIterator v_beg = kernel.GetPoints().begin();
+namespace
+{
+/*
+ * Computes the new positions of the points index(0), ..., index(count - 1) with func and
+ * assigns them afterwards. As func only sees the positions of the previous iteration the
+ * result doesn't depend on the order of the points and thus the points can be split into
+ * chunks that are processed concurrently.
+ */
+template<class Index, class Func>
+void updatePoints(MeshKernel& kernel,
+                  std::vector<Base::Vector3f>& buffer,
+                  int threads,
+                  std::size_t count,
+                  Index index,
+                  Func func)
+{
+    buffer.resize(count);
+    if (threads < 1) {
+        threads = int(std::thread::hardware_concurrency());
+    }
+    threads = parallel_threads(threads, count);
+    parallel_for(count, threads, [&](std::size_t first, std::size_t last) {
+        for (std::size_t i = first; i < last; i++) {
+            buffer[i] = func(index(i));
+        }
+    });
 
-    for (unsigned int i = 0; i < iterations; i++) {
-        Base::Vector3f N, L;
-        for (v_it.Begin(); v_it.More(); v_it.Next()) {
-            MeshCore::PlaneFit pf;
-            pf.AddPoint(*v_it);
-            center = *v_it;
-            const std::set<PointIndex>& cv = vv_it[v_it.Position()];
-            if (cv.size() < 3) {
-                continue;
-            }
+    for (std::size_t i = 0; i < count; i++) {
+        kernel.SetPoint(index(i), buffer[i]);
+    }
+}
 
-            std::set<PointIndex>::const_iterator cv_it;
-            for (cv_it = cv.begin(); cv_it != cv.end(); ++cv_it) {
-                pf.AddPoint(v_beg[*cv_it]);
-                center += v_beg[*cv_it];
-            }
+Base::Vector3f planeFitPoint(const MeshPointArray& points,
+                             const MeshRefPointToPoints& vv_it,
+                             float maximum,
+                             PointIndex pos)
+{
+    const MeshPoint& point = points[pos];
+    MeshIndexRange cv = vv_it[pos];
+    if (cv.size() < 3) {
+        return point;
+    }
 
-            float scale = 1.0F / (static_cast<float>(cv.size()) + 1.0F);
-            center.Scale(scale, scale, scale);
+    PlaneFit pf;
+    pf.AddPoint(point);
+    Base::Vector3f center = point;
+    for (ElementIndex index : cv) {
+        pf.AddPoint(points[index]);
+        center += points[index];
+    }
 
-            // get the mean plane of the current vertex with the surrounding vertices
-            pf.Fit();
-            N = pf.GetNormal();
-            N.Normalize();
+    float scale = 1.0F / (static_cast<float>(cv.size()) + 1.0F);
+    center.Scale(scale, scale, scale);
 
-            // look in which direction we should move the vertex
-            L.Set(v_it->x - center.x, v_it->y - center.y, v_it->z - center.z);
-            if (N * L < 0.0F) {
-                N.Scale(-1.0, -1.0, -1.0);
-            }
+    // get the mean plane of the current vertex with the surrounding vertices
+    pf.Fit();
+    Base::Vector3f N = pf.GetNormal();
+    N.Normalize();
 
-            // maximum value to move is distance to mean plane
-            float d = std::min<float>(std::fabs(this->maximum), fabs(N * L));
-            N.Scale(d, d, d);
+    // look in which direction we should move the vertex
+    Base::Vector3f L = point - center;
+    if (N * L < 0.0F) {
+        N.Scale(-1.0, -1.0, -1.0);
+    }
 
-            PointArray[v_it.Position()].Set(v_it->x - N.x, v_it->y - N.y, v_it->z - N.z);
-        }
+    // maximum value to move is distance to mean plane
+    float d = std::min<float>(std::fabs(maximum), std::fabs(N * L));
+    N.Scale(d, d, d);
 
-        // assign values without affecting iterators
-        PointIndex count = kernel.CountPoints();
-        for (PointIndex idx = 0; idx < count; idx++) {
-            kernel.SetPoint(idx, PointArray[idx]);
-        }
-    }
+    return point - N;
 }
 
-void PlaneFitSmoothing::SmoothPoints(unsigned int iterations,
-                                     const std::vector<PointIndex>& point_indices)
+Base::Vector3f umbrellaPoint(const MeshPointArray& points,
+                             const MeshRefPointToPoints& vv_it,
+                             const MeshRefPointToFacets& vf_it,
+                             double stepsize,
+                             PointIndex pos)
 {
-    MeshCore::MeshPoint center;
-    MeshCore::MeshPointArray PointArray = kernel.GetPoints();
-
-    MeshCore::MeshPointIterator v_it(kernel);
-    MeshCore::MeshRefPointToPoints vv_it(kernel);
-    MeshCore::MeshPointArray::_TConstIterator v_beg = kernel.GetPoints().begin();
-
-    for (unsigned int i = 0; i < iterations; i++) {
-        Base::Vector3f N, L;
-        for (PointIndex it : point_indices) {
-            v_it.Set(it);
-            MeshCore::PlaneFit pf;
-            pf.AddPoint(*v_it);
-            center = *v_it;
-            const std::set<PointIndex>& cv = vv_it[v_it.Position()];
-            if (cv.size() < 3) {
-                continue;
-            }
+    const MeshPoint& point = points[pos];
+    MeshIndexRange cv = vv_it[pos];
+    if (cv.size() < 3) {
+        return point;
+    }
+    if (cv.size() != vf_it[pos].size()) {
+        // do nothing for border points
+        return point;
+    }
 
-            std::set<PointIndex>::const_iterator cv_it;
-            for (cv_it = cv.begin(); cv_it != cv.end(); ++cv_it) {
-                pf.AddPoint(v_beg[*cv_it]);
-                center += v_beg[*cv_it];
-            }
+    // the neighbours are stored contiguously, so only sum up the differences here
+    double delx = 0.0, dely = 0.0, delz = 0.0;
+    for (ElementIndex index : cv) {
+        const MeshPoint& neighbour = points[index];
+        delx += static_cast<double>(neighbour.x - point.x);
+        dely += static_cast<double>(neighbour.y - point.y);
+        delz += static_cast<double>(neighbour.z - point.z);
+    }
 
-            float scale = 1.0F / (static_cast<float>(cv.size()) + 1.0F);
-            center.Scale(scale, scale, scale);
+    double w = stepsize / double(cv.size());
+    return Base::Vector3f(static_cast<float>(static_cast<double>(point.x) + w * delx),
+                          static_cast<float>(static_cast<double>(point.y) + w * dely),
+                          static_cast<float>(static_cast<double>(point.z) + w * delz));
+}
+}  // namespace
 
-            // get the mean plane of the current vertex with the surrounding vertices
-            pf.Fit();
-            N = pf.GetNormal();
-            N.Normalize();
+PlaneFitSmoothing::PlaneFitSmoothing(MeshKernel& m)
+    : AbstractSmoothing(m)
+{}
 
-            // look in which direction we should move the vertex
-            L.Set(v_it->x - center.x, v_it->y - center.y, v_it->z - center.z);
-            if (N * L < 0.0F) {
-                N.Scale(-1.0, -1.0, -1.0);
-            }
+void PlaneFitSmoothing::Smooth(unsigned int iterations)
+{
+    MeshCore::MeshRefPointToPoints vv_it(kernel);
+    const MeshCore::MeshPointArray& points = kernel.GetPoints();
+    auto index = [](std::size_t i) {
+        return PointIndex(i);
+    };
+    auto fit = [this, &points, &vv_it](PointIndex pos) {
+        return planeFitPoint(points, vv_it, this->maximum, pos);
+    };
 
-            // maximum value to move is distance to mean plane
-            float d = std::min<float>(std::fabs(this->maximum), fabs(N * L));
-            N.Scale(d, d, d);
+    Base::SequencerLauncher seq("Smoothing...", iterations);
+    for (unsigned int i = 0; i < iterations; i++) {
+        updatePoints(kernel, buffer, threads, points.size(), index, fit);
+        seq.next(true);
+    }
+}
 
-            PointArray[v_it.Position()].Set(v_it->x - N.x, v_it->y - N.y, v_it->z - N.z);
-        }
+void PlaneFitSmoothing::SmoothPoints(unsigned int iterations,
+                                     const std::vector<PointIndex>& point_indices)
+{
+    MeshCore::MeshRefPointToPoints vv_it(kernel);
+    const MeshCore::MeshPointArray& points = kernel.GetPoints();
+    auto index = [&point_indices](std::size_t i) {
+        return point_indices[i];
+    };
+    auto fit = [this, &points, &vv_it](PointIndex pos) {
+        return planeFitPoint(points, vv_it, this->maximum, pos);
+    };
 
-        // assign values without affecting iterators
-        PointIndex count = kernel.CountPoints();
-        for (PointIndex idx = 0; idx < count; idx++) {
-            kernel.SetPoint(idx, PointArray[idx]);
-        }
+    Base::SequencerLauncher seq("Smoothing...", iterations);
+    for (unsigned int i = 0; i < iterations; i++) {
+        updatePoints(kernel, buffer, threads, point_indices.size(), index, fit);
+        seq.next(true);
     }
 }
 
@@ -174,36 +212,14 @@ void LaplaceSmoothing::Umbrella(const MeshRefPointToPoints& vv_it,
                                 double stepsize)
 {
     const MeshCore::MeshPointArray& points = kernel.GetPoints();
-    MeshCore::MeshPointArray::_TConstIterator v_it, v_beg = points.begin(), v_end = points.end();
-
-    PointIndex pos = 0;
-    for (v_it = points.begin(); v_it != v_end; ++v_it, ++pos) {
-        const std::set<PointIndex>& cv = vv_it[pos];
-        if (cv.size() < 3) {
-            continue;
-        }
-        if (cv.size() != vf_it[pos].size()) {
-            // do nothing for border points
-            continue;
-        }
-
-        size_t n_count = cv.size();
-        double w {};
-        w = 1.0 / double(n_count);
-
-        double delx = 0.0, dely = 0.0, delz = 0.0;
-        std::set<PointIndex>::const_iterator cv_it;
-        for (cv_it = cv.begin(); cv_it != cv.end(); ++cv_it) {
-            delx += w * static_cast<double>((v_beg[*cv_it]).x - v_it->x);
-            dely += w * static_cast<double>((v_beg[*cv_it]).y - v_it->y);
-            delz += w * static_cast<double>((v_beg[*cv_it]).z - v_it->z);
-        }
+    auto index = [](std::size_t i) {
+        return PointIndex(i);
+    };
+    auto umbrella = [&points, &vv_it, &vf_it, stepsize](PointIndex pos) {
+        return umbrellaPoint(points, vv_it, vf_it, stepsize, pos);
+    };
 
-        float x = static_cast<float>(static_cast<double>(v_it->x) + stepsize * delx);
-        float y = static_cast<float>(static_cast<double>(v_it->y) + stepsize * dely);
-        float z = static_cast<float>(static_cast<double>(v_it->z) + stepsize * delz);
-        kernel.SetPoint(pos, x, y, z);
-    }
+    updatePoints(kernel, buffer, threads, points.size(), index, umbrella);
 }
 
 void LaplaceSmoothing::Umbrella(const MeshRefPointToPoints& vv_it,
@@ -212,35 +228,14 @@ void LaplaceSmoothing::Umbrella(const MeshRefPointToPoints& vv_it,
                                 const std::vector<PointIndex>& point_indices)
 {
     const MeshCore::MeshPointArray& points = kernel.GetPoints();
-    MeshCore::MeshPointArray::_TConstIterator v_beg = points.begin();
-
-    for (PointIndex it : point_indices) {
-        const std::set<PointIndex>& cv = vv_it[it];
-        if (cv.size() < 3) {
-            continue;
-        }
-        if (cv.size() != vf_it[it].size()) {
-            // do nothing for border points
-            continue;
-        }
-
-        size_t n_count = cv.size();
-        double w {};
-        w = 1.0 / double(n_count);
-
-        double delx = 0.0, dely = 0.0, delz = 0.0;
-        std::set<PointIndex>::const_iterator cv_it;
-        for (cv_it = cv.begin(); cv_it != cv.end(); ++cv_it) {
-            delx += w * static_cast<double>((v_beg[*cv_it]).x - (v_beg[it]).x);
-            dely += w * static_cast<double>((v_beg[*cv_it]).y - (v_beg[it]).y);
-            delz += w * static_cast<double>((v_beg[*cv_it]).z - (v_beg[it]).z);
-        }
+    auto index = [&point_indices](std::size_t i) {
+        return point_indices[i];
+    };
+    auto umbrella = [&points, &vv_it, &vf_it, stepsize](PointIndex pos) {
+        return umbrellaPoint(points, vv_it, vf_it, stepsize, pos);
+    };
 
-        float x = static_cast<float>(static_cast<double>((v_beg[it]).x) + stepsize * delx);
-        float y = static_cast<float>(static_cast<double>((v_beg[it]).y) + stepsize * dely);
-        float z = static_cast<float>(static_cast<double>((v_beg[it]).z) + stepsize * delz);
-        kernel.SetPoint(it, x, y, z);
-    }
+    updatePoints(kernel, buffer, threads, point_indices.size(), index, umbrella);
 }
 
 void LaplaceSmoothing::Smooth(unsigned int iterations)
@@ -248,8 +243,10 @@ void LaplaceSmoothing::Smooth(unsigned int iterations)
     MeshCore::MeshRefPointToPoints vv_it(kernel);
     MeshCore::MeshRefPointToFacets vf_it(kernel);
 
+    Base::SequencerLauncher seq("Smoothing...", iterations);
     for (unsigned int i = 0; i < iterations; i++) {
         Umbrella(vv_it, vf_it, lambda);
+        seq.next(true);
     }
 }
 
@@ -259,8 +256,10 @@ void LaplaceSmoothing::SmoothPoints(unsigned int iterations,
     MeshCore::MeshRefPointToPoints vv_it(kernel);
     MeshCore::MeshRefPointToFacets vf_it(kernel);
 
+    Base::SequencerLauncher seq("Smoothing...", iterations);
     for (unsigned int i = 0; i < iterations; i++) {
         Umbrella(vv_it, vf_it, lambda, point_indices);
+        seq.next(true);
     }
 }
 
@@ -275,9 +274,11 @@ void TaubinSmoothing::Smooth(unsigned int iterations)
 
     // Theoretically Taubin does not shrink the surface
     iterations = (iterations + 1) / 2;  // two steps per iteration
+    Base::SequencerLauncher seq("Smoothing...", iterations);
     for (unsigned int i = 0; i < iterations; i++) {
         Umbrella(vv_it, vf_it, GetLambda());
         Umbrella(vv_it, vf_it, -(GetLambda() + micro));
+        seq.next(true);
     }
 }
 
@@ -289,9 +290,11 @@ void TaubinSmoothing::SmoothPoints(unsigned int iterations,
 
     // Theoretically Taubin does not shrink the surface
     iterations = (iterations + 1) / 2;  // two steps per iteration
+    Base::SequencerLauncher seq("Smoothing...", iterations);
     for (unsigned int i = 0; i < iterations; i++) {
         Umbrella(vv_it, vf_it, GetLambda(), point_indices);
         Umbrella(vv_it, vf_it, -(GetLambda() + micro), point_indices);
+        seq.next(true);
     }
 }
 
@@ -367,7 +370,7 @@ void MedianFilterSmoothing::UpdatePoints(const MeshRefFacetToFacets& ff_it,
     for (FacetIndex pos = 0; pos < facets.size(); pos++) {
         iter.Set(pos);
         Base::Vector3d refNormal = Base::toVector<double>(iter->GetNormal());
-        const std::set<FacetIndex>& cv = ff_it[pos];
+        MeshIndexRange cv = ff_it[pos];
         const MeshCore::MeshFacet& facet = facets[pos];
 
         std::vector<AngleNormal> anglesWithFaces;
@@ -396,7 +399,7 @@ void MedianFilterSmoothing::UpdatePoints(const MeshRefFacetToFacets& ff_it,
     // Step 2: move vertices
     for (auto pos : point_indices) {
         Base::Vector3d P = Base::toVector<double>(points[pos]);
-        const std::set<FacetIndex>& cv = vf_it[pos];
+        MeshIndexRange cv = vf_it[pos];
 
         double totalArea = 0.0;
         Base::Vector3d totalvT;
@@ -26,6 +26,8 @@
 #include <limits>
 #include <vector>
 
+#include <Base/Vector3D.h>
+
 #include "Definitions.h"
 
 
@@ -62,6 +64,10 @@ public:
     AbstractSmoothing& operator=(AbstractSmoothing&&) = delete;
 
     void initialize(Component comp, Continuity cont);
+    /** Sets the number of threads used to smooth the points. A value < 1 uses all cores.
+     * The result doesn't depend on the number of threads.
+     */
+    void SetThreads(int num);
 
     /** Smooth the triangle mesh. */
     virtual void Smooth(unsigned int) = 0;
@@ -73,6 +79,9 @@ protected:
 
     Component component {Normal};
     Continuity continuity {C0};
+    int threads {0};
+    /** Holds the new point positions until all points of an iteration are computed. */
+    std::vector<Base::Vector3f> buffer;
     // NOLINTEND
 };
 
@@ -117,7 +117,7 @@ unsigned long MeshKernel::VisitNeighbourFacetsOverCorners(MeshFacetVisitor& rclF
              ++pCurrFacet) {
             for (int i = 0; i < 3; i++) {
                 const MeshFacet& rclFacet = raclFAry[*pCurrFacet];
-                const std::set<FacetIndex>& raclNB = clRPF[rclFacet._aulPoints[i]];
+                MeshIndexRange raclNB = clRPF[rclFacet._aulPoints[i]];
                 for (FacetIndex pINb : raclNB) {
                     if (!pFBegin[pINb].IsFlag(MeshFacet::VISIT)) {
                         // only visit if VISIT Flag not set
@@ -159,7 +159,7 @@ unsigned long MeshKernel::VisitNeighbourPoints(MeshPointVisitor& rclPVisitor,
         // visit all neighbours of the current level
         for (clCurrIter = aclCurrentLevel.begin(); clCurrIter < aclCurrentLevel.end();
              ++clCurrIter) {
-            const std::set<PointIndex>& raclNB = clNPs[*clCurrIter];
+            MeshIndexRange raclNB = clNPs[*clCurrIter];
             for (PointIndex pINb : raclNB) {
                 if (!pPBegin[pINb].IsFlag(MeshPoint::VISIT)) {
                     // only visit if VISIT Flag not set
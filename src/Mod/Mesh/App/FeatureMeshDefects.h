@@ -54,6 +54,11 @@ public:
     /// recalculate the Feature
     App::DocumentObjectExecReturn* execute() override;
     short mustExecute() const override;
+    /// the fixes only read the source mesh and work on their own copy
+    bool isRecomputeThreadSafe() const override
+    {
+        return true;
+    }
     //@}
 
     /// returns the type name of the ViewProvider
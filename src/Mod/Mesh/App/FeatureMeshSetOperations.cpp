@@ -22,6 +22,9 @@
 
 #include "PreCompiled.h"
 
+#include <Base/Console.h>
+
+#include "Core/Boolean.h"
 #include "Core/Iterator.h"
 #include "Core/SetOperations.h"
 
@@ -39,6 +42,7 @@ SetOperations::SetOperations()
     ADD_PROPERTY(Source1, (nullptr));
     ADD_PROPERTY(Source2, (nullptr));
     ADD_PROPERTY(OperationType, ("union"));
+    ADD_PROPERTY(Exact, (false));
 }
 
 short SetOperations::mustExecute() const
@@ -53,6 +57,9 @@ short SetOperations::mustExecute() const
         if (OperationType.isTouched()) {
             return 1;
         }
+        if (Exact.isTouched()) {
+            return 1;
+        }
     }
 
     return 0;
@@ -91,12 +98,25 @@ App::DocumentObjectExecReturn* SetOperations::execute()
                                    " or 'difference' or 'inner' or 'outer'");
         }
 
-        MeshCore::SetOperations setOp(meshKernel1.getKernel(),
-                                      meshKernel2.getKernel(),
-                                      pcKernel->getKernel(),
-                                      type,
-                                      1.0e-5F);
-        setOp.Do();
+        if (Exact.getValue()) {
+            MeshCore::MeshBoolean boolOp(meshKernel1.getKernel(),
+                                         meshKernel2.getKernel(),
+                                         pcKernel->getKernel(),
+                                         type);
+            if (!boolOp.Do()) {
+                Base::Console().warning("%s: %lu facets couldn't be cut cleanly\n",
+                                        getNameInDocument(),
+                                        boolOp.CountFailedFacets());
+            }
+        }
+        else {
+            MeshCore::SetOperations setOp(meshKernel1.getKernel(),
+                                          meshKernel2.getKernel(),
+                                          pcKernel->getKernel(),
+                                          type,
+                                          1.0e-5F);
+            setOp.Do();
+        }
         Mesh.setValuePtr(pcKernel.release());
     }
     else {
@@ -46,6 +46,8 @@ public:
     App::PropertyLink Source1;
     App::PropertyLink Source2;
     App::PropertyString OperationType;
+    /// Use exact predicates instead of a tolerance
+    App::PropertyBool Exact;
 
     /** @name methods override Feature */
     //@{
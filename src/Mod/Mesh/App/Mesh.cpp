@@ -38,6 +38,7 @@
 #include <Base/ViewProj.h>
 #include <Base/Writer.h>
 
+#include "Core/Boolean.h"
 #include "Core/Builder.h"
 #include "Core/Decimation.h"
 #include "Core/Degeneration.h"
@@ -367,7 +368,7 @@ void MeshObject::getFaces(std::vector<Base::Vector3d>& Points,
     }
 }
 
-unsigned int MeshObject::getMemSize() const
+std::size_t MeshObject::getMemSize() const
 {
     return _kernel.GetMemSize();
 }
@@ -1217,84 +1218,78 @@ void MeshObject::trimByPlane(const Base::Vector3f& base, const Base::Vector3f& n
     }
 }
 
-MeshObject* MeshObject::unite(const MeshObject& mesh) const
+namespace
+{
+MeshCore::MeshKernel booleanOperation(const MeshCore::MeshKernel& kernel1,
+                                      const MeshCore::MeshKernel& kernel2,
+                                      MeshCore::SetOperations::OperationType type,
+                                      float epsilon,
+                                      bool exact)
 {
     MeshCore::MeshKernel result;
+    if (exact) {
+        MeshCore::MeshBoolean boolOp(kernel1, kernel2, result, type);
+        if (!boolOp.Do()) {
+            Base::Console().warning("Boolean operation: %lu facets couldn't be cut cleanly\n",
+                                    boolOp.CountFailedFacets());
+        }
+    }
+    else {
+        MeshCore::SetOperations setOp(kernel1, kernel2, result, type, epsilon);
+        setOp.Do();
+    }
+    return result;
+}
+}  // namespace
+
+MeshObject* MeshObject::unite(const MeshObject& mesh, bool exact) const
+{
     MeshCore::MeshKernel kernel1(this->_kernel);
     kernel1.Transform(this->_Mtrx);
     MeshCore::MeshKernel kernel2(mesh._kernel);
     kernel2.Transform(mesh._Mtrx);
-    MeshCore::SetOperations setOp(kernel1,
-                                  kernel2,
-                                  result,
-                                  MeshCore::SetOperations::Union,
-                                  Epsilon);
-    setOp.Do();
-    return new MeshObject(result);
+    return new MeshObject(
+        booleanOperation(kernel1, kernel2, MeshCore::SetOperations::Union, Epsilon, exact));
 }
 
-MeshObject* MeshObject::intersect(const MeshObject& mesh) const
+MeshObject* MeshObject::intersect(const MeshObject& mesh, bool exact) const
 {
-    MeshCore::MeshKernel result;
     MeshCore::MeshKernel kernel1(this->_kernel);
     kernel1.Transform(this->_Mtrx);
     MeshCore::MeshKernel kernel2(mesh._kernel);
     kernel2.Transform(mesh._Mtrx);
-    MeshCore::SetOperations setOp(kernel1,
-                                  kernel2,
-                                  result,
-                                  MeshCore::SetOperations::Intersect,
-                                  Epsilon);
-    setOp.Do();
-    return new MeshObject(result);
+    return new MeshObject(
+        booleanOperation(kernel1, kernel2, MeshCore::SetOperations::Intersect, Epsilon, exact));
 }
 
-MeshObject* MeshObject::subtract(const MeshObject& mesh) const
+MeshObject* MeshObject::subtract(const MeshObject& mesh, bool exact) const
 {
-    MeshCore::MeshKernel result;
     MeshCore::MeshKernel kernel1(this->_kernel);
     kernel1.Transform(this->_Mtrx);
     MeshCore::MeshKernel kernel2(mesh._kernel);
     kernel2.Transform(mesh._Mtrx);
-    MeshCore::SetOperations setOp(kernel1,
-                                  kernel2,
-                                  result,
-                                  MeshCore::SetOperations::Difference,
-                                  Epsilon);
-    setOp.Do();
-    return new MeshObject(result);
+    return new MeshObject(
+        booleanOperation(kernel1, kernel2, MeshCore::SetOperations::Difference, Epsilon, exact));
 }
 
-MeshObject* MeshObject::inner(const MeshObject& mesh) const
+MeshObject* MeshObject::inner(const MeshObject& mesh, bool exact) const
 {
-    MeshCore::MeshKernel result;
     MeshCore::MeshKernel kernel1(this->_kernel);
     kernel1.Transform(this->_Mtrx);
     MeshCore::MeshKernel kernel2(mesh._kernel);
     kernel2.Transform(mesh._Mtrx);
-    MeshCore::SetOperations setOp(kernel1,
-                                  kernel2,
-                                  result,
-                                  MeshCore::SetOperations::Inner,
-                                  Epsilon);
-    setOp.Do();
-    return new MeshObject(result);
+    return new MeshObject(
+        booleanOperation(kernel1, kernel2, MeshCore::SetOperations::Inner, Epsilon, exact));
 }
 
-MeshObject* MeshObject::outer(const MeshObject& mesh) const
+MeshObject* MeshObject::outer(const MeshObject& mesh, bool exact) const
 {
-    MeshCore::MeshKernel result;
     MeshCore::MeshKernel kernel1(this->_kernel);
     kernel1.Transform(this->_Mtrx);
     MeshCore::MeshKernel kernel2(mesh._kernel);
     kernel2.Transform(mesh._Mtrx);
-    MeshCore::SetOperations setOp(kernel1,
-                                  kernel2,
-                                  result,
-                                  MeshCore::SetOperations::Outer,
-                                  Epsilon);
-    setOp.Do();
-    return new MeshObject(result);
+    return new MeshObject(
+        booleanOperation(kernel1, kernel2, MeshCore::SetOperations::Outer, Epsilon, exact));
 }
 
 std::vector<std::vector<Base::Vector3f>>
@@ -191,7 +191,7 @@ public:
     /** @name I/O */
     //@{
     // Implemented from Persistence
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     void Save(Base::Writer& writer) const override;
     void SaveDocFile(Base::Writer& writer) const override;
     void Restore(Base::XMLReader& reader) override;
@@ -293,13 +293,16 @@ public:
     void clearPointSelection() const;
     //@}
 
-    /** @name Boolean operations */
+    /** @name Boolean operations
+     * If \a exact is true the operations use exact predicates (MeshCore::MeshBoolean) instead
+     * of the tolerance based algorithm (MeshCore::SetOperations).
+     */
     //@{
-    MeshObject* unite(const MeshObject&) const;
-    MeshObject* intersect(const MeshObject&) const;
-    MeshObject* subtract(const MeshObject&) const;
-    MeshObject* inner(const MeshObject&) const;
-    MeshObject* outer(const MeshObject&) const;
+    MeshObject* unite(const MeshObject&, bool exact = false) const;
+    MeshObject* intersect(const MeshObject&, bool exact = false) const;
+    MeshObject* subtract(const MeshObject&, bool exact = false) const;
+    MeshObject* inner(const MeshObject&, bool exact = false) const;
+    MeshObject* outer(const MeshObject&, bool exact = false) const;
     std::vector<std::vector<Base::Vector3f>>
     section(const MeshObject&, bool connectLines, float fMinDist) const;
     //@}
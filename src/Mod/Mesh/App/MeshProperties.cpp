@@ -22,6 +22,10 @@
 
 #include "PreCompiled.h"
 
+#ifndef _PreComp_
+#include <memory>
+#endif
+
 #include <Base/Converter.h>
 #include <Base/Exception.h>
 #include <Base/Reader.h>
@@ -179,9 +183,9 @@ void PropertyNormalList::Paste(const App::Property& from)
     hasSetValue();
 }
 
-unsigned int PropertyNormalList::getMemSize() const
+std::size_t PropertyNormalList::getMemSize() const
 {
-    return static_cast<unsigned int>(_lValueList.size() * sizeof(Base::Vector3f));
+    return _lValueList.size() * sizeof(Base::Vector3f);
 }
 
 void PropertyNormalList::transformGeometry(const Base::Matrix4D& mat)
@@ -698,14 +702,13 @@ void PropertyMaterial::Paste(const Property& from)
     hasSetValue();
 }
 
-unsigned int PropertyMaterial::getMemSize() const
+std::size_t PropertyMaterial::getMemSize() const
 {
-    auto size = (_material.ambientColor.size() + _material.diffuseColor.size()
-                 + _material.emissiveColor.size() + _material.specularColor.size())
-            * sizeof(Base::Color)
+    return (_material.ambientColor.size() + _material.diffuseColor.size()
+            + _material.emissiveColor.size() + _material.specularColor.size())
+        * sizeof(Base::Color)
         + (_material.shininess.size() + _material.transparency.size()) * sizeof(float)
         + _material.library.size() + sizeof(_material);
-    return static_cast<unsigned int>(size);
 }
 
 bool PropertyMaterial::isSame(const App::Property& other) const
@@ -721,6 +724,7 @@ bool PropertyMaterial::isSame(const App::Property& other) const
 
 PropertyMeshKernel::PropertyMeshKernel()
     : _meshObject(new MeshObject())
+    , _meshOwners(std::make_shared<int>())
 {
     // Note: Normally this property is a member of a document object, i.e. the setValue()
     // method gets called in the constructor of a subclass of DocumentObject, e.g. Mesh::Feature.
@@ -738,33 +742,71 @@ PropertyMeshKernel::~PropertyMeshKernel()
     }
 }
 
+bool PropertyMeshKernel::isShared() const
+{
+    return _meshOwners.use_count() > 1;
+}
+
+void PropertyMeshKernel::detachMesh()
+{
+    // the mesh is about to be modified but is still referenced by a copy of this property
+    if (isShared()) {
+        replaceMesh(new MeshObject(*_meshObject));
+    }
+}
+
+void PropertyMeshKernel::replaceMesh(MeshObject* mesh)
+{
+    // use the tmp. object to guarantee that the referenced mesh is not destroyed
+    // before the Python wrapper is re-attached
+    Base::Reference<MeshObject> tmp(_meshObject);
+    _meshObject = mesh;
+    _meshOwners = std::make_shared<int>();
+    if (meshPyObject) {
+        mesh->ref();
+        meshPyObject->setTwinPointer(mesh);
+        tmp->unref();
+    }
+}
+
 void PropertyMeshKernel::setValuePtr(MeshObject* mesh)
 {
     // use the tmp. object to guarantee that the referenced mesh is not destroyed
     // before calling hasSetValue()
     Base::Reference<MeshObject> tmp(_meshObject);
     aboutToSetValue();
-    _meshObject = mesh;
+    replaceMesh(mesh);
     hasSetValue();
 }
 
 void PropertyMeshKernel::setValue(const MeshObject& mesh)
 {
     aboutToSetValue();
-    *_meshObject = mesh;
+    if (isShared()) {
+        replaceMesh(new MeshObject(mesh));
+    }
+    else {
+        *_meshObject = mesh;
+    }
     hasSetValue();
 }
 
 void PropertyMeshKernel::setValue(const MeshCore::MeshKernel& mesh)
 {
     aboutToSetValue();
-    _meshObject->setKernel(mesh);
+    if (isShared()) {
+        replaceMesh(new MeshObject(mesh, _meshObject->getTransform()));
+    }
+    else {
+        _meshObject->setKernel(mesh);
+    }
     hasSetValue();
 }
 
 void PropertyMeshKernel::swapMesh(MeshObject& mesh)
 {
     aboutToSetValue();
+    detachMesh();
     _meshObject->swap(mesh);
     hasSetValue();
 }
@@ -772,6 +814,7 @@ void PropertyMeshKernel::swapMesh(MeshObject& mesh)
 void PropertyMeshKernel::swapMesh(MeshCore::MeshKernel& mesh)
 {
     aboutToSetValue();
+    detachMesh();
     _meshObject->swap(mesh);
     hasSetValue();
 }
@@ -796,17 +839,15 @@ Base::BoundBox3d PropertyMeshKernel::getBoundingBox() const
     return _meshObject->getBoundBox();
 }
 
-unsigned int PropertyMeshKernel::getMemSize() const
+std::size_t PropertyMeshKernel::getMemSize() const
 {
-    unsigned int size = 0;
-    size += _meshObject->getMemSize();
-
-    return size;
+    return _meshObject->getMemSize();
 }
 
 MeshObject* PropertyMeshKernel::startEditing()
 {
     aboutToSetValue();
+    detachMesh();
     return static_cast<MeshObject*>(_meshObject);
 }
 
@@ -818,6 +859,7 @@ void PropertyMeshKernel::finishEditing()
 void PropertyMeshKernel::transformGeometry(const Base::Matrix4D& rclMat)
 {
     aboutToSetValue();
+    detachMesh();
     _meshObject->transformGeometry(rclMat);
     hasSetValue();
 }
@@ -826,6 +868,7 @@ void PropertyMeshKernel::setPointIndices(
     const std::vector<std::pair<PointIndex, Base::Vector3f>>& inds)
 {
     aboutToSetValue();
+    detachMesh();
     MeshCore::MeshKernel& kernel = _meshObject->getKernel();
     for (const auto& it : inds) {
         kernel.SetPoint(it.first, it.second);
@@ -835,6 +878,7 @@ void PropertyMeshKernel::setPointIndices(
 
 void PropertyMeshKernel::setTransform(const Base::Matrix4D& rclTrf)
 {
+    // Note: The placement is kept in sync by the owner, so a shared mesh is not detached here
     _meshObject->setTransform(rclTrf);
 }
 
@@ -910,6 +954,7 @@ void PropertyMeshKernel::Restore(Base::XMLReader& reader)
         kernel.Adopt(points, facets);
 
         aboutToSetValue();
+        detachMesh();
         _meshObject->getKernel().Adopt(points, facets);
         hasSetValue();
     }
@@ -927,23 +972,43 @@ void PropertyMeshKernel::SaveDocFile(Base::Writer& writer) const
 void PropertyMeshKernel::RestoreDocFile(Base::Reader& reader)
 {
     aboutToSetValue();
+    detachMesh();
     _meshObject->load(reader);
     hasSetValue();
 }
 
+bool PropertyMeshKernel::canParseDocFile() const
+{
+    return true;
+}
+
+std::function<void()> PropertyMeshKernel::parseDocFile(Base::Reader& reader)
+{
+    auto mesh = std::make_shared<MeshObject>();
+    mesh->load(reader);
+    return [this, mesh]() {
+        aboutToSetValue();
+        detachMesh();
+        _meshObject->swap(mesh->getKernel());
+        hasSetValue();
+    };
+}
+
 App::Property* PropertyMeshKernel::Copy() const
 {
-    // Note: Copy the content, do NOT reference the same mesh object
+    // Note: Reference the same mesh object, it gets detached before a modification
     PropertyMeshKernel* prop = new PropertyMeshKernel();
-    *(prop->_meshObject) = *(this->_meshObject);
+    prop->_meshObject = this->_meshObject;
+    prop->_meshOwners = this->_meshOwners;
     return prop;
 }
 
 void PropertyMeshKernel::Paste(const App::Property& from)
 {
-    // Note: Copy the content, do NOT reference the same mesh object
+    // Note: Reference the same mesh object, it gets detached before a modification
     aboutToSetValue();
     const PropertyMeshKernel& prop = dynamic_cast<const PropertyMeshKernel&>(from);
-    *(this->_meshObject) = *(prop._meshObject);
+    replaceMesh(prop._meshObject);
+    _meshOwners = prop._meshOwners;
     hasSetValue();
 }
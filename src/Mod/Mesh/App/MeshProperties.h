@@ -25,6 +25,7 @@
 
 #include <list>
 #include <map>
+#include <memory>
 #include <set>
 #include <string>
 #include <vector>
@@ -89,7 +90,7 @@ public:
     App::Property* Copy() const override;
     void Paste(const App::Property& from) override;
 
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
 
     void transformGeometry(const Base::Matrix4D& rclMat);
 
@@ -168,7 +169,7 @@ public:
     App::Property* Copy() const override;
     void Paste(const App::Property& from) override;
 
-    unsigned int getMemSize() const override
+    std::size_t getMemSize() const override
     {
         return _lValueList.size() * sizeof(CurvatureInfo);
     }
@@ -220,7 +221,7 @@ public:
     Property* Copy() const override;
     void Paste(const Property& from) override;
 
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     bool isSame(const Property& other) const override;
 
 private:
@@ -267,7 +268,7 @@ public:
      */
     const MeshObject& getValue() const;
     const MeshObject* getValuePtr() const;
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     //@}
 
     /** @name Getting basic geometric entities */
@@ -315,13 +316,26 @@ public:
 
     void SaveDocFile(Base::Writer& writer) const override;
     void RestoreDocFile(Base::Reader& reader) override;
+    bool canParseDocFile() const override;
+    std::function<void()> parseDocFile(Base::Reader& reader) override;
 
+    /** The copy shares the mesh object with this property. Before the mesh gets modified
+     * the property detaches it, so that e.g. an undo record keeps the old state without
+     * duplicating the mesh data.
+     */
     App::Property* Copy() const override;
     void Paste(const App::Property& from) override;
     //@}
 
 private:
+    bool isShared() const;
+    void detachMesh();
+    void replaceMesh(MeshObject* mesh);
+
     Base::Reference<MeshObject> _meshObject;
+    /// Shared by the copies of this property that reference the same mesh object. Other
+    /// references, e.g. of segments, the Python wrapper or the view provider, don't count.
+    std::shared_ptr<int> _meshOwners;
     MeshPy* meshPyObject {nullptr};
 };
 
@@ -76,27 +76,42 @@ class MeshPy(ComplexGeoData):
 
     @constmethod
     def unite(self) -> Any:
-        """Union of this and the given mesh object."""
+        """
+        unite(mesh, [exact=False]) -> Mesh
+        Union of this and the given mesh object.
+        If exact is True the operation uses exact predicates instead of a tolerance."""
         ...
 
     @constmethod
     def intersect(self) -> Any:
-        """Intersection of this and the given mesh object."""
+        """
+        intersect(mesh, [exact=False]) -> Mesh
+        Intersection of this and the given mesh object.
+        If exact is True the operation uses exact predicates instead of a tolerance."""
         ...
 
     @constmethod
     def difference(self) -> Any:
-        """Difference of this and the given mesh object."""
+        """
+        difference(mesh, [exact=False]) -> Mesh
+        Difference of this and the given mesh object.
+        If exact is True the operation uses exact predicates instead of a tolerance."""
         ...
 
     @constmethod
     def inner(self) -> Any:
-        """Get the part inside of the intersection"""
+        """
+        inner(mesh, [exact=False]) -> Mesh
+        Get the part inside of the intersection
+        If exact is True the operation uses exact predicates instead of a tolerance."""
         ...
 
     @constmethod
     def outer(self) -> Any:
-        """Get the part outside the intersection"""
+        """
+        outer(mesh, [exact=False]) -> Mesh
+        Get the part outside the intersection
+        If exact is True the operation uses exact predicates instead of a tolerance."""
         ...
 
     @constmethod
@@ -457,7 +457,8 @@ PyObject* MeshPy::unite(PyObject* args) const
 {
     MeshPy* pcObject {};
     PyObject* pcObj {};
-    if (!PyArg_ParseTuple(args, "O!", &(MeshPy::Type), &pcObj)) {
+    PyObject* exact = Py_False;
+    if (!PyArg_ParseTuple(args, "O!|O!", &(MeshPy::Type), &pcObj, &PyBool_Type, &exact)) {
         return nullptr;
     }
 
@@ -465,7 +466,8 @@ PyObject* MeshPy::unite(PyObject* args) const
 
     PY_TRY
     {
-        MeshObject* mesh = getMeshObjectPtr()->unite(*pcObject->getMeshObjectPtr());
+        MeshObject* mesh =
+            getMeshObjectPtr()->unite(*pcObject->getMeshObjectPtr(), Base::asBoolean(exact));
         return new MeshPy(mesh);
     }
     PY_CATCH;
@@ -477,7 +479,8 @@ PyObject* MeshPy::intersect(PyObject* args) const
 {
     MeshPy* pcObject {};
     PyObject* pcObj {};
-    if (!PyArg_ParseTuple(args, "O!", &(MeshPy::Type), &pcObj)) {
+    PyObject* exact = Py_False;
+    if (!PyArg_ParseTuple(args, "O!|O!", &(MeshPy::Type), &pcObj, &PyBool_Type, &exact)) {
         return nullptr;
     }
 
@@ -485,7 +488,8 @@ PyObject* MeshPy::intersect(PyObject* args) const
 
     PY_TRY
     {
-        MeshObject* mesh = getMeshObjectPtr()->intersect(*pcObject->getMeshObjectPtr());
+        MeshObject* mesh =
+            getMeshObjectPtr()->intersect(*pcObject->getMeshObjectPtr(), Base::asBoolean(exact));
         return new MeshPy(mesh);
     }
     PY_CATCH;
@@ -497,7 +501,8 @@ PyObject* MeshPy::difference(PyObject* args) const
 {
     MeshPy* pcObject {};
     PyObject* pcObj {};
-    if (!PyArg_ParseTuple(args, "O!", &(MeshPy::Type), &pcObj)) {
+    PyObject* exact = Py_False;
+    if (!PyArg_ParseTuple(args, "O!|O!", &(MeshPy::Type), &pcObj, &PyBool_Type, &exact)) {
         return nullptr;
     }
 
@@ -505,7 +510,8 @@ PyObject* MeshPy::difference(PyObject* args) const
 
     PY_TRY
     {
-        MeshObject* mesh = getMeshObjectPtr()->subtract(*pcObject->getMeshObjectPtr());
+        MeshObject* mesh =
+            getMeshObjectPtr()->subtract(*pcObject->getMeshObjectPtr(), Base::asBoolean(exact));
         return new MeshPy(mesh);
     }
     PY_CATCH;
@@ -517,7 +523,8 @@ PyObject* MeshPy::inner(PyObject* args) const
 {
     MeshPy* pcObject {};
     PyObject* pcObj {};
-    if (!PyArg_ParseTuple(args, "O!", &(MeshPy::Type), &pcObj)) {
+    PyObject* exact = Py_False;
+    if (!PyArg_ParseTuple(args, "O!|O!", &(MeshPy::Type), &pcObj, &PyBool_Type, &exact)) {
         return nullptr;
     }
 
@@ -525,7 +532,8 @@ PyObject* MeshPy::inner(PyObject* args) const
 
     PY_TRY
     {
-        MeshObject* mesh = getMeshObjectPtr()->inner(*pcObject->getMeshObjectPtr());
+        MeshObject* mesh =
+            getMeshObjectPtr()->inner(*pcObject->getMeshObjectPtr(), Base::asBoolean(exact));
         return new MeshPy(mesh);
     }
     PY_CATCH;
@@ -537,7 +545,8 @@ PyObject* MeshPy::outer(PyObject* args) const
 {
     MeshPy* pcObject {};
     PyObject* pcObj {};
-    if (!PyArg_ParseTuple(args, "O!", &(MeshPy::Type), &pcObj)) {
+    PyObject* exact = Py_False;
+    if (!PyArg_ParseTuple(args, "O!|O!", &(MeshPy::Type), &pcObj, &PyBool_Type, &exact)) {
         return nullptr;
     }
 
@@ -545,7 +554,8 @@ PyObject* MeshPy::outer(PyObject* args) const
 
     PY_TRY
     {
-        MeshObject* mesh = getMeshObjectPtr()->outer(*pcObject->getMeshObjectPtr());
+        MeshObject* mesh =
+            getMeshObjectPtr()->outer(*pcObject->getMeshObjectPtr(), Base::asBoolean(exact));
         return new MeshPy(mesh);
     }
     PY_CATCH;
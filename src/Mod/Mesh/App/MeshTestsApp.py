@@ -747,3 +747,31 @@ class MeshProperty(unittest.TestCase):
         self.assertEqual(len(material2["emissiveColor"]), len1 + len2)
         self.assertEqual(len(material2["shininess"]), len1 + len2)
         self.assertEqual(len(material2["transparency"]), len1 + len2)
+
+    def testParallelRestore(self):
+        names = []
+        for i in range(4):
+            mesh = self.doc.addObject("Mesh::Feature", "Mesh{}".format(i))
+            mesh.Mesh = Mesh.createSphere(1.0 + i, 20 + i)
+            names.append((mesh.Name, mesh.Mesh.CountPoints, mesh.Mesh.CountFacets))
+
+        TempPath = tempfile.gettempdir()
+        SaveName = TempPath + os.sep + "mesh_parallel_restore.FCStd"
+        self.doc.saveAs(SaveName)
+        FreeCAD.closeDocument(self.doc.Name)
+
+        param = FreeCAD.ParamGet("User parameter:BaseApp/Preferences/Document")
+        parallel = param.GetBool("ParallelRestore", False)
+        threads = param.GetInt("RestoreThreads", 0)
+        param.SetBool("ParallelRestore", True)
+        param.SetInt("RestoreThreads", 3)
+        try:
+            self.doc = FreeCAD.openDocument(SaveName)
+        finally:
+            param.SetBool("ParallelRestore", parallel)
+            param.SetInt("RestoreThreads", threads)
+
+        for name, points, facets in names:
+            mesh = self.doc.getObject(name).Mesh
+            self.assertEqual(mesh.CountPoints, points)
+            self.assertEqual(mesh.CountFacets, facets)
@@ -51,6 +51,7 @@
 #include <Base/Stream.h>
 
 #include <Mod/Mesh/App/Core/Algorithm.h>
+#include <Mod/Mesh/App/Core/BVH.h>
 #include <Mod/Mesh/App/Core/Grid.h>
 #include <Mod/Mesh/App/Core/Iterator.h>
 #include <Mod/Mesh/App/Core/MeshKernel.h>
@@ -665,11 +666,6 @@ void MeshProjection::projectOnMesh(const std::vector<Base::Vector3f>& pointsIn,
                                    float tolerance,
                                    std::vector<Base::Vector3f>& pointsOut) const
 {
-    // calculate the average edge length and create a grid
-    MeshAlgorithm clAlg(_rcMesh);
-    float fAvgLen = clAlg.GetAverageEdgeLength();
-    MeshFacetGrid cGrid(_rcMesh, 5.0f * fAvgLen);
-
     // get all boundary points and edges of the mesh
     std::vector<Base::Vector3f> boundaryPoints;
     std::vector<MeshCore::MeshGeomEdge> boundaryEdges;
@@ -690,13 +686,22 @@ void MeshProjection::projectOnMesh(const std::vector<Base::Vector3f>& pointsIn,
         }
     }
 
+    // all points are projected along the same direction, so trace them together
+    std::vector<MeshCore::MeshFacetBVH::Ray> rays;
+    rays.reserve(pointsIn.size());
+    for (const auto& it : pointsIn) {
+        rays.push_back({it, dir});
+    }
+    MeshCore::MeshFacetBVH bvh(_rcMesh);
+    std::vector<MeshCore::MeshFacetBVH::RayHit> hits = bvh.NearestFacetsOnRays(rays);
+
     Base::SequencerLauncher seq("Project points on mesh", pointsIn.size());
 
-    for (auto it : pointsIn) {
-        Base::Vector3f result;
-        MeshCore::FacetIndex index;
-        if (clAlg.NearestFacetOnRay(it, dir, cGrid, result, index)) {
-            MeshCore::MeshGeomFacet geomFacet = _rcMesh.GetFacet(index);
+    for (std::size_t i = 0; i < pointsIn.size(); i++) {
+        const Base::Vector3f& it = pointsIn[i];
+        Base::Vector3f result = hits[i].point;
+        if (hits[i].facet != MeshCore::FACET_INDEX_MAX) {
+            MeshCore::MeshGeomFacet geomFacet = _rcMesh.GetFacet(hits[i].facet);
             if (tolerance > 0 && geomFacet.IntersectPlaneWithLine(it, dir, result)) {
                 if (geomFacet.IsPointOfFace(result, tolerance)) {
                     pointsOut.push_back(result);
@@ -241,7 +241,7 @@ bool Geometry::hasSameExtensions(const Geometry& other) const
 }
 
 // Persistence implementer
-unsigned int Geometry::getMemSize () const
+std::size_t Geometry::getMemSize () const
 {
     return 1;
 }
@@ -607,7 +607,7 @@ void GeomPoint::setPoint(const Base::Vector3d& p)
 }
 
 // Persistence implementer
-unsigned int GeomPoint::getMemSize () const
+std::size_t GeomPoint::getMemSize () const
 {
     return sizeof(Geom_CartesianPoint);
 }
@@ -1206,7 +1206,7 @@ std::vector<double> GeomBezierCurve::getWeights() const
 }
 
 // Persistence implementer
-unsigned int GeomBezierCurve::getMemSize () const
+std::size_t GeomBezierCurve::getMemSize () const
 {
     return sizeof(Geom_BezierCurve);
 }
@@ -1941,7 +1941,7 @@ void GeomBSplineCurve::scaleKnotsToBounds(double u0, double u1)
 }
 
 // Persistence implementer
-unsigned int GeomBSplineCurve::getMemSize () const
+std::size_t GeomBSplineCurve::getMemSize () const
 {
     return sizeof(Geom_BSplineCurve);
 }
@@ -2309,7 +2309,7 @@ GeomCurve* GeomTrimmedCurve::createArc(double first, double last) const
 }
 
 // Persistence implementer
-unsigned int GeomTrimmedCurve::getMemSize () const
+std::size_t GeomTrimmedCurve::getMemSize () const
 {
     return sizeof(Geom_TrimmedCurve);
 }
@@ -2705,7 +2705,7 @@ void GeomCircle::setRadius(double Radius)
 }
 
 // Persistence implementer
-unsigned int GeomCircle::getMemSize () const
+std::size_t GeomCircle::getMemSize () const
 {
     return sizeof(Geom_Circle);
 }
@@ -2951,7 +2951,7 @@ void GeomArcOfCircle::setRange(double u, double v, bool emulateCCWXY)
 }
 
 // Persistence implementer
-unsigned int GeomArcOfCircle::getMemSize () const
+std::size_t GeomArcOfCircle::getMemSize () const
 {
     return sizeof(Geom_Circle) + 2 *sizeof(double);
 }
@@ -3214,7 +3214,7 @@ void GeomEllipse::setMajorAxisDir(Base::Vector3d newdir)
 }
 
 // Persistence implementer
-unsigned int GeomEllipse::getMemSize () const
+std::size_t GeomEllipse::getMemSize () const
 {
     return sizeof(Geom_Ellipse);
 }
@@ -3498,7 +3498,7 @@ void GeomArcOfEllipse::setRange(double u, double v, bool emulateCCWXY)
 }
 
 // Persistence implementer
-unsigned int GeomArcOfEllipse::getMemSize () const
+std::size_t GeomArcOfEllipse::getMemSize () const
 {
     return sizeof(Geom_Ellipse) + 2 *sizeof(double);
 }
@@ -3682,7 +3682,7 @@ void GeomHyperbola::setMinorRadius(double Radius)
 }
 
 // Persistence implementer
-unsigned int GeomHyperbola::getMemSize () const
+std::size_t GeomHyperbola::getMemSize () const
 {
     return sizeof(Geom_Hyperbola);
 }
@@ -3954,7 +3954,7 @@ void GeomArcOfHyperbola::setRange(double u, double v, bool emulateCCWXY)
 }
 
 // Persistence implementer
-unsigned int GeomArcOfHyperbola::getMemSize () const
+std::size_t GeomArcOfHyperbola::getMemSize () const
 {
     return sizeof(Geom_Hyperbola) + 2 *sizeof(double);
 }
@@ -4118,7 +4118,7 @@ void GeomParabola::setFocal(double length)
 }
 
 // Persistence implementer
-unsigned int GeomParabola::getMemSize () const
+std::size_t GeomParabola::getMemSize () const
 {
     return sizeof(Geom_Parabola);
 }
@@ -4321,7 +4321,7 @@ void GeomArcOfParabola::setRange(double u, double v, bool emulateCCWXY)
 }
 
 // Persistence implementer
-unsigned int GeomArcOfParabola::getMemSize () const
+std::size_t GeomArcOfParabola::getMemSize () const
 {
     return sizeof(Geom_Parabola) + 2 *sizeof(double);
 }
@@ -4475,7 +4475,7 @@ Geometry *GeomLine::copy() const
 }
 
 // Persistence implementer
-unsigned int GeomLine::getMemSize () const
+std::size_t GeomLine::getMemSize () const
 {
     return sizeof(Geom_Line);
 }
@@ -4631,7 +4631,7 @@ void GeomLineSegment::setPoints(const Base::Vector3d& Start, const Base::Vector3
 }
 
 // Persistence implementer
-unsigned int GeomLineSegment::getMemSize () const
+std::size_t GeomLineSegment::getMemSize () const
 {
     return sizeof(Geom_TrimmedCurve) + sizeof(Geom_Line);
 }
@@ -4752,7 +4752,7 @@ const Handle(Geom_Geometry)& GeomOffsetCurve::handle() const
 }
 
 // Persistence implementer
-unsigned int GeomOffsetCurve::getMemSize () const
+std::size_t GeomOffsetCurve::getMemSize () const
 {
     return sizeof(Geom_OffsetCurve);
 }
@@ -4992,9 +4992,9 @@ Geometry *GeomBezierSurface::copy() const
 }
 
 // Persistence implementer
-unsigned int GeomBezierSurface::getMemSize () const
+std::size_t GeomBezierSurface::getMemSize () const
 {
-    unsigned int size = sizeof(Geom_BezierSurface);
+    std::size_t size = sizeof(Geom_BezierSurface);
     if (!mySurface.IsNull()) {
         unsigned int poles = mySurface->NbUPoles();
         poles *= mySurface->NbVPoles();
@@ -5120,9 +5120,9 @@ void GeomBSplineSurface::scaleKnotsToBounds(double u0, double u1, double v0, dou
 }
 
 // Persistence implementer
-unsigned int GeomBSplineSurface::getMemSize () const
+std::size_t GeomBSplineSurface::getMemSize () const
 {
-    unsigned int size = sizeof(Geom_BSplineSurface);
+    std::size_t size = sizeof(Geom_BSplineSurface);
     if (!mySurface.IsNull()) {
         size += mySurface->NbUKnots() * sizeof(Standard_Real);
         size += mySurface->NbUKnots() * sizeof(Standard_Integer);
@@ -5308,7 +5308,7 @@ Geometry *GeomCylinder::copy() const
 }
 
 // Persistence implementer
-unsigned int GeomCylinder::getMemSize () const
+std::size_t GeomCylinder::getMemSize () const
 {
     return sizeof(Geom_CylindricalSurface);
 }
@@ -5381,7 +5381,7 @@ Geometry *GeomCone::copy() const
 }
 
 // Persistence implementer
-unsigned int GeomCone::getMemSize () const
+std::size_t GeomCone::getMemSize () const
 {
     return sizeof(Geom_ConicalSurface);
 }
@@ -5512,7 +5512,7 @@ Geometry *GeomToroid::copy() const
 }
 
 // Persistence implementer
-unsigned int GeomToroid::getMemSize () const
+std::size_t GeomToroid::getMemSize () const
 {
     return sizeof(Geom_ToroidalSurface);
 }
@@ -5591,7 +5591,7 @@ Geometry *GeomSphere::copy() const
 }
 
 // Persistence implementer
-unsigned int GeomSphere::getMemSize () const
+std::size_t GeomSphere::getMemSize () const
 {
     return sizeof(Geom_SphericalSurface);
 }
@@ -5670,7 +5670,7 @@ Geometry *GeomPlane::copy() const
 }
 
 // Persistence implementer
-unsigned int GeomPlane::getMemSize () const
+std::size_t GeomPlane::getMemSize () const
 {
     return sizeof(Geom_Plane);
 }
@@ -5741,7 +5741,7 @@ Geometry *GeomOffsetSurface::copy() const
 }
 
 // Persistence implementer
-unsigned int GeomOffsetSurface::getMemSize () const
+std::size_t GeomOffsetSurface::getMemSize () const
 {
     return sizeof(Geom_OffsetSurface);
 }
@@ -5827,7 +5827,7 @@ Geometry *GeomPlateSurface::copy() const
 }
 
 // Persistence implementer
-unsigned int GeomPlateSurface::getMemSize () const
+std::size_t GeomPlateSurface::getMemSize () const
 {
     throw Base::NotImplementedError("GeomPlateSurface::getMemSize");
 }
@@ -5884,7 +5884,7 @@ Geometry *GeomTrimmedSurface::copy() const
 }
 
 // Persistence implementer
-unsigned int GeomTrimmedSurface::getMemSize () const
+std::size_t GeomTrimmedSurface::getMemSize () const
 {
     return sizeof(Geom_RectangularTrimmedSurface);
 }
@@ -6004,7 +6004,7 @@ Geometry *GeomSurfaceOfRevolution::copy() const
 }
 
 // Persistence implementer
-unsigned int GeomSurfaceOfRevolution::getMemSize () const
+std::size_t GeomSurfaceOfRevolution::getMemSize () const
 {
     return sizeof(Geom_SurfaceOfRevolution);
 }
@@ -6060,7 +6060,7 @@ Geometry *GeomSurfaceOfExtrusion::copy() const
 }
 
 // Persistence implementer
-unsigned int GeomSurfaceOfExtrusion::getMemSize () const
+std::size_t GeomSurfaceOfExtrusion::getMemSize () const
 {
    return sizeof(Geom_SurfaceOfLinearExtrusion);
 }
@@ -90,7 +90,7 @@ public:
     virtual TopoDS_Shape toShape() const = 0;
     virtual const Handle(Geom_Geometry)& handle() const = 0;
     // Persistence implementer ---------------------
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     void Save(Base::Writer &/*writer*/) const override;
     void Restore(Base::XMLReader &/*reader*/) override;
     /// returns a copy of this object having a new randomly generated tag. If you also want to copy the tag, you may use clone() instead.
@@ -161,7 +161,7 @@ public:
     TopoDS_Shape toShape() const override;
 
     // Persistence implementer ---------------------
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     void Save(Base::Writer &/*writer*/) const override;
     void Restore(Base::XMLReader &/*reader*/) override;
     // Base implementer ----------------------------
@@ -274,7 +274,7 @@ public:
     std::vector<double> getWeights() const;
 
     // Persistence implementer ---------------------
-    unsigned int getMemSize () const override;
+    std::size_t getMemSize () const override;
     void Save (Base::Writer &/*writer*/) const override;
     void Restore(Base::XMLReader &/*reader*/) override;
     // Base implementer ----------------------------
@@ -368,7 +368,7 @@ public:
     void scaleKnotsToBounds(double u0, double u1);
 
     // Persistence implementer ---------------------
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     void Save(Base::Writer &/*writer*/) const override;
     void Restore(Base::XMLReader &/*reader*/) override;
     // Base implementer ----------------------------
@@ -423,7 +423,7 @@ public:
 
     Base::Vector3d getAxisDirection() const;
 
-    unsigned int getMemSize() const override = 0;
+    std::size_t getMemSize() const override = 0;
     PyObject *getPyObject() override = 0;
     GeomBSplineCurve* toNurbs(double first, double last) const override;
 
@@ -443,7 +443,7 @@ public:
 
     GeomCurve* createArc(double first, double last) const override;
     // Persistence implementer ---------------------
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     void Save(Base::Writer &/*writer*/) const override;
     void Restore(Base::XMLReader &/*reader*/) override;
     // Base implementer ----------------------------
@@ -511,7 +511,7 @@ public:
     Base::Vector3d getXAxisDir() const;
     void setXAxisDir(const Base::Vector3d& newdir);
 
-    unsigned int getMemSize() const override = 0;
+    std::size_t getMemSize() const override = 0;
     PyObject *getPyObject() override = 0;
 
     const Handle(Geom_Geometry)& handle() const override = 0;
@@ -531,7 +531,7 @@ public:
     void setRadius(double Radius);
 
     // Persistence implementer ---------------------
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     void Save(Base::Writer &/*writer*/) const override;
     void Restore(Base::XMLReader &/*reader*/) override;
     // Base implementer ----------------------------
@@ -566,7 +566,7 @@ public:
     void setRange(double u, double v, bool emulateCCWXY) override;
 
     // Persistence implementer ---------------------
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     void Save(Base::Writer &/*writer*/) const override;
     void Restore(Base::XMLReader &/*reader*/) override;
     // Base implementer ----------------------------
@@ -598,7 +598,7 @@ public:
     Base::Vector3d getMinorAxisDir() const;
 
     // Persistence implementer ---------------------
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     void Save(Base::Writer &/*writer*/) const override;
     void Restore(Base::XMLReader &/*reader*/) override;
     // Base implementer ----------------------------
@@ -635,7 +635,7 @@ public:
     void setRange(double u, double v, bool emulateCCWXY) override;
 
     // Persistence implementer ---------------------
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     void Save(Base::Writer &/*writer*/) const override;
     void Restore(Base::XMLReader &/*reader*/) override;
     // Base implementer ----------------------------
@@ -664,7 +664,7 @@ public:
     void setMinorRadius(double Radius);
 
     // Persistence implementer ---------------------
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     void Save(Base::Writer &/*writer*/) const override;
     void Restore(Base::XMLReader &/*reader*/) override;
     // Base implementer ----------------------------
@@ -701,7 +701,7 @@ public:
     void setRange(double u, double v, bool emulateCCWXY) override;
 
     // Persistence implementer ---------------------
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     void Save(Base::Writer &/*writer*/) const override;
     void Restore(Base::XMLReader &/*reader*/) override;
     // Base implementer ----------------------------
@@ -727,7 +727,7 @@ public:
     void setFocal(double length);
 
     // Persistence implementer ---------------------
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     void Save(Base::Writer &/*writer*/) const override;
     void Restore(Base::XMLReader &/*reader*/) override;
     // Base implementer ----------------------------
@@ -761,7 +761,7 @@ public:
     void setRange(double u, double v, bool emulateCCWXY) override;
 
     // Persistence implementer ---------------------
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     void Save(Base::Writer &/*writer*/) const override;
     void Restore(Base::XMLReader &/*reader*/) override;
     // Base implementer ----------------------------
@@ -788,7 +788,7 @@ public:
     Base::Vector3d getDir() const;
 
     // Persistence implementer ---------------------
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     void Save(Base::Writer &/*writer*/) const override;
     void Restore(Base::XMLReader &/*reader*/) override;
     // Base implementer ----------------------------
@@ -819,7 +819,7 @@ public:
                    const Base::Vector3d& p2);
 
     // Persistence implementer ---------------------
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     void Save(Base::Writer &/*writer*/) const override;
     void Restore(Base::XMLReader &/*reader*/) override;
     // Base implementer ----------------------------
@@ -846,7 +846,7 @@ public:
     double getOffset() const;
 
     // Persistence implementer ---------------------
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     void Save(Base::Writer &/*writer*/) const override;
     void Restore(Base::XMLReader &/*reader*/) override;
     // Base implementer ----------------------------
@@ -915,7 +915,7 @@ public:
     Geometry *copy() const override;
 
     // Persistence implementer ---------------------
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     void Save(Base::Writer &/*writer*/) const override;
     void Restore(Base::XMLReader &/*reader*/) override;
     // Base implementer ----------------------------
@@ -941,7 +941,7 @@ public:
 
     void scaleKnotsToBounds(double u0, double u1, double v0, double v1);
     // Persistence implementer ---------------------
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     void Save(Base::Writer &/*writer*/) const override;
     void Restore(Base::XMLReader &/*reader*/) override;
     // Base implementer ----------------------------
@@ -985,7 +985,7 @@ public:
     Geometry *copy() const override;
 
     // Persistence implementer ---------------------
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     void Save(Base::Writer &/*writer*/) const override;
     void Restore(Base::XMLReader &/*reader*/) override;
     // Base implementer ----------------------------
@@ -1012,7 +1012,7 @@ public:
     Geometry *copy() const override;
 
     // Persistence implementer ---------------------
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     void Save(Base::Writer &/*writer*/) const override;
     void Restore(Base::XMLReader &/*reader*/) override;
     // Base implementer ----------------------------
@@ -1045,7 +1045,7 @@ public:
     Geometry *copy() const override;
 
     // Persistence implementer ---------------------
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     void Save(Base::Writer &/*writer*/) const override;
     void Restore(Base::XMLReader &/*reader*/) override;
     // Base implementer ----------------------------
@@ -1072,7 +1072,7 @@ public:
     Geometry *copy() const override;
 
     // Persistence implementer ---------------------
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     void Save(Base::Writer &/*writer*/) const override;
     void Restore(Base::XMLReader &/*reader*/) override;
     // Base implementer ----------------------------
@@ -1103,7 +1103,7 @@ public:
     std::optional<Base::Rotation> getRotation() const override;
 
     // Persistence implementer ---------------------
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     void Save(Base::Writer &/*writer*/) const override;
     void Restore(Base::XMLReader &/*reader*/) override;
     // Base implementer ----------------------------
@@ -1129,7 +1129,7 @@ public:
     Geometry *copy() const override;
 
     // Persistence implementer ---------------------
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     void Save(Base::Writer &/*writer*/) const override;
     void Restore(Base::XMLReader &/*reader*/) override;
     // Base implementer ----------------------------
@@ -1158,7 +1158,7 @@ public:
     Geometry *copy() const override;
 
     // Persistence implementer ---------------------
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     void Save(Base::Writer &/*writer*/) const override;
     void Restore(Base::XMLReader &/*reader*/) override;
     // Base implementer ----------------------------
@@ -1183,7 +1183,7 @@ public:
     Geometry *copy() const override;
 
     // Persistence implementer ---------------------
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     void Save(Base::Writer &/*writer*/) const override;
     void Restore(Base::XMLReader &/*reader*/) override;
     // Base implementer ----------------------------
@@ -1224,7 +1224,7 @@ public:
     Geometry *copy() const override;
 
     // Persistence implementer ---------------------
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     void Save(Base::Writer &/*writer*/) const override;
     void Restore(Base::XMLReader &/*reader*/) override;
     // Base implementer ----------------------------
@@ -1248,7 +1248,7 @@ public:
     Geometry *copy() const override;
 
     // Persistence implementer ---------------------
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     void Save(Base::Writer &/*writer*/) const override;
     void Restore(Base::XMLReader &/*reader*/) override;
     // Base implementer ----------------------------
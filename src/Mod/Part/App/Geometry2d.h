@@ -57,7 +57,7 @@ public:
     virtual TopoDS_Shape toShape() const = 0;
     virtual const Handle(Geom2d_Geometry)& handle() const = 0;
     // Persistence implementer ---------------------
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     void Save(Base::Writer &/*writer*/) const override;
     void Restore(Base::XMLReader &/*reader*/) override;
     /// returns a cloned object
@@ -83,7 +83,7 @@ public:
     TopoDS_Shape toShape() const override;
 
    // Persistence implementer ---------------------
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     void Save(Base::Writer &/*writer*/) const override;
     void Restore(Base::XMLReader &/*reader*/) override;
     // Base implementer ----------------------------
@@ -125,7 +125,7 @@ public:
     Geometry2d *clone() const override;
 
     // Persistence implementer ---------------------
-    unsigned int getMemSize () const override;
+    std::size_t getMemSize () const override;
     void Save (Base::Writer &/*writer*/) const override;
     void Restore(Base::XMLReader &/*reader*/) override;
     // Base implementer ----------------------------
@@ -174,7 +174,7 @@ public:
     std::list<Geometry2d*> toBiArcs(double tolerance) const;
 
     // Persistence implementer ---------------------
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     void Save(Base::Writer &/*writer*/) const override;
     void Restore(Base::XMLReader &/*reader*/) override;
     // Base implementer ----------------------------
@@ -208,7 +208,7 @@ public:
     void setLocation(const Base::Vector2d& Center);
     bool isReversed() const;
 
-    unsigned int getMemSize() const override = 0;
+    std::size_t getMemSize() const override = 0;
     PyObject *getPyObject() override = 0;
 
     const Handle(Geom2d_Geometry)& handle() const override = 0;
@@ -238,7 +238,7 @@ public:
     void getRange(double& u, double& v) const;
     void setRange(double u, double v);
 
-    unsigned int getMemSize() const override = 0;
+    std::size_t getMemSize() const override = 0;
     PyObject *getPyObject() override = 0;
 
     const Handle(Geom2d_Geometry)& handle() const override = 0;
@@ -261,7 +261,7 @@ public:
     void setRadius(double Radius);
 
     // Persistence implementer ---------------------
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     void Save(Base::Writer &/*writer*/) const override;
     void Restore(Base::XMLReader &/*reader*/) override;
     // Base implementer ----------------------------
@@ -288,7 +288,7 @@ public:
     void setRadius(double Radius);
 
     // Persistence implementer ---------------------
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     void Save(Base::Writer &/*writer*/) const override;
     void Restore(Base::XMLReader &/*reader*/) override;
     // Base implementer ----------------------------
@@ -318,7 +318,7 @@ public:
     void setMajorAxisDir(Base::Vector2d newdir);
 
     // Persistence implementer ---------------------
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     void Save(Base::Writer &/*writer*/) const override;
     void Restore(Base::XMLReader &/*reader*/) override;
     // Base implementer ----------------------------
@@ -348,7 +348,7 @@ public:
     void setMajorAxisDir(Base::Vector2d newdir);
 
     // Persistence implementer ---------------------
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     void Save(Base::Writer &/*writer*/) const override;
     void Restore(Base::XMLReader &/*reader*/) override;
     // Base implementer ----------------------------
@@ -376,7 +376,7 @@ public:
     void setMinorRadius(double Radius);
 
     // Persistence implementer ---------------------
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     void Save(Base::Writer &/*writer*/) const override;
     void Restore(Base::XMLReader &/*reader*/) override;
     // Base implementer ----------------------------
@@ -403,7 +403,7 @@ public:
     void setMinorRadius(double Radius);
 
     // Persistence implementer ---------------------
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     void Save(Base::Writer &/*writer*/) const override;
     void Restore(Base::XMLReader &/*reader*/) override;
     // Base implementer ----------------------------
@@ -429,7 +429,7 @@ public:
     void setFocal(double length);
 
     // Persistence implementer ---------------------
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     void Save(Base::Writer &/*writer*/) const override;
     void Restore(Base::XMLReader &/*reader*/) override;
     // Base implementer ----------------------------
@@ -454,7 +454,7 @@ public:
     void setFocal(double length);
 
     // Persistence implementer ---------------------
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     void Save(Base::Writer &/*writer*/) const override;
     void Restore(Base::XMLReader &/*reader*/) override;
     // Base implementer ----------------------------
@@ -482,7 +482,7 @@ public:
     Base::Vector2d getDir() const;
 
     // Persistence implementer ---------------------
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     void Save(Base::Writer &/*writer*/) const override;
     void Restore(Base::XMLReader &/*reader*/) override;
     // Base implementer ----------------------------
@@ -509,7 +509,7 @@ public:
                    const Base::Vector2d& p2);
 
     // Persistence implementer ---------------------
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     void Save(Base::Writer &/*writer*/) const override;
     void Restore(Base::XMLReader &/*reader*/) override;
     // Base implementer ----------------------------
@@ -533,7 +533,7 @@ public:
     Geometry2d *clone() const override;
 
     // Persistence implementer ---------------------
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     void Save(Base::Writer &/*writer*/) const override;
     void Restore(Base::XMLReader &/*reader*/) override;
     // Base implementer ----------------------------
@@ -556,7 +556,7 @@ public:
     Geometry2d *clone() const override;
 
     // Persistence implementer ---------------------
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     void Save(Base::Writer &/*writer*/) const override;
     void Restore(Base::XMLReader &/*reader*/) override;
     // Base implementer ----------------------------
@@ -47,6 +47,8 @@
 
 // STL
 #include <array>
+#include <atomic>
+#include <exception>
 #include <fcntl.h>
 #include <fstream>
 #include <list>
@@ -57,6 +59,7 @@
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <thread>
 #include <vector>
 
 // Qt
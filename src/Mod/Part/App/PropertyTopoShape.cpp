@@ -226,7 +226,7 @@ void PropertyPartShape::Paste(const App::Property &from)
     }
 }
 
-unsigned int PropertyPartShape::getMemSize () const
+std::size_t PropertyPartShape::getMemSize () const
 {
     return _Shape.getMemSize();
 }
@@ -569,21 +569,24 @@ void PropertyPartShape::SaveDocFile (Base::Writer &writer) const
     if (_Shape.getShape().IsNull())
         return;
     TopoDS_Shape myShape = _Shape.getShape();
+    ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath
+        ("User parameter:BaseApp/Preferences/Mod/Part/General");
+    // keep the triangulations so that reopening the document doesn't need to tessellate again
+    bool withTriangles = hGrp->GetBool("SaveTessellation", false);
     if (writer.getMode("BinaryBrep")) {
         TopoShape shape;
         shape.setShape(myShape);
-        shape.exportBinary(writer.Stream());
+        shape.exportBinary(writer.Stream(), withTriangles);
     }
     else {
-        bool direct = App::GetApplication().GetParameterGroupByPath
-            ("User parameter:BaseApp/Preferences/Mod/Part/General")->GetBool("DirectAccess", true);
+        bool direct = hGrp->GetBool("DirectAccess", true);
         if (!direct) {
             saveToFile(writer);
         }
         else {
             TopoShape shape;
             shape.setShape(myShape);
-            shape.exportBrep(writer.Stream());
+            shape.exportBrep(writer.Stream(), withTriangles);
         }
     }
 }
@@ -631,6 +634,46 @@ void PropertyPartShape::RestoreDocFile(Base::Reader &reader)
     _Ver = ver;
 }
 
+bool PropertyPartShape::canParseDocFile() const
+{
+    // parseDocFile() reads from the inflated data in memory, so unlike RestoreDocFile() it
+    // never needs the detour over a temporary file and the DirectAccess setting doesn't matter
+    return true;
+}
+
+std::function<void()> PropertyPartShape::parseDocFile(Base::Reader &reader)
+{
+    Base::FileInfo brep(reader.getFileName());
+    TopoShape shape;
+
+    if (brep.hasExtension("bin")) {
+        shape.importBinary(reader);
+    }
+    else {
+        try {
+            reader.exceptions(std::istream::failbit | std::istream::badbit);
+            BRep_Builder builder;
+            TopoDS_Shape brepShape;
+            BRepTools::Read(brepShape, reader, builder);
+            shape.setShape(brepShape);
+        }
+        catch (const std::exception&) {
+            if (!reader.eof())
+                Base::Console().warning("Failed to load BRep file %s\n", reader.getFileName().c_str());
+        }
+    }
+
+    // restore the element map the same way as RestoreDocFile() does
+    return [this, shape]() mutable {
+        auto elementMap = _Shape.resetElementMap();
+        std::string ver = _Ver;
+        shape.Hasher = _Shape.Hasher;
+        shape.resetElementMap(elementMap);
+        setValue(shape);
+        _Ver = ver;
+    };
+}
+
 // -------------------------------------------------------------------------
 
 ShapeHistory::ShapeHistory(BRepBuilderAPI_MakeShape& mkShape, TopAbs_ShapeEnum type,
@@ -90,10 +90,12 @@ public:
 
     void SaveDocFile (Base::Writer &writer) const override;
     void RestoreDocFile(Base::Reader &reader) override;
+    bool canParseDocFile() const override;
+    std::function<void()> parseDocFile(Base::Reader &reader) override;
 
     App::Property *Copy() const override;
     void Paste(const App::Property &from) override;
-    unsigned int getMemSize () const override;
+    std::size_t getMemSize () const override;
     //@}
 
     /// Get valid paths for this property; used by auto completer
@@ -181,7 +183,7 @@ public:
     Property *Copy() const override;
     void Paste(const Property &from) override;
 
-    unsigned int getMemSize () const override {
+    std::size_t getMemSize () const override {
         return _lValueList.size() * sizeof(ShapeHistory);
     }
 
@@ -248,7 +250,7 @@ public:
     Property *Copy() const override;
     void Paste(const Property &from) override;
 
-    unsigned int getMemSize () const override {
+    std::size_t getMemSize () const override {
         return _lValueList.size() * sizeof(FilletElement);
     }
 
@@ -267,9 +267,9 @@ void PropertyTopoShapeList::Paste(const Property &from)
     setValues(FromList._lValueList);
 }
 
-unsigned int PropertyTopoShapeList::getMemSize() const
+std::size_t PropertyTopoShapeList::getMemSize() const
 {
-    int size = sizeof(PropertyTopoShapeList);
+    std::size_t size = sizeof(PropertyTopoShapeList);
     for (int i = 0; i < getSize(); i++)
         size += _lValueList[i].getMemSize();
     return size;
@@ -891,7 +891,7 @@ void TopoShape::exportBrep(const char *filename) const
 #endif
 }
 
-void TopoShape::exportBrep(std::ostream& out) const
+void TopoShape::exportBrep(std::ostream& out, bool withTriangles) const
 {
     // See TopTools_FormatVersion of OCCT 7.6
     enum {
@@ -899,14 +899,14 @@ void TopoShape::exportBrep(std::ostream& out) const
         VERSION_2 = 2,
         VERSION_3 = 3
     };
-    BRepTools_ShapeSet SS(Standard_False);
+    BRepTools_ShapeSet SS(withTriangles ? Standard_True : Standard_False);
     SS.SetFormatNb(VERSION_1);
     SS.Add(this->_Shape);
     SS.Write(out);
     SS.Write(this->_Shape, out);
 }
 
-void TopoShape::exportBinary(std::ostream& out) const
+void TopoShape::exportBinary(std::ostream& out, bool withTriangles) const
 {
     // See BinTools_FormatVersion of OCCT 7.6
     enum {
@@ -917,7 +917,12 @@ void TopoShape::exportBinary(std::ostream& out) const
     };
 
     // An example how to use BinTools_ShapeSet can be found in BinMNaming_NamedShapeDriver.cxx
+#if OCC_VERSION_HEX >= 0x070600
     BinTools_ShapeSet theShapeSet;
+    theShapeSet.SetWithTriangles(withTriangles ? Standard_True : Standard_False);
+#else
+    BinTools_ShapeSet theShapeSet(withTriangles ? Standard_True : Standard_False);
+#endif
     theShapeSet.SetFormatNb(VERSION_3);
     if (this->_Shape.IsNull()) {
         theShapeSet.Add(this->_Shape);
@@ -1205,11 +1210,11 @@ unsigned int TopoShape_RefCountShapes(const TopoDS_Shape& aShape)
     return size;
 }
 
-unsigned int TopoShape::getMemSize () const
+std::size_t TopoShape::getMemSize () const
 {
     if (!_Shape.IsNull()) {
         // Count total amount of references of TopoDS_Shape objects
-        unsigned int memsize = (sizeof(TopoDS_Shape)+sizeof(TopoDS_TShape)) * TopoShape_RefCountShapes(_Shape);
+        std::size_t memsize = (sizeof(TopoDS_Shape)+sizeof(TopoDS_TShape)) * TopoShape_RefCountShapes(_Shape);
 
         // Now get a map of TopoDS_Shape objects without duplicates
         TopTools_IndexedMapOfShape M;
@@ -460,7 +460,7 @@ public:
 
     void SaveDocFile(Base::Writer& writer) const override;
     void RestoreDocFile(Base::Reader& reader) override;
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     //@}
 
     /** @name Input/Output */
@@ -476,8 +476,9 @@ public:
     void exportIges(const char* FileName) const;
     void exportStep(const char* FileName) const;
     void exportBrep(const char* FileName) const;
-    void exportBrep(std::ostream&) const;
-    void exportBinary(std::ostream&) const;
+    /// \a withTriangles also writes the triangulations of the faces
+    void exportBrep(std::ostream&, bool withTriangles = false) const;
+    void exportBinary(std::ostream&, bool withTriangles = false) const;
     void exportStl(const char* FileName, double deflection) const;
     void exportFaceSet(double, double, const std::vector<Base::Color>&, std::ostream&) const;
     void exportLineSet(std::ostream&) const;
@@ -1649,6 +1650,17 @@ public:
                                        const Mapper &mapper,
                                        const std::vector<TopoShape> &sources,
                                        const char *op=nullptr);
+
+    /** Set the number of threads makeShapeWithElementMap() may use
+     *
+     * The names of the modified and generated elements are collected per
+     * element type and source shape in parallel. The Mapper is only queried
+     * by one thread at a time.
+     *
+     * @param threads: 0 to use all cores, 1 to collect the names serially
+     */
+    static void setElementMapThreads(int threads);
+    static int getElementMapThreads();
     /**
      * When given a single shape to create a compound, two results are possible: either to simply
      * return the shape as given, or to force it to be placed in a Compound.
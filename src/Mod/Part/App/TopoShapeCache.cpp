@@ -135,6 +135,16 @@ int TopoShapeCache::Ancestry::find(const TopoDS_Shape& parent, const TopoDS_Shap
     return shapes.FindIndex(stripLocation(parent, subShape));
 }
 
+int TopoShapeCache::Ancestry::find(const TopLoc_Location& parentInverse,
+                                   const TopoDS_Shape& subShape) const
+{
+    if (parentInverse.IsIdentity()) {
+        return shapes.FindIndex(subShape);
+    }
+    return shapes.FindIndex(
+        TopoShape::located(subShape, parentInverse * subShape.Location()));
+}
+
 TopoDS_Shape TopoShapeCache::Ancestry::find(const TopoDS_Shape& parent, int index)
 {
     if (index <= 0 || index > shapes.Extent()) {
@@ -112,6 +112,9 @@ public:
         std::vector<TopoShape> getTopoShapes(const TopoShape& parent);
         TopoDS_Shape stripLocation(const TopoDS_Shape& parent, const TopoDS_Shape& child);
         int find(const TopoDS_Shape& parent, const TopoDS_Shape& subShape);
+        /// Same as find() above but with the inverted parent location passed in. It does not
+        /// touch the owner, so it can be called concurrently.
+        int find(const TopLoc_Location& parentInverse, const TopoDS_Shape& subShape) const;
         TopoDS_Shape find(const TopoDS_Shape& parent, int index);
         int count() const;
         bool empty() const;
@@ -25,8 +25,11 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <atomic>
 #include <cmath>
+#include <exception>
 #include <limits>
+#include <thread>
 
 #include <BRepAdaptor_Curve.hxx>
 #include <BRepAdaptor_CompCurve.hxx>
@@ -97,6 +100,7 @@
 #include "BRepOffsetAPI_MakeOffsetFix.h"
 #include "Base/BoundBox.h"
 #include "Base/Exception.h"
+#include "Base/Profiler.h"
 #include "Base/Tools.h"
 #include "OCCTProgressIndicator.h"
 
@@ -882,6 +886,7 @@ void TopoShape::mapSubElementForShape(const TopoShape& other, const char* op)
 
 void TopoShape::mapSubElement(const TopoShape& other, const char* op, bool forceHasher)
 {
+    ZoneScoped;
     if (!canMapElement(other)) {
         return;
     }
@@ -1041,6 +1046,7 @@ void TopoShape::mapCompoundSubElements(const std::vector<TopoShape>& shapes, con
 
 void TopoShape::mapSubElement(const std::vector<TopoShape>& shapes, const char* op)
 {
+    ZoneScoped;
     if (shapes.empty()) {
         return;
     }
@@ -1217,12 +1223,14 @@ struct ShapeInfo
     TopoShapeCache::Ancestry& cache;
     TopAbs_ShapeEnum type;
     const char* shapetype;
+    TopLoc_Location locationInverse;
 
     ShapeInfo(const TopoDS_Shape& shape, TopAbs_ShapeEnum type, TopoShapeCache::Ancestry& cache)
         : shape(shape)
         , cache(cache)
         , type(type)
         , shapetype(TopoShape::shapeName(type).c_str())
+        , locationInverse(shape.Location().Inverted())
     {}
 
     [[nodiscard]] int count() const
@@ -1235,9 +1243,10 @@ struct ShapeInfo
         return cache.find(shape, index);
     }
 
-    int find(const TopoDS_Shape& subshape)
+    // Read only, so that the element map tasks can call it concurrently
+    int find(const TopoDS_Shape& subshape) const
     {
-        return cache.find(shape, subshape);
+        return cache.find(locationInverse, subshape);
     }
 };
 
@@ -1385,12 +1394,240 @@ void checkForParallelOrCoplanar(const TopoDS_Shape& newShape,
     }
 }
 
+using NameMap = std::map<Data::IndexedName, std::map<NameKey, NameInfo>>;
+
+// The shapes modified and generated by one source sub-element
+struct ElementHistory
+{
+    TopoDS_Shape element;
+    std::vector<TopoDS_Shape> modified;
+    std::vector<TopoDS_Shape> generated;
+};
+
+// A range of the sub-elements of one type of one source shape
+struct ElementMapTask
+{
+    const ShapeInfo* info;
+    const TopoShape* shape;
+    TopoShapeCache::Ancestry* ancestry;
+    int begin;
+    int end;
+    std::vector<ElementHistory> history;
+};
+
+// Query the history of the sub-elements of a task. Mappers keep temporary
+// results and OCCT makers are not reentrant, so this is always done in the
+// calling thread.
+void queryElementHistory(const TopoShape::Mapper& mapper, ElementMapTask& task)
+{
+    task.history.resize(task.end - task.begin);
+    for (int i = task.begin; i < task.end; i++) {
+        auto& history = task.history[i - task.begin];
+        history.element = task.ancestry->find(task.shape->getShape(), i);
+        history.modified = mapper.modified(history.element);
+        history.generated = mapper.generated(history.element);
+    }
+}
+
+// Collect the names of the new elements that are modified or generated by the
+// sub-elements of a task. It only reads the shapes and their element maps, so
+// that tasks can run concurrently once their history is queried.
+void collectElementNames(const TopoShape& self,
+                         const std::array<ShapeInfo*, TopAbs_SHAPE>& infoMap,
+                         const ElementMapTask& task,
+                         const char* op,
+                         NameMap& newNames)
+{
+    const auto& info = *task.info;
+    const auto& incomingShape = *task.shape;
+    for (int i = task.begin; i < task.end; i++) {
+        const auto& [otherElement, modified, generated] = task.history[i - task.begin];
+        // Find all new objects that are a modification of the old object
+        Data::ElementIDRefs sids;
+        NameKey key(
+            info.type,
+            incomingShape.getMappedName(Data::IndexedName::fromConst(info.shapetype, i),
+                                        true,
+                                        &sids));
+
+        int newShapeCounter = 0;
+        for (auto& newShape : modified) {
+            ++newShapeCounter;
+            if (newShape.ShapeType() >= TopAbs_SHAPE) {
+                // NOLINTNEXTLINE
+                FC_ERR("unknown modified shape type " << newShape.ShapeType() << " from "
+                                                      << info.shapetype << i);
+                continue;
+            }
+            const auto& newInfo = *infoMap.at(newShape.ShapeType());
+            if (newInfo.type != newShape.ShapeType()) {
+                if (FC_LOG_INSTANCE.isEnabled(FC_LOGLEVEL_LOG)) {
+                    // TODO: it seems modified shape may report higher
+                    // level shape type just like generated shape below.
+                    // Maybe we shall do the same for name construction.
+                    // NOLINTNEXTLINE
+                    FC_WARN("modified shape type " << shapeName(newShape.ShapeType())
+                                                   << " mismatch with " << info.shapetype
+                                                   << i);
+                }
+                continue;
+            }
+            int newShapeIndex = newInfo.find(newShape);
+            if (newShapeIndex == 0) {
+                // This warning occurs in makeElementRevolve. It generates
+                // some shape from a vertex that never made into the
+                // final shape. There may be incomingShape cases there.
+                if (FC_LOG_INSTANCE.isEnabled(FC_LOGLEVEL_LOG)) {
+                    // NOLINTNEXTLINE
+                    FC_WARN("Cannot find " << op << " modified " << newInfo.shapetype
+                                           << " from " << info.shapetype << i);
+                }
+                continue;
+            }
+
+            Data::IndexedName element =
+                Data::IndexedName::fromConst(newInfo.shapetype, newShapeIndex);
+            if (self.getMappedName(element)) {
+                continue;
+            }
+
+            key.tag = incomingShape.Tag;
+            auto& name_info = newNames[element][key];
+            name_info.sids = sids;
+            name_info.index = newShapeCounter;
+            name_info.shapetype = info.shapetype;
+        }
+
+        int checkParallel = -1;
+        gp_Pln pln;
+
+        // Find all new objects that were generated from an old object
+        // (e.g. a face generated from an edge)
+        newShapeCounter = 0;
+        for (auto& newShape : generated) {
+            if (newShape.ShapeType() >= TopAbs_SHAPE) {
+                // NOLINTNEXTLINE
+                FC_ERR("unknown generated shape type " << newShape.ShapeType() << " from "
+                                                       << info.shapetype << i);
+                continue;
+            }
+
+            int parallelFace = -1;
+            int coplanarFace = -1;
+            const auto& newInfo = *infoMap.at(newShape.ShapeType());
+            std::vector<TopoDS_Shape> newShapes;
+            int shapeOffset = 0;
+            if (newInfo.type == newShape.ShapeType()) {
+                newShapes.push_back(newShape);
+            }
+            else {
+                // It is possible for the maker to report generating a
+                // higher level shape, such as shell or solid. For
+                // example, when extruding, OCC will report the
+                // extruding face generating the entire solid. However,
+                // it will also report the edges of the extruding face
+                // generating the side faces. In this case, too much
+                // information is bad for us. We don't want the name of
+                // the side face (and its edges) to be coupled with
+                // incomingShape (unrelated) edges in the extruding face.
+                //
+                // shapeOffset below is used to make sure the higher
+                // level mapped names comes late after sorting. We'll
+                // ignore those names if there are more precise mapping
+                // available.
+                shapeOffset = 3;
+
+                if (info.type == TopAbs_FACE && checkParallel < 0) {
+                    if (!TopoShape(otherElement).findPlane(pln)) {
+                        checkParallel = 0;
+                    }
+                    else {
+                        checkParallel = 1;
+                    }
+                }
+                checkForParallelOrCoplanar(newShape,
+                                           newInfo,
+                                           newShapes,
+                                           pln,
+                                           parallelFace,
+                                           coplanarFace,
+                                           checkParallel);
+            }
+            key.shapetype += shapeOffset;
+            for (auto& workingShape : newShapes) {
+                ++newShapeCounter;
+                int workingShapeIndex = newInfo.find(workingShape);
+                if (workingShapeIndex == 0) {
+                    if (FC_LOG_INSTANCE.isEnabled(FC_LOGLEVEL_LOG)) {
+                        // NOLINTNEXTLINE
+                        FC_WARN("Cannot find " << op << " generated " << newInfo.shapetype
+                                               << " from " << info.shapetype << i);
+                    }
+                    continue;
+                }
+
+                Data::IndexedName element =
+                    Data::IndexedName::fromConst(newInfo.shapetype, workingShapeIndex);
+                auto mapped = self.getMappedName(element);
+                if (mapped) {
+                    continue;
+                }
+
+                key.tag = incomingShape.Tag;
+                auto& name_info = newNames[element][key];
+                name_info.sids = sids;
+                if (newShapeCounter == parallelFace) {
+                    name_info.index = std::numeric_limits<int>::min();
+                }
+                else if (newShapeCounter == coplanarFace) {
+                    name_info.index = std::numeric_limits<int>::min() + 1;
+                }
+                else {
+                    name_info.index = -newShapeCounter;
+                }
+                name_info.shapetype = info.shapetype;
+            }
+            key.shapetype -= shapeOffset;
+        }
+    }
+}
+
+void mergeElementNames(NameMap& newNames, NameMap& staged)
+{
+    for (auto& [element, names] : staged) {
+        auto& target = newNames[element];
+        if (target.empty()) {
+            target = std::move(names);
+            continue;
+        }
+        // Same as the serial path, where a later source overwrites the entry
+        for (auto& [key, info] : names) {
+            target.insert_or_assign(key, std::move(info));
+        }
+    }
+}
+
+static std::atomic<int> elementMapThreads {0};
+// Below this, starting the threads costs more than it saves
+constexpr int minParallelElements = 256;
+
+void TopoShape::setElementMapThreads(int threads)
+{
+    elementMapThreads = threads;
+}
+
+int TopoShape::getElementMapThreads()
+{
+    return elementMapThreads;
+}
+
 // TODO: Refactor makeShapeWithElementMap to reduce complexity
 TopoShape& TopoShape::makeShapeWithElementMap(const TopoDS_Shape& shape,
                                               const Mapper& mapper,
                                               const std::vector<TopoShape>& shapes,
                                               const char* op)
 {
+    ZoneScoped;
     setShape(shape);
     if (shape.IsNull()) {
         FC_THROWM(NullShapeException, "Null shape");
@@ -1441,172 +1678,85 @@ TopoShape& TopoShape::makeShapeWithElementMap(const TopoDS_Shape& shape,
     std::string postfix;
     Data::MappedName newName;
 
-    std::map<Data::IndexedName, std::map<NameKey, NameInfo>> newNames;
+    NameMap newNames;
 
     // First, collect names from other shapes that generates or modifies the
-    // new shape
-    for (auto& pinfo : infos) {  // Walk Vertexes, then Edges, then Faces
-        auto& info = *pinfo;
+    // new shape. Walk Vertexes, then Edges, then Faces of each source shape,
+    // split into tasks that can be processed concurrently.
+    constexpr int chunkSize = 64;
+    std::vector<ElementMapTask> tasks;
+    int elementCount = 0;
+    flushElementMap();
+    for (auto& pinfo : infos) {
         for (const auto& incomingShape : shapes) {
             if (!canMapElement(incomingShape)) {
                 continue;
             }
-            auto& otherMap = incomingShape._cache->getAncestry(info.type);
+            auto& otherMap = incomingShape._cache->getAncestry(pinfo->type);
             if (otherMap.empty()) {
                 continue;
             }
-            for (int i = 1; i <= otherMap.count(); i++) {
-                const auto& otherElement = otherMap.find(incomingShape._Shape, i);
-                // Find all new objects that are a modification of the old object
-                Data::ElementIDRefs sids;
-                NameKey key(
-                    info.type,
-                    incomingShape.getMappedName(Data::IndexedName::fromConst(info.shapetype, i),
-                                                true,
-                                                &sids));
-
-                int newShapeCounter = 0;
-                for (auto& newShape : mapper.modified(otherElement)) {
-                    ++newShapeCounter;
-                    if (newShape.ShapeType() >= TopAbs_SHAPE) {
-                        // NOLINTNEXTLINE
-                        FC_ERR("unknown modified shape type " << newShape.ShapeType() << " from "
-                                                              << info.shapetype << i);
-                        continue;
-                    }
-                    auto& newInfo = *infoMap.at(newShape.ShapeType());
-                    if (newInfo.type != newShape.ShapeType()) {
-                        if (FC_LOG_INSTANCE.isEnabled(FC_LOGLEVEL_LOG)) {
-                            // TODO: it seems modified shape may report higher
-                            // level shape type just like generated shape below.
-                            // Maybe we shall do the same for name construction.
-                            // NOLINTNEXTLINE
-                            FC_WARN("modified shape type " << shapeName(newShape.ShapeType())
-                                                           << " mismatch with " << info.shapetype
-                                                           << i);
-                        }
-                        continue;
-                    }
-                    int newShapeIndex = newInfo.find(newShape);
-                    if (newShapeIndex == 0) {
-                        // This warning occurs in makeElementRevolve. It generates
-                        // some shape from a vertex that never made into the
-                        // final shape. There may be incomingShape cases there.
-                        if (FC_LOG_INSTANCE.isEnabled(FC_LOGLEVEL_LOG)) {
-                            // NOLINTNEXTLINE
-                            FC_WARN("Cannot find " << op << " modified " << newInfo.shapetype
-                                                   << " from " << info.shapetype << i);
-                        }
-                        continue;
-                    }
-
-                    Data::IndexedName element =
-                        Data::IndexedName::fromConst(newInfo.shapetype, newShapeIndex);
-                    if (getMappedName(element)) {
-                        continue;
-                    }
+            // Resolve pending element maps here, the tasks only read them
+            incomingShape.flushElementMap();
+            for (int i = 1; i <= otherMap.count(); i += chunkSize) {
+                tasks.push_back({pinfo,
+                                 &incomingShape,
+                                 &otherMap,
+                                 i,
+                                 std::min(i + chunkSize, otherMap.count() + 1)});
+            }
+            elementCount += otherMap.count();
+        }
+    }
 
-                    key.tag = incomingShape.Tag;
-                    auto& name_info = newNames[element][key];
-                    name_info.sids = sids;
-                    name_info.index = newShapeCounter;
-                    name_info.shapetype = info.shapetype;
+    FC_TIME_INIT(t);
+    int threads = getElementMapThreads();
+    if (threads <= 0) {
+        threads = static_cast<int>(std::thread::hardware_concurrency());
+    }
+    threads = std::min<int>(threads, static_cast<int>(tasks.size()));
+    if (threads <= 1 || elementCount < minParallelElements) {
+        for (auto& task : tasks) {
+            queryElementHistory(mapper, task);
+            collectElementNames(*this, infoMap, task, op, newNames);
+            task.history.clear();
+        }
+    }
+    else {
+        for (auto& task : tasks) {
+            queryElementHistory(mapper, task);
+        }
+        FC_TIME_LOG(t, "query history of " << elementCount << " elements");
+        std::vector<NameMap> staged(tasks.size());
+        std::vector<std::exception_ptr> errors(tasks.size());
+        std::atomic<std::size_t> nextTask {0};
+        auto worker = [&]() {
+            for (std::size_t i = nextTask++; i < tasks.size(); i = nextTask++) {
+                try {
+                    collectElementNames(*this, infoMap, tasks[i], op, staged[i]);
                 }
-
-                int checkParallel = -1;
-                gp_Pln pln;
-
-                // Find all new objects that were generated from an old object
-                // (e.g. a face generated from an edge)
-                newShapeCounter = 0;
-                for (auto& newShape : mapper.generated(otherElement)) {
-                    if (newShape.ShapeType() >= TopAbs_SHAPE) {
-                        // NOLINTNEXTLINE
-                        FC_ERR("unknown generated shape type " << newShape.ShapeType() << " from "
-                                                               << info.shapetype << i);
-                        continue;
-                    }
-
-                    int parallelFace = -1;
-                    int coplanarFace = -1;
-                    auto& newInfo = *infoMap.at(newShape.ShapeType());
-                    std::vector<TopoDS_Shape> newShapes;
-                    int shapeOffset = 0;
-                    if (newInfo.type == newShape.ShapeType()) {
-                        newShapes.push_back(newShape);
-                    }
-                    else {
-                        // It is possible for the maker to report generating a
-                        // higher level shape, such as shell or solid. For
-                        // example, when extruding, OCC will report the
-                        // extruding face generating the entire solid. However,
-                        // it will also report the edges of the extruding face
-                        // generating the side faces. In this case, too much
-                        // information is bad for us. We don't want the name of
-                        // the side face (and its edges) to be coupled with
-                        // incomingShape (unrelated) edges in the extruding face.
-                        //
-                        // shapeOffset below is used to make sure the higher
-                        // level mapped names comes late after sorting. We'll
-                        // ignore those names if there are more precise mapping
-                        // available.
-                        shapeOffset = 3;
-
-                        if (info.type == TopAbs_FACE && checkParallel < 0) {
-                            if (!TopoShape(otherElement).findPlane(pln)) {
-                                checkParallel = 0;
-                            }
-                            else {
-                                checkParallel = 1;
-                            }
-                        }
-                        checkForParallelOrCoplanar(newShape,
-                                                   newInfo,
-                                                   newShapes,
-                                                   pln,
-                                                   parallelFace,
-                                                   coplanarFace,
-                                                   checkParallel);
-                    }
-                    key.shapetype += shapeOffset;
-                    for (auto& workingShape : newShapes) {
-                        ++newShapeCounter;
-                        int workingShapeIndex = newInfo.find(workingShape);
-                        if (workingShapeIndex == 0) {
-                            if (FC_LOG_INSTANCE.isEnabled(FC_LOGLEVEL_LOG)) {
-                                // NOLINTNEXTLINE
-                                FC_WARN("Cannot find " << op << " generated " << newInfo.shapetype
-                                                       << " from " << info.shapetype << i);
-                            }
-                            continue;
-                        }
-
-                        Data::IndexedName element =
-                            Data::IndexedName::fromConst(newInfo.shapetype, workingShapeIndex);
-                        auto mapped = getMappedName(element);
-                        if (mapped) {
-                            continue;
-                        }
-
-                        key.tag = incomingShape.Tag;
-                        auto& name_info = newNames[element][key];
-                        name_info.sids = sids;
-                        if (newShapeCounter == parallelFace) {
-                            name_info.index = std::numeric_limits<int>::min();
-                        }
-                        else if (newShapeCounter == coplanarFace) {
-                            name_info.index = std::numeric_limits<int>::min() + 1;
-                        }
-                        else {
-                            name_info.index = -newShapeCounter;
-                        }
-                        name_info.shapetype = info.shapetype;
-                    }
-                    key.shapetype -= shapeOffset;
+                catch (...) {
+                    errors[i] = std::current_exception();
                 }
             }
+        };
+        std::vector<std::thread> pool;
+        for (int i = 1; i < threads; i++) {
+            pool.emplace_back(worker);
+        }
+        worker();
+        for (auto& thread : pool) {
+            thread.join();
+        }
+        // Merge in task order to get the same names as the serial path
+        for (std::size_t i = 0; i < tasks.size(); i++) {
+            if (errors[i]) {
+                std::rethrow_exception(errors[i]);
+            }
+            mergeElementNames(newNames, staged[i]);
         }
     }
+    FC_TIME_LOG(t, "collect names of " << elementCount << " elements");
 
     // We shall first exclude those names generated from high level mapping. If
     // there are still any unnamed elements left after we go through the process
@@ -2089,6 +2239,7 @@ TopoShape& TopoShape::makeElementEvolve(const TopoShape& spine,
                                         double tol,
                                         const char* op)
 {
+    ZoneScoped;
     if (!op) {
         op = Part::OpCodes::Evolve;
     }
@@ -2314,6 +2465,7 @@ TopoShape& TopoShape::makeElementCompound(const std::vector<TopoShape>& shapes,
                                           const char* op,
                                           SingleShapeCompoundCreationPolicy policy)
 {
+    ZoneScoped;
     if (policy == SingleShapeCompoundCreationPolicy::returnShape && shapes.size() == 1) {
         *this = shapes[0];
         return *this;
@@ -2378,6 +2530,7 @@ TopoShape& TopoShape::makeElementPipeShell(const std::vector<TopoShape>& shapes,
                                            double tolBound,
                                            double tolAngular)
 {
+    ZoneScoped;
     if (!op) {
         op = Part::OpCodes::PipeShell;
     }
@@ -2454,6 +2607,7 @@ TopoShape& TopoShape::makeElementOffset(const TopoShape& shape,
                                         FillType fill,
                                         const char* op)
 {
+    ZoneScoped;
     if (!op) {
         op = Part::OpCodes::Offset;
     }
@@ -2593,6 +2747,7 @@ TopoShape& TopoShape::makeElementOffsetFace(const TopoShape& shape,
                                             JoinType innerJoinType,
                                             const char* op)
 {
+    ZoneScoped;
     if (std::abs(innerOffset) < Precision::Confusion()
         && std::abs(offset) < Precision::Confusion()) {
         *this = shape;
@@ -2991,6 +3146,7 @@ TopoShape& TopoShape::makeElementThickSolid(const TopoShape& shape,
                                             JoinType join,
                                             const char* op)
 {
+    ZoneScoped;
     if (!op) {
         op = Part::OpCodes::Thicken;
     }
@@ -3368,6 +3524,7 @@ TopoShape& TopoShape::makeElementTransform(const TopoShape& shape,
                                            const char* op,
                                            CopyType copy)
 {
+    ZoneScoped;
     if (copy == CopyType::noCopy) {
         // OCCT checks the ScaleFactor against gp::Resolution() which is DBL_MIN!!!
         copy = trsf.ScaleFactor() * trsf.HVectorialPart().Determinant() < 0.
@@ -3413,6 +3570,7 @@ TopoShape& TopoShape::makeElementGTransform(const TopoShape& shape,
                                             const char* op,
                                             CopyType copy)
 {
+    ZoneScoped;
     if (shape.isNull()) {
         FC_THROWM(NullShapeException, "Null input shape");
     }
@@ -3654,6 +3812,7 @@ TopoShape& TopoShape::makeElementFilledFace(const std::vector<TopoShape>& _shape
                                             const BRepFillingParams& params,
                                             const char* op)
 {
+    ZoneScoped;
     if (!op) {
         op = Part::OpCodes::FilledFace;
     }
@@ -3942,6 +4101,7 @@ TopoShape& TopoShape::makeElementSlices(const TopoShape& shape,
                                         const std::vector<double>& distances,
                                         const char* op)
 {
+    ZoneScoped;
     std::vector<TopoShape> wires;
     TopoCrossSection cs(dir.x, dir.y, dir.z, shape, op);
     int index = 0;
@@ -3999,6 +4159,7 @@ TopoShape& TopoShape::makeElementFillet(const TopoShape& shape,
                                         double radius2,
                                         const char* op)
 {
+    ZoneScoped;
     if (!op) {
         op = Part::OpCodes::Fillet;
     }
@@ -4031,6 +4192,7 @@ TopoShape& TopoShape::makeElementChamfer(const TopoShape& shape,
                                          const char* op,
                                          Flip flipDirection)
 {
+    ZoneScoped;
     if (!op) {
         op = Part::OpCodes::Chamfer;
     }
@@ -4080,6 +4242,7 @@ TopoShape& TopoShape::makeElementGeneralFuse(const std::vector<TopoShape>& _shap
                                              double tol,
                                              const char* op)
 {
+    ZoneScoped;
     if (!op) {
         op = Part::OpCodes::GeneralFuse;
     }
@@ -4187,6 +4350,7 @@ TopoShape& TopoShape::makeElementLoft(const std::vector<TopoShape>& shapes,
                                       Standard_Integer maxDegree,
                                       const char* op)
 {
+    ZoneScoped;
     if (!op) {
         op = Part::OpCodes::Loft;
     }
@@ -4262,6 +4426,7 @@ TopoShape& TopoShape::makeElementLoft(const std::vector<TopoShape>& shapes,
 
 TopoShape& TopoShape::makeElementPrism(const TopoShape& base, const gp_Vec& vec, const char* op)
 {
+    ZoneScoped;
     if (!op) {
         op = Part::OpCodes::Extrude;
     }
@@ -4281,6 +4446,7 @@ TopoShape& TopoShape::makeElementPrismUntil(const TopoShape& _base,
                                             Standard_Boolean checkLimits,
                                             const char* op)
 {
+    ZoneScoped;
     if (!op) {
         op = Part::OpCodes::Prism;
     }
@@ -4474,6 +4640,7 @@ TopoShape& TopoShape::makeElementRevolve(const TopoShape& _base,
                                          const char* face_maker,
                                          const char* op)
 {
+    ZoneScoped;
     if (!op) {
         op = Part::OpCodes::Revolve;
     }
@@ -4502,6 +4669,7 @@ TopoShape& TopoShape::makeElementRevolution(const TopoShape& _base,
                                             Standard_Boolean Modify,
                                             const char* op)
 {
+    ZoneScoped;
     if (!op) {
         op = Part::OpCodes::Revolve;
     }
@@ -4544,6 +4712,7 @@ TopoShape& TopoShape::makeElementDraft(const TopoShape& shape,
                                        bool retry,
                                        const char* op)
 {
+    ZoneScoped;
     if (!op) {
         op = Part::OpCodes::Draft;
     }
@@ -4611,6 +4780,7 @@ TopoShape& TopoShape::makeElementFace(const std::vector<TopoShape>& shapes,
                                       const char* maker,
                                       const gp_Pln* plane)
 {
+    ZoneScoped;
     if (!maker || !maker[0]) {
         maker = "Part::FaceMakerBullseye";
     }
@@ -4689,6 +4859,7 @@ public:
 
 TopoShape& TopoShape::makeElementRefine(const TopoShape& shape, const char* op, RefineFail no_fail)
 {
+    ZoneScoped;
     if (shape.isNull()) {
         if (no_fail == RefineFail::throwException) {
             FC_THROWM(NullShapeException, "Null shape");
@@ -5428,6 +5599,7 @@ const std::vector<TopoDS_Shape>& MapperHistory::generated(const TopoDS_Shape& s)
 // topo naming counterpart of TopoShape::makeShell()
 TopoShape& TopoShape::makeElementShell(bool silent, const char* op)
 {
+    ZoneScoped;
     if (silent) {
         if (isNull()) {
             return *this;
@@ -5608,6 +5780,7 @@ TopoShape& TopoShape::makeElementBoolean(const char* maker,
                                          const char* op,
                                          double tolerance)
 {
+    ZoneScoped;
     if (!maker) {
         FC_THROWM(Base::CADKernelError, "no maker");
     }
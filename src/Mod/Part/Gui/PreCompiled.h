@@ -84,6 +84,7 @@
 
 // Qt Toolkit
 # include <Gui/QtAll.h>
+# include <QCryptographicHash>
 
 // Inventor includes OpenGL
 # include <Gui/InventorAll.h>
@@ -0,0 +1,266 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 The FreeCAD Project Association                     *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+
+#ifndef _PreComp_
+# include <algorithm>
+# include <cmath>
+# include <sstream>
+
+# include <BRep_Builder.hxx>
+# include <BRep_Tool.hxx>
+# include <BRepTools_ShapeSet.hxx>
+# include <TopExp.hxx>
+# include <TopoDS.hxx>
+# include <TopoDS_Edge.hxx>
+# include <TopTools_IndexedMapOfShape.hxx>
+
+# include <QByteArray>
+# include <QCryptographicHash>
+#endif
+
+#include <App/Application.h>
+#include <Base/Parameter.h>
+
+#include "TessellationCache.h"
+
+
+using namespace PartGui;
+
+namespace
+{
+ParameterGrp::handle getParameter()
+{
+    return App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Part/General");
+}
+
+// The triangulation is stored in the TShape of the face, so location and orientation
+// don't matter.
+TopoDS_Face localFace(const TopoDS_Face& face)
+{
+    TopoDS_Face local = face;
+    local.Location(TopLoc_Location());
+    local.Orientation(TopAbs_FORWARD);
+    return local;
+}
+}  // namespace
+
+TessellationCache& TessellationCache::instance()
+{
+    static TessellationCache cache;
+    return cache;
+}
+
+bool TessellationCache::isEnabled() const
+{
+    return getParameter()->GetBool("TessellationCache", true);
+}
+
+double TessellationCache::quantizeDeflection(double deflection)
+{
+    if (deflection <= 0.0) {
+        return deflection;
+    }
+    constexpr double stepsPerOctave = 4.0;
+    return std::exp2(std::floor(std::log2(deflection) * stepsPerOctave) / stepsPerOctave);
+}
+
+std::string TessellationCache::makeKey(const TopoDS_Face& face, double deflection, double angle)
+{
+    std::ostringstream str;
+    BRepTools_ShapeSet shapeSet(Standard_False);
+    shapeSet.Add(face);
+    shapeSet.Write(str);
+    shapeSet.Write(face, str);
+
+    std::string data = str.str();
+    QByteArray digest =
+        QCryptographicHash::hash(QByteArray::fromRawData(data.c_str(), int(data.size())),
+                                 QCryptographicHash::Sha1);
+
+    std::string key(digest.constData(), digest.size());
+    key.append(reinterpret_cast<const char*>(&deflection), sizeof(deflection));
+    key.append(reinterpret_cast<const char*>(&angle), sizeof(angle));
+    return key;
+}
+
+std::size_t TessellationCache::memorySize(const Entry& entry)
+{
+    const Handle(Poly_Triangulation)& tria = entry.triangulation;
+    std::size_t size = entry.key.size() + sizeof(Entry);
+    size += std::size_t(tria->NbNodes()) * sizeof(gp_Pnt);
+    size += std::size_t(tria->NbTriangles()) * sizeof(Poly_Triangle);
+    if (tria->HasUVNodes()) {
+        size += std::size_t(tria->NbNodes()) * sizeof(gp_Pnt2d);
+    }
+
+    for (const auto& edge : entry.edges) {
+        for (const auto& poly : {edge.forward, edge.reversed}) {
+            if (!poly.IsNull()) {
+                size += std::size_t(poly->NbNodes()) * (sizeof(int) + sizeof(double));
+            }
+        }
+    }
+
+    return size;
+}
+
+TessellationCache::FaceKeys
+TessellationCache::apply(const TopoDS_Shape& shape, double deflection, double angle)
+{
+    FaceKeys uncached;
+    if (!isEnabled() || shape.IsNull()) {
+        return uncached;
+    }
+
+    BRep_Builder builder;
+    TopTools_IndexedMapOfShape faceMap;
+    TopExp::MapShapes(shape, TopAbs_FACE, faceMap);
+    for (int i = 1; i <= faceMap.Extent(); i++) {
+        TopoDS_Face face = localFace(TopoDS::Face(faceMap(i)));
+        TopLoc_Location loc;
+        Handle(Poly_Triangulation) current = BRep_Tool::Triangulation(face, loc);
+        // a fine enough triangulation is kept by BRepMesh_IncrementalMesh anyway
+        if (!current.IsNull() && current->Deflection() <= deflection) {
+            continue;
+        }
+
+        std::string key = makeKey(face, deflection, angle);
+        auto it = index.find(key);
+        TopTools_IndexedMapOfShape edgeMap;
+        TopExp::MapShapes(face, TopAbs_EDGE, edgeMap);
+        if (it == index.end() || edgeMap.Extent() != int(it->second->edges.size())) {
+            uncached.emplace_back(face, std::move(key));
+            continue;
+        }
+
+        // move the entry to the front of the list of recently used entries
+        entries.splice(entries.begin(), entries, it->second);
+        const Entry& entry = *it->second;
+
+        builder.UpdateFace(face, entry.triangulation);
+        for (int j = 1; j <= edgeMap.Extent(); j++) {
+            const TopoDS_Edge& edge = TopoDS::Edge(edgeMap(j));
+            if (!current.IsNull()) {
+                // remove the polygons of the replaced triangulation
+                if (BRep_Tool::IsClosed(edge, face)) {
+                    builder.UpdateEdge(edge,
+                                       Handle(Poly_PolygonOnTriangulation)(),
+                                       Handle(Poly_PolygonOnTriangulation)(),
+                                       current,
+                                       loc);
+                }
+                else {
+                    builder.UpdateEdge(edge, Handle(Poly_PolygonOnTriangulation)(), current, loc);
+                }
+            }
+
+            const EdgePolygons& poly = entry.edges[j - 1];
+            if (poly.forward.IsNull()) {
+                continue;
+            }
+            if (poly.reversed.IsNull()) {
+                builder.UpdateEdge(edge, poly.forward, entry.triangulation, loc);
+            }
+            else {
+                builder.UpdateEdge(TopoDS::Edge(edge.Oriented(TopAbs_FORWARD)),
+                                   poly.forward,
+                                   poly.reversed,
+                                   entry.triangulation,
+                                   loc);
+            }
+        }
+    }
+
+    return uncached;
+}
+
+void TessellationCache::insert(const FaceKeys& faces)
+{
+    if (faces.empty() || !isEnabled()) {
+        return;
+    }
+
+    for (const auto& [face, key] : faces) {
+        if (index.find(key) != index.end()) {
+            continue;
+        }
+
+        TopLoc_Location loc;
+        Handle(Poly_Triangulation) tria = BRep_Tool::Triangulation(face, loc);
+        if (tria.IsNull()) {
+            continue;
+        }
+
+        Entry entry;
+        entry.key = key;
+        entry.triangulation = tria;
+
+        TopTools_IndexedMapOfShape edgeMap;
+        TopExp::MapShapes(face, TopAbs_EDGE, edgeMap);
+        for (int i = 1; i <= edgeMap.Extent(); i++) {
+            const TopoDS_Edge& edge = TopoDS::Edge(edgeMap(i));
+            EdgePolygons poly;
+            if (BRep_Tool::IsClosed(edge, face)) {
+                poly.forward = BRep_Tool::PolygonOnTriangulation(
+                    TopoDS::Edge(edge.Oriented(TopAbs_FORWARD)), tria, loc);
+                poly.reversed = BRep_Tool::PolygonOnTriangulation(
+                    TopoDS::Edge(edge.Oriented(TopAbs_REVERSED)), tria, loc);
+            }
+            else {
+                poly.forward = BRep_Tool::PolygonOnTriangulation(edge, tria, loc);
+            }
+            entry.edges.push_back(poly);
+        }
+
+        entry.memory = memorySize(entry);
+        memory += entry.memory;
+        entries.push_front(std::move(entry));
+        index[key] = entries.begin();
+    }
+
+    shrink();
+}
+
+void TessellationCache::shrink()
+{
+    // the limit is given in MB
+    long size = std::max(getParameter()->GetInt("TessellationCacheSize", 256), 0L);
+    std::size_t limit = std::size_t(size);
+    limit *= 1024 * 1024;
+    while (memory > limit && !entries.empty()) {
+        const Entry& entry = entries.back();
+        memory -= entry.memory;
+        index.erase(entry.key);
+        entries.pop_back();
+    }
+}
+
+void TessellationCache::clear()
+{
+    entries.clear();
+    index.clear();
+    memory = 0;
+}
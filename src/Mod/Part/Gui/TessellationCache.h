@@ -0,0 +1,116 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 The FreeCAD Project Association                     *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+
+#ifndef PARTGUI_TESSELLATIONCACHE_H
+#define PARTGUI_TESSELLATIONCACHE_H
+
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <Poly_PolygonOnTriangulation.hxx>
+#include <Poly_Triangulation.hxx>
+#include <TopoDS_Face.hxx>
+
+#include <Mod/Part/PartGlobal.h>
+
+class TopoDS_Shape;
+
+namespace PartGui
+{
+
+/**
+ * Keeps the triangulations of faces that were tessellated for display.
+ * A face is identified by its geometry and the tessellation parameters. Because recomputes
+ * create new faces even if they didn't change, the key is computed from the BRep data of
+ * the face and not from its TShape. The least recently used entries are removed if the
+ * cache exceeds its size limit.
+ */
+class PartGuiExport TessellationCache
+{
+public:
+    /// Faces without triangulation and their keys
+    using FaceKeys = std::vector<std::pair<TopoDS_Face, std::string>>;
+
+    static TessellationCache& instance();
+
+    /// Returns true if the cache is enabled in the preferences
+    bool isEnabled() const;
+
+    /** Rounds \a deflection down to one of four steps per power of two.
+     * The display deflection is derived from the bounding box of the whole shape, so it
+     * changes with every edit that moves the box. Tessellating with the rounded value lets
+     * the faces that didn't change be found again, and never gives a coarser tessellation
+     * than requested.
+     */
+    static double quantizeDeflection(double deflection);
+
+    /** Assigns the cached triangulations to the faces of \a shape that have none.
+     * The faces that aren't in the cache are returned and can be passed to insert()
+     * once they are tessellated.
+     */
+    FaceKeys apply(const TopoDS_Shape& shape, double deflection, double angle);
+    /// Adds the triangulations of \a faces to the cache
+    void insert(const FaceKeys& faces);
+    void clear();
+
+    std::size_t size() const
+    {
+        return entries.size();
+    }
+
+private:
+    TessellationCache() = default;
+
+    struct EdgePolygons
+    {
+        Handle(Poly_PolygonOnTriangulation) forward;
+        // only set for seam edges
+        Handle(Poly_PolygonOnTriangulation) reversed;
+    };
+
+    struct Entry
+    {
+        std::string key;
+        Handle(Poly_Triangulation) triangulation;
+        std::vector<EdgePolygons> edges;
+        std::size_t memory {};
+    };
+
+    static std::string makeKey(const TopoDS_Face& face, double deflection, double angle);
+    static std::size_t memorySize(const Entry& entry);
+    void shrink();
+
+private:
+    std::list<Entry> entries;
+    std::unordered_map<std::string, std::list<Entry>::iterator> index;
+    std::size_t memory {};
+};
+
+}  // namespace PartGui
+
+
+#endif  // PARTGUI_TESSELLATIONCACHE_H
@@ -91,6 +91,7 @@
 #include "SoBrepFaceSet.h"
 #include "SoBrepPointSet.h"
 #include "TaskFaceAppearances.h"
+#include "TessellationCache.h"
 
 
 FC_LOG_LEVEL_INIT("Part", true, true)
@@ -849,20 +850,42 @@ void ViewProviderPartExt::updateData(const App::Property* prop)
 {
     const char *propName = prop->getName();
     if (propName && (strcmp(propName, "Shape") == 0 || strstr(propName, "Touched"))) {
-        // calculate the visual only if visible
-        if (isUpdateForced() || Visibility.getValue())
-            updateVisual();
+        if (deferShapeVisual)
+            shapeVisualPending = true;
         else
-            VisualTouched = true;
+            updateShapeVisual();
+    }
+    Gui::ViewProviderGeometryObject::updateData(prop);
+}
 
-        if (!VisualTouched) {
-            if (this->faceset->partIndex.getNum() >
-                this->pcShapeMaterial->diffuseColor.getNum()) {
-                this->pcFaceBind->value = SoMaterialBinding::OVERALL;
-            }
+void ViewProviderPartExt::updateDataBatch(const std::vector<const App::Property*>& props)
+{
+    // the shape and a 'Touched' property changed in the same batch would tessellate twice
+    shapeVisualPending = false;
+    {
+        Base::FlagToggler<> flag(deferShapeVisual);
+        Gui::ViewProviderGeometryObject::updateDataBatch(props);
+    }
+    if (shapeVisualPending) {
+        shapeVisualPending = false;
+        updateShapeVisual();
+    }
+}
+
+void ViewProviderPartExt::updateShapeVisual()
+{
+    // calculate the visual only if visible
+    if (isUpdateForced() || Visibility.getValue())
+        updateVisual();
+    else
+        VisualTouched = true;
+
+    if (!VisualTouched) {
+        if (this->faceset->partIndex.getNum() >
+            this->pcShapeMaterial->diffuseColor.getNum()) {
+            this->pcFaceBind->value = SoMaterialBinding::OVERALL;
         }
     }
-    Gui::ViewProviderGeometryObject::updateData(prop);
 }
 
 void ViewProviderPartExt::startRestoring()
@@ -957,7 +980,7 @@ void ViewProviderPartExt::updateVisual()
 
     // time measurement and book keeping
     Base::TimeElapsed start_time;
-    int numTriangles=0,numNodes=0,numNorms=0,numFaces=0,numEdges=0,numLines=0;
+    int numTriangles=0,numNodes=0,numNorms=0,numFaces=0,numEdges=0,numLines=0,numCachedFaces=0;
     std::set<int> faceEdges;
 
     try {
@@ -980,6 +1003,13 @@ void ViewProviderPartExt::updateVisual()
         // See also forum: https://forum.freecad.org/viewtopic.php?t=77521
         //deflection = std::min(deflection, 20.0);
 
+        // faces that didn't change since the last tessellation are taken from the cache,
+        // BRepMesh_IncrementalMesh only meshes the others
+        TessellationCache& cache = TessellationCache::instance();
+        if (cache.isEnabled()) {
+            deflection = TessellationCache::quantizeDeflection(deflection);
+        }
+
         // create or use the mesh on the data structure
         Standard_Real AngDeflectionRads = Base::toRadians(AngularDeflection.getValue());
 
@@ -990,7 +1020,11 @@ void ViewProviderPartExt::updateVisual()
         meshParams.InParallel = Standard_True;
         meshParams.AllowQualityDecrease = Standard_True;
 
+        TessellationCache::FaceKeys uncachedFaces = cache.apply(cShape, deflection, AngDeflectionRads);
+        numCachedFaces = -static_cast<int>(uncachedFaces.size());
+
         BRepMesh_IncrementalMesh(cShape, meshParams);
+        cache.insert(uncachedFaces);
 
         // We must reset the location here because the transformation data
         // are set in the placement property
@@ -1018,6 +1052,7 @@ void ViewProviderPartExt::updateVisual()
             }
             numFaces++;
         }
+        numCachedFaces += numFaces;
 
         // get an indexed map of edges
         TopTools_IndexedMapOfShape edgeMap;
@@ -1314,8 +1349,10 @@ void ViewProviderPartExt::updateVisual()
         // printing some information
         Base::Console().log("ViewProvider update time: %f s\n",Base::TimeElapsed::diffTimeF(start_time,Base::TimeElapsed()));
         Base::Console().log("Shape tria info: Faces:%d Edges:%d Nodes:%d Triangles:%d IdxVec:%d\n",numFaces,numEdges,numNodes,numTriangles,numLines);
+        Base::Console().log("Shape tria cache: %d of %d faces not tessellated\n",numCachedFaces,numFaces);
 #   else
     (void)numEdges;
+    (void)numCachedFaces;
 #   endif
     VisualTouched = false;
 
@@ -100,6 +100,8 @@ public:
     bool changeFaceAppearances();
 
     void updateData(const App::Property*) override;
+    /// The shape is tessellated at most once per change batch
+    void updateDataBatch(const std::vector<const App::Property*>& props) override;
 
     /** @name Restoring view provider from document load */
     //@{
@@ -166,6 +168,7 @@ protected:
     void onChanged(const App::Property* prop) override;
     bool loadParameter();
     void updateVisual();
+    void updateShapeVisual();
     void handleChangedPropertyName(Base::XMLReader& reader,
                                    const char* TypeName,
                                    const char* PropName) override;
@@ -192,6 +195,9 @@ protected:
 
 private:
     Gui::ViewProviderFaceTexture texture;
+    // set while a change batch is passed to updateData()
+    bool deferShapeVisual {false};
+    bool shapeVisualPending {false};
     // settings stuff
     int forceUpdateCount;
     static App::PropertyFloatConstraint::Constraints sizeRange;
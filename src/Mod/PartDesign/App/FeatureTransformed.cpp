@@ -49,6 +49,7 @@
 #include "FeatureLinearPattern.h"
 #include "FeaturePolarPattern.h"
 #include "FeatureSketchBased.h"
+#include "PatternBoolean.h"
 #include "Mod/Part/App/TopoShapeOpCode.h"
 #include "Mod/Part/App/OCCTProgressIndicator.h"
 
@@ -74,6 +75,21 @@ Transformed::Transformed()
 
     ADD_PROPERTY(TransformMode, (static_cast<long>(Mode::TransformToolShapes)));
     TransformMode.setEnums(transformModeEnums.data());
+
+    // Off by default so that the patterns of older files keep their element names,
+    // new features get it switched on in setupObject()
+    ADD_PROPERTY_TYPE(BatchBooleans,
+                      (false),
+                      "Part Design",
+                      App::Prop_None,
+                      "Fuse large patterns in batches of instances that do not touch.\n"
+                      "This is faster but gives other element names than a single boolean.");
+}
+
+void Transformed::setupObject()
+{
+    BatchBooleans.setValue(true);
+    FeatureRefine::setupObject();
 }
 
 void Transformed::positionBySupport()
@@ -193,7 +209,7 @@ void Transformed::handleChangedPropertyType(Base::XMLReader& reader,
 
 short Transformed::mustExecute() const
 {
-    if (Originals.isTouched() || TransformMode.isTouched()) {
+    if (Originals.isTouched() || TransformMode.isTouched() || BatchBooleans.isTouched()) {
         return 1;
     }
     return PartDesign::Feature::mustExecute();
@@ -275,8 +291,9 @@ App::DocumentObjectExecReturn* Transformed::execute()
 
     supportShape.setTransform(Base::Matrix4D());
 
-    auto getTransformedCompShape = [&](const auto& supportShape, const auto& origShape) {
-        std::vector<TopoShape> shapes = {supportShape};
+    auto getTransformedShapes = [&](const auto& origShape) {
+        std::vector<TopoShape> shapes;
+        shapes.reserve(transformations.size());
         TopoShape shape (origShape);
         int idx=1;
         auto transformIter = transformations.cbegin();
@@ -325,27 +342,36 @@ App::DocumentObjectExecReturn* Transformed::execute()
                     cutShape = cutShape.makeElementTransform(trsf);
                 }
                 if (!fuseShape.isNull()) {
-                    auto shapes = getTransformedCompShape(supportShape, fuseShape);
+                    auto shapes = getTransformedShapes(fuseShape);
                     if (OCCTProgressIndicator::getAppIndicator().UserBreak()) {
                         return new App::DocumentObjectExecReturn("User aborted");
                     }
-                    supportShape.makeElementFuse(shapes);
+                    PatternBoolean::apply(supportShape,
+                                          shapes,
+                                          PatternBoolean::Operation::Fuse,
+                                          BatchBooleans.getValue());
                 }
                 if (!cutShape.isNull()) {
-                    auto shapes = getTransformedCompShape(supportShape, cutShape);
+                    auto shapes = getTransformedShapes(cutShape);
                     if (OCCTProgressIndicator::getAppIndicator().UserBreak()) {
                         return new App::DocumentObjectExecReturn("User aborted");
                     }
-                    supportShape.makeElementCut(shapes);
+                    PatternBoolean::apply(supportShape,
+                                          shapes,
+                                          PatternBoolean::Operation::Cut,
+                                          BatchBooleans.getValue());
                 }
             }
             break;
         case Mode::TransformBody: {
-            auto shapes = getTransformedCompShape(supportShape, supportShape);
+            auto shapes = getTransformedShapes(supportShape);
             if (OCCTProgressIndicator::getAppIndicator().UserBreak()) {
                 return new App::DocumentObjectExecReturn("User aborted");
             }
-            supportShape.makeElementFuse(shapes);
+            PatternBoolean::apply(supportShape,
+                                  shapes,
+                                  PatternBoolean::Operation::Fuse,
+                                  BatchBooleans.getValue());
             break;
         }
     }
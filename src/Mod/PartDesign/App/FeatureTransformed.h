@@ -58,6 +58,9 @@ public:
 
     App::PropertyBool Refine;
 
+    /// Fuse large patterns in batches of instances that do not touch, see PatternBoolean
+    App::PropertyBool BatchBooleans;
+
     /**
      * Returns the BaseFeature property's object(if any) otherwise return first original,
      *         which serves as "Support" for old style workflows
@@ -100,6 +103,7 @@ public:
     TopoDS_Shape rejected;
 
 protected:
+    void setupObject() override;
     void Restore(Base::XMLReader& reader) override;
     void handleChangedPropertyType(Base::XMLReader& reader,
                                    const char* TypeName,
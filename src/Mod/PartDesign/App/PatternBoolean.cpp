@@ -0,0 +1,304 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 The FreeCAD Project Association                     *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+
+#include "PreCompiled.h"
+#ifndef _PreComp_
+#include <algorithm>
+#include <exception>
+#include <memory>
+#include <Bnd_Box.hxx>
+#include <BRepBndLib.hxx>
+#include <OSD_Parallel.hxx>
+#include <Precision.hxx>
+#include <Standard_Version.hxx>
+#include <TopoDS_Iterator.hxx>
+#include <TopTools_ListOfShape.hxx>
+#endif
+
+#include <App/Application.h>
+#include <Base/Exception.h>
+#include <Mod/Part/App/FCBRepAlgoAPI_Cut.h>
+#include <Mod/Part/App/FCBRepAlgoAPI_Fuse.h>
+#include <Mod/Part/App/OCCTProgressIndicator.h>
+#include <Mod/Part/App/TopoShapeOpCode.h>
+
+#include "PatternBoolean.h"
+
+
+using namespace PartDesign;
+using Part::OCCTProgressIndicator;
+using Part::TopoShape;
+
+namespace
+{
+
+void checkUserBreak()
+{
+    if (OCCTProgressIndicator::getAppIndicator().UserBreak()) {
+        throw Base::CADKernelError("User aborted");
+    }
+}
+
+// Runs in a worker thread, so it must neither touch the element maps nor the app indicator
+void buildFuse(FCBRepAlgoAPI_Fuse& mk, const TopoShape& argument, const TopoShape& tool)
+{
+    TopTools_ListOfShape arguments;
+    TopTools_ListOfShape tools;
+    arguments.Append(argument.getShape());
+    tools.Append(tool.getShape());
+    mk.SetArguments(arguments);
+    mk.SetTools(tools);
+    FCBRepAlgoAPIHelper::setAutoFuzzy(&mk);
+    mk.Build();
+    if (!mk.IsDone()) {
+        throw Base::CADKernelError("Failed to fuse pattern instances");
+    }
+}
+
+/// Fuses the batches pairwise, level by level, until one shape is left
+TopoShape reduceBatches(std::vector<TopoShape> level, const TopoShape& support)
+{
+    while (level.size() > 1) {
+        checkUserBreak();
+
+        const std::size_t pairs = level.size() / 2;
+        std::vector<std::unique_ptr<FCBRepAlgoAPI_Fuse>> makers;
+        makers.reserve(pairs);
+        for (std::size_t i = 0; i < pairs; ++i) {
+            makers.push_back(std::make_unique<FCBRepAlgoAPI_Fuse>());
+        }
+        // OSD_Parallel runs the fusions on the OCCT thread pool, which is sized to the
+        // number of cores. Failures are rethrown here in pair order.
+        std::vector<std::exception_ptr> errors(pairs);
+        OSD_Parallel::For(0, static_cast<int>(pairs), [&](int i) {
+            try {
+                buildFuse(*makers[i], level[2 * i], level[2 * i + 1]);
+            }
+            catch (...) {
+                errors[i] = std::current_exception();
+            }
+        });
+        for (const auto& error : errors) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+
+        std::vector<TopoShape> next;
+        next.reserve(pairs + 1);
+        for (std::size_t i = 0; i < pairs; ++i) {
+            next.push_back(TopoShape(support.Tag, support.Hasher)
+                               .makeElementShape(*makers[i],
+                                                 {level[2 * i], level[2 * i + 1]},
+                                                 Part::OpCodes::Fuse));
+        }
+        if (level.size() % 2 != 0) {
+            next.push_back(std::move(level.back()));
+        }
+        level = std::move(next);
+    }
+    return std::move(level.front());
+}
+
+}  // namespace
+
+int PatternBoolean::batchThreshold()
+{
+    Base::Reference<ParameterGrp> hGrp = App::GetApplication().GetUserParameter()
+        .GetGroup("BaseApp")->GetGroup("Preferences")->GetGroup("Mod/PartDesign");
+    return static_cast<int>(hGrp->GetInt("PatternBatchThreshold", 16));
+}
+
+std::vector<std::vector<int>>
+PatternBoolean::makeBatches(const std::vector<TopoShape>& instances)
+{
+    const int count = static_cast<int>(instances.size());
+
+    std::vector<Bnd_Box> boxes(count);
+    Bnd_Box bounds;
+    for (int i = 0; i < count; ++i) {
+        if (!instances[i].isNull()) {
+            BRepBndLib::Add(instances[i].getShape(), boxes[i]);
+        }
+        if (!boxes[i].IsVoid()) {
+            // instances that merely touch must not share a batch either
+            boxes[i].Enlarge(Precision::Confusion());
+            bounds.Add(boxes[i]);
+        }
+    }
+
+    // Sweep and prune along the axis the pattern spreads the most, so that few boxes are active
+    // at the same time
+    std::vector<std::vector<int>> neighbours(count);
+    if (!bounds.IsVoid()) {
+        double lo[3];
+        double hi[3];
+        bounds.Get(lo[0], lo[1], lo[2], hi[0], hi[1], hi[2]);
+        int axis = 0;
+        for (int k = 1; k < 3; ++k) {
+            if (hi[k] - lo[k] > hi[axis] - lo[axis]) {
+                axis = k;
+            }
+        }
+
+        struct Interval
+        {
+            double min;
+            double max;
+            int index;
+        };
+        std::vector<Interval> intervals;
+        intervals.reserve(count);
+        for (int i = 0; i < count; ++i) {
+            if (boxes[i].IsVoid()) {
+                continue;
+            }
+            double bmin[3];
+            double bmax[3];
+            boxes[i].Get(bmin[0], bmin[1], bmin[2], bmax[0], bmax[1], bmax[2]);
+            intervals.push_back({bmin[axis], bmax[axis], i});
+        }
+        std::sort(intervals.begin(), intervals.end(), [](const Interval& a, const Interval& b) {
+            return a.min < b.min || (a.min == b.min && a.index < b.index);
+        });
+
+        std::vector<Interval> active;
+        for (const auto& interval : intervals) {
+            active.erase(std::remove_if(active.begin(),
+                                        active.end(),
+                                        [&](const Interval& other) {
+                                            return other.max < interval.min;
+                                        }),
+                         active.end());
+            for (const auto& other : active) {
+                if (!boxes[interval.index].IsOut(boxes[other.index])) {
+                    neighbours[interval.index].push_back(other.index);
+                    neighbours[other.index].push_back(interval.index);
+                }
+            }
+            active.push_back(interval);
+        }
+    }
+
+    // Greedy colouring in pattern order: every instance joins the first batch that has none of
+    // its neighbours. Regular patterns only have a handful of neighbours per instance, and so
+    // end up with a handful of batches.
+    std::vector<int> batchOf(count, -1);
+    std::vector<std::vector<int>> batches;
+    std::vector<char> taken;
+    for (int i = 0; i < count; ++i) {
+        taken.assign(batches.size() + 1, 0);
+        for (int neighbour : neighbours[i]) {
+            if (batchOf[neighbour] >= 0) {
+                taken[batchOf[neighbour]] = 1;
+            }
+        }
+        std::size_t batch = 0;
+        while (taken[batch] != 0) {
+            ++batch;
+        }
+        if (batch == batches.size()) {
+            batches.emplace_back();
+        }
+        batches[batch].push_back(i);
+        batchOf[i] = static_cast<int>(batch);
+    }
+    return batches;
+}
+
+TopoShape& PatternBoolean::apply(TopoShape& support,
+                                 const std::vector<TopoShape>& instances,
+                                 Operation op,
+                                 bool batch)
+{
+    const char* maker = op == Operation::Fuse ? Part::OpCodes::Fuse : Part::OpCodes::Cut;
+
+    if (instances.empty()) {
+        return support;
+    }
+    if (!batch || static_cast<int>(instances.size()) < batchThreshold()) {
+        std::vector<TopoShape> shapes;
+        shapes.reserve(instances.size() + 1);
+        shapes.push_back(support);
+        shapes.insert(shapes.end(), instances.begin(), instances.end());
+        return support.makeElementBoolean(maker, shapes);
+    }
+
+    std::vector<TopoShape> compounds;
+    for (const auto& batch : makeBatches(instances)) {
+        std::vector<TopoShape> members;
+        members.reserve(batch.size());
+        for (int index : batch) {
+            members.push_back(instances[index]);
+        }
+        compounds.push_back(TopoShape(support.Tag, support.Hasher)
+                                .makeElementCompound(members,
+                                                     nullptr,
+                                                     TopoShape::SingleShapeCompoundCreationPolicy::
+                                                         returnShape));
+    }
+    TopoShape tool = reduceBatches(std::move(compounds), support);
+    checkUserBreak();
+
+    // The tool is handed over as separate solids: FCBRepAlgoAPI_Cut would otherwise fuse the
+    // members of a compound tool once more before cutting.
+    TopTools_ListOfShape arguments;
+    TopTools_ListOfShape tools;
+    arguments.Append(support.getShape());
+    if (tool.getShape().ShapeType() == TopAbs_COMPOUND) {
+        for (TopoDS_Iterator it(tool.getShape()); it.More(); it.Next()) {
+            tools.Append(it.Value());
+        }
+    }
+    else {
+        tools.Append(tool.getShape());
+    }
+
+    std::unique_ptr<BRepAlgoAPI_BooleanOperation> mk;
+    if (op == Operation::Fuse) {
+        mk = std::make_unique<FCBRepAlgoAPI_Fuse>();
+    }
+    else {
+        mk = std::make_unique<FCBRepAlgoAPI_Cut>();
+    }
+    OSD_Parallel::SetUseOcctThreads(Standard_True);
+    mk->SetArguments(arguments);
+    mk->SetTools(tools);
+    FCBRepAlgoAPIHelper::setAutoFuzzy(mk.get());
+#if OCC_VERSION_HEX >= 0x070600
+    mk->Build(OCCTProgressIndicator::getAppIndicator().Start());
+#else
+    mk->Build();
+#endif
+    checkUserBreak();
+    if (!mk->IsDone()) {
+        throw Base::CADKernelError(op == Operation::Fuse ? "Failed to fuse pattern"
+                                                         : "Failed to cut pattern");
+    }
+
+    TopoShape base(support);
+    support.makeElementShape(*mk, {base, tool}, maker);
+    support.makeElementShell();
+    return support;
+}
@@ -0,0 +1,84 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 The FreeCAD Project Association                     *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+
+#ifndef PARTDESIGN_PatternBoolean_H
+#define PARTDESIGN_PatternBoolean_H
+
+#include <vector>
+
+#include <Mod/Part/App/TopoShape.h>
+#include <Mod/PartDesign/PartDesignGlobal.h>
+
+
+namespace PartDesign
+{
+
+/** Fuses the instances of a pattern to, or cuts them from, the support shape.
+ *
+ * Handing all instances to one general fuse lets OCCT treat every instance as a separate
+ * argument, although most instances of a pattern do not touch each other. Instead, the instances
+ * are grouped into batches whose members have disjoint bounding boxes. A batch is a plain
+ * compound and needs no boolean of its own. Only batches can interfere with each other; they
+ * are fused pairwise in a balanced tree, running the fusions of one tree level in parallel, and
+ * the result is finally fused with or cut from the support.
+ *
+ * The OCCT booleans run on the OCCT thread pool, the element maps are built in the calling
+ * thread.
+ */
+class PartDesignExport PatternBoolean
+{
+public:
+    enum class Operation
+    {
+        Fuse,
+        Cut
+    };
+
+    /** Groups the instances into batches of instances that cannot touch each other
+     * @return the indices into \a instances of each batch, in pattern order
+     */
+    static std::vector<std::vector<int>>
+    makeBatches(const std::vector<Part::TopoShape>& instances);
+
+    /** Fuses the instances to or cuts them from \a support
+     *
+     * Patterns with fewer instances than batchThreshold() are handed to a single boolean,
+     * exactly like TopoShape::makeElementFuse() or makeElementCut() would do. So are all
+     * patterns if \a batch is false, which keeps the element names of the single boolean.
+     *
+     * @return \a support, which is replaced by the result
+     */
+    static Part::TopoShape& apply(Part::TopoShape& support,
+                                  const std::vector<Part::TopoShape>& instances,
+                                  Operation op,
+                                  bool batch = true);
+
+    /// Minimum number of instances to use batches, from the PatternBatchThreshold preference
+    static int batchThreshold();
+};
+
+}  // namespace PartDesign
+
+
+#endif  // PARTDESIGN_PatternBoolean_H
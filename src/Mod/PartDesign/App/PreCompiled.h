@@ -35,7 +35,10 @@
 #ifdef _PreComp_
 
 // stl
+#include <algorithm>
+#include <exception>
 #include <limits>
+#include <memory>
 
 // OpenCasCade
 #include <Mod/Part/App/OpenCascadeAll.h>
@@ -22,6 +22,7 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <array>
 #include <memory>
 #endif
 
@@ -30,9 +31,11 @@
 #include <App/DocumentObject.h>
 #include <App/DocumentObjectPy.h>
 #include <App/Property.h>
+#include <Base/BoundBoxPy.h>
 #include <Base/Console.h>
 #include <Base/FileInfo.h>
 #include <Base/Interpreter.h>
+#include <Base/PyWrapParseTupleAndKeywords.h>
 
 #include "Points.h"
 #include "PointsAlgos.h"
@@ -49,8 +52,18 @@ public:
     Module()
         : Py::ExtensionModule<Module>("Points")
     {
-        add_varargs_method("open", &Module::open);
-        add_varargs_method("insert", &Module::importer);
+        add_keyword_method("open",
+                           &Module::open,
+                           "open(filename, [subsampling=1, cropBox=None])\n"
+                           "Load the points of a file into a new document.\n"
+                           "subsampling keeps only every n-th point of the file and cropBox\n"
+                           "(a BoundBox) keeps only the points inside the box.");
+        add_keyword_method("insert",
+                           &Module::importer,
+                           "insert(filename, docname, [subsampling=1, cropBox=None])\n"
+                           "Load the points of a file into the given document.\n"
+                           "subsampling keeps only every n-th point of the file and cropBox\n"
+                           "(a BoundBox) keeps only the points inside the box.");
         add_varargs_method("export", &Module::exporter);
         add_varargs_method("show",
                            &Module::show,
@@ -73,10 +86,93 @@ private:
 
         return std::make_tuple(useColor, checkState, minDistance);
     }
-    Py::Object open(const Py::Tuple& args)
+    long readSubsampling() const
+    {
+        Base::Reference<ParameterGrp> hGrp = App::GetApplication()
+                                                 .GetUserParameter()
+                                                 .GetGroup("BaseApp")
+                                                 ->GetGroup("Preferences")
+                                                 ->GetGroup("Mod/Points");
+        return hGrp->GetInt("Subsampling", 1);
+    }
+    std::unique_ptr<Reader>
+    createReader(const Base::FileInfo& file, long subsampling, PyObject* cropBox) const
+    {
+        std::unique_ptr<Reader> reader;
+        if (file.hasExtension("asc")) {
+            reader = std::make_unique<AscReader>();
+        }
+        else if (file.hasExtension("e57")) {
+            auto setting = readE57Settings();
+            reader = std::make_unique<E57Reader>(std::get<0>(setting),
+                                                 std::get<1>(setting),
+                                                 std::get<2>(setting));
+        }
+        else if (file.hasExtension("ply")) {
+            reader = std::make_unique<PlyReader>();
+        }
+        else if (file.hasExtension("pcd")) {
+            reader = std::make_unique<PcdReader>();
+        }
+        else {
+            throw Py::RuntimeError("Unsupported file extension");
+        }
+
+        if (subsampling < 1) {
+            throw Py::ValueError("subsampling must be at least 1");
+        }
+        reader->setSubsampling(static_cast<std::size_t>(subsampling));
+        if (cropBox) {
+            reader->setCropBox(*static_cast<Base::BoundBoxPy*>(cropBox)->getBoundBoxPtr());
+        }
+        return reader;
+    }
+    static void addProperties(Points::Feature* pcFeature, Reader& reader)
+    {
+        // the arrays are as long as the point list, hand them over without copying
+        // add gray values
+        if (reader.hasIntensities()) {
+            Points::PropertyGreyValueList* prop = static_cast<Points::PropertyGreyValueList*>(
+                pcFeature->addDynamicProperty("Points::PropertyGreyValueList", "Intensity"));
+            if (prop) {
+                prop->setValues(reader.takeIntensities());
+            }
+        }
+        // add colors
+        if (reader.hasColors()) {
+            App::PropertyColorList* prop = static_cast<App::PropertyColorList*>(
+                pcFeature->addDynamicProperty("App::PropertyColorList", "Color"));
+            if (prop) {
+                prop->setValues(reader.takeColors());
+            }
+        }
+        // add normals
+        if (reader.hasNormals()) {
+            Points::PropertyNormalList* prop = static_cast<Points::PropertyNormalList*>(
+                pcFeature->addDynamicProperty("Points::PropertyNormalList", "Normal"));
+            if (prop) {
+                prop->setValues(reader.takeNormals());
+            }
+        }
+    }
+    Py::Object open(const Py::Tuple& args, const Py::Dict& keywds)
     {
         char* Name {};
-        if (!PyArg_ParseTuple(args.ptr(), "et", "utf-8", &Name)) {
+        long subsampling = readSubsampling();
+        PyObject* cropBox {};
+        static const std::array<const char*, 4> kwList {"filename",
+                                                        "subsampling",
+                                                        "cropBox",
+                                                        nullptr};
+        if (!Base::Wrapped_ParseTupleAndKeywords(args.ptr(),
+                                                 keywds.ptr(),
+                                                 "et|lO!",
+                                                 kwList,
+                                                 "utf-8",
+                                                 &Name,
+                                                 &subsampling,
+                                                 &Base::BoundBoxPy::Type,
+                                                 &cropBox)) {
             throw Py::Exception();
         }
         std::string EncodedName = std::string(Name);
@@ -91,25 +187,7 @@ private:
                 throw Py::RuntimeError("No file extension");
             }
 
-            std::unique_ptr<Reader> reader;
-            if (file.hasExtension("asc")) {
-                reader = std::make_unique<AscReader>();
-            }
-            else if (file.hasExtension("e57")) {
-                auto setting = readE57Settings();
-                reader = std::make_unique<E57Reader>(std::get<0>(setting),
-                                                     std::get<1>(setting),
-                                                     std::get<2>(setting));
-            }
-            else if (file.hasExtension("ply")) {
-                reader = std::make_unique<PlyReader>();
-            }
-            else if (file.hasExtension("pcd")) {
-                reader = std::make_unique<PcdReader>();
-            }
-            else {
-                throw Py::RuntimeError("Unsupported file extension");
-            }
+            std::unique_ptr<Reader> reader = createReader(file, subsampling, cropBox);
 
             reader->read(EncodedName);
 
@@ -136,33 +214,8 @@ private:
                     pcFeature = new Points::FeatureCustom();
                 }
 
-                pcFeature->Points.setValue(reader->getPoints());
-                // add gray values
-                if (reader->hasIntensities()) {
-                    Points::PropertyGreyValueList* prop =
-                        static_cast<Points::PropertyGreyValueList*>(
-                            pcFeature->addDynamicProperty("Points::PropertyGreyValueList",
-                                                          "Intensity"));
-                    if (prop) {
-                        prop->setValues(reader->getIntensities());
-                    }
-                }
-                // add colors
-                if (reader->hasColors()) {
-                    App::PropertyColorList* prop = static_cast<App::PropertyColorList*>(
-                        pcFeature->addDynamicProperty("App::PropertyColorList", "Color"));
-                    if (prop) {
-                        prop->setValues(reader->getColors());
-                    }
-                }
-                // add normals
-                if (reader->hasNormals()) {
-                    Points::PropertyNormalList* prop = static_cast<Points::PropertyNormalList*>(
-                        pcFeature->addDynamicProperty("Points::PropertyNormalList", "Normal"));
-                    if (prop) {
-                        prop->setValues(reader->getNormals());
-                    }
-                }
+                pcFeature->Points.setValue(reader->takePoints());
+                addProperties(pcFeature, *reader);
 
                 // delayed adding of the points feature
                 pcDoc->addObject(pcFeature, file.fileNamePure().c_str());
@@ -181,7 +234,7 @@ private:
                 }
 
                 // delayed adding of the points feature
-                pcFeature->Points.setValue(reader->getPoints());
+                pcFeature->Points.setValue(reader->takePoints());
                 pcDoc->addObject(pcFeature, file.fileNamePure().c_str());
                 pcDoc->recomputeFeature(pcFeature);
                 pcFeature->purgeTouched();
@@ -194,11 +247,27 @@ private:
         return Py::None();
     }
 
-    Py::Object importer(const Py::Tuple& args)
+    Py::Object importer(const Py::Tuple& args, const Py::Dict& keywds)
     {
         char* Name {};
         const char* DocName {};
-        if (!PyArg_ParseTuple(args.ptr(), "ets", "utf-8", &Name, &DocName)) {
+        long subsampling = readSubsampling();
+        PyObject* cropBox {};
+        static const std::array<const char*, 5> kwList {"filename",
+                                                        "docname",
+                                                        "subsampling",
+                                                        "cropBox",
+                                                        nullptr};
+        if (!Base::Wrapped_ParseTupleAndKeywords(args.ptr(),
+                                                 keywds.ptr(),
+                                                 "ets|lO!",
+                                                 kwList,
+                                                 "utf-8",
+                                                 &Name,
+                                                 &DocName,
+                                                 &subsampling,
+                                                 &Base::BoundBoxPy::Type,
+                                                 &cropBox)) {
             throw Py::Exception();
         }
         std::string EncodedName = std::string(Name);
@@ -213,25 +282,7 @@ private:
                 throw Py::RuntimeError("No file extension");
             }
 
-            std::unique_ptr<Reader> reader;
-            if (file.hasExtension("asc")) {
-                reader = std::make_unique<AscReader>();
-            }
-            else if (file.hasExtension("e57")) {
-                auto setting = readE57Settings();
-                reader = std::make_unique<E57Reader>(std::get<0>(setting),
-                                                     std::get<1>(setting),
-                                                     std::get<2>(setting));
-            }
-            else if (file.hasExtension("ply")) {
-                reader = std::make_unique<PlyReader>();
-            }
-            else if (file.hasExtension("pcd")) {
-                reader = std::make_unique<PcdReader>();
-            }
-            else {
-                throw Py::RuntimeError("Unsupported file extension");
-            }
+            std::unique_ptr<Reader> reader = createReader(file, subsampling, cropBox);
 
             reader->read(EncodedName);
 
@@ -261,33 +312,8 @@ private:
                     pcFeature = new Points::FeatureCustom();
                 }
 
-                pcFeature->Points.setValue(reader->getPoints());
-                // add gray values
-                if (reader->hasIntensities()) {
-                    Points::PropertyGreyValueList* prop =
-                        static_cast<Points::PropertyGreyValueList*>(
-                            pcFeature->addDynamicProperty("Points::PropertyGreyValueList",
-                                                          "Intensity"));
-                    if (prop) {
-                        prop->setValues(reader->getIntensities());
-                    }
-                }
-                // add colors
-                if (reader->hasColors()) {
-                    App::PropertyColorList* prop = static_cast<App::PropertyColorList*>(
-                        pcFeature->addDynamicProperty("App::PropertyColorList", "Color"));
-                    if (prop) {
-                        prop->setValues(reader->getColors());
-                    }
-                }
-                // add normals
-                if (reader->hasNormals()) {
-                    Points::PropertyNormalList* prop = static_cast<Points::PropertyNormalList*>(
-                        pcFeature->addDynamicProperty("Points::PropertyNormalList", "Normal"));
-                    if (prop) {
-                        prop->setValues(reader->getNormals());
-                    }
-                }
+                pcFeature->Points.setValue(reader->takePoints());
+                addProperties(pcFeature, *reader);
 
                 // delayed adding of the points feature
                 pcDoc->addObject(pcFeature, file.fileNamePure().c_str());
@@ -296,7 +322,7 @@ private:
             }
             else {
                 auto* pcFeature = pcDoc->addObject<Points::Feature>(file.fileNamePure().c_str());
-                pcFeature->Points.setValue(reader->getPoints());
+                pcFeature->Points.setValue(reader->takePoints());
                 pcDoc->recomputeFeature(pcFeature);
                 pcFeature->purgeTouched();
             }
@@ -148,7 +148,7 @@ PointKernel& PointKernel::operator=(PointKernel&& Kernel) noexcept
     return *this;
 }
 
-unsigned int PointKernel::getMemSize() const
+std::size_t PointKernel::getMemSize() const
 {
     return _Points.size() * sizeof(value_type);
 }
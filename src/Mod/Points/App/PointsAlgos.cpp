@@ -25,13 +25,21 @@
 #ifdef FC_OS_LINUX
 #include <unistd.h>
 #endif
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <exception>
+#include <limits>
 #include <memory>
 #include <sstream>
+#include <thread>
 
 #include <boost/algorithm/string.hpp>
 #include <boost/lexical_cast.hpp>
 #include <boost/math/special_functions/fpclassify.hpp>  // needed for compilation on some systems
 #include <boost/regex.hpp>
+
+#include <QtConcurrentMap>
 #endif
 
 #include <Base/Console.h>
@@ -124,15 +132,109 @@ void PointsAlgos::LoadAscii(PointKernel& points, const char* FileName)
 
 // ----------------------------------------------------------------------------
 
+void PointBlock::clear()
+{
+    points.clear();
+    intensity.clear();
+    colors.clear();
+    normals.clear();
+}
+
+// ----------------------------------------------------------------------------
+
 Reader::Reader() = default;
 
 Reader::~Reader() = default;
 
+void Reader::read(const std::string& filename)
+{
+    clear();
+    readBlocks(filename, [this](PointBlock& block) {
+        append(block);
+    });
+
+    // a subsample or a section of a structured cloud isn't structured anymore
+    std::size_t size = points.size();
+    if (isFiltered() || static_cast<std::size_t>(width) * static_cast<std::size_t>(height) != size) {
+        this->width = static_cast<int>(size);
+        this->height = 1;
+    }
+}
+
+void Reader::readBlocks(const std::string& filename, const BlockHandler& handler)
+{
+    expectedPoints = 0;
+    decode(filename, handler);
+}
+
+void Reader::append(PointBlock& block)
+{
+    std::vector<Base::Vector3f>& pts = points.getBasicPoints();
+    if (pts.empty() && expectedPoints > 0 && !cropBox.IsValid()) {
+        // reserve the final size with the first block to avoid reallocations of large clouds
+        auto size = static_cast<std::size_t>((expectedPoints + subsampling - 1) / subsampling);
+        pts.reserve(size);
+        if (!block.intensity.empty()) {
+            intensity.reserve(size);
+        }
+        if (!block.colors.empty()) {
+            colors.reserve(size);
+        }
+        if (!block.normals.empty()) {
+            normals.reserve(size);
+        }
+    }
+
+    pts.insert(pts.end(), block.points.begin(), block.points.end());
+    intensity.insert(intensity.end(), block.intensity.begin(), block.intensity.end());
+    colors.insert(colors.end(), block.colors.begin(), block.colors.end());
+    normals.insert(normals.end(), block.normals.begin(), block.normals.end());
+}
+
+void Reader::setBlockSize(std::size_t size)
+{
+    blockSize = std::max<std::size_t>(size, 1);
+}
+
+std::size_t Reader::getBlockSize() const
+{
+    return blockSize;
+}
+
+void Reader::setSubsampling(std::size_t step)
+{
+    subsampling = std::max<std::size_t>(step, 1);
+}
+
+std::size_t Reader::getSubsampling() const
+{
+    return subsampling;
+}
+
+void Reader::setCropBox(const Base::BoundBox3d& box)
+{
+    cropBox = box;
+}
+
+const Base::BoundBox3d& Reader::getCropBox() const
+{
+    return cropBox;
+}
+
+bool Reader::isFiltered() const
+{
+    return subsampling > 1 || cropBox.IsValid();
+}
+
 void Reader::clear()
 {
+    points.clear();
     intensity.clear();
     colors.clear();
     normals.clear();
+    width = 0;
+    height = 1;
+    expectedPoints = 0;
 }
 
 const PointKernel& Reader::getPoints() const
@@ -140,6 +242,13 @@ const PointKernel& Reader::getPoints() const
     return points;
 }
 
+PointKernel Reader::takePoints()
+{
+    PointKernel kernel(std::move(points));
+    points.clear();
+    return kernel;
+}
+
 bool Reader::hasProperties() const
 {
     return (hasIntensities() || hasColors() || hasNormals());
@@ -150,6 +259,13 @@ const std::vector<float>& Reader::getIntensities() const
     return intensity;
 }
 
+std::vector<float> Reader::takeIntensities()
+{
+    std::vector<float> values(std::move(intensity));
+    intensity.clear();
+    return values;
+}
+
 bool Reader::hasIntensities() const
 {
     return (!intensity.empty());
@@ -160,6 +276,13 @@ const std::vector<Base::Color>& Reader::getColors() const
     return colors;
 }
 
+std::vector<Base::Color> Reader::takeColors()
+{
+    std::vector<Base::Color> values(std::move(colors));
+    colors.clear();
+    return values;
+}
+
 bool Reader::hasColors() const
 {
     return (!colors.empty());
@@ -170,6 +293,13 @@ const std::vector<Base::Vector3f>& Reader::getNormals() const
     return normals;
 }
 
+std::vector<Base::Vector3f> Reader::takeNormals()
+{
+    std::vector<Base::Vector3f> values(std::move(normals));
+    normals.clear();
+    return values;
+}
+
 bool Reader::hasNormals() const
 {
     return (!normals.empty());
@@ -192,17 +322,6 @@ int Reader::getHeight() const
 
 // ----------------------------------------------------------------------------
 
-AscReader::AscReader() = default;
-
-void AscReader::read(const std::string& filename)
-{
-    points.load(filename.c_str());
-    this->height = 1;
-    this->width = points.size();
-}
-
-// ----------------------------------------------------------------------------
-
 namespace Points
 {
 class Converter
@@ -211,7 +330,6 @@ public:
     Converter() = default;
     virtual ~Converter() = default;
     virtual std::string toString(double) const = 0;
-    virtual double toDouble(Base::InputStream&) const = 0;
     virtual int getSizeOf() const = 0;
 
     Converter(const Converter&) = delete;
@@ -232,12 +350,6 @@ public:
         oss << c;
         return oss.str();
     }
-    double toDouble(Base::InputStream& str) const override
-    {
-        T c;
-        str >> c;
-        return static_cast<double>(c);
-    }
     int getSizeOf() const override
     {
         return sizeof(T);
@@ -246,90 +358,6 @@ public:
 
 using ConverterPtr = std::shared_ptr<Converter>;
 
-class DataStreambuf: public std::streambuf
-{
-public:
-    explicit DataStreambuf(const std::vector<char>& data)
-        : _buffer(data)
-        , _end(int(data.size()))
-    {}
-    ~DataStreambuf() override = default;
-
-protected:
-    int_type uflow() override
-    {
-        if (_cur == _end) {
-            return traits_type::eof();
-        }
-
-        return static_cast<DataStreambuf::int_type>(_buffer[_cur++]) & 0x000000ff;
-    }
-    int_type underflow() override
-    {
-        if (_cur == _end) {
-            return traits_type::eof();
-        }
-
-        return static_cast<DataStreambuf::int_type>(_buffer[_cur]) & 0x000000ff;
-    }
-    int_type pbackfail(int_type ch) override
-    {
-        if (_cur == _beg || (ch != traits_type::eof() && ch != _buffer[_cur - 1])) {
-            return traits_type::eof();
-        }
-
-        return static_cast<DataStreambuf::int_type>(_buffer[--_cur]) & 0x000000ff;
-    }
-    std::streamsize showmanyc() override
-    {
-        return _end - _cur;
-    }
-    pos_type seekoff(std::streambuf::off_type off,
-                     std::ios_base::seekdir way,
-                     std::ios_base::openmode mode = std::ios::in | std::ios::out) override
-    {
-        (void)mode;
-        int p_pos = -1;
-        if (way == std::ios_base::beg) {
-            p_pos = _beg;
-        }
-        else if (way == std::ios_base::end) {
-            p_pos = _end;
-        }
-        else if (way == std::ios_base::cur) {
-            p_pos = _cur;
-        }
-
-        if (p_pos > _end) {
-            return traits_type::eof();
-        }
-
-        if (((p_pos + off) > _end) || ((p_pos + off) < _beg)) {
-            return traits_type::eof();
-        }
-
-        _cur = p_pos + off;
-
-        return ((p_pos + off) - _beg);
-    }
-    pos_type seekpos(std::streambuf::pos_type pos,
-                     std::ios_base::openmode which = std::ios::in | std::ios::out) override
-    {
-        (void)which;
-        return seekoff(pos, std::ios_base::beg);
-    }
-
-public:
-    DataStreambuf(const DataStreambuf&) = delete;
-    DataStreambuf(DataStreambuf&&) = delete;
-    DataStreambuf& operator=(const DataStreambuf&) = delete;
-    DataStreambuf& operator=(DataStreambuf&&) = delete;
-
-private:
-    const std::vector<char>& _buffer;
-    int _beg {0}, _end {0}, _cur {0};
-};
-
 // NOLINTBEGIN
 // Taken from https://github.com/PointCloudLibrary/pcl/blob/master/io/src/lzf.cpp
 unsigned int
@@ -543,177 +571,539 @@ lzfDecompress(const void* const in_data, unsigned int in_len, void* out_data, un
 }  // namespace Points
 // NOLINTEND
 
-PlyReader::PlyReader() = default;
-
-void PlyReader::read(const std::string& filename)
+namespace
 {
-    clear();
 
-    Base::FileInfo fi(filename);
-    Base::ifstream inp(fi, std::ios::in | std::ios::binary);
+/**
+ * Decodes a file block by block. \a readRaw fetches the raw data of the next block from the file
+ * and returns its number of records, zero at the end of the data. As many blocks as there are
+ * cores are fetched, then \a decodeRaw decodes them in parallel and the blocks are handed over in
+ * file order. So the memory in use is bounded by a few blocks regardless of the file size.
+ */
+template<typename Raw, typename ReadRaw, typename DecodeRaw>
+void decodeParallel(ReadRaw&& readRaw,
+                    DecodeRaw&& decodeRaw,
+                    const Reader::BlockHandler& handler)
+{
+    struct Job
+    {
+        Raw raw {};
+        std::uint64_t first = 0;
+        std::size_t count = 0;
+        PointBlock block;
+        std::exception_ptr error;
+    };
 
-    std::string format;
-    std::vector<std::string> fields;
-    std::vector<std::string> types;
-    std::vector<int> sizes;
-    std::size_t offset = 0;
-    Eigen::Index numPoints = Eigen::Index(readHeader(inp, format, offset, fields, types, sizes));
+    std::vector<Job> jobs(std::max(1U, std::thread::hardware_concurrency()));
+    std::uint64_t index = 0;
+    bool atEnd = false;
+    while (!atEnd) {
+        std::size_t numJobs = 0;
+        while (numJobs < jobs.size()) {
+            Job& job = jobs[numJobs];
+            job.count = readRaw(job.raw);
+            if (job.count == 0) {
+                atEnd = true;
+                break;
+            }
+            job.first = index;
+            index += job.count;
+            ++numJobs;
+        }
 
-    this->width = numPoints;
-    this->height = 1;
+        // only QException is passed through by QtConcurrent
+        QtConcurrent::blockingMap(jobs.begin(), jobs.begin() + numJobs, [&decodeRaw](Job& job) {
+            job.block.clear();
+            job.error = nullptr;
+            try {
+                decodeRaw(job.raw, job.first, job.count, job.block);
+            }
+            catch (...) {
+                job.error = std::current_exception();
+            }
+        });
 
-    Eigen::MatrixXd data(numPoints, fields.size());
-    if (format == "ascii") {
-        readAscii(inp, offset, data);
-    }
-    else if (format == "binary_little_endian") {
-        readBinary(false, inp, offset, types, sizes, data);
-    }
-    else if (format == "binary_big_endian") {
-        readBinary(true, inp, offset, types, sizes, data);
+        for (std::size_t i = 0; i < numJobs; i++) {
+            if (jobs[i].error) {
+                std::rethrow_exception(jobs[i].error);
+            }
+            handler(jobs[i].block);
+        }
     }
+}
 
-    std::vector<std::string>::iterator it;
-    Eigen::Index max_size = std::numeric_limits<Eigen::Index>::max();
+/// Collects the next non-empty lines of at most \a count records after skipping \a skip lines
+std::size_t readLines(std::istream& inp,
+                      std::size_t& skip,
+                      std::uint64_t& remaining,
+                      std::size_t count,
+                      std::vector<std::string>& lines)
+{
+    lines.clear();
+    std::string line;
+    while (remaining > 0 && lines.size() < count && std::getline(inp, line)) {
+        if (line.empty()) {
+            continue;
+        }
 
-    // x field
-    Eigen::Index x = max_size;
-    it = std::ranges::find(fields, "x");
-    if (it != fields.end()) {
-        x = std::distance(fields.begin(), it);
+        if (skip > 0) {
+            skip--;
+            continue;
+        }
+
+        lines.push_back(std::move(line));
+        remaining--;
     }
 
-    // y field
-    Eigen::Index y = max_size;
-    it = std::ranges::find(fields, "y");
-    if (it != fields.end()) {
-        y = std::distance(fields.begin(), it);
+    return lines.size();
+}
+
+/// Reads the next records of at most \a count records of \a recordSize bytes
+std::size_t readRecords(std::istream& inp,
+                        std::size_t recordSize,
+                        std::uint64_t& remaining,
+                        std::size_t count,
+                        std::vector<char>& raw)
+{
+    auto num = static_cast<std::size_t>(std::min<std::uint64_t>(remaining, count));
+    raw.resize(num * recordSize);
+    if (num > 0) {
+        inp.read(raw.data(), static_cast<std::streamsize>(raw.size()));
+        if (!inp) {
+            throw Base::BadFormatError("Unexpected end of file");
+        }
+        remaining -= num;
     }
 
-    // z field
-    Eigen::Index z = max_size;
-    it = std::ranges::find(fields, "z");
-    if (it != fields.end()) {
-        z = std::distance(fields.begin(), it);
+    return num;
+}
+
+/// Skips \a offset bytes and makes sure that at least \a needed bytes follow
+void checkRemainingSize(std::istream& inp, std::size_t offset, std::uint64_t needed)
+{
+    std::streambuf* buf = inp.rdbuf();
+    if (buf) {
+        std::streamoff ulCurr =
+            buf->pubseekoff(static_cast<std::streamoff>(offset), std::ios::cur, std::ios::in);
+        std::streamoff ulSize = buf->pubseekoff(0, std::ios::end, std::ios::in);
+        buf->pubseekoff(ulCurr, std::ios::beg, std::ios::in);
+        if (ulCurr + static_cast<std::streamoff>(needed) > ulSize) {
+            throw Base::BadFormatError("File expects too many elements");
+        }
     }
+}
 
-    // normal x field
-    Eigen::Index normal_x = max_size;
-    it = std::ranges::find(fields, "normal_x");
-    if (it == fields.end()) {
-        it = std::ranges::find(fields, "nx");
+/// The type of a property and where it's found for the first record of a binary block
+struct FieldLayout
+{
+    /// 'I' for signed integers, 'U' for unsigned integers and 'F' for floating point values
+    char kind;
+    int size;
+    std::size_t offset;
+    /// the distance of the values of two consecutive records
+    std::size_t stride;
+};
+
+template<typename T>
+double castBytes(const char* bytes)
+{
+    T value {};
+    std::memcpy(&value, bytes, sizeof(T));
+    return static_cast<double>(value);
+}
+
+double readBinaryValue(const char* data, const FieldLayout& field, bool swapByteOrder)
+{
+    std::array<char, 8> bytes {};
+    std::memcpy(bytes.data(), data, field.size);
+    if (swapByteOrder) {
+        std::reverse(bytes.begin(), bytes.begin() + field.size);
     }
-    if (it != fields.end()) {
-        normal_x = std::distance(fields.begin(), it);
+
+    switch (field.kind) {
+        case 'I':
+            switch (field.size) {
+                case 1:
+                    return castBytes<int8_t>(bytes.data());
+                case 2:
+                    return castBytes<int16_t>(bytes.data());
+                case 4:
+                    return castBytes<int32_t>(bytes.data());
+                default:
+                    break;
+            }
+            break;
+        case 'U':
+            switch (field.size) {
+                case 1:
+                    return castBytes<uint8_t>(bytes.data());
+                case 2:
+                    return castBytes<uint16_t>(bytes.data());
+                case 4:
+                    return castBytes<uint32_t>(bytes.data());
+                default:
+                    break;
+            }
+            break;
+        case 'F':
+            switch (field.size) {
+                case 4:
+                    return castBytes<float>(bytes.data());
+                case 8:
+                    return castBytes<double>(bytes.data());
+                default:
+                    break;
+            }
+            break;
+        default:
+            break;
     }
 
-    // normal y field
-    Eigen::Index normal_y = max_size;
-    it = std::ranges::find(fields, "normal_y");
-    if (it == fields.end()) {
-        it = std::ranges::find(fields, "ny");
+    throw Base::BadFormatError("Unexpected type");
+}
+
+/// Checks the types of a binary record and returns the layout of its fields
+std::vector<FieldLayout> makeRecordLayout(const std::vector<char>& kinds,
+                                          const std::vector<int>& sizes,
+                                          std::size_t& recordSize)
+{
+    std::vector<FieldLayout> layout;
+    recordSize = 0;
+    for (std::size_t j = 0; j < kinds.size(); j++) {
+        char kind = kinds[j];
+        int size = sizes[j];
+        bool valid = (kind == 'I' || kind == 'U') ? (size == 1 || size == 2 || size == 4)
+            : kind == 'F'                         ? (size == 4 || size == 8)
+                                                  : false;
+        if (!valid) {
+            throw Base::BadFormatError("Unexpected type");
+        }
+
+        layout.push_back({kind, size, recordSize, 0});
+        recordSize += static_cast<std::size_t>(size);
     }
-    if (it != fields.end()) {
-        normal_y = std::distance(fields.begin(), it);
+
+    for (auto& field : layout) {
+        field.stride = recordSize;
     }
 
-    // normal z field
-    Eigen::Index normal_z = max_size;
-    it = std::ranges::find(fields, "normal_z");
-    if (it == fields.end()) {
-        it = std::ranges::find(fields, "nz");
+    return layout;
+}
+
+/// Where the attributes of a point are found in a record
+struct Columns
+{
+    enum class ColorType
+    {
+        None,
+        /// red, green, blue and alpha in the range [0, 255]
+        Byte,
+        /// red, green, blue and alpha in the range [0, 1]
+        Float,
+        /// rgba packed into an unsigned integer
+        PackedInt,
+        /// rgba packed into the bits of a float
+        PackedFloat
+    };
+
+    static constexpr std::size_t none = std::numeric_limits<std::size_t>::max();
+
+    explicit Columns(const std::vector<std::string>& fields)
+    {
+        auto find = [&fields](const char* name, const char* alias = nullptr) {
+            auto it = std::ranges::find(fields, name);
+            if (it == fields.end() && alias) {
+                it = std::ranges::find(fields, alias);
+            }
+            return it != fields.end() ? static_cast<std::size_t>(std::distance(fields.begin(), it))
+                                      : none;
+        };
+
+        x = find("x");
+        y = find("y");
+        z = find("z");
+        normalX = find("normal_x", "nx");
+        normalY = find("normal_y", "ny");
+        normalZ = find("normal_z", "nz");
+        intensity = find("intensity");
+        red = find("red");
+        green = find("green");
+        blue = find("blue");
+        alpha = find("alpha");
+        rgba = find("rgb", "rgba");
+    }
+
+    bool hasPoints() const
+    {
+        return x != none && y != none && z != none;
     }
-    if (it != fields.end()) {
-        normal_z = std::distance(fields.begin(), it);
+    bool hasNormals() const
+    {
+        return normalX != none && normalY != none && normalZ != none;
     }
-
-    // intensity field
-    Eigen::Index greyvalue = max_size;
-    it = std::ranges::find(fields, "intensity");
-    if (it != fields.end()) {
-        greyvalue = std::distance(fields.begin(), it);
+    bool hasChannels() const
+    {
+        return red != none && green != none && blue != none;
     }
 
-    // rgb(a) field
-    Eigen::Index red = max_size;
-    Eigen::Index green = max_size;
-    Eigen::Index blue = max_size;
-    Eigen::Index alpha = max_size;
-    it = std::ranges::find(fields, "red");
-    if (it != fields.end()) {
-        red = std::distance(fields.begin(), it);
+    Base::Vector3f getPoint(const std::vector<double>& row) const
+    {
+        return Base::Vector3f(static_cast<float>(row[x]),
+                              static_cast<float>(row[y]),
+                              static_cast<float>(row[z]));
     }
 
-    it = std::ranges::find(fields, "green");
-    if (it != fields.end()) {
-        green = std::distance(fields.begin(), it);
+    void append(const std::vector<double>& row, const Base::Vector3f& point, PointBlock& block) const
+    {
+        block.points.push_back(point);
+        if (hasNormals()) {
+            block.normals.emplace_back(static_cast<float>(row[normalX]),
+                                       static_cast<float>(row[normalY]),
+                                       static_cast<float>(row[normalZ]));
+        }
+        if (intensity != none) {
+            block.intensity.push_back(static_cast<float>(row[intensity]));
+        }
+
+        switch (color) {
+            case ColorType::Byte: {
+                float a = alpha != none ? static_cast<float>(row[alpha]) : 1.0F;
+                block.colors.emplace_back(static_cast<float>(row[red]) / 255.0F,
+                                          static_cast<float>(row[green]) / 255.0F,
+                                          static_cast<float>(row[blue]) / 255.0F,
+                                          a / 255.0F);
+            } break;
+            case ColorType::Float: {
+                float a = alpha != none ? static_cast<float>(row[alpha]) : 1.0F;
+                block.colors.emplace_back(static_cast<float>(row[red]),
+                                          static_cast<float>(row[green]),
+                                          static_cast<float>(row[blue]),
+                                          a);
+            } break;
+            case ColorType::PackedInt: {
+                Base::Color col;
+                col.setPackedARGB(static_cast<uint32_t>(row[rgba]));
+                block.colors.push_back(col);
+            } break;
+            case ColorType::PackedFloat: {
+                static_assert(sizeof(float) == sizeof(uint32_t),
+                              "float and uint32_t have different sizes");
+                float f = static_cast<float>(row[rgba]);
+                uint32_t packed {};
+                std::memcpy(&packed, &f, sizeof(packed));
+                Base::Color col;
+                col.setPackedARGB(packed);
+                block.colors.push_back(col);
+            } break;
+            case ColorType::None:
+                break;
+        }
     }
 
-    it = std::ranges::find(fields, "blue");
-    if (it != fields.end()) {
-        blue = std::distance(fields.begin(), it);
-    }
+    std::size_t x, y, z;
+    std::size_t normalX, normalY, normalZ;
+    std::size_t intensity;
+    std::size_t red, green, blue, alpha;
+    std::size_t rgba;
+    ColorType color {ColorType::None};
+};
 
-    it = std::ranges::find(fields, "alpha");
-    if (it != fields.end()) {
-        alpha = std::distance(fields.begin(), it);
-    }
+/// Parses the text records in \a lines whose first record is the record \a first of the file
+template<typename Accept>
+void decodeAsciiRecords(const std::vector<std::string>& lines,
+                        std::uint64_t first,
+                        std::size_t numFields,
+                        const Columns& columns,
+                        const Accept& accept,
+                        PointBlock& block)
+{
+    std::vector<double> row(numFields);
+    std::vector<std::string> list;
+    for (std::size_t i = 0; i < lines.size(); i++) {
+        std::string line = lines[i];
+        // since the file is loaded in binary mode we may get the CR at the end
+        boost::trim(line);
+        boost::split(list, line, boost::is_any_of("\t\r "), boost::token_compress_on);
 
-    // transfer the data
-    bool hasData = (x != max_size && y != max_size && z != max_size);
-    bool hasNormal = (normal_x != max_size && normal_y != max_size && normal_z != max_size);
-    bool hasIntensity = (greyvalue != max_size);
-    bool hasColor = (red != max_size && green != max_size && blue != max_size);
+        std::fill(row.begin(), row.end(), 0.0);
+        for (std::size_t col = 0; col < list.size() && col < numFields; col++) {
+            row[col] = boost::lexical_cast<double>(list[col]);
+        }
 
-    if (hasData) {
-        points.reserve(numPoints);
-        for (Eigen::Index i = 0; i < numPoints; i++) {
-            points.push_back(Base::Vector3d(data(i, x), data(i, y), data(i, z)));
+        Base::Vector3f point = columns.getPoint(row);
+        if (accept(first + i, point)) {
+            columns.append(row, point, block);
         }
     }
+}
 
-    if (hasData && hasNormal) {
-        normals.reserve(numPoints);
-        for (Eigen::Index i = 0; i < numPoints; i++) {
-            normals.emplace_back(data(i, normal_x), data(i, normal_y), data(i, normal_z));
+/// Decodes \a count binary records whose first record is the record \a first of the file
+template<typename Accept>
+void decodeBinaryRecords(const char* data,
+                         const std::vector<FieldLayout>& layout,
+                         bool swapByteOrder,
+                         std::uint64_t first,
+                         std::size_t count,
+                         const Columns& columns,
+                         const Accept& accept,
+                         PointBlock& block)
+{
+    std::vector<double> row(layout.size());
+    for (std::size_t i = 0; i < count; i++) {
+        for (std::size_t j = 0; j < layout.size(); j++) {
+            const FieldLayout& field = layout[j];
+            row[j] = readBinaryValue(data + field.offset + i * field.stride, field, swapByteOrder);
         }
-    }
 
-    if (hasData && hasIntensity) {
-        intensity.reserve(numPoints);
-        for (Eigen::Index i = 0; i < numPoints; i++) {
-            intensity.push_back(static_cast<float>(data(i, greyvalue)));
+        Base::Vector3f point = columns.getPoint(row);
+        if (accept(first + i, point)) {
+            columns.append(row, point, block);
         }
     }
+}
 
-    if (hasData && hasColor) {
-        colors.reserve(numPoints);
-        float a = 1.0;
-        if (types[red] == "uchar") {
-            for (Eigen::Index i = 0; i < numPoints; i++) {
-                float r = static_cast<float>(data(i, red));
-                float g = static_cast<float>(data(i, green));
-                float b = static_cast<float>(data(i, blue));
-                if (alpha != max_size) {
-                    a = static_cast<float>(data(i, alpha));
+const boost::regex& asciiPointPattern()
+{
+    static const boost::regex rx("^\\s*([-+]?[0-9]*)\\.?([0-9]+([eE][-+]?[0-9]+)?)"
+                                 "\\s+([-+]?[0-9]*)\\.?([0-9]+([eE][-+]?[0-9]+)?)"
+                                 "\\s+([-+]?[0-9]*)\\.?([0-9]+([eE][-+]?[0-9]+)?)\\s*$");
+    return rx;
+}
+
+}  // namespace
+
+// ----------------------------------------------------------------------------
+
+AscReader::AscReader() = default;
+
+void AscReader::decode(const std::string& filename, const BlockHandler& handler)
+{
+    Base::FileInfo fi(filename);
+    if (!fi.isReadable()) {
+        throw Base::FileException("File to load not existing or not readable", filename);
+    }
+
+    Base::ifstream inp(fi, std::ios::in);
+    std::size_t skip = 0;
+    std::uint64_t remaining = std::numeric_limits<std::uint64_t>::max();
+    const std::size_t blockSize = getBlockSize();
+    decodeParallel<std::vector<std::string>>(
+        [&](std::vector<std::string>& lines) {
+            return readLines(inp, skip, remaining, blockSize, lines);
+        },
+        [this](const std::vector<std::string>& lines,
+               std::uint64_t first,
+               std::size_t,
+               PointBlock& block) {
+            const boost::regex& rx = asciiPointPattern();
+            boost::cmatch what;
+            for (std::size_t i = 0; i < lines.size(); i++) {
+                if (boost::regex_match(lines[i].c_str(), what, rx)) {
+                    Base::Vector3f pt(static_cast<float>(std::atof(what[1].first)),
+                                      static_cast<float>(std::atof(what[4].first)),
+                                      static_cast<float>(std::atof(what[7].first)));
+                    if (accept(first + i, pt)) {
+                        block.points.push_back(pt);
+                    }
                 }
-                colors.emplace_back(static_cast<float>(r) / 255.0F,
-                                    static_cast<float>(g) / 255.0F,
-                                    static_cast<float>(b) / 255.0F,
-                                    static_cast<float>(a) / 255.0F);
             }
+        },
+        handler);
+}
+
+// ----------------------------------------------------------------------------
+
+PlyReader::PlyReader() = default;
+
+void PlyReader::decode(const std::string& filename, const BlockHandler& handler)
+{
+    Base::FileInfo fi(filename);
+    Base::ifstream inp(fi, std::ios::in | std::ios::binary);
+
+    std::string format;
+    std::vector<std::string> fields;
+    std::vector<std::string> types;
+    std::vector<int> sizes;
+    std::size_t offset = 0;
+    std::size_t numPoints = readHeader(inp, format, offset, fields, types, sizes);
+
+    this->width = static_cast<int>(numPoints);
+    this->height = 1;
+    this->expectedPoints = numPoints;
+
+    Columns columns(fields);
+    if (columns.hasChannels()) {
+        if (types[columns.red] == "uchar") {
+            columns.color = Columns::ColorType::Byte;
         }
-        else if (types[red] == "float") {
-            for (Eigen::Index i = 0; i < numPoints; i++) {
-                float r = static_cast<float>(data(i, red));
-                float g = static_cast<float>(data(i, green));
-                float b = static_cast<float>(data(i, blue));
-                if (alpha != max_size) {
-                    a = static_cast<float>(data(i, alpha));
-                }
-                colors.emplace_back(r, g, b, a);
+        else if (types[columns.red] == "float") {
+            columns.color = Columns::ColorType::Float;
+        }
+    }
+    if (!columns.hasPoints()) {
+        return;
+    }
+
+    auto filter = [this](std::uint64_t index, const Base::Vector3f& point) {
+        return accept(index, point);
+    };
+    std::uint64_t remaining = numPoints;
+    const std::size_t blockSize = getBlockSize();
+    if (format == "ascii") {
+        decodeParallel<std::vector<std::string>>(
+            [&](std::vector<std::string>& lines) {
+                return readLines(inp, offset, remaining, blockSize, lines);
+            },
+            [&](const std::vector<std::string>& lines,
+                std::uint64_t first,
+                std::size_t,
+                PointBlock& block) {
+                decodeAsciiRecords(lines, first, fields.size(), columns, filter, block);
+            },
+            handler);
+    }
+    else if (format == "binary_little_endian" || format == "binary_big_endian") {
+        bool swapByteOrder = (format == "binary_big_endian");
+        std::vector<char> kinds;
+        for (const auto& t : types) {
+            if (t == "char" || t == "int8" || t == "short" || t == "int16" || t == "int"
+                || t == "int32") {
+                kinds.push_back('I');
+            }
+            else if (t == "uchar" || t == "uint8" || t == "ushort" || t == "uint16" || t == "uint"
+                     || t == "uint32") {
+                kinds.push_back('U');
+            }
+            else if (t == "float" || t == "float32" || t == "double" || t == "float64") {
+                kinds.push_back('F');
+            }
+            else {
+                throw Base::BadFormatError("Unexpected type");
             }
         }
+
+        std::size_t recordSize = 0;
+        std::vector<FieldLayout> layout = makeRecordLayout(kinds, sizes, recordSize);
+        checkRemainingSize(inp, offset, std::uint64_t(recordSize) * numPoints);
+
+        decodeParallel<std::vector<char>>(
+            [&](std::vector<char>& raw) {
+                return readRecords(inp, recordSize, remaining, blockSize, raw);
+            },
+            [&](const std::vector<char>& raw,
+                std::uint64_t first,
+                std::size_t count,
+                PointBlock& block) {
+                decodeBinaryRecords(raw.data(),
+                                    layout,
+                                    swapByteOrder,
+                                    first,
+                                    count,
+                                    columns,
+                                    filter,
+                                    block);
+            },
+            handler);
     }
 }
 
@@ -887,143 +1277,12 @@ std::size_t PlyReader::readHeader(std::istream& in,
     return numPoints;
 }
 
-void PlyReader::readAscii(std::istream& inp, std::size_t offset, Eigen::MatrixXd& data)
-{
-    std::string line;
-    Eigen::Index row = 0;
-    Eigen::Index numPoints = Eigen::Index(data.rows());
-    Eigen::Index numFields = Eigen::Index(data.cols());
-    std::vector<std::string> list;
-    while (std::getline(inp, line) && row < numPoints) {
-        if (line.empty()) {
-            continue;
-        }
-
-        if (offset > 0) {
-            offset--;
-            continue;
-        }
-
-        // since the file is loaded in binary mode we may get the CR at the end
-        boost::trim(line);
-        boost::split(list, line, boost::is_any_of("\t\r "), boost::token_compress_on);
-
-        std::istringstream str(line);
-
-        Eigen::Index size = Eigen::Index(list.size());
-        for (Eigen::Index col = 0; col < size && col < numFields; col++) {
-            double value = boost::lexical_cast<double>(list[col]);
-            data(row, col) = value;
-        }
-
-        ++row;
-    }
-}
-
-void PlyReader::readBinary(bool swapByteOrder,
-                           std::istream& inp,
-                           std::size_t offset,
-                           const std::vector<std::string>& types,
-                           const std::vector<int>& sizes,
-                           Eigen::MatrixXd& data)
-{
-    Eigen::Index numPoints = data.rows();
-    Eigen::Index numFields = data.cols();
-
-    int neededSize = 0;
-    ConverterPtr convert_float32(new ConverterT<float>);
-    ConverterPtr convert_float64(new ConverterT<double>);
-    ConverterPtr convert_int8(new ConverterT<int8_t>);
-    ConverterPtr convert_uint8(new ConverterT<uint8_t>);
-    ConverterPtr convert_int16(new ConverterT<int16_t>);
-    ConverterPtr convert_uint16(new ConverterT<uint16_t>);
-    ConverterPtr convert_int32(new ConverterT<int32_t>);
-    ConverterPtr convert_uint32(new ConverterT<uint32_t>);
-
-    std::vector<ConverterPtr> converters;
-    for (Eigen::Index j = 0; j < numFields; j++) {
-        const std::string& t = types[j];
-        switch (sizes[j]) {
-            case 1:
-                if (t == "char" || t == "int8") {
-                    converters.push_back(convert_int8);
-                }
-                else if (t == "uchar" || t == "uint8") {
-                    converters.push_back(convert_uint8);
-                }
-                else {
-                    throw Base::BadFormatError("Unexpected type");
-                }
-                break;
-            case 2:
-                if (t == "short" || t == "int16") {
-                    converters.push_back(convert_int16);
-                }
-                else if (t == "ushort" || t == "uint16") {
-                    converters.push_back(convert_uint16);
-                }
-                else {
-                    throw Base::BadFormatError("Unexpected type");
-                }
-                break;
-            case 4:
-                if (t == "int" || t == "int32") {
-                    converters.push_back(convert_int32);
-                }
-                else if (t == "uint" || t == "uint32") {
-                    converters.push_back(convert_uint32);
-                }
-                else if (t == "float" || t == "float32") {
-                    converters.push_back(convert_float32);
-                }
-                else {
-                    throw Base::BadFormatError("Unexpected type");
-                }
-                break;
-            case 8:
-                if (t == "double" || t == "float64") {
-                    converters.push_back(convert_float64);
-                }
-                else {
-                    throw Base::BadFormatError("Unexpected type");
-                }
-                break;
-            default:
-                throw Base::BadFormatError("Unexpected type");
-        }
-
-        neededSize += converters.back()->getSizeOf();
-    }
-
-    std::streamoff ulSize = 0;
-    std::streamoff ulCurr = 0;
-    std::streambuf* buf = inp.rdbuf();
-    if (buf) {
-        ulCurr = buf->pubseekoff(static_cast<std::streamoff>(offset), std::ios::cur, std::ios::in);
-        ulSize = buf->pubseekoff(0, std::ios::end, std::ios::in);
-        buf->pubseekoff(ulCurr, std::ios::beg, std::ios::in);
-        if (ulCurr + neededSize * static_cast<std::streamoff>(numPoints) > ulSize) {
-            throw Base::BadFormatError("File expects too many elements");
-        }
-    }
-
-    Base::InputStream str(inp);
-    str.setByteOrder(swapByteOrder ? Base::Stream::BigEndian : Base::Stream::LittleEndian);
-    for (Eigen::Index i = 0; i < numPoints; i++) {
-        for (Eigen::Index j = 0; j < numFields; j++) {
-            double value = converters[j]->toDouble(str);
-            data(i, j) = value;
-        }
-    }
-}
-
 // ----------------------------------------------------------------------------
 
 PcdReader::PcdReader() = default;
 
-void PcdReader::read(const std::string& filename)
+void PcdReader::decode(const std::string& filename, const BlockHandler& handler)
 {
-    clear();
     this->width = 0;
     this->height = 1;
 
@@ -1034,14 +1293,63 @@ void PcdReader::read(const std::string& filename)
     std::vector<std::string> fields;
     std::vector<std::string> types;
     std::vector<int> sizes;
-    Eigen::Index numPoints = Eigen::Index(readHeader(inp, format, fields, types, sizes));
+    std::size_t numPoints = readHeader(inp, format, fields, types, sizes);
+    this->expectedPoints = numPoints;
 
-    Eigen::MatrixXd data(numPoints, fields.size());
-    if (format == "ascii") {
-        readAscii(inp, data);
+    Columns columns(fields);
+    if (columns.rgba != Columns::none) {
+        if (types[columns.rgba] == "U") {
+            columns.color = Columns::ColorType::PackedInt;
+        }
+        else if (types[columns.rgba] == "F") {
+            columns.color = Columns::ColorType::PackedFloat;
+        }
     }
-    else if (format == "binary") {
-        readBinary(false, inp, types, sizes, data);
+    if (!columns.hasPoints()) {
+        return;
+    }
+
+    auto filter = [this](std::uint64_t index, const Base::Vector3f& point) {
+        return accept(index, point);
+    };
+    std::uint64_t remaining = numPoints;
+    const std::size_t blockSize = getBlockSize();
+    if (format == "ascii") {
+        std::size_t skip = 0;
+        decodeParallel<std::vector<std::string>>(
+            [&](std::vector<std::string>& lines) {
+                return readLines(inp, skip, remaining, blockSize, lines);
+            },
+            [&](const std::vector<std::string>& lines,
+                std::uint64_t first,
+                std::size_t,
+                PointBlock& block) {
+                decodeAsciiRecords(lines, first, fields.size(), columns, filter, block);
+            },
+            handler);
+        return;
+    }
+
+    std::vector<char> kinds;
+    for (const auto& t : types) {
+        kinds.push_back(t.empty() ? '\0' : t[0]);
+    }
+    std::size_t recordSize = 0;
+    std::vector<FieldLayout> layout = makeRecordLayout(kinds, sizes, recordSize);
+
+    if (format == "binary") {
+        checkRemainingSize(inp, 0, std::uint64_t(recordSize) * numPoints);
+        decodeParallel<std::vector<char>>(
+            [&](std::vector<char>& raw) {
+                return readRecords(inp, recordSize, remaining, blockSize, raw);
+            },
+            [&](const std::vector<char>& raw,
+                std::uint64_t first,
+                std::size_t count,
+                PointBlock& block) {
+                decodeBinaryRecords(raw.data(), layout, false, first, count, columns, filter, block);
+            },
+            handler);
     }
     else if (format == "binary_compressed") {
         unsigned int c {};
@@ -1049,140 +1357,48 @@ void PcdReader::read(const std::string& filename)
         Base::InputStream str(inp);
         str >> c >> u;
 
-        std::vector<char> compressed(c);
-        inp.read(compressed.data(), c);
+        // LZF needs the whole block, but the compressed data is released before decoding
         std::vector<char> uncompressed(u);
-        if (lzfDecompress(compressed.data(), c, uncompressed.data(), u) == u) {
-            DataStreambuf ibuf(uncompressed);
-            std::istream istr(nullptr);
-            istr.rdbuf(&ibuf);
-            readBinary(true, istr, types, sizes, data);
-        }
-        else {
-            throw Base::BadFormatError("Failed to decompress binary data");
-        }
-    }
-
-    std::vector<std::string>::iterator it;
-    Eigen::Index max_size = std::numeric_limits<Eigen::Index>::max();
-
-    // x field
-    Eigen::Index x = max_size;
-    it = std::ranges::find(fields, "x");
-    if (it != fields.end()) {
-        x = std::distance(fields.begin(), it);
-    }
-
-    // y field
-    Eigen::Index y = max_size;
-    it = std::ranges::find(fields, "y");
-    if (it != fields.end()) {
-        y = std::distance(fields.begin(), it);
-    }
-
-    // z field
-    Eigen::Index z = max_size;
-    it = std::ranges::find(fields, "z");
-    if (it != fields.end()) {
-        z = std::distance(fields.begin(), it);
-    }
-
-    // normal x field
-    Eigen::Index normal_x = max_size;
-    it = std::ranges::find(fields, "normal_x");
-    if (it == fields.end()) {
-        it = std::ranges::find(fields, "nx");
-    }
-    if (it != fields.end()) {
-        normal_x = std::distance(fields.begin(), it);
-    }
-
-    // normal y field
-    Eigen::Index normal_y = max_size;
-    it = std::ranges::find(fields, "normal_y");
-    if (it == fields.end()) {
-        it = std::ranges::find(fields, "ny");
-    }
-    if (it != fields.end()) {
-        normal_y = std::distance(fields.begin(), it);
-    }
-
-    // normal z field
-    Eigen::Index normal_z = max_size;
-    it = std::ranges::find(fields, "normal_z");
-    if (it == fields.end()) {
-        it = std::ranges::find(fields, "nz");
-    }
-    if (it != fields.end()) {
-        normal_z = std::distance(fields.begin(), it);
-    }
-
-    // intensity field
-    Eigen::Index greyvalue = max_size;
-    it = std::ranges::find(fields, "intensity");
-    if (it != fields.end()) {
-        greyvalue = std::distance(fields.begin(), it);
-    }
-
-    // rgb(a) field
-    Eigen::Index rgba = max_size;
-    it = std::ranges::find(fields, "rgb");
-    if (it == fields.end()) {
-        it = std::ranges::find(fields, "rgba");
-    }
-    if (it != fields.end()) {
-        rgba = std::distance(fields.begin(), it);
-    }
-
-    // transfer the data
-    bool hasData = (x != max_size && y != max_size && z != max_size);
-    bool hasNormal = (normal_x != max_size && normal_y != max_size && normal_z != max_size);
-    bool hasIntensity = (greyvalue != max_size);
-    bool hasColor = (rgba != max_size);
-
-    if (hasData) {
-        points.reserve(numPoints);
-        for (Eigen::Index i = 0; i < numPoints; i++) {
-            points.push_back(Base::Vector3d(data(i, x), data(i, y), data(i, z)));
-        }
-    }
-
-    if (hasData && hasNormal) {
-        normals.reserve(numPoints);
-        for (Eigen::Index i = 0; i < numPoints; i++) {
-            normals.emplace_back(data(i, normal_x), data(i, normal_y), data(i, normal_z));
-        }
-    }
-
-    if (hasData && hasIntensity) {
-        intensity.reserve(numPoints);
-        for (Eigen::Index i = 0; i < numPoints; i++) {
-            intensity.push_back(data(i, greyvalue));
-        }
-    }
-
-    if (hasData && hasColor) {
-        colors.reserve(numPoints);
-        if (types[rgba] == "U") {
-            for (Eigen::Index i = 0; i < numPoints; i++) {
-                uint32_t packed = static_cast<uint32_t>(data(i, rgba));
-                Base::Color col;
-                col.setPackedARGB(packed);
-                colors.emplace_back(col);
+        {
+            std::vector<char> compressed(c);
+            inp.read(compressed.data(), c);
+            if (lzfDecompress(compressed.data(), c, uncompressed.data(), u) != u) {
+                throw Base::BadFormatError("Failed to decompress binary data");
             }
         }
-        else if (types[rgba] == "F") {
-            static_assert(sizeof(float) == sizeof(uint32_t),
-                          "float and uint32_t have different sizes");
-            for (Eigen::Index i = 0; i < numPoints; i++) {
-                float f = static_cast<float>(data(i, rgba));
-                uint32_t packed {};
-                std::memcpy(&packed, &f, sizeof(packed));
-                Base::Color col;
-                col.setPackedARGB(packed);
-                colors.emplace_back(col);
-            }
+        if (std::uint64_t(recordSize) * numPoints > u) {
+            throw Base::BadFormatError("File expects too many elements");
         }
+
+        // the values of a field are stored one after the other
+        std::size_t columnStart = 0;
+        for (auto& field : layout) {
+            field.offset = columnStart;
+            field.stride = static_cast<std::size_t>(field.size);
+            columnStart += field.stride * numPoints;
+        }
+
+        decodeParallel<char>(
+            [&](char&) {
+                auto count = static_cast<std::size_t>(std::min<std::uint64_t>(remaining, blockSize));
+                remaining -= count;
+                return count;
+            },
+            [&](const char&, std::uint64_t first, std::size_t count, PointBlock& block) {
+                std::vector<FieldLayout> blockLayout = layout;
+                for (auto& field : blockLayout) {
+                    field.offset += first * field.stride;
+                }
+                decodeBinaryRecords(uncompressed.data(),
+                                    blockLayout,
+                                    false,
+                                    first,
+                                    count,
+                                    columns,
+                                    filter,
+                                    block);
+            },
+            handler);
     }
 }
 
@@ -1257,139 +1473,6 @@ std::size_t PcdReader::readHeader(std::istream& in,
     return points;
 }
 
-void PcdReader::readAscii(std::istream& inp, Eigen::MatrixXd& data)
-{
-    std::string line;
-    Eigen::Index row = 0;
-    Eigen::Index numPoints = data.rows();
-    Eigen::Index numFields = data.cols();
-    std::vector<std::string> list;
-    while (std::getline(inp, line) && row < numPoints) {
-        if (line.empty()) {
-            continue;
-        }
-
-        // since the file is loaded in binary mode we may get the CR at the end
-        boost::trim(line);
-        boost::split(list, line, boost::is_any_of("\t\r "), boost::token_compress_on);
-
-        std::istringstream str(line);
-
-        Eigen::Index size = Eigen::Index(list.size());
-        for (Eigen::Index col = 0; col < size && col < numFields; col++) {
-            double value = boost::lexical_cast<double>(list[col]);
-            data(row, col) = value;
-        }
-
-        ++row;
-    }
-}
-
-void PcdReader::readBinary(bool transpose,
-                           std::istream& inp,
-                           const std::vector<std::string>& types,
-                           const std::vector<int>& sizes,
-                           Eigen::MatrixXd& data)
-{
-    Eigen::Index numPoints = data.rows();
-    Eigen::Index numFields = data.cols();
-
-    int neededSize = 0;
-    ConverterPtr convert_float32(new ConverterT<float>);
-    ConverterPtr convert_float64(new ConverterT<double>);
-    ConverterPtr convert_int8(new ConverterT<int8_t>);
-    ConverterPtr convert_uint8(new ConverterT<uint8_t>);
-    ConverterPtr convert_int16(new ConverterT<int16_t>);
-    ConverterPtr convert_uint16(new ConverterT<uint16_t>);
-    ConverterPtr convert_int32(new ConverterT<int32_t>);
-    ConverterPtr convert_uint32(new ConverterT<uint32_t>);
-
-    std::vector<ConverterPtr> converters;
-    for (Eigen::Index j = 0; j < numFields; j++) {
-        char t = types[j][0];
-        switch (sizes[j]) {
-            case 1:
-                if (t == 'I') {
-                    converters.push_back(convert_int8);
-                }
-                else if (t == 'U') {
-                    converters.push_back(convert_uint8);
-                }
-                else {
-                    throw Base::BadFormatError("Unexpected type");
-                }
-                break;
-            case 2:
-                if (t == 'I') {
-                    converters.push_back(convert_int16);
-                }
-                else if (t == 'U') {
-                    converters.push_back(convert_uint16);
-                }
-                else {
-                    throw Base::BadFormatError("Unexpected type");
-                }
-                break;
-            case 4:
-                if (t == 'I') {
-                    converters.push_back(convert_int32);
-                }
-                else if (t == 'U') {
-                    converters.push_back(convert_uint32);
-                }
-                else if (t == 'F') {
-                    converters.push_back(convert_float32);
-                }
-                else {
-                    throw Base::BadFormatError("Unexpected type");
-                }
-                break;
-            case 8:
-                if (t == 'F') {
-                    converters.push_back(convert_float64);
-                }
-                else {
-                    throw Base::BadFormatError("Unexpected type");
-                }
-                break;
-            default:
-                throw Base::BadFormatError("Unexpected type");
-        }
-
-        neededSize += converters.back()->getSizeOf();
-    }
-
-    std::streamoff ulSize = 0;
-    std::streamoff ulCurr = 0;
-    std::streambuf* buf = inp.rdbuf();
-    if (buf) {
-        ulCurr = buf->pubseekoff(0, std::ios::cur, std::ios::in);
-        ulSize = buf->pubseekoff(0, std::ios::end, std::ios::in);
-        buf->pubseekoff(ulCurr, std::ios::beg, std::ios::in);
-        if (ulCurr + neededSize * static_cast<std::streamoff>(numPoints) > ulSize) {
-            throw Base::BadFormatError("File expects too many elements");
-        }
-    }
-
-    Base::InputStream str(inp);
-    if (transpose) {
-        for (Eigen::Index j = 0; j < numFields; j++) {
-            for (Eigen::Index i = 0; i < numPoints; i++) {
-                double value = converters[j]->toDouble(str);
-                data(i, j) = value;
-            }
-        }
-    }
-    else {
-        for (Eigen::Index i = 0; i < numPoints; i++) {
-            for (Eigen::Index j = 0; j < numFields; j++) {
-                double value = converters[j]->toDouble(str);
-                data(i, j) = value;
-            }
-        }
-    }
-}
-
 // ----------------------------------------------------------------------------
 
 namespace
@@ -1397,40 +1480,47 @@ namespace
 class E57ReaderImp
 {
 public:
-    E57ReaderImp(const std::string& filename, bool color, bool state, double distance)
+    using AcceptFunc = std::function<bool(std::uint64_t, const Base::Vector3f&)>;
+
+    E57ReaderImp(const std::string& filename,
+                 bool color,
+                 bool state,
+                 double distance,
+                 std::size_t blockSize,
+                 AcceptFunc filter,
+                 const Reader::BlockHandler& handler)
         : imfi(filename, "r")
         , useColor {color}
         , checkState {state}
         , minDistance {distance}
+        , buf_size {blockSize}
+        , accept {std::move(filter)}
+        , handler {handler}
     {}
 
-    void read()
+    /// The number of records of all scans
+    std::uint64_t countPoints() const
     {
+        std::uint64_t count = 0;
         e57::StructureNode root = imfi.root();
         if (root.isDefined("data3D")) {
             e57::VectorNode data3D(root.get("data3D"));
-            readData3D(data3D);
+            for (int child = 0; child < data3D.childCount(); ++child) {
+                e57::StructureNode scan_data(data3D.get(child));
+                e57::CompressedVectorNode cvn(scan_data.get("points"));
+                count += static_cast<std::uint64_t>(cvn.childCount());
+            }
         }
+        return count;
     }
 
-    std::vector<Base::Color> getColors() const
-    {
-        return colors;
-    }
-
-    std::vector<float> getItensity() const
-    {
-        return intensity;
-    }
-
-    const PointKernel& getPoints() const
-    {
-        return points;
-    }
-
-    const std::vector<Base::Vector3f>& getNormals() const
+    void read()
     {
-        return normals;
+        e57::StructureNode root = imfi.root();
+        if (root.isDefined("data3D")) {
+            e57::VectorNode data3D(root.get("data3D"));
+            readData3D(data3D);
+        }
     }
 
 private:
@@ -1645,8 +1735,11 @@ private:
         bool hasState = proto.inv_state && checkState;
         bool filter = false;
 
+        // every read fills the buffers with up to buf_size records, they make up one block
+        PointBlock block;
         while ((count = cvr.read())) {
-            for (size_t i = 0; i < count; ++i) {
+            block.clear();
+            for (size_t i = 0; i < count; ++i, ++index) {
                 filter = false;
                 if (hasState) {
                     if (proto.state[i] != 0) {
@@ -1663,19 +1756,27 @@ private:
                 }
                 if (!filter) {
                     cnt_pts++;
-                    points.push_back(pt);
                     last = pt;
+                    Base::Vector3f point = Base::convertTo<Base::Vector3f>(pt);
+                    if (!accept(index, point)) {
+                        continue;
+                    }
+                    block.points.push_back(point);
                     if (hasColor) {
-                        colors.push_back(getColor(proto, i));
+                        block.colors.push_back(getColor(proto, i));
                     }
                     if (hasItensity) {
-                        intensity.push_back(proto.intensity[i]);
+                        block.intensity.push_back(proto.intensity[i]);
                     }
                     if (hasNormal) {
-                        normals.push_back(getNormal(proto, i, hasPlacement, plm.getRotation()));
+                        block.normals.push_back(
+                            getNormal(proto, i, hasPlacement, plm.getRotation()));
                     }
                 }
             }
+            if (block.size() > 0) {
+                handler(block);
+            }
         }
     }
 
@@ -1768,11 +1869,11 @@ private:
     bool useColor;
     bool checkState;
     double minDistance;
-    const size_t buf_size = 1024;
-    std::vector<Base::Color> colors;
-    std::vector<float> intensity;
-    PointKernel points;
-    std::vector<Base::Vector3f> normals;
+    const size_t buf_size;
+    AcceptFunc accept;
+    const Reader::BlockHandler& handler;
+    /// the index of the current record in the file
+    std::uint64_t index = 0;
 };
 }  // namespace
 
@@ -1782,19 +1883,27 @@ E57Reader::E57Reader(bool Color, bool State, double Distance)
     , minDistance {Distance}
 {}
 
-void E57Reader::read(const std::string& filename)
+void E57Reader::decode(const std::string& filename, const BlockHandler& handler)
 {
     try {
-        E57ReaderImp reader(filename, useColor, checkState, minDistance);
+        auto filter = [this](std::uint64_t index, const Base::Vector3f& point) {
+            return accept(index, point);
+        };
+        // libE57 reads a scan sequentially, and filtering by distance depends on the previous
+        // point, so the blocks are decoded one after the other
+        E57ReaderImp reader(filename,
+                            useColor,
+                            checkState,
+                            minDistance,
+                            getBlockSize(),
+                            filter,
+                            handler);
+        this->expectedPoints = reader.countPoints();
+        this->width = 0;
+        this->height = 1;
         reader.read();
-        points = reader.getPoints();
-        normals = reader.getNormals();
-        colors = reader.getColors();
-        intensity = reader.getItensity();
-        width = points.size();
-        height = 1;
-    }
-    catch (const Base::BadFormatError&) {
+    }
+    catch (const Base::Exception&) {
         throw;
     }
     catch (...) {
@@ -23,8 +23,12 @@
 #ifndef _PointsAlgos_h_
 #define _PointsAlgos_h_
 
+#include <cstdint>
+#include <functional>
 #include <Eigen/Core>
 
+#include <Base/BoundBox.h>
+
 #include "Points.h"
 #include "Properties.h"
 
@@ -45,21 +49,64 @@ public:
     static void LoadAscii(PointKernel&, const char* FileName);
 };
 
+/** A block of consecutive points read from a file. The attribute arrays are either empty or
+ * have one entry per point.
+ */
+struct PointsExport PointBlock
+{
+    std::vector<Base::Vector3f> points;
+    std::vector<float> intensity;
+    std::vector<Base::Color> colors;
+    std::vector<Base::Vector3f> normals;
+
+    std::size_t size() const
+    {
+        return points.size();
+    }
+    void clear();
+};
+
 class PointsExport Reader
 {
 public:
+    using BlockHandler = std::function<void(PointBlock&)>;
+
     Reader();
     virtual ~Reader();
-    virtual void read(const std::string& filename) = 0;
+    /// Reads all points of the file into the reader
+    virtual void read(const std::string& filename);
+    /** Reads the file block by block and hands each block over to \a handler, in file order.
+     * Only a few blocks are held in memory at any time. Where the format permits, the blocks
+     * are decoded in parallel.
+     */
+    void readBlocks(const std::string& filename, const BlockHandler& handler);
+
+    /// Sets the number of records decoded per block, 65536 by default
+    void setBlockSize(std::size_t);
+    std::size_t getBlockSize() const;
+    /// Keeps only every \a step-th point of the file
+    void setSubsampling(std::size_t step);
+    std::size_t getSubsampling() const;
+    /// Keeps only the points inside \a box, an invalid box keeps all points
+    void setCropBox(const Base::BoundBox3d& box);
+    const Base::BoundBox3d& getCropBox() const;
 
     void clear();
     const PointKernel& getPoints() const;
+    /// Moves the points out of the reader, which avoids copying large clouds
+    PointKernel takePoints();
     bool hasProperties() const;
     const std::vector<float>& getIntensities() const;
+    /// Moves the intensities out of the reader
+    std::vector<float> takeIntensities();
     bool hasIntensities() const;
     const std::vector<Base::Color>& getColors() const;
+    /// Moves the colors out of the reader
+    std::vector<Base::Color> takeColors();
     bool hasColors() const;
     const std::vector<Base::Vector3f>& getNormals() const;
+    /// Moves the normals out of the reader
+    std::vector<Base::Vector3f> takeNormals();
     bool hasNormals() const;
     bool isStructured() const;
     int getWidth() const;
@@ -70,6 +117,23 @@ public:
     Reader& operator=(const Reader&) = delete;
     Reader& operator=(Reader&&) = delete;
 
+protected:
+    /// Decodes the file and passes every block to \a handler
+    virtual void decode(const std::string& filename, const BlockHandler& handler) = 0;
+    /// Returns true if the record \a index of the file passes subsampling and cropping
+    bool accept(std::uint64_t index, const Base::Vector3f& point) const
+    {
+        if (subsampling > 1 && index % subsampling != 0) {
+            return false;
+        }
+        return !cropBox.IsValid()
+            || cropBox.IsInBox(Base::Vector3d(point.x, point.y, point.z));
+    }
+    bool isFiltered() const;
+
+private:
+    void append(PointBlock& block);
+
 protected:
     // NOLINTBEGIN
     PointKernel points;
@@ -78,21 +142,32 @@ protected:
     std::vector<Base::Vector3f> normals;
     int width {0};
     int height {1};
+    /// the number of records the file announces, if known
+    std::uint64_t expectedPoints {0};
     // NOLINTEND
+
+private:
+    std::size_t blockSize {65536};
+    std::size_t subsampling {1};
+    Base::BoundBox3d cropBox;
 };
 
 class PointsExport AscReader: public Reader
 {
 public:
     AscReader();
-    void read(const std::string& filename) override;
+
+protected:
+    void decode(const std::string& filename, const BlockHandler& handler) override;
 };
 
 class PointsExport PlyReader: public Reader
 {
 public:
     PlyReader();
-    void read(const std::string& filename) override;
+
+protected:
+    void decode(const std::string& filename, const BlockHandler& handler) override;
 
 private:
     std::size_t readHeader(std::istream&,
@@ -101,20 +176,15 @@ private:
                            std::vector<std::string>& fields,
                            std::vector<std::string>& types,
                            std::vector<int>& sizes);
-    void readAscii(std::istream&, std::size_t offset, Eigen::MatrixXd& data);
-    void readBinary(bool swapByteOrder,
-                    std::istream&,
-                    std::size_t offset,
-                    const std::vector<std::string>& types,
-                    const std::vector<int>& sizes,
-                    Eigen::MatrixXd& data);
 };
 
 class PointsExport PcdReader: public Reader
 {
 public:
     PcdReader();
-    void read(const std::string& filename) override;
+
+protected:
+    void decode(const std::string& filename, const BlockHandler& handler) override;
 
 private:
     std::size_t readHeader(std::istream&,
@@ -122,19 +192,15 @@ private:
                            std::vector<std::string>& fields,
                            std::vector<std::string>& types,
                            std::vector<int>& sizes);
-    void readAscii(std::istream&, Eigen::MatrixXd& data);
-    void readBinary(bool transpose,
-                    std::istream&,
-                    const std::vector<std::string>& types,
-                    const std::vector<int>& sizes,
-                    Eigen::MatrixXd& data);
 };
 
 class PointsExport E57Reader: public Reader
 {
 public:
     E57Reader(bool Color, bool State, double Distance);
-    void read(const std::string& filename) override;
+
+protected:
+    void decode(const std::string& filename, const BlockHandler& handler) override;
 
 protected:
     bool useColor, checkState;
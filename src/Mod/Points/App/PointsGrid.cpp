@@ -22,6 +22,11 @@
 
 #include "PreCompiled.h"
 
+#ifndef _PreComp_
+#include <algorithm>
+#include <thread>
+#endif
+
 #include "PointsGrid.h"
 
 
@@ -202,14 +207,7 @@ void PointsGrid::InitGrid()
     }
 
     // Create data structure
-    _aulGrid.clear();
-    _aulGrid.resize(_ulCtGridsX);
-    for (unsigned long i = 0; i < _ulCtGridsX; i++) {
-        _aulGrid[i].resize(_ulCtGridsY);
-        for (unsigned long j = 0; j < _ulCtGridsY; j++) {
-            _aulGrid[i][j].resize(_ulCtGridsZ);
-        }
-    }
+    _aulGrid.resize(_ulCtGridsX, _ulCtGridsY, _ulCtGridsZ);
 }
 
 unsigned long PointsGrid::InSide(const Base::BoundBox3d& rclBB,
@@ -232,9 +230,8 @@ unsigned long PointsGrid::InSide(const Base::BoundBox3d& rclBB,
     for (auto i = ulMinX; i <= ulMaxX; i++) {
         for (auto j = ulMinY; j <= ulMaxY; j++) {
             for (auto k = ulMinZ; k <= ulMaxZ; k++) {
-                raulElements.insert(raulElements.end(),
-                                    _aulGrid[i][j][k].begin(),
-                                    _aulGrid[i][j][k].end());
+                auto cell = _aulGrid(i, j, k);
+                raulElements.insert(raulElements.end(), cell.begin(), cell.end());
             }
         }
     }
@@ -270,9 +267,8 @@ unsigned long PointsGrid::InSide(const Base::BoundBox3d& rclBB,
         for (auto j = ulMinY; j <= ulMaxY; j++) {
             for (auto k = ulMinZ; k <= ulMaxZ; k++) {
                 if (Base::DistanceP2(GetBoundBox(i, j, k).GetCenter(), rclOrg) < fMinDistP2) {
-                    raulElements.insert(raulElements.end(),
-                                        _aulGrid[i][j][k].begin(),
-                                        _aulGrid[i][j][k].end());
+                    auto cell = _aulGrid(i, j, k);
+                    raulElements.insert(raulElements.end(), cell.begin(), cell.end());
                 }
             }
         }
@@ -303,7 +299,8 @@ unsigned long PointsGrid::InSide(const Base::BoundBox3d& rclBB,
     for (auto i = ulMinX; i <= ulMaxX; i++) {
         for (auto j = ulMinY; j <= ulMaxY; j++) {
             for (auto k = ulMinZ; k <= ulMaxZ; k++) {
-                raulElements.insert(_aulGrid[i][j][k].begin(), _aulGrid[i][j][k].end());
+                auto cell = _aulGrid(i, j, k);
+                raulElements.insert(cell.begin(), cell.end());
             }
         }
     }
@@ -552,7 +549,8 @@ void PointsGrid::SearchNearestFromPoint(const Base::Vector3d& rclPt,
                 while (raclInd.empty()) {
                     for (unsigned long i = 0; i < _ulCtGridsY; i++) {
                         for (unsigned long j = 0; j < _ulCtGridsZ; j++) {
-                            raclInd.insert(_aulGrid[nX][i][j].begin(), _aulGrid[nX][i][j].end());
+                            auto cell = _aulGrid(nX, i, j);
+                            raclInd.insert(cell.begin(), cell.end());
                         }
                     }
                     nX++;
@@ -564,7 +562,8 @@ void PointsGrid::SearchNearestFromPoint(const Base::Vector3d& rclPt,
                 while (raclInd.empty()) {
                     for (unsigned long i = 0; i < _ulCtGridsY; i++) {
                         for (unsigned long j = 0; j < _ulCtGridsZ; j++) {
-                            raclInd.insert(_aulGrid[nX][i][j].begin(), _aulGrid[nX][i][j].end());
+                            auto cell = _aulGrid(nX, i, j);
+                            raclInd.insert(cell.begin(), cell.end());
                         }
                     }
                     nX++;
@@ -576,7 +575,8 @@ void PointsGrid::SearchNearestFromPoint(const Base::Vector3d& rclPt,
                 while (raclInd.empty()) {
                     for (unsigned long i = 0; i < _ulCtGridsX; i++) {
                         for (unsigned long j = 0; j < _ulCtGridsZ; j++) {
-                            raclInd.insert(_aulGrid[i][nY][j].begin(), _aulGrid[i][nY][j].end());
+                            auto cell = _aulGrid(i, nY, j);
+                            raclInd.insert(cell.begin(), cell.end());
                         }
                     }
                     nY++;
@@ -588,7 +588,8 @@ void PointsGrid::SearchNearestFromPoint(const Base::Vector3d& rclPt,
                 while (raclInd.empty()) {
                     for (unsigned long i = 0; i < _ulCtGridsX; i++) {
                         for (unsigned long j = 0; j < _ulCtGridsZ; j++) {
-                            raclInd.insert(_aulGrid[i][nY][j].begin(), _aulGrid[i][nY][j].end());
+                            auto cell = _aulGrid(i, nY, j);
+                            raclInd.insert(cell.begin(), cell.end());
                         }
                     }
                     nY--;
@@ -600,7 +601,8 @@ void PointsGrid::SearchNearestFromPoint(const Base::Vector3d& rclPt,
                 while (raclInd.empty()) {
                     for (unsigned long i = 0; i < _ulCtGridsX; i++) {
                         for (unsigned long j = 0; j < _ulCtGridsY; j++) {
-                            raclInd.insert(_aulGrid[i][j][nZ].begin(), _aulGrid[i][j][nZ].end());
+                            auto cell = _aulGrid(i, j, nZ);
+                            raclInd.insert(cell.begin(), cell.end());
                         }
                     }
                     nZ++;
@@ -612,7 +614,8 @@ void PointsGrid::SearchNearestFromPoint(const Base::Vector3d& rclPt,
                 while (raclInd.empty()) {
                     for (unsigned long i = 0; i < _ulCtGridsX; i++) {
                         for (unsigned long j = 0; j < _ulCtGridsY; j++) {
-                            raclInd.insert(_aulGrid[i][j][nZ].begin(), _aulGrid[i][j][nZ].end());
+                            auto cell = _aulGrid(i, j, nZ);
+                            raclInd.insert(cell.begin(), cell.end());
                         }
                     }
                     nZ--;
@@ -682,7 +685,7 @@ unsigned long PointsGrid::GetElements(unsigned long ulX,
                                       unsigned long ulZ,
                                       std::set<unsigned long>& raclInd) const
 {
-    const std::set<unsigned long>& rclSet = _aulGrid[ulX][ulY][ulZ];
+    auto rclSet = _aulGrid(ulX, ulY, ulZ);
     if (!rclSet.empty()) {
         raclInd.insert(rclSet.begin(), rclSet.end());
         return rclSet.size();
@@ -691,15 +694,6 @@ unsigned long PointsGrid::GetElements(unsigned long ulX,
     return 0;
 }
 
-void PointsGrid::AddPoint(const Base::Vector3d& rclPt, unsigned long ulPtIndex, float /*fEpsilon*/)
-{
-    unsigned long ulX {}, ulY {}, ulZ {};
-    Pos(Base::Vector3d(rclPt.x, rclPt.y, rclPt.z), ulX, ulY, ulZ);
-    if ((ulX < _ulCtGridsX) && (ulY < _ulCtGridsY) && (ulZ < _ulCtGridsZ)) {
-        _aulGrid[ulX][ulY][ulZ].insert(ulPtIndex);
-    }
-}
-
 void PointsGrid::Validate(const PointKernel& rclPoints)
 {
     if (_pclPoints != &rclPoints) {
@@ -752,11 +746,13 @@ void PointsGrid::RebuildGrid()
     InitGrid();
 
     // Fill data structure
-
-    unsigned long i = 0;
-    for (const auto& pnt : *_pclPoints) {
-        AddPoint(pnt, i++);
-    }
+    int threads = std::max(1, int(std::thread::hardware_concurrency()));
+    _aulGrid.build(
+        _ulCtElements,
+        [this](unsigned long ulPtIndex, auto&& add) {
+            AddPoint(_pclPoints->getPoint(int(ulPtIndex)), add);
+        },
+        threads);
 }
 
 void PointsGrid::Pos(const Base::Vector3d& rclPoint,
@@ -819,9 +815,8 @@ bool PointsGridIterator::InitOnRay(const Base::Vector3d& rclPt,
     // point lies within global BB
     if (_rclGrid.GetBoundBox().IsInBox(rclPt)) {  // determine the voxel by the starting point
         _rclGrid.Position(rclPt, _ulX, _ulY, _ulZ);
-        raulElements.insert(raulElements.end(),
-                            _rclGrid._aulGrid[_ulX][_ulY][_ulZ].begin(),
-                            _rclGrid._aulGrid[_ulX][_ulY][_ulZ].end());
+        auto cell = _rclGrid._aulGrid(_ulX, _ulY, _ulZ);
+        raulElements.insert(raulElements.end(), cell.begin(), cell.end());
         _bValidRay = true;
     }
     else {  // StartPoint outside
@@ -837,9 +832,8 @@ bool PointsGridIterator::InitOnRay(const Base::Vector3d& rclPt,
                 _rclGrid.Position(cP1, _ulX, _ulY, _ulZ);
             }
 
-            raulElements.insert(raulElements.end(),
-                                _rclGrid._aulGrid[_ulX][_ulY][_ulZ].begin(),
-                                _rclGrid._aulGrid[_ulX][_ulY][_ulZ].end());
+            auto cell = _rclGrid._aulGrid(_ulX, _ulY, _ulZ);
+            raulElements.insert(raulElements.end(), cell.begin(), cell.end());
             _bValidRay = true;
         }
     }
@@ -903,9 +897,8 @@ bool PointsGridIterator::NextOnRay(std::vector<unsigned long>& raulElements)
     if (_bValidRay && _rclGrid.CheckPos(_ulX, _ulY, _ulZ)) {
         GridElement pos(_ulX, _ulY, _ulZ);
         _cSearchPositions.insert(pos);
-        raulElements.insert(raulElements.end(),
-                            _rclGrid._aulGrid[_ulX][_ulY][_ulZ].begin(),
-                            _rclGrid._aulGrid[_ulX][_ulY][_ulZ].end());
+        auto cell = _rclGrid._aulGrid(_ulX, _ulY, _ulZ);
+        raulElements.insert(raulElements.end(), cell.begin(), cell.end());
     }
     else {
         _bValidRay = false;  // ray exited
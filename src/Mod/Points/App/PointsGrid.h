@@ -27,6 +27,7 @@
 #include <set>
 
 #include <Base/BoundBox.h>
+#include <Base/FlatGrid.h>
 #include <Base/Vector3D.h>
 
 #include "Points.h"
@@ -131,7 +132,7 @@ public:
     /** Returns the number of elements in a given grid. */
     unsigned long GetCtElements(unsigned long ulX, unsigned long ulY, unsigned long ulZ) const
     {
-        return _aulGrid[ulX][ulY][ulZ].size();
+        return _aulGrid(ulX, ulY, ulZ).size();
     }
     /** Finds all points that lie in the same grid as the point \a rclPoint. */
     unsigned long FindElements(const Base::Vector3d& rclPoint,
@@ -181,8 +182,7 @@ protected:
                  std::set<unsigned long>& raclInd) const;
 
 private:
-    std::vector<std::vector<std::vector<std::set<unsigned long>>>>
-        _aulGrid;                  /**< Grid data structure. */
+    Base::FlatGrid<unsigned long> _aulGrid; /**< Grid data structure. */
     const PointKernel* _pclPoints; /**< The point kernel. */
     unsigned long _ulCtElements;   /**< Number of grid elements for validation issues. */
     unsigned long _ulCtGridsX;     /**< Number of grid elements in z. */
@@ -201,9 +201,17 @@ private:
 
 public:
 protected:
-    /** Adds a new point element to the grid structure. \a rclPt is the geometric point and \a
-     * ulPtIndex the corresponding index in the point kernel. */
-    void AddPoint(const Base::Vector3d& rclPt, unsigned long ulPtIndex, float fEpsilon = 0.0f);
+    /** Determines the grid element of the point \a rclPt and passes it to \a add(ulX, ulY, ulZ)
+     * if it lies inside the grid. */
+    template<typename Func>
+    void AddPoint(const Base::Vector3d& rclPt, Func&& add) const
+    {
+        unsigned long ulX {}, ulY {}, ulZ {};
+        Pos(rclPt, ulX, ulY, ulZ);
+        if ((ulX < _ulCtGridsX) && (ulY < _ulCtGridsY) && (ulZ < _ulCtGridsZ)) {
+            add(ulX, ulY, ulZ);
+        }
+    }
     /** Returns the grid numbers to the given point \a rclPoint. */
     void Pos(const Base::Vector3d& rclPoint,
              unsigned long& rulX,
@@ -228,9 +236,8 @@ public:
     /** Returns indices of the elements in the current grid. */
     void GetElements(std::vector<unsigned long>& raulElements) const
     {
-        raulElements.insert(raulElements.end(),
-                            _rclGrid._aulGrid[_ulX][_ulY][_ulZ].begin(),
-                            _rclGrid._aulGrid[_ulX][_ulY][_ulZ].end());
+        auto cell = _rclGrid._aulGrid(_ulX, _ulY, _ulZ);
+        raulElements.insert(raulElements.end(), cell.begin(), cell.end());
     }
     /** @name Iteration */
     //@{
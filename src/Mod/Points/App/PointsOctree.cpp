@@ -0,0 +1,452 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 The FreeCAD Project Association                     *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+#ifndef _PreComp_
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <limits>
+#include <queue>
+#include <boost/math/special_functions/fpclassify.hpp>
+#endif
+
+#include <Base/Exception.h>
+#include <Base/FileInfo.h>
+#include <Base/Stream.h>
+
+#include "PointsOctree.h"
+
+
+using namespace Points;
+
+namespace
+{
+
+using Indices = std::vector<std::uint32_t>;
+
+/// Moves the indices of [begin, end) whose point is below \a value on \a axis to the front
+std::size_t partitionBelow(Indices& indices,
+                           const std::vector<Base::Vector3f>& pts,
+                           std::size_t begin,
+                           std::size_t end,
+                           unsigned short axis,
+                           float value)
+{
+    auto first = indices.begin();
+    auto mid = std::partition(first + static_cast<std::ptrdiff_t>(begin),
+                              first + static_cast<std::ptrdiff_t>(end),
+                              [&](std::uint32_t index) {
+                                  return pts[index][axis] < value;
+                              });
+    return static_cast<std::size_t>(mid - first);
+}
+
+/** Sorts [begin, end) by octant around \a center, where the x, y and z halves are the bits 1,
+ * 2 and 4 of the octant index. Octant i ends up in [bounds[i], bounds[i + 1]).
+ */
+std::array<std::size_t, 9> splitOctants(Indices& indices,
+                                        const std::vector<Base::Vector3f>& pts,
+                                        std::size_t begin,
+                                        std::size_t end,
+                                        const Base::Vector3f& center)
+{
+    std::array<std::size_t, 9> bounds {};
+    bounds[0] = begin;
+    bounds[8] = end;
+    bounds[4] = partitionBelow(indices, pts, begin, end, 2, center.z);
+    bounds[2] = partitionBelow(indices, pts, bounds[0], bounds[4], 1, center.y);
+    bounds[6] = partitionBelow(indices, pts, bounds[4], bounds[8], 1, center.y);
+    for (std::size_t i = 0; i < 8; i += 2) {
+        bounds[i + 1] = partitionBelow(indices, pts, bounds[i], bounds[i + 2], 0, center.x);
+    }
+    return bounds;
+}
+
+int gridCell(const Base::Vector3f& pt, const Base::BoundBox3f& box, int grid)
+{
+    auto cell = [&](float value, float min, float length) {
+        int index = static_cast<int>((value - min) / length * static_cast<float>(grid));
+        return std::clamp(index, 0, grid - 1);
+    };
+    return cell(pt.x, box.MinX, box.LengthX())
+        + grid * (cell(pt.y, box.MinY, box.LengthY()) + grid * cell(pt.z, box.MinZ, box.LengthZ()));
+}
+
+template<typename T>
+void copyRange(const std::vector<T>& source,
+               std::vector<T>& target,
+               std::size_t first,
+               std::size_t count)
+{
+    auto begin = source.begin() + static_cast<std::ptrdiff_t>(first);
+    target.assign(begin, begin + static_cast<std::ptrdiff_t>(count));
+}
+
+template<typename T>
+void readRange(std::istream& in, std::vector<T>& target, std::uint64_t offset, std::size_t count)
+{
+    target.resize(count);
+    in.seekg(static_cast<std::streamoff>(offset * sizeof(T)));
+    in.read(reinterpret_cast<char*>(target.data()),  // NOLINT
+            static_cast<std::streamsize>(count * sizeof(T)));
+}
+
+template<typename T>
+void writeRange(std::ostream& out, const std::vector<T>& source)
+{
+    out.write(reinterpret_cast<const char*>(source.data()),  // NOLINT
+              static_cast<std::streamsize>(source.size() * sizeof(T)));
+}
+
+}  // namespace
+
+void PointOctree::NodeData::clear()
+{
+    coords.clear();
+    colors.clear();
+    normals.clear();
+    intensity.clear();
+}
+
+PointOctree::PointOctree(std::uint32_t nodeCapacity, int maxLevel)
+    : nodeCapacity(std::max<std::uint32_t>(nodeCapacity, 1))
+    , maxLevel(maxLevel)
+{}
+
+PointOctree::~PointOctree()
+{
+    clear();
+}
+
+void PointOctree::clear()
+{
+    nodes.clear();
+    cloud.clear();
+    cloud.coords.shrink_to_fit();
+    cloud.colors.shrink_to_fit();
+    cloud.normals.shrink_to_fit();
+    cloud.intensity.shrink_to_fit();
+    numPoints = 0;
+    withColors = false;
+    withNormals = false;
+    withIntensity = false;
+    if (!cacheFile.empty()) {
+        Base::FileInfo(cacheFile).deleteFile();
+        cacheFile.clear();
+    }
+}
+
+void PointOctree::build(const PointKernel& points,
+                        const std::vector<Base::Color>* colors,
+                        const std::vector<Base::Vector3f>* normals,
+                        const std::vector<float>* intensity)
+{
+    clear();
+
+    const std::vector<Base::Vector3f>& pts = points.getBasicPoints();
+    if (pts.size() >= std::numeric_limits<std::uint32_t>::max()) {
+        throw Base::ValueError("Too many points for the octree");
+    }
+    withColors = colors && colors->size() == pts.size();
+    withNormals = normals && normals->size() == pts.size();
+    withIntensity = intensity && intensity->size() == pts.size();
+
+    Indices indices;
+    indices.reserve(pts.size());
+    Base::BoundBox3f bbox;
+    for (std::size_t i = 0; i < pts.size(); ++i) {
+        const Base::Vector3f& pt = pts[i];
+        if (!(boost::math::isnan(pt.x) || boost::math::isnan(pt.y) || boost::math::isnan(pt.z))) {
+            indices.push_back(static_cast<std::uint32_t>(i));
+            bbox.Add(pt);
+        }
+    }
+    if (indices.empty()) {
+        return;
+    }
+
+    // cubic cells keep the sampling grids isotropic
+    float length = std::max({bbox.LengthX(), bbox.LengthY(), bbox.LengthZ()});
+    length = length > 0.0F ? length * 1.001F : 1.0F;
+    Node root;
+    root.box = Base::BoundBox3f(bbox.GetCenter(), length / 2.0F);
+    nodes.push_back(root);
+
+    // a node keeps at most one point per cell of its sampling grid
+    const int grid = std::max(1, static_cast<int>(std::cbrt(static_cast<double>(nodeCapacity))));
+
+    struct Task
+    {
+        std::int32_t node;
+        std::size_t begin;
+        std::size_t end;
+    };
+    std::deque<Task> queue;
+    queue.push_back({0, 0, indices.size()});
+
+    Indices order;
+    order.reserve(indices.size());
+    std::vector<char> taken;
+
+    // breadth first, so that the nodes of a level are next to each other in the cache file
+    while (!queue.empty()) {
+        Task task = queue.front();
+        queue.pop_front();
+
+        Base::BoundBox3f box = nodes[task.node].box;
+        int level = nodes[task.node].level;
+        std::size_t mid = task.end;
+        if (task.end - task.begin > nodeCapacity && level < maxLevel) {
+            taken.assign(static_cast<std::size_t>(grid) * grid * grid, 0);
+            mid = task.begin;
+            for (std::size_t i = task.begin; i < task.end; ++i) {
+                int cell = gridCell(pts[indices[i]], box, grid);
+                if (taken[cell] == 0) {
+                    taken[cell] = 1;
+                    std::swap(indices[mid++], indices[i]);
+                }
+            }
+        }
+
+        Node& node = nodes[task.node];
+        node.first = order.size();
+        node.count = static_cast<std::uint32_t>(mid - task.begin);
+        node.spacing = box.LengthX() / static_cast<float>(grid);
+        order.insert(order.end(),
+                     indices.begin() + static_cast<std::ptrdiff_t>(task.begin),
+                     indices.begin() + static_cast<std::ptrdiff_t>(mid));
+
+        if (mid == task.end) {
+            continue;
+        }
+
+        Base::Vector3f boxCenter = box.GetCenter();
+        auto bounds = splitOctants(indices, pts, mid, task.end, boxCenter);
+        for (int octant = 0; octant < 8; ++octant) {
+            if (bounds[octant] == bounds[octant + 1]) {
+                continue;
+            }
+            Node child;
+            child.box.MinX = (octant & 1) ? boxCenter.x : box.MinX;
+            child.box.MaxX = (octant & 1) ? box.MaxX : boxCenter.x;
+            child.box.MinY = (octant & 2) ? boxCenter.y : box.MinY;
+            child.box.MaxY = (octant & 2) ? box.MaxY : boxCenter.y;
+            child.box.MinZ = (octant & 4) ? boxCenter.z : box.MinZ;
+            child.box.MaxZ = (octant & 4) ? box.MaxZ : boxCenter.z;
+            child.parent = task.node;
+            child.level = level + 1;
+
+            auto index = static_cast<std::int32_t>(nodes.size());
+            nodes.push_back(child);
+            nodes[task.node].children[octant] = index;
+            queue.push_back({index, bounds[octant], bounds[octant + 1]});
+        }
+    }
+
+    indices.clear();
+    indices.shrink_to_fit();
+
+    numPoints = order.size();
+    cloud.coords.resize(3 * order.size());
+    if (withColors) {
+        cloud.colors.resize(order.size());
+    }
+    if (withNormals) {
+        cloud.normals.resize(3 * order.size());
+    }
+    if (withIntensity) {
+        cloud.intensity.resize(order.size());
+    }
+    for (std::size_t i = 0; i < order.size(); ++i) {
+        std::uint32_t index = order[i];
+        const Base::Vector3f& pt = pts[index];
+        cloud.coords[3 * i] = pt.x;
+        cloud.coords[3 * i + 1] = pt.y;
+        cloud.coords[3 * i + 2] = pt.z;
+        if (withColors) {
+            cloud.colors[i] = (*colors)[index].getPackedRGB() | 0xFFU;
+        }
+        if (withNormals) {
+            const Base::Vector3f& normal = (*normals)[index];
+            cloud.normals[3 * i] = normal.x;
+            cloud.normals[3 * i + 1] = normal.y;
+            cloud.normals[3 * i + 2] = normal.z;
+        }
+        if (withIntensity) {
+            cloud.intensity[i] = (*intensity)[index];
+        }
+    }
+}
+
+void PointOctree::writeCache(std::ostream& out) const
+{
+    // one block per attribute, the offsets follow from the number of points
+    writeRange(out, cloud.coords);
+    writeRange(out, cloud.colors);
+    writeRange(out, cloud.normals);
+    writeRange(out, cloud.intensity);
+}
+
+void PointOctree::swapOut(const std::string& filename)
+{
+    if (isSwappedOut()) {
+        return;
+    }
+
+    Base::FileInfo fi(filename);
+    Base::ofstream out(fi, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!out) {
+        throw Base::FileException("Cannot create point cache", fi);
+    }
+    writeCache(out);
+    out.close();
+    if (!out) {
+        fi.deleteFile();
+        throw Base::FileException("Cannot write point cache", fi);
+    }
+
+    cacheFile = filename;
+    std::vector<float>().swap(cloud.coords);
+    std::vector<std::uint32_t>().swap(cloud.colors);
+    std::vector<float>().swap(cloud.normals);
+    std::vector<float>().swap(cloud.intensity);
+}
+
+void PointOctree::readNode(int node, NodeData& data) const
+{
+    const Node& entry = nodes.at(node);
+    const std::uint64_t first = entry.first;
+    const std::size_t count = entry.count;
+
+    data.clear();
+    if (!isSwappedOut()) {
+        copyRange(cloud.coords, data.coords, 3 * first, 3 * count);
+        if (withColors) {
+            copyRange(cloud.colors, data.colors, first, count);
+        }
+        if (withNormals) {
+            copyRange(cloud.normals, data.normals, 3 * first, 3 * count);
+        }
+        if (withIntensity) {
+            copyRange(cloud.intensity, data.intensity, first, count);
+        }
+        return;
+    }
+
+    // every call has its own stream, so that nodes can be read in parallel
+    Base::FileInfo fi(cacheFile);
+    Base::ifstream in(fi, std::ios::in | std::ios::binary);
+    if (!in) {
+        throw Base::FileException("Cannot open point cache", fi);
+    }
+
+    std::uint64_t base = 0;
+    readRange(in, data.coords, 3 * first, 3 * count);
+    base += 3 * numPoints * sizeof(float);
+    if (withColors) {
+        readRange(in, data.colors, base / sizeof(std::uint32_t) + first, count);
+        base += numPoints * sizeof(std::uint32_t);
+    }
+    if (withNormals) {
+        readRange(in, data.normals, base / sizeof(float) + 3 * first, 3 * count);
+        base += 3 * numPoints * sizeof(float);
+    }
+    if (withIntensity) {
+        readRange(in, data.intensity, base / sizeof(float) + first, count);
+    }
+    if (!in) {
+        data.clear();
+        throw Base::FileException("Cannot read point cache", fi);
+    }
+}
+
+bool PointOctree::isVisible(const Node& node, const View& view)
+{
+    // the corner of the box that lies furthest on the inner side of a plane must be inside
+    const Base::BoundBox3f& box = node.box;
+    for (const auto& plane : view.planes) {
+        float x = plane[0] >= 0.0F ? box.MaxX : box.MinX;
+        float y = plane[1] >= 0.0F ? box.MaxY : box.MinY;
+        float z = plane[2] >= 0.0F ? box.MaxZ : box.MinZ;
+        if (plane[0] * x + plane[1] * y + plane[2] * z + plane[3] < 0.0F) {
+            return false;
+        }
+    }
+    return true;
+}
+
+float PointOctree::projectedSpacing(const Node& node, const View& view)
+{
+    if (!view.perspective) {
+        return node.spacing * view.pixelsPerUnit;
+    }
+
+    const Base::BoundBox3f& box = node.box;
+    const Base::Vector3f& eye = view.eye;
+    float dx = std::max({box.MinX - eye.x, 0.0F, eye.x - box.MaxX});
+    float dy = std::max({box.MinY - eye.y, 0.0F, eye.y - box.MaxY});
+    float dz = std::max({box.MinZ - eye.z, 0.0F, eye.z - box.MaxZ});
+    float distance = std::sqrt(dx * dx + dy * dy + dz * dz);
+    if (distance <= std::numeric_limits<float>::epsilon()) {
+        return std::numeric_limits<float>::max();
+    }
+    return node.spacing * view.pixelsPerUnit / distance;
+}
+
+std::vector<int> PointOctree::selectNodes(const View& view) const
+{
+    std::vector<int> selection;
+    if (nodes.empty() || !isVisible(nodes.front(), view)) {
+        return selection;
+    }
+
+    // the coarsest nodes are refined first, so that the budget goes where it is seen most
+    using Entry = std::pair<float, int>;
+    std::priority_queue<Entry> queue;
+    queue.emplace(projectedSpacing(nodes.front(), view), 0);
+
+    std::uint64_t selected = 0;
+    while (!queue.empty()) {
+        auto [error, index] = queue.top();
+        queue.pop();
+
+        const Node& node = nodes[index];
+        if (!selection.empty() && selected + node.count > view.pointBudget) {
+            break;
+        }
+        selection.push_back(index);
+        selected += node.count;
+
+        if (error <= view.maxError) {
+            continue;
+        }
+        for (auto child : node.children) {
+            if (child >= 0 && isVisible(nodes[child], view)) {
+                queue.emplace(projectedSpacing(nodes[child], view), child);
+            }
+        }
+    }
+
+    return selection;
+}
@@ -0,0 +1,197 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 The FreeCAD Project Association                     *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#ifndef POINTS_OCTREE_H
+#define POINTS_OCTREE_H
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <Base/BoundBox.h>
+#include <Base/Color.h>
+#include <Base/Vector3D.h>
+
+#include "Points.h"
+
+
+namespace Points
+{
+
+/**
+ * The PointOctree sorts a point cloud into a level of detail hierarchy.
+ *
+ * Every node keeps an evenly spaced subsample of the points inside its cell, taken on a regular
+ * grid. The points a node keeps are not repeated in its children, i.e. a node together with all
+ * of its ancestors holds the full density of its cell. A renderer therefore always draws a set of
+ * nodes that contains the parents of its nodes, and refines where the grid spacing of a node
+ * covers too many pixels on the screen.
+ *
+ * The points and their attributes are reordered so that every node is a contiguous block. After
+ * swapOut() the blocks live in a cache file and are read back one node at a time, so only the
+ * nodes that are currently drawn need to be in memory.
+ */
+class PointsExport PointOctree
+{
+public:
+    struct Node
+    {
+        /// the cubic cell of the node
+        Base::BoundBox3f box;
+        /// the octants of the cell, -1 if there are no points in it
+        std::array<std::int32_t, 8> children {-1, -1, -1, -1, -1, -1, -1, -1};
+        std::int32_t parent = -1;
+        int level = 0;
+        /// the distance of the points of the node, and of the node with its ancestors
+        float spacing = 0.0F;
+        /// the first point of the node in the reordered cloud
+        std::uint64_t first = 0;
+        std::uint32_t count = 0;
+
+        bool isLeaf() const
+        {
+            for (auto child : children) {
+                if (child >= 0) {
+                    return false;
+                }
+            }
+            return true;
+        }
+    };
+
+    /// The points of a node together with the attributes the cloud has
+    struct NodeData
+    {
+        /// x, y and z of each point
+        std::vector<float> coords;
+        /// packed 0xRRGGBBAA values
+        std::vector<std::uint32_t> colors;
+        /// x, y and z of each normal
+        std::vector<float> normals;
+        std::vector<float> intensity;
+
+        std::size_t size() const
+        {
+            return coords.size() / 3;
+        }
+        void clear();
+    };
+
+    /// The camera, in the coordinate system of the point cloud
+    struct View
+    {
+        Base::Vector3f eye;
+        bool perspective = true;
+        /// number of pixels per length unit, at distance one from the eye for a perspective view
+        float pixelsPerUnit = 1.0F;
+        /// the planes a*x + b*y + c*z + d = 0 of the view volume, with the inside being positive
+        std::vector<std::array<float, 4>> planes;
+        /// the projected point spacing in pixels that needs no further refinement
+        float maxError = 2.0F;
+        /// the maximum number of points to select
+        std::uint64_t pointBudget = 5000000;
+    };
+
+    explicit PointOctree(std::uint32_t nodeCapacity = 30000, int maxLevel = 20);
+    ~PointOctree();
+
+    PointOctree(const PointOctree&) = delete;
+    PointOctree(PointOctree&&) = delete;
+    PointOctree& operator=(const PointOctree&) = delete;
+    PointOctree& operator=(PointOctree&&) = delete;
+
+    /** Builds the hierarchy of \a points. Attributes whose size differs from the number of
+     * points are ignored. Invalid points are skipped.
+     */
+    void build(const PointKernel& points,
+               const std::vector<Base::Color>* colors = nullptr,
+               const std::vector<Base::Vector3f>* normals = nullptr,
+               const std::vector<float>* intensity = nullptr);
+    /// Removes all nodes, and the cache file if there is one
+    void clear();
+
+    /** Moves the points into the cache file \a filename and releases their memory. The file is
+     * removed again by clear() or when the octree is destroyed.
+     */
+    void swapOut(const std::string& filename);
+    bool isSwappedOut() const
+    {
+        return !cacheFile.empty();
+    }
+
+    /// number of points stored in the octree
+    std::uint64_t size() const
+    {
+        return numPoints;
+    }
+    const std::vector<Node>& getNodes() const
+    {
+        return nodes;
+    }
+    bool hasColors() const
+    {
+        return withColors;
+    }
+    bool hasNormals() const
+    {
+        return withNormals;
+    }
+    bool hasIntensity() const
+    {
+        return withIntensity;
+    }
+
+    /** Reads the points of the node with index \a node into \a data.
+     * It's safe to call this method from several threads at the same time.
+     */
+    void readNode(int node, NodeData& data) const;
+
+    /** Selects the nodes to draw for \a view, coarse nodes first. A node is refined while its
+     * projected spacing exceeds View::maxError and the point budget permits. Nodes outside the
+     * view volume are skipped together with their children.
+     */
+    std::vector<int> selectNodes(const View& view) const;
+    /// The spacing of \a node in pixels, as seen from \a view
+    static float projectedSpacing(const Node& node, const View& view);
+
+private:
+    void writeCache(std::ostream&) const;
+    static bool isVisible(const Node& node, const View& view);
+
+private:
+    std::uint32_t nodeCapacity;
+    int maxLevel;
+    std::vector<Node> nodes;
+    NodeData cloud;
+    std::uint64_t numPoints = 0;
+    bool withColors = false;
+    bool withNormals = false;
+    bool withIntensity = false;
+    std::string cacheFile;
+};
+
+}  // namespace Points
+
+
+#endif  // POINTS_OCTREE_H
@@ -39,11 +39,19 @@
 
 // STL
 #include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <functional>
 #include <iostream>
+#include <limits>
 #include <memory>
+#include <queue>
 #include <set>
 #include <sstream>
+#include <thread>
 #include <vector>
 
 // boost
@@ -78,6 +78,13 @@ void PropertyGreyValueList::setValues(const std::vector<float>& values)
     hasSetValue();
 }
 
+void PropertyGreyValueList::setValues(std::vector<float>&& values)
+{
+    aboutToSetValue();
+    _lValueList = std::move(values);
+    hasSetValue();
+}
+
 PyObject* PropertyGreyValueList::getPyObject()
 {
     PyObject* list = PyList_New(getSize());
@@ -181,9 +188,9 @@ void PropertyGreyValueList::Paste(const App::Property& from)
     hasSetValue();
 }
 
-unsigned int PropertyGreyValueList::getMemSize() const
+std::size_t PropertyGreyValueList::getMemSize() const
 {
-    return static_cast<unsigned int>(_lValueList.size() * sizeof(float));
+    return _lValueList.size() * sizeof(float);
 }
 
 void PropertyGreyValueList::removeIndices(const std::vector<unsigned long>& uIndices)
@@ -254,6 +261,13 @@ void PropertyNormalList::setValues(const std::vector<Base::Vector3f>& values)
     hasSetValue();
 }
 
+void PropertyNormalList::setValues(std::vector<Base::Vector3f>&& values)
+{
+    aboutToSetValue();
+    _lValueList = std::move(values);
+    hasSetValue();
+}
+
 PyObject* PropertyNormalList::getPyObject()
 {
     PyObject* list = PyList_New(getSize());
@@ -353,9 +367,9 @@ void PropertyNormalList::Paste(const App::Property& from)
     hasSetValue();
 }
 
-unsigned int PropertyNormalList::getMemSize() const
+std::size_t PropertyNormalList::getMemSize() const
 {
-    return static_cast<unsigned int>(_lValueList.size() * sizeof(Base::Vector3f));
+    return _lValueList.size() * sizeof(Base::Vector3f);
 }
 
 void PropertyNormalList::transformGeometry(const Base::Matrix4D& mat)
@@ -636,7 +650,7 @@ void PropertyCurvatureList::Paste(const App::Property& from)
     hasSetValue();
 }
 
-unsigned int PropertyCurvatureList::getMemSize() const
+std::size_t PropertyCurvatureList::getMemSize() const
 {
     return sizeof(CurvatureInfo) * this->_lValueList.size();
 }
@@ -71,6 +71,7 @@ public:
         _lValueList[idx] = value;
     }
     void setValues(const std::vector<float>& values);
+    void setValues(std::vector<float>&& values);
 
     const std::vector<float>& getValues() const
     {
@@ -88,7 +89,7 @@ public:
 
     App::Property* Copy() const override;
     void Paste(const App::Property& from) override;
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
 
     /** @name Modify */
     //@{
@@ -123,6 +124,7 @@ public:
     }
 
     void setValues(const std::vector<Base::Vector3f>& values);
+    void setValues(std::vector<Base::Vector3f>&& values);
 
     const std::vector<Base::Vector3f>& getValues() const
     {
@@ -141,7 +143,7 @@ public:
     App::Property* Copy() const override;
     void Paste(const App::Property& from) override;
 
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
 
     /** @name Modify */
     //@{
@@ -223,7 +225,7 @@ public:
     App::Property* Copy() const override;
     /// paste the value from the property (mainly for Undo/Redo and transactions)
     void Paste(const App::Property& from) override;
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     //@}
 
     /** @name Modify */
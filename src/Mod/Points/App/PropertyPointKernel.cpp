@@ -26,6 +26,7 @@
 #include <algorithm>
 #include <cmath>
 #include <iostream>
+#include <memory>
 #endif
 
 #include <Base/Matrix.h>
@@ -43,10 +44,34 @@ PropertyPointKernel::PropertyPointKernel()
     : _cPoints(new PointKernel())
 {}
 
+void PropertyPointKernel::detachPoints()
+{
+    if (_cPoints.getRefCount() > 1) {
+        _cPoints = new PointKernel(*_cPoints);
+    }
+}
+
 void PropertyPointKernel::setValue(const PointKernel& m)
 {
     aboutToSetValue();
-    *_cPoints = m;
+    if (_cPoints.getRefCount() > 1) {
+        _cPoints = new PointKernel(m);
+    }
+    else {
+        *_cPoints = m;
+    }
+    hasSetValue();
+}
+
+void PropertyPointKernel::setValue(PointKernel&& m)
+{
+    aboutToSetValue();
+    if (_cPoints.getRefCount() > 1) {
+        _cPoints = new PointKernel(std::move(m));
+    }
+    else {
+        *_cPoints = std::move(m);
+    }
     hasSetValue();
 }
 
@@ -62,6 +87,7 @@ const Data::ComplexGeoData* PropertyPointKernel::getComplexData() const
 
 void PropertyPointKernel::setTransform(const Base::Matrix4D& rclTrf)
 {
+    // Note: The placement is kept in sync by the owner, so shared points are not detached here
     _cPoints->setTransform(rclTrf);
 }
 
@@ -115,6 +141,7 @@ void PropertyPointKernel::Restore(Base::XMLReader& reader)
         mtrx.fromString(Matrix);
 
         aboutToSetValue();
+        detachPoints();
         _cPoints->setTransform(mtrx);
         hasSetValue();
     }
@@ -129,14 +156,35 @@ void PropertyPointKernel::SaveDocFile(Base::Writer& writer) const
 void PropertyPointKernel::RestoreDocFile(Base::Reader& reader)
 {
     aboutToSetValue();
+    detachPoints();
     _cPoints->RestoreDocFile(reader);
     hasSetValue();
 }
 
+bool PropertyPointKernel::canParseDocFile() const
+{
+    return true;
+}
+
+std::function<void()> PropertyPointKernel::parseDocFile(Base::Reader& reader)
+{
+    PointKernel kernel;
+    kernel.RestoreDocFile(reader);
+    auto points = std::make_shared<std::vector<PointKernel::value_type>>();
+    kernel.swap(*points);
+    return [this, points]() {
+        aboutToSetValue();
+        detachPoints();
+        _cPoints->swap(*points);
+        hasSetValue();
+    };
+}
+
 App::Property* PropertyPointKernel::Copy() const
 {
+    // Note: Reference the same points, they get detached before a modification
     PropertyPointKernel* prop = new PropertyPointKernel();
-    (*prop->_cPoints) = (*this->_cPoints);
+    prop->_cPoints = this->_cPoints;
     return prop;
 }
 
@@ -144,11 +192,11 @@ void PropertyPointKernel::Paste(const App::Property& from)
 {
     aboutToSetValue();
     const PropertyPointKernel& prop = dynamic_cast<const PropertyPointKernel&>(from);
-    *(this->_cPoints) = *(prop._cPoints);
+    this->_cPoints = prop._cPoints;
     hasSetValue();
 }
 
-unsigned int PropertyPointKernel::getMemSize() const
+std::size_t PropertyPointKernel::getMemSize() const
 {
     return sizeof(Base::Vector3f) * this->_cPoints->size();
 }
@@ -156,6 +204,7 @@ unsigned int PropertyPointKernel::getMemSize() const
 PointKernel* PropertyPointKernel::startEditing()
 {
     aboutToSetValue();
+    detachPoints();
     return static_cast<PointKernel*>(_cPoints);
 }
 
@@ -199,6 +248,7 @@ void PropertyPointKernel::removeIndices(const std::vector<unsigned long>& uIndic
 void PropertyPointKernel::transformGeometry(const Base::Matrix4D& rclMat)
 {
     aboutToSetValue();
+    detachPoints();
     _cPoints->transformGeometry(rclMat);
     hasSetValue();
 }
@@ -42,6 +42,8 @@ public:
     //@{
     /// Sets the points to the property
     void setValue(const PointKernel& m);
+    /// Takes over the points, which avoids a copy of large clouds
+    void setValue(PointKernel&& m);
     /// get the points (only const possible!)
     const PointKernel& getValue() const;
     const Data::ComplexGeoData* getComplexData() const override;
@@ -64,10 +66,11 @@ public:
     /** @name Undo/Redo */
     //@{
     /// returns a new copy of the property (mainly for Undo/Redo and transactions)
+    /// The copy shares the points until one of them gets modified.
     App::Property* Copy() const override;
     /// paste the value from the property (mainly for Undo/Redo and transactions)
     void Paste(const App::Property& from) override;
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     //@}
 
     /** @name Save/restore */
@@ -76,6 +79,8 @@ public:
     void Restore(Base::XMLReader& reader) override;
     void SaveDocFile(Base::Writer& writer) const override;
     void RestoreDocFile(Base::Reader& reader) override;
+    bool canParseDocFile() const override;
+    std::function<void()> parseDocFile(Base::Reader& reader) override;
     //@}
 
     /** @name Modification */
@@ -88,6 +93,9 @@ public:
     //@}
 
 private:
+    /// Takes a private copy of the points if they are shared with a copy of this property
+    void detachPoints();
+
     Base::Reference<PointKernel> _cPoints;
 };
 
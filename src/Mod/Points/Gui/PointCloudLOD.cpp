@@ -0,0 +1,437 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 The FreeCAD Project Association                     *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+#ifndef _PreComp_
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+
+#include <Inventor/SbPlane.h>
+#include <Inventor/SbViewVolume.h>
+#include <Inventor/SbViewportRegion.h>
+#include <Inventor/actions/SoGLRenderAction.h>
+#include <Inventor/elements/SoModelMatrixElement.h>
+#include <Inventor/elements/SoViewVolumeElement.h>
+#include <Inventor/elements/SoViewportRegionElement.h>
+#include <Inventor/nodes/SoCallback.h>
+#include <Inventor/nodes/SoCoordinate3.h>
+#include <Inventor/nodes/SoNormal.h>
+#include <Inventor/nodes/SoPackedColor.h>
+#include <Inventor/nodes/SoPointSet.h>
+#include <Inventor/nodes/SoSeparator.h>
+#include <Inventor/sensors/SoOneShotSensor.h>
+#include <Inventor/sensors/SoTimerSensor.h>
+#endif
+
+#include <Base/Console.h>
+#include <Base/Exception.h>
+
+#include "PointCloudLOD.h"
+
+
+using namespace PointsGui;
+
+namespace
+{
+
+bool sameView(const Points::PointOctree::View& a, const Points::PointOctree::View& b)
+{
+    return a.perspective == b.perspective && a.eye == b.eye && a.pixelsPerUnit == b.pixelsPerUnit
+        && a.planes == b.planes;
+}
+
+using Vec3Array = const float (*)[3];
+
+Vec3Array asVec3(const std::vector<float>& values)
+{
+    return reinterpret_cast<const float(*)[3]>(values.data());  // NOLINT
+}
+
+}  // namespace
+
+PointCloudLOD::PointCloudLOD()
+{
+    root = new SoSeparator();
+    root->ref();
+
+    // looks at the camera of every frame, the scene itself is only changed by the sensors
+    auto callback = new SoCallback();
+    callback->setCallback(renderCallback, this);
+    root->addChild(callback);
+
+    nodeGroup = new SoGroup();
+    root->addChild(nodeGroup);
+
+    selectSensor = new SoOneShotSensor(selectCallback, this);
+    loadedSensor = new SoTimerSensor(loadedCallback, this);
+    loadedSensor->setInterval(SbTime(0.05));
+}
+
+PointCloudLOD::~PointCloudLOD()
+{
+    reset();
+    delete selectSensor;
+    delete loadedSensor;
+    root->unref();
+}
+
+void PointCloudLOD::setOctree(std::shared_ptr<const Points::PointOctree> tree)
+{
+    reset();
+    octree = std::move(tree);
+    if (octree) {
+        startWorker();
+        // the next frame selects the nodes
+        root->touch();
+    }
+}
+
+void PointCloudLOD::reset()
+{
+    stopWorker();
+    selectSensor->unschedule();
+    loadedSensor->unschedule();
+    clearNodes();
+    selection.clear();
+    pending.clear();
+    viewValid = false;
+    octree.reset();
+}
+
+bool PointCloudLOD::setMode(Mode newMode)
+{
+    if (octree) {
+        if ((newMode == Mode::Color && !octree->hasColors())
+            || (newMode == Mode::Intensity && !octree->hasIntensity())
+            || (newMode == Mode::Shaded && !octree->hasNormals())) {
+            return false;
+        }
+    }
+
+    if (mode != newMode) {
+        mode = newMode;
+        // the resident nodes lack the attributes of the new mode
+        clearNodes();
+        if (viewValid) {
+            selectSensor->schedule();
+        }
+    }
+    return true;
+}
+
+void PointCloudLOD::setPointBudget(std::uint64_t budget)
+{
+    view.pointBudget = std::max<std::uint64_t>(budget, 1);
+    if (viewValid) {
+        selectSensor->schedule();
+    }
+}
+
+void PointCloudLOD::setMaxError(float pixels)
+{
+    view.maxError = std::max(pixels, 0.1F);
+    if (viewValid) {
+        selectSensor->schedule();
+    }
+}
+
+void PointCloudLOD::renderCallback(void* data, SoAction* action)
+{
+    static_cast<PointCloudLOD*>(data)->checkView(action);
+}
+
+void PointCloudLOD::selectCallback(void* data, SoSensor*)
+{
+    static_cast<PointCloudLOD*>(data)->selectNodes();
+}
+
+void PointCloudLOD::loadedCallback(void* data, SoSensor*)
+{
+    static_cast<PointCloudLOD*>(data)->addLoadedNodes();
+}
+
+void PointCloudLOD::checkView(SoAction* action)
+{
+    if (!octree || !action->isOfType(SoGLRenderAction::getClassTypeId())) {
+        return;
+    }
+
+    // express the camera in the coordinate system of the points
+    SoState* state = action->getState();
+    SbViewVolume volume = SoViewVolumeElement::get(state);
+    volume.transform(SoModelMatrixElement::get(state).inverse());
+    const SbViewportRegion& region = SoViewportRegionElement::get(state);
+
+    Points::PointOctree::View current = view;
+    current.perspective = volume.getProjectionType() == SbViewVolume::PERSPECTIVE;
+    SbVec3f eye = volume.getProjectionPoint();
+    current.eye.Set(eye[0], eye[1], eye[2]);
+    float pixels = static_cast<float>(region.getViewportSizePixels()[1]);
+    float height = std::max(volume.getHeight(), std::numeric_limits<float>::min());
+    current.pixelsPerUnit =
+        current.perspective ? pixels * volume.getNearDist() / height : pixels / height;
+
+    std::array<SbPlane, 6> planes;
+    volume.getViewVolumePlanes(planes.data());
+    current.planes.clear();
+    for (const auto& plane : planes) {
+        // the normals point into the view volume
+        const SbVec3f& normal = plane.getNormal();
+        current.planes.push_back(
+            {normal[0], normal[1], normal[2], -plane.getDistanceFromOrigin()});
+    }
+
+    if (!viewValid || !sameView(current, view)) {
+        view = current;
+        viewValid = true;
+        // the scene must not be changed while it's being traversed
+        selectSensor->schedule();
+    }
+}
+
+void PointCloudLOD::selectNodes()
+{
+    if (!octree || !viewValid) {
+        return;
+    }
+
+    selection = octree->selectNodes(view);
+    ++frame;
+
+    std::vector<int> missing;
+    for (int node : selection) {
+        auto it = resident.find(node);
+        if (it != resident.end()) {
+            it->second.lastUsed = frame;
+        }
+        else if (pending.count(node) == 0) {
+            missing.push_back(node);
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        // drop what the former selection still waits for but the new one doesn't need
+        std::set<int> selected(selection.begin(), selection.end());
+        auto stale = std::remove_if(requests.begin(), requests.end(), [&](int node) {
+            if (selected.count(node) != 0) {
+                return false;
+            }
+            pending.erase(node);
+            return true;
+        });
+        requests.erase(stale, requests.end());
+        requests.insert(requests.end(), missing.begin(), missing.end());
+    }
+    pending.insert(missing.begin(), missing.end());
+    if (!missing.empty()) {
+        wakeUp.notify_one();
+    }
+    if (!pending.empty() && !loadedSensor->isScheduled()) {
+        loadedSensor->schedule();
+    }
+
+    updateScene();
+}
+
+void PointCloudLOD::addLoadedNodes()
+{
+    std::vector<Loaded> arrived;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        arrived.swap(loaded);
+    }
+
+    for (const auto& entry : arrived) {
+        pending.erase(entry.node);
+        if (resident.count(entry.node) != 0) {
+            continue;
+        }
+        SoSeparator* group = createNode(entry.data);
+        group->ref();
+        auto count = static_cast<std::uint32_t>(entry.data.size());
+        resident[entry.node] = {group, count, frame};
+        residentPoints += count;
+    }
+
+    if (pending.empty()) {
+        loadedSensor->unschedule();
+    }
+    if (!arrived.empty()) {
+        updateScene();
+    }
+}
+
+void PointCloudLOD::updateScene()
+{
+    nodeGroup->enableNotify(false);
+    nodeGroup->removeAllChildren();
+    for (int node : selection) {
+        auto it = resident.find(node);
+        if (it != resident.end()) {
+            nodeGroup->addChild(it->second.group);
+        }
+    }
+    nodeGroup->enableNotify(true);
+    nodeGroup->touch();
+
+    evict();
+}
+
+void PointCloudLOD::evict()
+{
+    const std::uint64_t limit = 2 * view.pointBudget;
+    if (residentPoints <= limit) {
+        return;
+    }
+
+    // least recently used first, the nodes of the current selection are never removed
+    std::vector<std::pair<std::uint64_t, int>> candidates;
+    for (const auto& it : resident) {
+        if (it.second.lastUsed < frame) {
+            candidates.emplace_back(it.second.lastUsed, it.first);
+        }
+    }
+    std::sort(candidates.begin(), candidates.end());
+
+    for (const auto& candidate : candidates) {
+        if (residentPoints <= limit) {
+            break;
+        }
+        auto it = resident.find(candidate.second);
+        residentPoints -= it->second.count;
+        it->second.group->unref();
+        resident.erase(it);
+    }
+}
+
+SoSeparator* PointCloudLOD::createNode(const Points::PointOctree::NodeData& data) const
+{
+    const int count = static_cast<int>(data.size());
+    auto group = new SoSeparator();
+
+    auto coords = new SoCoordinate3();
+    coords->point.setValues(0, count, asVec3(data.coords));
+    group->addChild(coords);
+
+    switch (mode) {
+        case Mode::Color:
+            if (!data.colors.empty()) {
+                auto colors = new SoPackedColor();
+                colors->orderedRGBA.setValues(0, count, data.colors.data());
+                group->addChild(colors);
+            }
+            break;
+        case Mode::Intensity:
+            if (!data.intensity.empty()) {
+                auto colors = new SoPackedColor();
+                colors->orderedRGBA.setNum(count);
+                std::uint32_t* rgba = colors->orderedRGBA.startEditing();
+                for (int i = 0; i < count; ++i) {
+                    auto grey = static_cast<std::uint32_t>(
+                        std::lround(std::clamp(data.intensity[i], 0.0F, 1.0F) * 255.0F));
+                    rgba[i] = grey << 24 | grey << 16 | grey << 8 | 0xFFU;
+                }
+                colors->orderedRGBA.finishEditing();
+                group->addChild(colors);
+            }
+            break;
+        case Mode::Shaded:
+            if (!data.normals.empty()) {
+                auto normals = new SoNormal();
+                normals->vector.setValues(0, count, asVec3(data.normals));
+                group->addChild(normals);
+            }
+            break;
+        case Mode::Points:
+            break;
+    }
+
+    auto points = new SoPointSet();
+    points->numPoints = count;
+    group->addChild(points);
+    return group;
+}
+
+void PointCloudLOD::clearNodes()
+{
+    nodeGroup->removeAllChildren();
+    for (auto& it : resident) {
+        it.second.group->unref();
+    }
+    resident.clear();
+    residentPoints = 0;
+}
+
+void PointCloudLOD::startWorker()
+{
+    stopping = false;
+    worker = std::thread([this, tree = octree]() {
+        workerLoop(tree);
+    });
+}
+
+void PointCloudLOD::stopWorker()
+{
+    if (!worker.joinable()) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+        requests.clear();
+    }
+    wakeUp.notify_all();
+    worker.join();
+    loaded.clear();
+}
+
+void PointCloudLOD::workerLoop(const std::shared_ptr<const Points::PointOctree>& tree)
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    for (;;) {
+        wakeUp.wait(lock, [this]() {
+            return stopping || !requests.empty();
+        });
+        if (stopping) {
+            return;
+        }
+        Loaded entry;
+        entry.node = requests.front();
+        requests.pop_front();
+        lock.unlock();
+
+        try {
+            tree->readNode(entry.node, entry.data);
+        }
+        catch (const Base::Exception& e) {
+            // an empty node is added instead, so that it isn't requested over and over again
+            Base::Console().warning("Cannot load points: %s\n", e.what());
+        }
+
+        lock.lock();
+        loaded.push_back(std::move(entry));
+    }
+}
@@ -0,0 +1,152 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 The FreeCAD Project Association                     *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#ifndef POINTSGUI_POINTCLOUDLOD_H
+#define POINTSGUI_POINTCLOUDLOD_H
+
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include <Mod/Points/App/PointsOctree.h>
+
+
+class SoAction;
+class SoGroup;
+class SoOneShotSensor;
+class SoSensor;
+class SoSeparator;
+class SoTimerSensor;
+
+namespace PointsGui
+{
+
+/**
+ * The PointCloudLOD class renders the nodes of a Points::PointOctree that the current camera
+ * needs. Whenever the camera changes the nodes are selected anew after the frame, the missing
+ * nodes are loaded by a worker thread and added to the scene as they arrive. Until then the
+ * coarser nodes, which are always part of a selection, fill the gaps. Nodes that are no longer
+ * needed are kept until the resident points exceed twice the point budget.
+ */
+class PointCloudLOD
+{
+public:
+    enum class Mode
+    {
+        Points,
+        Color,
+        Intensity,
+        Shaded
+    };
+
+    PointCloudLOD();
+    ~PointCloudLOD();
+
+    PointCloudLOD(const PointCloudLOD&) = delete;
+    PointCloudLOD(PointCloudLOD&&) = delete;
+    PointCloudLOD& operator=(const PointCloudLOD&) = delete;
+    PointCloudLOD& operator=(PointCloudLOD&&) = delete;
+
+    /// The node to add to the scene graph
+    SoSeparator* getRoot() const
+    {
+        return root;
+    }
+    void setOctree(std::shared_ptr<const Points::PointOctree> octree);
+    /// Drops the octree and all nodes built from it
+    void reset();
+    bool isActive() const
+    {
+        return static_cast<bool>(octree);
+    }
+
+    /// Returns false if the octree lacks the attribute needed by \a mode
+    bool setMode(Mode mode);
+    void setPointBudget(std::uint64_t budget);
+    /// The projected point spacing in pixels up to which nodes are refined
+    void setMaxError(float pixels);
+
+private:
+    struct Resident
+    {
+        SoSeparator* group;
+        std::uint32_t count;
+        std::uint64_t lastUsed;
+    };
+    struct Loaded
+    {
+        int node;
+        Points::PointOctree::NodeData data;
+    };
+
+    static void renderCallback(void* data, SoAction* action);
+    static void selectCallback(void* data, SoSensor* sensor);
+    static void loadedCallback(void* data, SoSensor* sensor);
+    void checkView(SoAction* action);
+    void selectNodes();
+    void addLoadedNodes();
+    void updateScene();
+    void evict();
+    SoSeparator* createNode(const Points::PointOctree::NodeData& data) const;
+    void clearNodes();
+
+    void startWorker();
+    void stopWorker();
+    void workerLoop(const std::shared_ptr<const Points::PointOctree>& tree);
+
+private:
+    SoSeparator* root;
+    SoGroup* nodeGroup;
+    SoOneShotSensor* selectSensor;
+    SoTimerSensor* loadedSensor;
+
+    std::shared_ptr<const Points::PointOctree> octree;
+    Mode mode = Mode::Points;
+    Points::PointOctree::View view;
+    bool viewValid = false;
+
+    std::vector<int> selection;
+    std::map<int, Resident> resident;
+    /// nodes requested from the worker that have not arrived yet
+    std::set<int> pending;
+    std::uint64_t residentPoints = 0;
+    std::uint64_t frame = 0;
+
+    // shared with the worker thread
+    std::thread worker;
+    std::mutex mutex;
+    std::condition_variable wakeUp;
+    std::deque<int> requests;
+    std::vector<Loaded> loaded;
+    bool stopping = false;
+};
+
+}  // namespace PointsGui
+
+
+#endif  // POINTSGUI_POINTCLOUDLOD_H
@@ -35,23 +35,38 @@
 #include <Inventor/nodes/SoMaterialBinding.h>
 #include <Inventor/nodes/SoNormal.h>
 #include <Inventor/nodes/SoPointSet.h>
+#include <Inventor/nodes/SoSeparator.h>
+#include <Inventor/sensors/SoOneShotSensor.h>
 #endif
 
+#include <App/Application.h>
 #include <App/Document.h>
+#include <Base/FileInfo.h>
 #include <Base/Vector3D.h>
 #include <Gui/Application.h>
 #include <Gui/Document.h>
 #include <Gui/Selection/SoFCSelection.h>
 #include <Gui/View3DInventorViewer.h>
 #include <Mod/Points/App/PointsFeature.h>
+#include <Mod/Points/App/PointsOctree.h>
 #include <Mod/Points/App/Properties.h>
 
+#include "PointCloudLOD.h"
 #include "ViewProvider.h"
 
 
 using namespace PointsGui;
 using namespace Points;
 
+namespace
+{
+ParameterGrp::handle getLevelOfDetailParameter()
+{
+    return App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Points/LevelOfDetail");
+}
+}  // namespace
+
 
 PROPERTY_SOURCE_ABSTRACT(PointsGui::ViewProviderPoints, Gui::ViewProviderGeometryObject)
 
@@ -367,6 +382,8 @@ void ViewProviderPoints::clipPointsCallback(void*, SoEventCallback* n)
 PROPERTY_SOURCE(PointsGui::ViewProviderScattered, PointsGui::ViewProviderPoints)
 
 ViewProviderScattered::ViewProviderScattered()
+    : pcLevelOfDetail(std::make_unique<PointCloudLOD>())
+    , pcBuildSensor(new SoOneShotSensor(buildCallback, this))
 {
     pcPoints = new SoPointSet();
     pcPoints->ref();
@@ -374,6 +391,12 @@ ViewProviderScattered::ViewProviderScattered()
 
 ViewProviderScattered::~ViewProviderScattered()
 {
+    delete pcBuildSensor;
+    // the renderer goes before the selection node that might still hold its scene
+    int index = pcHighlight->findChild(pcLevelOfDetail->getRoot());
+    if (index >= 0) {
+        pcHighlight->removeChild(index);
+    }
     pcPoints->unref();
 }
 
@@ -427,21 +450,138 @@ void ViewProviderScattered::updateData(const App::Property* prop)
 {
     ViewProviderPoints::updateData(prop);
     if (prop->is<Points::PropertyPointKernel>()) {
-        ViewProviderPointsBuilder builder;
-        builder.createPoints(prop, pcPointsCoord, pcPoints);
+        const Points::PointKernel& kernel =
+            static_cast<const Points::PropertyPointKernel*>(prop)->getValue();
+        unsigned long threshold = getLevelOfDetailParameter()->GetUnsigned("Threshold", 2000000);
+        if (threshold > 0 && kernel.size() >= threshold) {
+            pcBuildSensor->schedule();
+        }
+        else {
+            pcBuildSensor->unschedule();
+            setLevelOfDetail(false);
+            ViewProviderPointsBuilder builder;
+            builder.createPoints(prop, pcPointsCoord, pcPoints);
+        }
 
         // The number of points might have changed, so force also a resize of the Inventor internals
         setActiveMode();
     }
-    else if (prop->is<Points::PropertyNormalList>()) {
+    else if (prop->is<Points::PropertyNormalList>() || prop->is<Points::PropertyGreyValueList>()
+             || prop->is<App::PropertyColorList>()) {
+        // the attributes are part of the octree
+        if (pcLevelOfDetail->isActive()) {
+            pcBuildSensor->schedule();
+        }
         setActiveMode();
     }
-    else if (prop->is<Points::PropertyGreyValueList>()) {
-        setActiveMode();
+}
+
+void ViewProviderScattered::buildCallback(void* data, SoSensor*)
+{
+    auto self = static_cast<ViewProviderScattered*>(data);
+    self->buildLevelOfDetail();
+    self->setActiveMode();
+}
+
+void ViewProviderScattered::setDisplayMode(const char* ModeName)
+{
+    if (!pcLevelOfDetail->isActive()) {
+        ViewProviderPoints::setDisplayMode(ModeName);
+        return;
     }
-    else if (prop->is<App::PropertyColorList>()) {
-        setActiveMode();
+
+    // the octree already holds the attributes, only the mask mode needs to be set
+    using Mode = PointCloudLOD::Mode;
+    Mode mode = Mode::Points;
+    const char* mask = "Point";
+    if (strcmp("Color", ModeName) == 0) {
+        mode = Mode::Color;
+        mask = "Color";
+    }
+    else if (strcmp("Intensity", ModeName) == 0) {
+        mode = Mode::Intensity;
+        mask = "Color";
+    }
+    else if (strcmp("Shaded", ModeName) == 0) {
+        mode = Mode::Shaded;
+        mask = "Shaded";
+    }
+
+    if (!pcLevelOfDetail->setMode(mode)) {
+        // fallback
+        pcLevelOfDetail->setMode(Mode::Points);
+        mask = "Point";
+    }
+    setDisplayMaskMode(mask);
+
+    ViewProviderGeometryObject::setDisplayMode(ModeName);
+}
+
+void ViewProviderScattered::setLevelOfDetail(bool on)
+{
+    SoSeparator* lodRoot = pcLevelOfDetail->getRoot();
+    if (!on) {
+        pcLevelOfDetail->reset();
+    }
+    if (on == (pcHighlight->findChild(lodRoot) >= 0)) {
+        return;
+    }
+
+    pcHighlight->removeAllChildren();
+    if (on) {
+        pcPointsCoord->point.setNum(0);
+        pcPoints->numPoints = 0;
+        pcHighlight->addChild(lodRoot);
     }
+    else {
+        pcHighlight->addChild(pcPointsCoord);
+        pcHighlight->addChild(pcPoints);
+    }
+}
+
+void ViewProviderScattered::buildLevelOfDetail()
+{
+    const App::PropertyColorList* colors = nullptr;
+    const Points::PropertyNormalList* normals = nullptr;
+    const Points::PropertyGreyValueList* greyValues = nullptr;
+
+    std::map<std::string, App::Property*> Map;
+    pcObject->getPropertyMap(Map);
+    for (const auto& it : Map) {
+        Base::Type type = it.second->getTypeId();
+        if (type == App::PropertyColorList::getClassTypeId()) {
+            colors = static_cast<App::PropertyColorList*>(it.second);
+        }
+        else if (type == Points::PropertyNormalList::getClassTypeId()) {
+            normals = static_cast<Points::PropertyNormalList*>(it.second);
+        }
+        else if (type == Points::PropertyGreyValueList::getClassTypeId()) {
+            greyValues = static_cast<Points::PropertyGreyValueList*>(it.second);
+        }
+    }
+
+    const Points::PointKernel& kernel = static_cast<Points::Feature*>(pcObject)->Points.getValue();
+    auto octree = std::make_shared<Points::PointOctree>();
+    octree->build(kernel,
+                  colors ? &colors->getValues() : nullptr,
+                  normals ? &normals->getValues() : nullptr,
+                  greyValues ? &greyValues->getValues() : nullptr);
+
+    ParameterGrp::handle hGrp = getLevelOfDetailParameter();
+    if (octree->size() >= hGrp->GetUnsigned("SwapThreshold", 20000000)) {
+        try {
+            octree->swapOut(Base::FileInfo::getTempFileName("Points"));
+        }
+        catch (const Base::Exception& e) {
+            // keep the points in memory then
+            e.reportException();
+        }
+    }
+
+    pcLevelOfDetail->setPointBudget(hGrp->GetUnsigned("PointBudget", 3000000));
+    pcLevelOfDetail->setMaxError(static_cast<float>(hGrp->GetFloat("MaxError", 2.0)));
+    pcLevelOfDetail->setOctree(octree);
+    setLevelOfDetail(true);
 }
 
 void ViewProviderScattered::cut(const std::vector<SbVec2f>& picked,
@@ -23,6 +23,7 @@
 #ifndef POINTSGUI_VIEWPROVIDERPOINTS_H
 #define POINTSGUI_VIEWPROVIDERPOINTS_H
 
+#include <memory>
 #include <Inventor/SbVec2f.h>
 
 #include <Gui/ViewProviderBuilder.h>
@@ -38,6 +39,8 @@ class SoLocateHighlight;
 class SoCoordinate3;
 class SoNormal;
 class SoEventCallback;
+class SoOneShotSensor;
+class SoSensor;
 
 namespace App
 {
@@ -59,6 +62,7 @@ class Feature;
 
 namespace PointsGui
 {
+class PointCloudLOD;
 
 class ViewProviderPointsBuilder: public Gui::ViewProviderBuilder
 {
@@ -137,12 +141,27 @@ public:
     void attach(App::DocumentObject*) override;
     /// Update the point representation
     void updateData(const App::Property*) override;
+    /// set the viewing mode
+    void setDisplayMode(const char* ModeName) override;
 
 protected:
     void cut(const std::vector<SbVec2f>& picked, Gui::View3DInventorViewer& Viewer) override;
 
+private:
+    /** Clouds from the size set by the Mod/Points/LevelOfDetail preferences on are drawn by
+     * the level of detail renderer. Smaller clouds are uploaded to the scene graph in full.
+     */
+    void setLevelOfDetail(bool on);
+    void buildLevelOfDetail();
+    /// The octree is built once after the points and their attributes have changed
+    static void buildCallback(void* data, SoSensor* sensor);
+
 protected:
     SoPointSet* pcPoints;
+
+private:
+    std::unique_ptr<PointCloudLOD> pcLevelOfDetail;
+    SoOneShotSensor* pcBuildSensor;
 };
 
 /**
@@ -57,7 +57,7 @@ public:
     Robot6Axis();
 
     // from base class
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     void Save(Base::Writer& /*writer*/) const override;
     void Restore(Base::XMLReader& /*reader*/) override;
 
@@ -141,7 +141,7 @@ Quantity Constraint::getPresentationValue() const
     return quantity;
 }
 
-unsigned int Constraint::getMemSize() const
+std::size_t Constraint::getMemSize() const
 {
     return 0;
 }
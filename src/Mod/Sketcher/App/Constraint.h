@@ -112,7 +112,7 @@ public:
     Constraint* copy() const;
 
     // from base class
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     void Save(Base::Writer& /*writer*/) const override;
     void Restore(Base::XMLReader& /*reader*/) override;
 
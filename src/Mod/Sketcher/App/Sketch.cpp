@@ -37,6 +37,7 @@
 
 #include <Base/Console.h>
 #include <Base/Exception.h>
+#include <Base/Profiler.h>
 #include <Base/Reader.h>
 #include <Base/TimeInfo.h>
 #include <Base/VectorPy.h>
@@ -4572,6 +4573,7 @@ bool Sketch::updateNonDrivingConstraints()
 
 int Sketch::solve()
 {
+    ZoneScoped;
     Base::TimeElapsed start_time;
     std::string solvername;
 
@@ -4593,6 +4595,7 @@ int Sketch::solve()
 
 int Sketch::internalSolve(std::string& solvername, int level)
 {
+    ZoneScoped;
     if (!isInitMove) {  // make sure we are in single subsystem mode
         clearTemporaryConstraints();
         isFine = true;
@@ -5336,7 +5339,7 @@ TopoShape Sketch::toShape() const
 
 // Persistence implementer -------------------------------------------------
 
-unsigned int Sketch::getMemSize() const
+std::size_t Sketch::getMemSize() const
 {
     return 0;
 }
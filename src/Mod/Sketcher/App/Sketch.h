@@ -46,7 +46,7 @@ public:
     ~Sketch() override;
 
     // from base class
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     void Save(Base::Writer& /*writer*/) const override;
     void Restore(Base::XMLReader& /*reader*/) override;
 
@@ -607,6 +607,10 @@ public:
     {
         GCSsys.dogLegGaussStep = mode;
     }
+    inline void setJacobianStorage(GCS::JacobianStorage storage)
+    {
+        GCSsys.jacobianStorage = storage;
+    }
     inline void setDebugMode(GCS::DebugMode mode)
     {
         debugMode = mode;
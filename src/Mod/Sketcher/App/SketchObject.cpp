@@ -9807,7 +9807,7 @@ PyObject* SketchObject::getPyObject()
     return Py::new_reference_to(PythonObject);
 }
 
-unsigned int SketchObject::getMemSize() const
+std::size_t SketchObject::getMemSize() const
 {
     return 0;
 }
@@ -609,7 +609,7 @@ public:
 
     // from base class
     PyObject* getPyObject() override;
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     void Save(Base::Writer& /*writer*/) const override;
     void Restore(Base::XMLReader& /*reader*/) override;
     void handleChangedPropertyType(Base::XMLReader& reader,
@@ -96,6 +96,7 @@
 #endif
 
 #include <Base/Console.h>
+#include <Base/Profiler.h>
 #include <FCConfig.h>
 
 #include <boost/graph/connected_components.hpp>
@@ -469,6 +470,7 @@ System::System()
     , dofs(0)
     , hasUnknowns(false)
     , hasDiagnosis(false)
+    , solvedComponents(0)
     , isInit(false)
     , emptyDiagnoseMatrix(true)
     , maxIter(100)
@@ -479,6 +481,7 @@ System::System()
     , convergenceRedundant(1e-10)
     , qrAlgorithm(EigenSparseQR)
     , dogLegGaussStep(FullPivLU)
+    , jacobianStorage(DenseJacobian)
     , qrpivotThreshold(1E-13)
     , debugMode(Minimal)
     , LM_eps(1E-10)
@@ -1784,6 +1787,7 @@ void System::rescaleConstraint(int id, double coeff)
     }
     if (clist[id]) {
         clist[id]->rescale(coeff);
+        invalidateComponentStates();
     }
 }
 
@@ -1805,6 +1809,7 @@ void System::declareDrivenParams(VEC_pD& params)
 
 void System::initSolution(Algorithm alg)
 {
+    ZoneScoped;
     // - Stores the current parameters values in the vector "reference"
     // - identifies any decoupled subsystems and partitions the original
     //   system into corresponding components
@@ -1938,9 +1943,64 @@ void System::initSolution(Algorithm alg)
         }
     }
 
+    // collect the parameters each component depends on without solving for them
+    componentStates.clear();
+    componentStates.resize(clists.size());
+    for (std::size_t cid = 0; cid < clists.size(); ++cid) {
+        SET_pD inputs;
+        for (const auto& constr : clists[cid]) {
+            for (const auto& param : c2p[constr]) {
+                if (pIndex.find(param) == pIndex.end()) {
+                    inputs.insert(param);
+                }
+            }
+        }
+        componentStates[cid].inputs.assign(inputs.begin(), inputs.end());
+    }
+
     isInit = true;
 }
 
+bool System::isComponentSolved(std::size_t cid, bool isFine, bool isRedundantsolving) const
+{
+    if (cid >= componentStates.size()) {
+        return false;
+    }
+    const ComponentState& state = componentStates[cid];
+    if (!state.isSolved || state.isFine != isFine
+        || state.isRedundantsolving != isRedundantsolving) {
+        return false;
+    }
+    for (std::size_t i = 0; i < state.inputs.size(); ++i) {
+        if (*state.inputs[i] != state.inputValues[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void System::storeComponentState(std::size_t cid, bool isFine, bool isRedundantsolving)
+{
+    if (cid >= componentStates.size()) {
+        return;
+    }
+    ComponentState& state = componentStates[cid];
+    state.inputValues.resize(state.inputs.size());
+    for (std::size_t i = 0; i < state.inputs.size(); ++i) {
+        state.inputValues[i] = *state.inputs[i];
+    }
+    state.isSolved = true;
+    state.isFine = isFine;
+    state.isRedundantsolving = isRedundantsolving;
+}
+
+void System::invalidateComponentStates()
+{
+    for (auto& state : componentStates) {
+        state.isSolved = false;
+    }
+}
+
 void System::setReference()
 {
     reference.clear();
@@ -1970,6 +2030,7 @@ int System::solve(VEC_pD& params, bool isFine, Algorithm alg, bool isRedundantso
 
 int System::solve(bool isFine, Algorithm alg, bool isRedundantsolving)
 {
+    ZoneScoped;
     if (!isInit) {
         return Failed;
     }
@@ -1978,21 +2039,38 @@ int System::solve(bool isFine, Algorithm alg, bool isRedundantsolving)
     // return success by default in order to permit coincidence constraints to be applied
     // even if no other system has to be solved
     int res = Success;
+    solvedComponents = 0;
     for (int cid = 0; cid < int(subSystems.size()); cid++) {
         if ((subSystems[cid] || subSystemsAux[cid]) && !isReset) {
             resetToReference();
             isReset = true;
         }
+        // the subsystems of a component whose inputs are unchanged still hold its solution,
+        // which applySolution() writes back, so only the affected components are solved
+        if (isComponentSolved(cid, isFine, isRedundantsolving)) {
+            continue;
+        }
+        int cres = Success;
         if (subSystems[cid] && subSystemsAux[cid]) {
-            res = std::max(res,
-                           solve(subSystems[cid], subSystemsAux[cid], isFine, isRedundantsolving));
+            cres = solve(subSystems[cid], subSystemsAux[cid], isFine, isRedundantsolving);
         }
         else if (subSystems[cid]) {
-            res = std::max(res, solve(subSystems[cid], isFine, alg, isRedundantsolving));
+            cres = solve(subSystems[cid], isFine, alg, isRedundantsolving);
         }
         else if (subSystemsAux[cid]) {
-            res = std::max(res, solve(subSystemsAux[cid], isFine, alg, isRedundantsolving));
+            cres = solve(subSystemsAux[cid], isFine, alg, isRedundantsolving);
         }
+        else {
+            continue;
+        }
+        ++solvedComponents;
+        if (cres == Success) {
+            storeComponentState(cid, isFine, isRedundantsolving);
+        }
+        else {
+            componentStates[cid].isSolved = false;
+        }
+        res = std::max(res, cres);
     }
     if (res == Success) {
         for (std::set<Constraint*>::const_iterator constr = redundant.begin();
@@ -2013,6 +2091,7 @@ int System::solve(bool isFine, Algorithm alg, bool isRedundantsolving)
 
 int System::solve(SubSystem* subsys, bool isFine, Algorithm alg, bool isRedundantsolving)
 {
+    ZoneScoped;
     if (alg == BFGS) {
         return solve_BFGS(subsys, isFine, isRedundantsolving);
     }
@@ -2029,6 +2108,7 @@ int System::solve(SubSystem* subsys, bool isFine, Algorithm alg, bool isRedundan
 
 int System::solve_BFGS(SubSystem* subsys, bool /*isFine*/, bool isRedundantsolving)
 {
+    ZoneScoped;
 #ifdef _GCS_EXTRACT_SOLVER_SUBSYSTEM_
     extractSubsystem(subsys, isRedundantsolving);
 #endif
@@ -2155,7 +2235,91 @@ int System::solve_BFGS(SubSystem* subsys, bool /*isFine*/, bool isRedundantsolvi
     return Failed;
 }
 
+// Solves the augmented normal equations A*h=g of a LevenbergMarquardt step
+static Eigen::VectorXd solveNormalEquations(const Eigen::MatrixXd& A, const Eigen::VectorXd& g)
+{
+    return A.fullPivLu().solve(g);
+}
+
+static Eigen::VectorXd solveNormalEquations(const Eigen::SparseMatrix<double>& A,
+                                            const Eigen::VectorXd& g)
+{
+    // A = J^T J + mu I is symmetric positive definite for mu > 0
+    Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>> ldlt(A);
+    if (ldlt.info() != Eigen::Success) {
+        // rejected by the caller's residual check, which then increases the damping
+        return Eigen::VectorXd::Zero(g.size());
+    }
+    return ldlt.solve(g);
+}
+
+// Gauss-Newton step of the DogLeg solver, i.e. a solution of Jx*h=-fx
+static Eigen::VectorXd
+gaussNewtonStep(const Eigen::MatrixXd& Jx, const Eigen::VectorXd& fx, DogLegGaussStep type)
+{
+    // https://forum.freecad.org/viewtopic.php?f=10&t=12769&start=50#p106220
+    // https://forum.kde.org/viewtopic.php?f=74&t=129439#p346104
+    switch (type) {
+        case FullPivLU:
+            return Jx.fullPivLu().solve(-fx);
+        case LeastNormFullPivLU:
+            return Jx.adjoint() * (Jx * Jx.adjoint()).fullPivLu().solve(-fx);
+        case LeastNormLdlt:
+            return Jx.adjoint() * (Jx * Jx.adjoint()).ldlt().solve(-fx);
+    }
+    return Eigen::VectorXd::Zero(Jx.cols());
+}
+
+// Rank revealing solution of A*x=b, used where the dense path uses FullPivLU
+static Eigen::VectorXd solveSparseQR(const Eigen::SparseMatrix<double>& A,
+                                     const Eigen::VectorXd& b)
+{
+    Eigen::SparseQR<Eigen::SparseMatrix<double>, Eigen::COLAMDOrdering<int>> qr(A);
+    if (qr.info() != Eigen::Success) {
+        return Eigen::VectorXd::Zero(A.cols());
+    }
+    return qr.solve(b);
+}
+
+static Eigen::VectorXd gaussNewtonStep(const Eigen::SparseMatrix<double>& Jx,
+                                       const Eigen::VectorXd& fx,
+                                       DogLegGaussStep type)
+{
+    // Jx Jx^T has one row per constraint and is about as sparse as Jx itself
+    switch (type) {
+        case FullPivLU:
+            return solveSparseQR(Jx, -fx);
+        case LeastNormFullPivLU: {
+            Eigen::SparseMatrix<double> JJt = Jx * Jx.transpose();
+            return Jx.transpose() * solveSparseQR(JJt, -fx);
+        }
+        case LeastNormLdlt: {
+            Eigen::SparseMatrix<double> JJt = Jx * Jx.transpose();
+            Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>> ldlt(JJt);
+            if (ldlt.info() == Eigen::Success) {
+                Eigen::VectorXd y = ldlt.solve(-fx);
+                if (ldlt.info() == Eigen::Success && y.allFinite()) {
+                    return Jx.transpose() * y;
+                }
+            }
+            // rank deficient Jacobian, e.g. from conflicting constraints
+            return Jx.transpose() * solveSparseQR(JJt, -fx);
+        }
+    }
+    return Eigen::VectorXd::Zero(Jx.cols());
+}
+
 int System::solve_LM(SubSystem* subsys, bool isRedundantsolving)
+{
+    ZoneScoped;
+    if (jacobianStorage == SparseJacobian) {
+        return solve_LM_impl<Eigen::SparseMatrix<double>>(subsys, isRedundantsolving);
+    }
+    return solve_LM_impl<Eigen::MatrixXd>(subsys, isRedundantsolving);
+}
+
+template<typename JacobianType>
+int System::solve_LM_impl(SubSystem* subsys, bool isRedundantsolving)
 {
 #ifdef _GCS_EXTRACT_SOLVER_SUBSYSTEM_
     extractSubsystem(subsys, isRedundantsolving);
@@ -2170,8 +2334,8 @@ int System::solve_LM(SubSystem* subsys, bool isRedundantsolving)
 
     Eigen::VectorXd e(csize),
         e_new(csize);  // vector of all function errors (every constraint is one function)
-    Eigen::MatrixXd J(csize, xsize);  // Jacobi of the subsystem
-    Eigen::MatrixXd A(xsize, xsize);
+    JacobianType J(csize, xsize);  // Jacobi of the subsystem
+    JacobianType A(xsize, xsize);
     Eigen::VectorXd x(xsize), h(xsize), x_new(xsize), g(xsize), diag_A(xsize);
 
     subsys->redirectParams();
@@ -2249,11 +2413,11 @@ int System::solve_LM(SubSystem* subsys, bool isRedundantsolving)
         while (k < 50) {
             // augment normal equations A = A+uI
             for (int i = 0; i < xsize; ++i) {
-                A(i, i) += mu;
+                A.coeffRef(i, i) += mu;
             }
 
             // solve augmented functions A*h=-g
-            h = A.fullPivLu().solve(g);
+            h = solveNormalEquations(A, g);
             double rel_error = (A * h - g).norm() / g.norm();
 
             // check if solving works
@@ -2305,7 +2469,7 @@ int System::solve_LM(SubSystem* subsys, bool isRedundantsolving)
             mu *= nu;
             nu *= 2.0;
             for (int i = 0; i < xsize; ++i) {  // restore diagonal J^T J entries
-                A(i, i) = diag_A(i);
+                A.coeffRef(i, i) = diag_A(i);
             }
 
             k++;
@@ -2336,6 +2500,16 @@ int System::solve_LM(SubSystem* subsys, bool isRedundantsolving)
 }
 
 int System::solve_DL(SubSystem* subsys, bool isRedundantsolving)
+{
+    ZoneScoped;
+    if (jacobianStorage == SparseJacobian) {
+        return solve_DL_impl<Eigen::SparseMatrix<double>>(subsys, isRedundantsolving);
+    }
+    return solve_DL_impl<Eigen::MatrixXd>(subsys, isRedundantsolving);
+}
+
+template<typename JacobianType>
+int System::solve_DL_impl(SubSystem* subsys, bool isRedundantsolving)
 {
 #ifdef _GCS_EXTRACT_SOLVER_SUBSYSTEM_
     extractSubsystem(subsys, isRedundantsolving);
@@ -2371,6 +2545,7 @@ int System::solve_DL(SubSystem* subsys, bool isRedundantsolving)
                        ? "FullPivLU"
                        : (dogLegGaussStep == LeastNormFullPivLU ? "LeastNormFullPivLU"
                                                                 : "LeastNormLdlt"))
+               << ", jacobian: " << (jacobianStorage == SparseJacobian ? "sparse" : "dense")
                << ", xsize: " << xsize << ", csize: " << csize << ", maxIter: " << maxIterNumber
                << "\n";
 
@@ -2380,7 +2555,7 @@ int System::solve_DL(SubSystem* subsys, bool isRedundantsolving)
 
     Eigen::VectorXd x(xsize), x_new(xsize);
     Eigen::VectorXd fx(csize), fx_new(csize);
-    Eigen::MatrixXd Jx(csize, xsize), Jx_new(csize, xsize);
+    JacobianType Jx(csize, xsize), Jx_new(csize, xsize);
     Eigen::VectorXd g(xsize), h_sd(xsize), h_gn(xsize), h_dl(xsize);
 
     subsys->redirectParams();
@@ -2432,19 +2607,7 @@ int System::solve_DL(SubSystem* subsys, bool isRedundantsolving)
         h_sd = alpha * g;
 
         // get the gauss-newton step
-        // https://forum.freecad.org/viewtopic.php?f=10&t=12769&start=50#p106220
-        // https://forum.kde.org/viewtopic.php?f=74&t=129439#p346104
-        switch (dogLegGaussStep) {
-            case FullPivLU:
-                h_gn = Jx.fullPivLu().solve(-fx);
-                break;
-            case LeastNormFullPivLU:
-                h_gn = Jx.adjoint() * (Jx * Jx.adjoint()).fullPivLu().solve(-fx);
-                break;
-            case LeastNormLdlt:
-                h_gn = Jx.adjoint() * (Jx * Jx.adjoint()).ldlt().solve(-fx);
-                break;
-        }
+        h_gn = gaussNewtonStep(Jx, fx, dogLegGaussStep);
 
         double rel_error = (Jx * h_gn + fx).norm() / fx.norm();
         if (rel_error > 1e15) {
@@ -4608,6 +4771,7 @@ void System::extractSubsystem(SubSystem* subsys, bool isRedundantsolving)
 // treating the first of them as of higher priority than the second
 int System::solve(SubSystem* subsysA, SubSystem* subsysB, bool /*isFine*/, bool isRedundantsolving)
 {
+    ZoneScoped;
     int xsizeA = subsysA->pSize();
     int xsizeB = subsysB->pSize();
     int csizeA = subsysA->cSize();
@@ -4795,6 +4959,7 @@ void System::applySolution()
 
 void System::undoSolution()
 {
+    invalidateComponentStates();
     resetToReference();
 }
 
@@ -4845,6 +5010,7 @@ void System::makeReducedJacobian(Eigen::MatrixXd& J,
 
 int System::diagnose(Algorithm alg)
 {
+    ZoneScoped;
     // Analyses the constrainess grad of the system and provides feedback
     // The vector "conflictingTags" will hold a group of conflicting constraints
 
@@ -5735,6 +5901,7 @@ void System::identifyConflictingRedundantConstraints(
 void System::clearSubSystems()
 {
     isInit = false;
+    componentStates.clear();
     deleteAllContent(subSystems);
     deleteAllContent(subSystemsAux);
     subSystems.clear();
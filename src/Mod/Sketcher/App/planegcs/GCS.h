@@ -78,6 +78,13 @@ enum QRAlgorithm
     EigenSparseQR = 1
 };
 
+// Storage of the Jacobian in the LevenbergMarquardt and DogLeg solvers
+enum JacobianStorage
+{
+    DenseJacobian = 0,
+    SparseJacobian = 1
+};
+
 enum DebugMode
 {
     NoDebug = 0,
@@ -133,6 +140,24 @@ private:
     std::vector<std::vector<Constraint*>> clists;
     std::vector<MAP_pD_pD> reductionmaps;  // for simplification of equality constraints
 
+    // State of a decoupled component at its last successful solution. A component whose
+    // inputs (the non-unknown parameters its constraints read, e.g. datums or the temporary
+    // parameters of a drag) did not change since then keeps the solution stored in its
+    // subsystems and is not solved again.
+    struct ComponentState
+    {
+        VEC_pD inputs;
+        VEC_D inputValues;
+        bool isSolved = false;
+        bool isFine = false;
+        bool isRedundantsolving = false;
+    };
+    std::vector<ComponentState> componentStates;
+    int solvedComponents;  // number of components actually solved by the last solve()
+    bool isComponentSolved(std::size_t cid, bool isFine, bool isRedundantsolving) const;
+    void storeComponentState(std::size_t cid, bool isFine, bool isRedundantsolving);
+    void invalidateComponentStates();
+
     int dofs;
     std::set<Constraint*> redundant;
     VEC_I conflictingTags, redundantTags, partiallyRedundantTags;
@@ -146,6 +171,10 @@ private:
     int solve_BFGS(SubSystem* subsys, bool isFine = true, bool isRedundantsolving = false);
     int solve_LM(SubSystem* subsys, bool isRedundantsolving = false);
     int solve_DL(SubSystem* subsys, bool isRedundantsolving = false);
+    template<typename JacobianType>
+    int solve_LM_impl(SubSystem* subsys, bool isRedundantsolving);
+    template<typename JacobianType>
+    int solve_DL_impl(SubSystem* subsys, bool isRedundantsolving);
 
     void makeReducedJacobian(Eigen::MatrixXd& J,
                              std::map<int, int>& jacobianconstraintmap,
@@ -224,6 +253,7 @@ public:
     double convergenceRedundant;
     QRAlgorithm qrAlgorithm;
     DogLegGaussStep dogLegGaussStep;
+    JacobianStorage jacobianStorage;
     double qrpivotThreshold;
     DebugMode debugMode;
     double LM_eps;
@@ -617,6 +647,10 @@ public:
 
     // Unit testing interface - not intended for use by production code
 protected:
+    int _getNumberOfSolvedComponents() const
+    {
+        return solvedComponents;
+    }
     size_t _getNumberOfConstraints(int tagID = -1)
     {
         if (tagID < 0) {
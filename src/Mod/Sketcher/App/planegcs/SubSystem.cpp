@@ -276,6 +276,23 @@ void SubSystem::calcJacobi(Eigen::MatrixXd& jacobi)
     calcJacobi(plist, jacobi);
 }
 
+void SubSystem::calcJacobi(Eigen::SparseMatrix<double>& jacobi)
+{
+    // only the parameters a constraint depends on can have a non-zero derivative
+    std::vector<Eigen::Triplet<double>> triplets;
+    for (int i = 0; i < csize; i++) {
+        auto it = c2p.find(clist[i]);
+        if (it == c2p.end()) {
+            continue;
+        }
+        for (double* param : it->second) {
+            triplets.emplace_back(i, static_cast<int>(param - pvals.data()), clist[i]->grad(param));
+        }
+    }
+    jacobi.resize(csize, psize);
+    jacobi.setFromTriplets(triplets.begin(), triplets.end());
+}
+
 void SubSystem::calcGrad(VEC_pD& params, Eigen::VectorXd& grad)
 {
     assert(grad.size() == int(params.size()));
@@ -103,7 +103,7 @@ void PropertyVisualLayerList::Paste(const Property& from)
     setValues(dynamic_cast<const PropertyVisualLayerList&>(from)._lValueList);
 }
 
-unsigned int PropertyVisualLayerList::getMemSize() const
+std::size_t PropertyVisualLayerList::getMemSize() const
 {
-    return static_cast<unsigned int>(_lValueList.size() * sizeof(VisualLayer));
+    return _lValueList.size() * sizeof(VisualLayer);
 }
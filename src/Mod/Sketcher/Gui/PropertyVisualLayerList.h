@@ -64,7 +64,7 @@ public:
 
     Property* Copy() const override;
     void Paste(const Property& from) override;
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
 
 protected:
     VisualLayer getPyValue(PyObject*) const override;
@@ -49,6 +49,7 @@
 #define DEFAULT_SOLVER_DEBUG 1    // None=0, Minimal=1, IterationLevel=2
 #define MAX_ITER_MULTIPLIER false
 #define DEFAULT_DOGLEG_GAUSS_STEP 0  // FullPivLU = 0, LeastNormFullPivLU = 1, LeastNormLdlt = 2
+#define DEFAULT_JACOBIAN 0           // Dense = 0, Sparse = 1
 
 using namespace SketcherGui;
 using namespace Gui::TaskView;
@@ -70,6 +71,7 @@ TaskSketcherSolverAdvanced::TaskSketcherSolverAdvanced(ViewProviderSketch* sketc
 
     ui->comboBoxDefaultSolver->onRestore();
     ui->comboBoxDogLegGaussStep->onRestore();
+    ui->comboBoxJacobian->onRestore();
     ui->spinBoxMaxIter->onRestore();
     ui->checkBoxSketchSizeMultiplier->onRestore();
     ui->lineEditConvergence->onRestore();
@@ -97,6 +99,10 @@ void TaskSketcherSolverAdvanced::setupConnections()
             qOverload<int>(&QComboBox::currentIndexChanged),
             this,
             &TaskSketcherSolverAdvanced::onComboBoxDogLegGaussStepCurrentIndexChanged);
+    connect(ui->comboBoxJacobian,
+            qOverload<int>(&QComboBox::currentIndexChanged),
+            this,
+            &TaskSketcherSolverAdvanced::onComboBoxJacobianCurrentIndexChanged);
     connect(ui->spinBoxMaxIter,
             qOverload<int>(&QSpinBox::valueChanged),
             this,
@@ -550,6 +556,13 @@ void TaskSketcherSolverAdvanced::onComboBoxDogLegGaussStepCurrentIndexChanged(in
     updateDefaultMethodParameters();
 }
 
+void TaskSketcherSolverAdvanced::onComboBoxJacobianCurrentIndexChanged(int index)
+{
+    ui->comboBoxJacobian->onSave();
+    const_cast<Sketcher::Sketch&>(sketchView->getSketchObject()->getSolvedSketch())
+        .setJacobianStorage((GCS::JacobianStorage)index);
+}
+
 void TaskSketcherSolverAdvanced::onSpinBoxMaxIterValueChanged(int i)
 {
     ui->spinBoxMaxIter->onSave();
@@ -685,6 +698,7 @@ void TaskSketcherSolverAdvanced::onPushButtonDefaultsClicked(bool checked /* = f
     // Set other settings
     hGrp->SetInt("DefaultSolver", DEFAULT_SOLVER);
     hGrp->SetInt("DogLegGaussStep", DEFAULT_DOGLEG_GAUSS_STEP);
+    hGrp->SetInt("Jacobian", DEFAULT_JACOBIAN);
 
     hGrp->SetInt("RedundantDefaultSolver", DEFAULT_RSOLVER);
     hGrp->SetInt("MaxIter", MAX_ITER);
@@ -699,6 +713,7 @@ void TaskSketcherSolverAdvanced::onPushButtonDefaultsClicked(bool checked /* = f
 
     ui->comboBoxDefaultSolver->onRestore();
     ui->comboBoxDogLegGaussStep->onRestore();
+    ui->comboBoxJacobian->onRestore();
     ui->spinBoxMaxIter->onRestore();
     ui->checkBoxSketchSizeMultiplier->onRestore();
     ui->lineEditConvergence->onRestore();
@@ -740,6 +755,8 @@ void TaskSketcherSolverAdvanced::updateSketchObject()
         static_cast<GCS::Algorithm>(ui->comboBoxDefaultSolver->currentIndex());
     const_cast<Sketcher::Sketch&>(sketchView->getSketchObject()->getSolvedSketch())
         .setDogLegGaussStep((GCS::DogLegGaussStep)ui->comboBoxDogLegGaussStep->currentIndex());
+    const_cast<Sketcher::Sketch&>(sketchView->getSketchObject()->getSolvedSketch())
+        .setJacobianStorage((GCS::JacobianStorage)ui->comboBoxJacobian->currentIndex());
 
     updateDefaultMethodParameters();
     updateRedundantMethodParameters();
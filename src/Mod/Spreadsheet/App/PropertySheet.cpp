@@ -1221,7 +1221,7 @@ void PropertySheet::removeColumns(int col, int count)
     signaller.tryInvoke();
 }
 
-unsigned int PropertySheet::getMemSize() const
+std::size_t PropertySheet::getMemSize() const
 {
     return sizeof(*this);
 }
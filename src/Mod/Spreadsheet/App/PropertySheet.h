@@ -181,7 +181,7 @@ public:
 
     void removeColumns(int col, int count);
 
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
 
     bool mergeCells(App::CellAddress from, App::CellAddress to);
 
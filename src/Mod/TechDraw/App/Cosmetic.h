@@ -67,7 +67,7 @@ public:
     void dump(const char* title) const;
 
     // Persistence implementer ---------------------
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     void Save(Base::Writer &/*writer*/) const override;
     void Restore(Base::XMLReader &/*reader*/) override;
 
@@ -100,7 +100,7 @@ public:
     ~GeomFormat() override;
 
     // Persistence implementer ---------------------
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     void Save(Base::Writer &/*writer*/) const override;
     void Restore(Base::XMLReader &/*reader*/) override;
 
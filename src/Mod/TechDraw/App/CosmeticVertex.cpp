@@ -110,7 +110,7 @@ std::string CosmeticVertex::toString() const
 }
 
 // Persistence implementers
-unsigned int CosmeticVertex::getMemSize () const
+std::size_t CosmeticVertex::getMemSize () const
 {
     return 1;
 }
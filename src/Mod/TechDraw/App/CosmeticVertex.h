@@ -62,7 +62,7 @@ public:
     static bool restoreCosmetic();
 
     // Persistence implementer ---------------------
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     void Save(Base::Writer &/*writer*/) const override;
     void Restore(Base::XMLReader &/*reader*/) override;
 
@@ -115,6 +115,7 @@
 #include <Base/FileInfo.h>
 #include <Base/Interpreter.h>
 #include <Base/Parameter.h>
+#include <Base/Profiler.h>
 #include <Base/Tools.h>
 
 #include <Mod/Part/App/PartFeature.h>
@@ -326,6 +327,7 @@ void DrawComplexSection::onSectionCutFinished()
 //for Aligned strategy, cut the rawShape by each segment of the tool
 void DrawComplexSection::makeAlignedPieces(const TopoDS_Shape& rawShape)
 {
+    ZoneScoped;
     if (!canBuild(getSectionCS(), CuttingToolWireObject.getValue())) {
         throw Base::RuntimeError("Profile is parallel to Section Normal");
     }
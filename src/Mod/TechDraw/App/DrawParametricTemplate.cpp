@@ -59,7 +59,7 @@ PyObject *DrawParametricTemplate::getPyObject()
     return Py::new_reference_to(PythonObject);
 }
 
-unsigned int DrawParametricTemplate::getMemSize() const
+std::size_t DrawParametricTemplate::getMemSize() const
 {
     return 0;
 }
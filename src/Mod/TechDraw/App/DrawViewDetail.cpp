@@ -53,6 +53,7 @@
 #include <App/Document.h>
 #include <Base/Console.h>
 #include <Base/Parameter.h>
+#include <Base/Profiler.h>
 
 #include "DrawComplexSection.h"
 #include "DrawUtil.h"
@@ -216,6 +217,7 @@ void DrawViewDetail::detailExec(TopoDS_Shape& shape, DrawViewPart* dvp, DrawView
 //the matting style)
 void DrawViewDetail::makeDetailShape(const TopoDS_Shape& shape3d, DrawViewPart* dvp, DrawViewSection* dvs)
 {
+    ZoneScoped;
     showProgressMessage(getNameInDocument(), "is making detail shape");
 
     Base::Vector3d dirDetail = dvp->Direction.getValue();
@@ -71,6 +71,7 @@
 #include <Base/Converter.h>
 #include <Base/Exception.h>
 #include <Base/Parameter.h>
+#include <Base/Profiler.h>
 #include <Base/Tools.h>
 
 #include "Cosmetic.h"
@@ -500,6 +501,7 @@ void DrawViewPart::postFaceExtractionTasks()
 //! make faces from the edge geometry
 void DrawViewPart::extractFaces()
 {
+    ZoneScoped;
     if (!geometryObject) {
         //geometry is in flux, can not make faces right now
         return;
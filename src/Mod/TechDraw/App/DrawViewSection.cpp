@@ -81,6 +81,7 @@
 #include <Base/Converter.h>
 #include <Base/FileInfo.h>
 #include <Base/Parameter.h>
+#include <Base/Profiler.h>
 #include <Base/Tools.h>
 
 #include <Mod/Part/App/PartFeature.h>
@@ -503,6 +504,7 @@ void DrawViewSection::sectionExec(TopoDS_Shape& baseShape)
 
 void DrawViewSection::makeSectionCut(const TopoDS_Shape& baseShape)
 {
+    ZoneScoped;
     showProgressMessage(getNameInDocument(), "is making section cut");
 
     // We need to copy the shape to not modify the BRepstructure
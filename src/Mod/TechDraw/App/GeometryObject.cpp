@@ -66,6 +66,7 @@
 #include <chrono>
 
 #include <Base/Console.h>
+#include <Base/Profiler.h>
 #include <Mod/Part/App/PartFeature.h>
 
 #include "Cosmetic.h"
@@ -142,6 +143,7 @@ void GeometryObject::clear()
 
 void GeometryObject::projectShape(const TopoDS_Shape& inShape, const gp_Ax2& viewAxis)
 {
+    ZoneScoped;
     clear();
 
     Handle(HLRBRep_Algo) brep_hlr;
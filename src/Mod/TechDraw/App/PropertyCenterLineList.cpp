@@ -193,9 +193,9 @@ void PropertyCenterLineList::Paste(const Property &from)
     setValues(FromList._lValueList);
 }
 
-unsigned int PropertyCenterLineList::getMemSize() const
+std::size_t PropertyCenterLineList::getMemSize() const
 {
-    int size = sizeof(PropertyCenterLineList);
+    std::size_t size = sizeof(PropertyCenterLineList);
     for (int i = 0; i < getSize(); i++)
         size += _lValueList[i]->getMemSize();
     return size;
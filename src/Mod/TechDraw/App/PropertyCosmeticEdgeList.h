@@ -81,7 +81,7 @@ public:
     App::Property *Copy() const override;
     void Paste(const App::Property &from) override;
 
-    unsigned int getMemSize(void) const override;
+    std::size_t getMemSize(void) const override;
 
 private:
     std::vector<CosmeticEdge*> _lValueList;
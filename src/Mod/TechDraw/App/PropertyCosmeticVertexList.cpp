@@ -195,9 +195,9 @@ void PropertyCosmeticVertexList::Paste(const Property &from)
     setValues(FromList._lValueList);
 }
 
-unsigned int PropertyCosmeticVertexList::getMemSize() const
+std::size_t PropertyCosmeticVertexList::getMemSize() const
 {
-    int size = sizeof(PropertyCosmeticVertexList);
+    std::size_t size = sizeof(PropertyCosmeticVertexList);
     for (int i = 0; i < getSize(); i++)
         size += _lValueList[i]->getMemSize();
     return size;
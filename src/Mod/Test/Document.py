@@ -171,6 +171,9 @@ class DocumentBasicCases(unittest.TestCase):
         self.Doc.Objects
         self.Doc.UndoMode
         self.Doc.UndoRedoMemSize
+        self.Doc.UndoLimit
+        self.Doc.UndoMemSizes
+        self.Doc.RedoMemSizes
         self.Doc.UndoCount
         # test read only mechanismus
         try:
@@ -1929,6 +1932,11 @@ class DocumentObserverCases(unittest.TestCase):
             self.parameter.append(obj)
             self.parameter2.append(prop)
 
+        def slotChangedObjects(self, doc, changes):
+            self.signal.append("ObjsChanged")
+            self.parameter.append(doc)
+            self.parameter2.append(changes)
+
         def slotRecomputedObject(self, obj):
             self.signal.append("ObjRecomputed")
             self.parameter.append(obj)
@@ -2237,6 +2245,36 @@ class DocumentObserverCases(unittest.TestCase):
         FreeCAD.closeDocument(self.Doc1.Name)
         self.Obs.clear()
 
+    def testChangeBatch(self):
+        self.Doc1 = FreeCAD.newDocument("Observer1")
+        obj = self.Doc1.addObject("App::FeatureTest", "obj")
+        self.Obs.clear()
+
+        with self.Doc1.changeBatch():
+            for i in range(10):
+                obj.Integer = i
+                obj.Float = i
+            self.assertNotIn("ObjChanged", self.Obs.signal)
+            self.assertNotIn("ObjsChanged", self.Obs.signal)
+
+        signals = [s for s in self.Obs.signal if s != "ObjBeforeChange"]
+        self.assertEqual(signals, ["ObjsChanged", "ObjChanged", "ObjChanged"])
+        index = self.Obs.signal.index("ObjsChanged")
+        self.assertIs(self.Obs.parameter[index], self.Doc1)
+        changes = [(o.Name, p) for o, p in self.Obs.parameter2[-3]]
+        self.assertEqual(changes, [("obj", "Integer"), ("obj", "Float")])
+
+        # leaving the batch through an exception still delivers the changes
+        self.Obs.clear()
+        with self.assertRaises(ValueError):
+            with self.Doc1.changeBatch():
+                obj.Integer = 20
+                raise ValueError("abort")
+        self.assertIn("ObjsChanged", self.Obs.signal)
+
+        FreeCAD.closeDocument(self.Doc1.Name)
+        self.Obs.clear()
+
     def testUndoDisabledDocument(self):
 
         # testing document level signals
@@ -0,0 +1,105 @@
+# SPDX-License-Identifier: LGPL-2.1-or-later
+"""**************************************************************************
+*                                                                          *
+*   This file is part of FreeCAD.                                          *
+*                                                                          *
+*   FreeCAD is free software: you can redistribute it and/or modify it     *
+*   under the terms of the GNU Lesser General Public License as            *
+*   published by the Free Software Foundation, either version 2.1 of the   *
+*   License, or (at your option) any later version.                        *
+*                                                                          *
+*   FreeCAD is distributed in the hope that it will be useful, but         *
+*   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+*   Lesser General Public License for more details.                        *
+*                                                                          *
+*   You should have received a copy of the GNU Lesser General Public       *
+*   License along with FreeCAD. If not, see                                *
+*   <https://www.gnu.org/licenses/>.                                       *
+*                                                                          *
+***************************************************************************/"""
+
+import FreeCAD, FreeCADGui, unittest
+
+# ---------------------------------------------------------------------------
+# define the functions to test the selection notifications
+# ---------------------------------------------------------------------------
+
+
+class SelectionRecorder:
+    """Selection observer that only records the messages it is interested in"""
+
+    def __init__(self):
+        self.added = []
+        self.removed = []
+        self.set = []
+
+    def addSelection(self, doc, obj, sub, pnt):
+        self.added.append(sub)
+
+    def removeSelection(self, doc, obj, sub):
+        self.removed.append(sub)
+
+    def setSelection(self, doc):
+        self.set.append(doc)
+
+
+class TestGuiSelection(unittest.TestCase):
+    def setUp(self):
+        self.doc = FreeCAD.newDocument("TestSelection")
+        self.box = self.doc.addObject("Part::Box", "Box")
+        self.doc.recompute()
+        FreeCADGui.Selection.clearSelection()
+        self.observer = SelectionRecorder()
+        FreeCADGui.Selection.addObserver(self.observer)
+
+    def tearDown(self):
+        FreeCADGui.Selection.removeObserver(self.observer)
+        FreeCADGui.Selection.clearSelection()
+        FreeCAD.closeDocument("TestSelection")
+
+    def testAddSelectionListNotifiesEachElement(self):
+        FreeCADGui.Selection.addSelection(self.box, ["Face1", "Face2", "Edge1"])
+
+        self.assertEqual(self.observer.added, ["Face1", "Face2", "Edge1"])
+        self.assertEqual(self.observer.set, [])
+        sel = FreeCADGui.Selection.getSelectionEx("TestSelection")
+        self.assertEqual(len(sel), 1)
+        self.assertEqual(sel[0].SubElementNames, ("Face1", "Face2", "Edge1"))
+
+    def testRemoveSelectionListNotifiesEachElement(self):
+        FreeCADGui.Selection.addSelection(self.box, ["Face1", "Face2", "Edge1"])
+        FreeCADGui.Selection.removeSelection(self.box, ["Face2", "Edge1"])
+
+        self.assertEqual(self.observer.removed, ["Face2", "Edge1"])
+        self.assertEqual(self.observer.set, [])
+        self.assertTrue(FreeCADGui.Selection.isSelected(self.box, "Face1"))
+        self.assertFalse(FreeCADGui.Selection.isSelected(self.box, "Face2"))
+        self.assertFalse(FreeCADGui.Selection.isSelected(self.box, "Edge1"))
+
+    def testSingleAddSelection(self):
+        FreeCADGui.Selection.addSelection(self.box, "Face3")
+        FreeCADGui.Selection.addSelection(self.box, "Face3")
+
+        # selecting an element twice notifies only once
+        self.assertEqual(self.observer.added, ["Face3"])
+        self.assertTrue(FreeCADGui.Selection.isSelected(self.box, "Face3"))
+
+    def testAddSelectionBatchNotifiesOnce(self):
+        FreeCADGui.Selection.addSelectionBatch(self.box, ["Face1", "Face2", "Edge1"])
+
+        self.assertEqual(self.observer.added, [])
+        self.assertEqual(self.observer.set, ["TestSelection"])
+        sel = FreeCADGui.Selection.getSelectionEx("TestSelection")
+        self.assertEqual(len(sel), 1)
+        self.assertEqual(sel[0].SubElementNames, ("Face1", "Face2", "Edge1"))
+
+    def testRemoveSelectionBatchNotifiesOnce(self):
+        FreeCADGui.Selection.addSelection(self.box, ["Face1", "Face2", "Edge1"])
+        FreeCADGui.Selection.removeSelectionBatch(self.box, ["Face2", "Edge1"])
+
+        self.assertEqual(self.observer.removed, [])
+        self.assertEqual(self.observer.set, ["TestSelection"])
+        self.assertTrue(FreeCADGui.Selection.isSelected(self.box, "Face1"))
+        self.assertFalse(FreeCADGui.Selection.isSelected(self.box, "Face2"))
+        self.assertFalse(FreeCADGui.Selection.isSelected(self.box, "Edge1"))
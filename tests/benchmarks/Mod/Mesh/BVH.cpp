@@ -0,0 +1,67 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <vector>
+#include <Mod/Mesh/App/Core/Algorithm.h>
+#include <Mod/Mesh/App/Core/BVH.h>
+#include <Mod/Mesh/App/Core/Grid.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+
+#include "src/Mod/Mesh/App/MeshTestHelpers.h"
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+using MeshTestHelpers::createRays;
+using MeshTestHelpers::createUnevenMesh;
+
+// Compares the rays per second of the grid and the hierarchy on a mesh with uneven density
+TEST(MeshFacetBVHBenchmark, rays)
+{
+    using Clock = std::chrono::steady_clock;
+    MeshCore::MeshKernel kernel = createUnevenMesh(100, 700);
+    std::vector<MeshCore::MeshFacetBVH::Ray> rays = createRays(100000);
+    auto raysPerSecond = [&rays](Clock::time_point start) {
+        std::chrono::duration<double> time = Clock::now() - start;
+        return std::to_string(double(rays.size()) / time.count());
+    };
+
+    // a grid length derived from the average edge length would need far too many cells here
+    MeshCore::MeshAlgorithm alg(kernel);
+    auto start = Clock::now();
+    MeshCore::MeshFacetGrid grid(kernel);
+    std::chrono::duration<double> gridBuild = Clock::now() - start;
+    start = Clock::now();
+    std::size_t gridHits = 0;
+    for (const auto& ray : rays) {
+        Base::Vector3f res;
+        MeshCore::FacetIndex index {};
+        gridHits += alg.NearestFacetOnRay(ray.point, ray.dir, grid, res, index) ? 1 : 0;
+    }
+    std::string gridRate = raysPerSecond(start);
+
+    start = Clock::now();
+    MeshCore::MeshFacetBVH bvh(kernel);
+    std::chrono::duration<double> bvhBuild = Clock::now() - start;
+    start = Clock::now();
+    std::size_t bvhHits = 0;
+    for (const auto& ray : rays) {
+        Base::Vector3f res;
+        MeshCore::FacetIndex index {};
+        bvhHits += bvh.NearestFacetOnRay(ray.point, ray.dir, res, index) ? 1 : 0;
+    }
+    std::string bvhRate = raysPerSecond(start);
+
+    start = Clock::now();
+    std::vector<MeshCore::MeshFacetBVH::RayHit> hits = bvh.NearestFacetsOnRays(rays, 1);
+    std::string packetRate = raysPerSecond(start);
+
+    RecordProperty("Facets", std::to_string(kernel.CountFacets()));
+    RecordProperty("GridBuildSeconds", std::to_string(gridBuild.count()));
+    RecordProperty("BVHBuildSeconds", std::to_string(bvhBuild.count()));
+    RecordProperty("GridRaysPerSecond", gridRate);
+    RecordProperty("BVHRaysPerSecond", bvhRate);
+    RecordProperty("BVHPacketRaysPerSecond", packetRate);
+    EXPECT_EQ(gridHits, bvhHits);
+    EXPECT_EQ(hits.size(), rays.size());
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
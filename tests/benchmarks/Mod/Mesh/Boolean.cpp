@@ -0,0 +1,56 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <vector>
+#include <Mod/Mesh/App/Core/Boolean.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+#include <Mod/Mesh/App/Core/SetOperations.h>
+
+#include "src/Mod/Mesh/App/MeshTestHelpers.h"
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+using MeshTestHelpers::createSphere;
+
+// Compares the throughput and the robustness of the exact engine with SetOperations on a
+// corpus of sphere pairs that get closer to a degenerate configuration
+TEST(MeshBooleanBenchmark, corpus)
+{
+    std::vector<std::pair<MeshCore::MeshKernel, MeshCore::MeshKernel>> corpus;
+    for (float shift : {0.5F, 0.1F, 1e-3F, 1e-5F, 0.0F}) {
+        corpus.emplace_back(createSphere(Base::Vector3f(0, 0, 0), 1.0F, 100),
+                            createSphere(Base::Vector3f(shift, shift, 0), 1.0F, 100));
+    }
+
+    double classicTime = 0.0;
+    double exactTime = 0.0;
+    int classicOpen = 0;
+    int exactOpen = 0;
+    std::size_t exactFailed = 0;
+    for (const auto& it : corpus) {
+        MeshCore::MeshKernel result;
+        auto start = std::chrono::steady_clock::now();
+        MeshCore::SetOperations(it.first, it.second, result, MeshCore::SetOperations::Union, 1e-5F)
+            .Do();
+        classicTime +=
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        classicOpen += result.HasOpenEdges() ? 1 : 0;
+
+        result.Clear();
+        start = std::chrono::steady_clock::now();
+        MeshCore::MeshBoolean op(it.first, it.second, result, MeshCore::SetOperations::Union);
+        op.Do();
+        exactTime +=
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        exactOpen += result.HasOpenEdges() ? 1 : 0;
+        exactFailed += op.CountFailedFacets();
+    }
+
+    RecordProperty("Cases", std::to_string(corpus.size()));
+    RecordProperty("ClassicSeconds", std::to_string(classicTime));
+    RecordProperty("ClassicOpenResults", std::to_string(classicOpen));
+    RecordProperty("ExactSeconds", std::to_string(exactTime));
+    RecordProperty("ExactOpenResults", std::to_string(exactOpen));
+    RecordProperty("ExactFailedFacets", std::to_string(exactFailed));
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -0,0 +1,53 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <set>
+#include <Mod/Mesh/App/Core/Grid.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+
+#include "src/Mod/Mesh/App/MeshTestHelpers.h"
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+using MeshTestHelpers::createHeightField;
+
+// Compares the flat grid with the former layout of one std::set per cell
+TEST(MeshGridBenchmark, build)
+{
+    MeshCore::MeshKernel kernel = createHeightField(1000);
+
+    auto start = std::chrono::steady_clock::now();
+    MeshCore::MeshFacetGrid grid(kernel, MESH_CT_GRID_PER_AXIS * 2);
+    auto flatTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - start);
+
+    unsigned long ulX {}, ulY {}, ulZ {};
+    grid.GetCtGrids(ulX, ulY, ulZ);
+    start = std::chrono::steady_clock::now();
+    std::vector<std::vector<std::vector<std::set<MeshCore::ElementIndex>>>> sets(
+        ulX,
+        std::vector<std::vector<std::set<MeshCore::ElementIndex>>>(
+            ulY,
+            std::vector<std::set<MeshCore::ElementIndex>>(ulZ)));
+    MeshCore::MeshGridIterator it(grid);
+    std::vector<MeshCore::ElementIndex> elements;
+    std::size_t entries = 0;
+    for (it.Init(); it.More(); it.Next()) {
+        elements.clear();
+        it.GetElements(elements);
+        it.GetGridPos(ulX, ulY, ulZ);
+        sets[ulX][ulY][ulZ].insert(elements.begin(), elements.end());
+        entries += elements.size();
+    }
+    auto setTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - start);
+
+    // a red-black tree node holds three pointers, the color and the value
+    std::size_t setMemory = entries * (4 * sizeof(void*) + sizeof(MeshCore::ElementIndex));
+
+    RecordProperty("Facets", std::to_string(kernel.CountFacets()));
+    RecordProperty("FlatBuildSeconds", std::to_string(flatTime.count()));
+    RecordProperty("SetInsertSeconds", std::to_string(setTime.count()));
+    RecordProperty("FlatBytes", std::to_string(grid.GetMemoryUsage()));
+    RecordProperty("SetBytes", std::to_string(setMemory));
+    EXPECT_LT(grid.GetMemoryUsage(), setMemory);
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
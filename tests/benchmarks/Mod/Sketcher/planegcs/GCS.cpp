@@ -0,0 +1,38 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "src/Mod/Sketcher/App/planegcs/GCSTestHelpers.h"
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+// Solves each large sketch with the dense and the sparse Jacobian. The time of the solver alone
+// is recorded per sketch, algorithm and storage, e.g. Staircase400_DogLeg_SparseMilliseconds.
+TEST(GCSBenchmark, largeSketches)
+{
+    for (const auto& sketch : GCSTestHelpers::largeSketches) {
+        for (auto alg : {GCS::DogLeg, GCS::LevenbergMarquardt}) {
+            for (auto storage : {GCS::DenseJacobian, GCS::SparseJacobian}) {
+                GCS::System system;
+                system.jacobianStorage = storage;
+                std::vector<double> values, dimensions;
+                double origin {};
+                sketch.make(&system, sketch.size, values, dimensions, origin);
+
+                auto start = std::chrono::steady_clock::now();
+                int result = system.solve(true, alg);
+                auto time = std::chrono::duration<double, std::milli>(
+                    std::chrono::steady_clock::now() - start);
+
+                std::string name = GCSTestHelpers::largeSketchName(sketch, alg, storage);
+                RecordProperty(name + "Milliseconds", std::to_string(time.count()));
+                EXPECT_EQ(GCS::Success, result) << name;
+            }
+        }
+    }
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -463,8 +463,8 @@ TEST_F(ComplexGeoDataTest, saveDocFileWithElementMap)
     // Act
     cgd().SaveDocFile(writer);
 
-    // Assert -- must begin a v1 ElementMap
-    EXPECT_TRUE(writer.getString().find("BeginElementMap v1") != std::string::npos);
+    // Assert -- must begin a v2 ElementMap
+    EXPECT_TRUE(writer.getString().find("BeginElementMap v2") != std::string::npos);
 }
 
 TEST_F(ComplexGeoDataTest, restoreStream)
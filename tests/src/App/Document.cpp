@@ -2,9 +2,11 @@
 
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
+#include <thread>
 
 #include "App/Application.h"
 #include "App/Document.h"
+#include "App/FeatureTest.h"
 #include "App/StringHasher.h"
 #include "Base/Writer.h"
 #include <src/App/InitApplication.h>
@@ -54,6 +56,115 @@ private:
 };
 
 
+TEST_F(DocumentTest, undoLimitRemovesOldestTransactions)
+{
+    // Arrange
+    auto feature = doc()->addObject<App::FeatureTest>("Feature");
+    doc()->setUndoMode(1);
+    const std::size_t stepSize = 1000 * sizeof(long);
+    doc()->setUndoLimit(5 * stepSize / 2);
+
+    // Act
+    for (long step = 1; step <= 5; step++) {
+        doc()->openTransaction("Step");
+        feature->IntegerList.setValues(std::vector<long>(1000, step));
+        doc()->commitTransaction();
+    }
+
+    // Assert
+    EXPECT_EQ(doc()->getAvailableUndos(), 2);
+    EXPECT_THAT(doc()->getAvailableUndoMemSizes(), ::testing::ElementsAre(stepSize, stepSize));
+    EXPECT_EQ(doc()->getUndoMemSize(), 2 * stepSize);
+    EXPECT_TRUE(doc()->undo());
+    EXPECT_EQ(feature->IntegerList[0], 4);
+    EXPECT_THAT(doc()->getAvailableRedoMemSizes(), ::testing::ElementsAre(stepSize));
+}
+
+TEST_F(DocumentTest, changeBatchDeliversEachChangeOnce)
+{
+    // Arrange
+    auto feature = doc()->addObject<App::FeatureTest>("Feature");
+    std::vector<std::string> single;
+    std::vector<std::size_t> batches;
+    auto connSingle = doc()->signalChangedObject.connect(
+        [&single](const App::DocumentObject&, const App::Property& prop) {
+            single.emplace_back(prop.getName());
+        });
+    auto connBatch = doc()->signalChangedObjects.connect(
+        [&batches](const App::Document&, const App::Document::PropertyChanges& changes) {
+            batches.push_back(changes.size());
+        });
+
+    // Act
+    {
+        App::DocumentChangeBatch batch(doc());
+        doc()->beginChangeBatch();
+        for (long value = 1; value <= 100; value++) {
+            feature->Integer.setValue(value);
+            feature->Float.setValue(double(value));
+        }
+        doc()->endChangeBatch();
+        EXPECT_TRUE(doc()->isChangeBatchActive());
+        EXPECT_TRUE(single.empty());
+    }
+    feature->Integer.setValue(0);
+    connSingle.disconnect();
+    connBatch.disconnect();
+
+    // Assert
+    EXPECT_FALSE(doc()->isChangeBatchActive());
+    EXPECT_THAT(batches, ::testing::ElementsAre(2));
+    EXPECT_THAT(single, ::testing::ElementsAre("Integer", "Float", "Integer"));
+    EXPECT_EQ(feature->Integer.getValue(), 0);
+}
+
+TEST_F(DocumentTest, changeBatchDropsChangesOfRemovedObject)
+{
+    // Arrange
+    auto feature = doc()->addObject<App::FeatureTest>("Feature");
+    std::vector<const App::DocumentObject*> changed;
+    auto conn = doc()->signalChangedObject.connect(
+        [&changed](const App::DocumentObject& obj, const App::Property&) {
+            changed.push_back(&obj);
+        });
+
+    // Act
+    App::DocumentObject* replacement {};
+    {
+        App::DocumentChangeBatch batch(doc());
+        feature->Integer.setValue(1);
+        doc()->removeObject("Feature");
+        // the name of the removed object is free again
+        replacement = doc()->addObject<App::FeatureTest>("Feature");
+    }
+    conn.disconnect();
+
+    // Assert
+    EXPECT_EQ(std::string(replacement->getNameInDocument()), "Feature");
+    EXPECT_THAT(changed, ::testing::Each(replacement));
+}
+
+TEST_F(DocumentTest, undoStackSizeWithoutMemoryLimitRemovesOnlyOldest)
+{
+    // Arrange
+    auto feature = doc()->addObject<App::FeatureTest>("Feature");
+    doc()->setUndoMode(1);
+    doc()->setUndoLimit(0);
+    doc()->setMaxUndoStackSize(3);
+
+    // Act
+    for (long step = 1; step <= 5; step++) {
+        doc()->openTransaction("Step");
+        feature->Integer.setValue(step);
+        doc()->commitTransaction();
+    }
+
+    // Assert
+    EXPECT_EQ(doc()->getAvailableUndos(), 3);
+    EXPECT_TRUE(doc()->undo());
+    EXPECT_EQ(feature->Integer.getValue(), 4);
+}
+
 TEST_F(DocumentTest, addStringHasherIndicatesUnwrittenWhenNew)
 {
     // Arrange
@@ -94,4 +205,108 @@ TEST_F(DocumentTest, getStringHasherGivesExpectedHasher)
     EXPECT_EQ(hasher, foundHasher);
 }
 
+class ParallelRecomputeTest: public DocumentTest
+{
+protected:
+    void SetUp() override
+    {
+        DocumentTest::SetUp();
+        _hGrp = App::GetApplication().GetParameterGroupByPath(
+            "User parameter:BaseApp/Preferences/Document");
+        _hGrp->SetBool("ParallelRecompute", true);
+        _hGrp->SetInt("RecomputeThreads", 4);
+    }
+
+    void TearDown() override
+    {
+        _hGrp->RemoveBool("ParallelRecompute");
+        _hGrp->RemoveInt("RecomputeThreads");
+        DocumentTest::TearDown();
+    }
+
+    App::FeatureTest* addFeature(const char* name)
+    {
+        return doc()->addObject<App::FeatureTest>(name);
+    }
+
+private:
+    ParameterGrp::handle _hGrp;
+};
+
+TEST_F(ParallelRecomputeTest, recomputesIndependentBranches)
+{
+    // Arrange
+    auto base = addFeature("Base");
+    auto left = addFeature("Left");
+    auto right = addFeature("Right");
+    auto top = addFeature("Top");
+    left->Source1.setValue(base);
+    right->Source1.setValue(base);
+    top->Source1.setValue(left);
+    top->Source2.setValue(right);
+
+    // Act
+    bool hasError = false;
+    int count = doc()->recompute({}, false, &hasError);
+
+    // Assert
+    EXPECT_FALSE(hasError);
+    EXPECT_EQ(count, 4);
+    for (auto obj : {base, left, right, top}) {
+        EXPECT_EQ(obj->ExecCount.getValue(), 1);
+        EXPECT_FALSE(obj->isTouched());
+    }
+}
+
+TEST_F(ParallelRecomputeTest, skipsDependentsOfFailedObject)
+{
+    // Arrange
+    auto failing = doc()->addObject<App::FeatureTestException>("Failing");
+    auto dependent = addFeature("Dependent");
+    auto independent = addFeature("Independent");
+    dependent->Source1.setValue(failing);
+
+    // Act
+    bool hasError = false;
+    doc()->recompute({}, false, &hasError);
+
+    // Assert
+    EXPECT_TRUE(hasError);
+    EXPECT_TRUE(failing->isError());
+    EXPECT_NE(doc()->getErrorDescription(failing), nullptr);
+    EXPECT_EQ(dependent->ExecCount.getValue(), 0);
+    EXPECT_EQ(independent->ExecCount.getValue(), 1);
+}
+
+TEST_F(ParallelRecomputeTest, notifiesChangesInCallingThread)
+{
+    // Arrange
+    auto base = addFeature("Base");
+    auto left = addFeature("Left");
+    auto right = addFeature("Right");
+    left->Source1.setValue(base);
+    right->Source1.setValue(base);
+    std::vector<std::thread::id> threads;
+    std::vector<std::string> changed;
+    auto connection = doc()->signalChangedObject.connect(
+        [&](const App::DocumentObject& obj, const App::Property& prop) {
+            threads.push_back(std::this_thread::get_id());
+            if (&prop == &static_cast<const App::FeatureTest&>(obj).ExecCount) {
+                changed.emplace_back(obj.getNameInDocument());
+            }
+        });
+
+    // Act
+    doc()->recompute();
+    connection.disconnect();
+
+    // Assert
+    EXPECT_THAT(changed, ::testing::UnorderedElementsAre("Base", "Left", "Right"));
+    // the dependencies are notified first
+    EXPECT_EQ(changed.front(), "Base");
+    for (auto id : threads) {
+        EXPECT_EQ(id, std::this_thread::get_id());
+    }
+}
+
 // NOLINTEND(readability-magic-numbers)
@@ -553,4 +553,165 @@ TEST_F(ElementMapTest, addAndGetChildElementsTest)
             return e.indexedName.toString() == "Pong2";
         }));
 }
+TEST_F(ElementMapTest, equalPostfixesShareBuffer)
+{
+    // Arrange
+    Data::ElementMap elementMap;
+    Data::MappedName name1("Edge1");
+    name1 += ";:M;FUS;:H1b:7,E";
+    Data::MappedName name2("Edge2");
+    name2 += ";:M;FUS;:H1b:7,E";
+    ASSERT_NE(name1.postfixBytes().constData(), name2.postfixBytes().constData());
+
+    // Act
+    elementMap.setElementName(Data::IndexedName("Edge", 1), name1, 0);
+    elementMap.setElementName(Data::IndexedName("Edge", 2), name2, 0);
+    auto stored1 = elementMap.find(Data::IndexedName("Edge", 1));
+    auto stored2 = elementMap.find(Data::IndexedName("Edge", 2));
+
+    // Assert
+    EXPECT_EQ(stored1, name1);
+    EXPECT_EQ(stored2, name2);
+    EXPECT_EQ(stored1.postfixBytes().constData(), stored2.postfixBytes().constData());
+    EXPECT_EQ(elementMap.find(name2), Data::IndexedName("Edge", 2));
+}
+
+TEST_F(ElementMapTest, equalPostfixesShareBufferAcrossMaps)
+{
+    // Arrange
+    Data::ElementMap base;
+    Data::ElementMap derived;
+    Data::MappedName name1("Face1");
+    name1 += ";:M;CUT;:H5c:9,F";
+    Data::MappedName name2("Face3");
+    name2 += ";:M;CUT;:H5c:9,F";
+    ASSERT_NE(name1.postfixBytes().constData(), name2.postfixBytes().constData());
+
+    // Act
+    base.setElementName(Data::IndexedName("Face", 1), name1, 0);
+    derived.setElementName(Data::IndexedName("Face", 3), name2, 0);
+    auto stored1 = base.find(Data::IndexedName("Face", 1));
+    auto stored2 = derived.find(Data::IndexedName("Face", 3));
+
+    // Assert
+    EXPECT_EQ(stored2, name2);
+    EXPECT_EQ(stored1.postfixBytes().constData(), stored2.postfixBytes().constData());
+}
+
+TEST_F(ElementMapTest, memoryUsageCountsSharedBuffersOnce)
+{
+    // Arrange
+    Data::ElementMap elementMap;
+    for (int i = 1; i <= 10; ++i) {
+        Data::MappedName name("Face" + std::to_string(i));
+        name += ";:M;CUT;:H2a:9,F";
+        elementMap.setElementName(Data::IndexedName("Face", i), name, 0);
+    }
+
+    // Act
+    auto usage = elementMap.getMemoryUsage();
+
+    // Assert
+    EXPECT_EQ(usage.names, 10);
+    EXPECT_EQ(usage.childMaps, 0);
+    EXPECT_EQ(usage.buffers, 11);  // ten names and one postfix
+    EXPECT_GT(usage.sharedBytes, 9 * std::strlen(";:M;CUT;:H2a:9,F"));
+    EXPECT_GT(usage.indexBytes, 0);
+}
+
+TEST_F(ElementMapTest, memoryUsageVisitsChildMapsOnce)
+{
+    // Arrange
+    LessComplexPart cube(1L, "Box", _hasher);
+    Data::ElementMap parent;
+    std::vector<Data::ElementMap::MappedChildElements> children = {
+        {Data::IndexedName("Face", 1), 6, 0, 2L, cube.elementMapPtr, QByteArray(), {}},
+        {Data::IndexedName("Face", 1), 6, 6, 3L, cube.elementMapPtr, QByteArray(), {}}};
+
+    // Act
+    parent.addChildElements(4L, children);
+    auto usage = parent.getMemoryUsage();
+
+    // Assert
+    EXPECT_EQ(usage.childMaps, 1);
+    EXPECT_EQ(usage.names, cube.elementMapPtr->getMemoryUsage().names);
+    EXPECT_EQ(usage.childElements, 12);
+}
+
+TEST_F(ElementMapTest, findNameSplitDifferently)
+{
+    // Arrange
+    Data::ElementMap elementMap;
+    Data::MappedName name("Face1");
+    name += ";:M;CUT";
+    Data::MappedName sameName("Face1;:M;CUT");
+    elementMap.setElementName(Data::IndexedName("Face", 1), name, 0);
+
+    // Act
+    auto element = elementMap.find(sameName);
+
+    // Assert
+    EXPECT_EQ(element, Data::IndexedName("Face", 1));
+}
+
+TEST_F(ElementMapTest, hashedNameStoredAsID)
+{
+    // Arrange
+    Data::ElementMap elementMap;
+    elementMap.hasher = _hasher;
+    Data::MappedName name("Face1;:M;CUT");
+    Data::ElementIDRefs sids;
+    std::ostringstream ss;
+    elementMap.encodeElementName('F', name, ss, &sids, 1L, nullptr, 2L);
+
+    // Act
+    elementMap.setElementName(Data::IndexedName("Face", 1), name, 1L, &sids);
+    auto usage = elementMap.getMemoryUsage();
+
+    // Assert
+    EXPECT_TRUE(name.startsWith("#"));
+    EXPECT_EQ(elementMap.find(Data::IndexedName("Face", 1)), name);
+    EXPECT_EQ(elementMap.find(name), Data::IndexedName("Face", 1));
+    EXPECT_EQ(usage.buffers, 1);  // only the postfix
+}
+
+TEST_F(ElementMapTest, saveAndRestore)
+{
+    // Arrange
+    Data::ElementMap elementMap;
+    Data::MappedName name1("Face1");
+    name1 += ";:M;CUT;:H2a:9,F";
+    Data::MappedName name2("Edge1;:H1:3,E;:M;CUT");
+    Data::MappedName name3("Edge1;:H1:3,E;:M;CUT");
+    name3 += ";:U;:H2a:9,E";
+    elementMap.setElementName(Data::IndexedName("Face", 1), name1, 0);
+    elementMap.setElementName(Data::IndexedName("Edge", 2), name2, 0);
+    elementMap.setElementName(Data::IndexedName("Edge", 3), name3, 0);
+    std::stringstream stream;
+
+    // Act
+    elementMap.save(stream);
+    auto restored = std::make_shared<Data::ElementMap>()->restore(_hasher, stream);
+
+    // Assert
+    EXPECT_NE(stream.str().find("MapVersion 2"), std::string::npos);
+    EXPECT_EQ(restored->size(), 3);
+    EXPECT_EQ(restored->find(Data::IndexedName("Face", 1)), name1);
+    EXPECT_EQ(restored->find(Data::IndexedName("Edge", 2)), name2);
+    EXPECT_EQ(restored->find(name3), Data::IndexedName("Edge", 3));
+}
+
+TEST_F(ElementMapTest, restoreVersion1)
+{
+    // Arrange
+    std::stringstream stream("1 PostfixCount 2\nEdge\n;SKT\n\nMapCount 1\n\nElementMap 1 1 1\n\n"
+                             "Edge\n\nChildCount 0\n\nNameCount 3\n0\n;g1.2 0\n;g2.2 0\n\nEndMap\n");
+
+    // Act
+    auto restored = std::make_shared<Data::ElementMap>()->restore(_hasher, stream);
+
+    // Assert
+    EXPECT_EQ(restored->size(), 2);
+    EXPECT_EQ(restored->find(Data::IndexedName("Edge", 2)), Data::MappedName("g2;SKT"));
+}
 // NOLINTEND(readability-magic-numbers)
@@ -0,0 +1,89 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <set>
+#include <vector>
+
+#include <Base/FlatGrid.h>
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+namespace
+{
+// Every element is in the cell given by its index, every third element also in cell (0, 0, 0)
+void visitElement(unsigned long index,
+                  const std::function<void(std::size_t, std::size_t, std::size_t)>& add)
+{
+    std::size_t ulX = index % 3;
+    std::size_t ulY = (index / 3) % 4;
+    std::size_t ulZ = (index / 12) % 5;
+    add(ulX, ulY, ulZ);
+    if (index % 3 == 0 && (ulX != 0 || ulY != 0 || ulZ != 0)) {
+        add(0, 0, 0);
+    }
+}
+}  // namespace
+
+TEST(FlatGrid, emptyGrid)
+{
+    Base::FlatGrid<unsigned long> grid;
+    grid.resize(2, 2, 2);
+
+    EXPECT_EQ(grid.countCells(), 8);
+    EXPECT_EQ(grid.countEntries(), 0);
+    EXPECT_TRUE(grid(1, 1, 1).empty());
+}
+
+TEST(FlatGrid, buildMatchesSetPerCell)
+{
+    constexpr std::size_t numElements = 1000;
+    std::vector<std::set<unsigned long>> reference(3 * 4 * 5);
+    for (unsigned long index = 0; index < numElements; ++index) {
+        visitElement(index, [&](std::size_t ulX, std::size_t ulY, std::size_t ulZ) {
+            reference[(ulX * 4 + ulY) * 5 + ulZ].insert(index);
+        });
+    }
+
+    for (int threads : {1, 2, 7}) {
+        Base::FlatGrid<unsigned long> grid;
+        grid.resize(3, 4, 5);
+        grid.build(numElements, visitElement, threads);
+
+        for (std::size_t ulX = 0; ulX < 3; ++ulX) {
+            for (std::size_t ulY = 0; ulY < 4; ++ulY) {
+                for (std::size_t ulZ = 0; ulZ < 5; ++ulZ) {
+                    auto cell = grid(ulX, ulY, ulZ);
+                    const auto& expected = reference[(ulX * 4 + ulY) * 5 + ulZ];
+                    EXPECT_EQ(std::vector<unsigned long>(cell.begin(), cell.end()),
+                              std::vector<unsigned long>(expected.begin(), expected.end()));
+                }
+            }
+        }
+    }
+}
+
+TEST(FlatGrid, rebuildReplacesContent)
+{
+    Base::FlatGrid<unsigned long> grid;
+    grid.resize(3, 4, 5);
+    grid.build(100, visitElement, 1);
+    grid.build(10, visitElement, 1);
+
+    EXPECT_EQ(grid.countEntries(), 10 + 3);
+}
+
+TEST(FlatGrid, clearReleasesMemory)
+{
+    Base::FlatGrid<unsigned long> grid;
+    grid.resize(3, 4, 5);
+    grid.build(100, visitElement, 1);
+    EXPECT_GT(grid.memoryUsage(), 0);
+
+    grid.clear();
+    EXPECT_EQ(grid.countCells(), 0);
+    EXPECT_EQ(grid.memoryUsage(), 0);
+}
+
+// NOLINTEND(readability-magic-numbers)
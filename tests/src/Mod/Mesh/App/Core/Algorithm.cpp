@@ -0,0 +1,203 @@
+#include <gtest/gtest.h>
+#include <set>
+#include <vector>
+#include <Mod/Mesh/App/Core/Algorithm.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+
+#include "src/Mod/Mesh/App/MeshTestHelpers.h"
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+using MeshTestHelpers::createHeightField;
+
+namespace
+{
+// The former layout of the point to facets structure
+std::vector<std::set<MeshCore::FacetIndex>> pointToFacets(const MeshCore::MeshKernel& kernel)
+{
+    std::vector<std::set<MeshCore::FacetIndex>> map(kernel.CountPoints());
+    const MeshCore::MeshFacetArray& facets = kernel.GetFacets();
+    for (MeshCore::FacetIndex index = 0; index < facets.size(); index++) {
+        for (MeshCore::PointIndex ptIndex : facets[index]._aulPoints) {
+            map[ptIndex].insert(index);
+        }
+    }
+    return map;
+}
+
+std::vector<MeshCore::ElementIndex> toVector(const MeshCore::MeshIndexRange& range)
+{
+    return {range.begin(), range.end()};
+}
+
+std::vector<MeshCore::ElementIndex> toVector(const std::set<MeshCore::ElementIndex>& set)
+{
+    return {set.begin(), set.end()};
+}
+}  // namespace
+
+TEST(MeshIndexAdjacencyTest, buildIsSortedAndIndependentOfThreads)
+{
+    // every item is added to three rows, some of them twice
+    constexpr std::size_t numRows = 5000;
+    constexpr std::size_t numItems = 30000;
+    auto visit = [](MeshCore::ElementIndex item, auto&& add) {
+        add((item * 7) % numRows, item);
+        add((item * 13) % numRows, item);
+        add((item * 13) % numRows, item);
+        add(item % numRows, item / 2);
+    };
+
+    std::vector<std::set<MeshCore::ElementIndex>> reference(numRows);
+    for (MeshCore::ElementIndex item = 0; item < numItems; item++) {
+        visit(item, [&reference](MeshCore::ElementIndex row, MeshCore::ElementIndex index) {
+            reference[row].insert(index);
+        });
+    }
+
+    for (int threads : {1, 2, 7}) {
+        MeshCore::MeshIndexAdjacency adjacency;
+        adjacency.build(numRows, numItems, visit, threads);
+        ASSERT_EQ(adjacency.size(), numRows);
+        for (std::size_t row = 0; row < numRows; row++) {
+            EXPECT_EQ(toVector(adjacency[row]), toVector(reference[row]));
+        }
+    }
+}
+
+TEST(MeshIndexAdjacencyTest, insertAndErase)
+{
+    MeshCore::MeshIndexAdjacency adjacency;
+    adjacency.build(3, 4, [](MeshCore::ElementIndex item, auto&& add) {
+        add(item % 3, item);
+    });
+    EXPECT_EQ(toVector(adjacency[0]), (std::vector<MeshCore::ElementIndex> {0, 3}));
+
+    // the full row is moved, the other rows must stay intact
+    adjacency.insert(0, 2);
+    adjacency.insert(0, 5);
+    adjacency.insert(0, 3);
+    adjacency.insert(1, 0);
+    EXPECT_EQ(toVector(adjacency[0]), (std::vector<MeshCore::ElementIndex> {0, 2, 3, 5}));
+    EXPECT_EQ(toVector(adjacency[1]), (std::vector<MeshCore::ElementIndex> {0, 1}));
+    EXPECT_EQ(toVector(adjacency[2]), (std::vector<MeshCore::ElementIndex> {2}));
+
+    adjacency.erase(0, 3);
+    adjacency.erase(0, 4);
+    adjacency.erase(2, 2);
+    EXPECT_EQ(toVector(adjacency[0]), (std::vector<MeshCore::ElementIndex> {0, 2, 5}));
+    EXPECT_TRUE(adjacency[2].empty());
+    EXPECT_EQ(adjacency[0].count(2), 1);
+    EXPECT_EQ(adjacency[0].find(3), adjacency[0].end());
+}
+
+TEST(MeshRefTest, pointToFacets)
+{
+    MeshCore::MeshKernel kernel = createHeightField(30);
+    MeshCore::MeshRefPointToFacets pt2f(kernel);
+    auto reference = pointToFacets(kernel);
+
+    for (MeshCore::PointIndex index = 0; index < kernel.CountPoints(); index++) {
+        EXPECT_EQ(toVector(pt2f[index]), toVector(reference[index]));
+    }
+
+    // the interior point (1, 1) has six facets
+    EXPECT_EQ(pt2f[32].size(), 6);
+    EXPECT_EQ(pt2f.GetIndices(32, 33).size(), 2);
+}
+
+TEST(MeshRefTest, facetToFacets)
+{
+    MeshCore::MeshKernel kernel = createHeightField(30);
+    MeshCore::MeshRefFacetToFacets f2f(kernel);
+    auto reference = pointToFacets(kernel);
+
+    const MeshCore::MeshFacetArray& facets = kernel.GetFacets();
+    for (MeshCore::FacetIndex index = 0; index < facets.size(); index++) {
+        std::set<MeshCore::FacetIndex> expected;
+        for (MeshCore::PointIndex ptIndex : facets[index]._aulPoints) {
+            expected.insert(reference[ptIndex].begin(), reference[ptIndex].end());
+        }
+        EXPECT_EQ(toVector(f2f[index]), toVector(expected));
+    }
+}
+
+TEST(MeshRefTest, pointToPoints)
+{
+    MeshCore::MeshKernel kernel = createHeightField(30);
+    MeshCore::MeshRefPointToPoints pt2p(kernel);
+
+    std::vector<std::set<MeshCore::PointIndex>> reference(kernel.CountPoints());
+    for (const auto& facet : kernel.GetFacets()) {
+        for (int i = 0; i < 3; i++) {
+            reference[facet._aulPoints[i]].insert(facet._aulPoints[(i + 1) % 3]);
+            reference[facet._aulPoints[i]].insert(facet._aulPoints[(i + 2) % 3]);
+        }
+    }
+
+    for (MeshCore::PointIndex index = 0; index < kernel.CountPoints(); index++) {
+        EXPECT_EQ(toVector(pt2p[index]), toVector(reference[index]));
+    }
+}
+
+TEST(MeshRefTest, modifyPointToFacets)
+{
+    MeshCore::MeshKernel kernel = createHeightField(4);
+    MeshCore::MeshRefPointToFacets pt2f(kernel);
+    std::vector<MeshCore::ElementIndex> facets = toVector(pt2f[6]);
+
+    pt2f.RemoveFacet(facets.front());
+    pt2f.AddNeighbour(6, 100);
+    pt2f.AddNeighbour(6, 101);
+    facets.erase(facets.begin());
+    facets.push_back(100);
+    facets.push_back(101);
+    EXPECT_EQ(toVector(pt2f[6]), facets);
+
+    pt2f.RemoveNeighbour(6, 100);
+    EXPECT_EQ(pt2f[6].count(100), 0);
+    EXPECT_EQ(pt2f[6].count(101), 1);
+}
+
+TEST(MeshRefTest, edgeToFacets)
+{
+    MeshCore::MeshKernel kernel = createHeightField(10);
+    MeshCore::MeshRefEdgeToFacets e2f(kernel);
+
+    const MeshCore::MeshFacetArray& facets = kernel.GetFacets();
+    for (MeshCore::FacetIndex index = 0; index < facets.size(); index++) {
+        for (int i = 0; i < 3; i++) {
+            MeshCore::MeshEdge edge(facets[index]._aulPoints[i],
+                                    facets[index]._aulPoints[(i + 1) % 3]);
+            EXPECT_EQ(e2f[edge], std::make_pair(index, MeshCore::FACET_INDEX_MAX));
+        }
+    }
+
+    // the boundary edge between (0, 0) and (0, 1) only exists in the direction of facet 0
+    EXPECT_EQ(e2f[MeshCore::MeshEdge(1, 0)].first, 0);
+    EXPECT_EQ(e2f[MeshCore::MeshEdge(0, 1)],
+              std::make_pair(MeshCore::FACET_INDEX_MAX, MeshCore::FACET_INDEX_MAX));
+}
+
+TEST(MeshRefTest, edgeToFacetsKeepsFirstAndLastFacet)
+{
+    MeshCore::MeshPointArray points;
+    for (int i = 0; i < 5; i++) {
+        points.push_back(MeshCore::MeshPoint(Base::Vector3f(float(i), float(i * i), 0.0F)));
+    }
+    MeshCore::MeshFacetArray facets;
+    facets.push_back(MeshCore::MeshFacet(0, 1, 2));
+    facets.push_back(MeshCore::MeshFacet(0, 1, 3));
+    facets.push_back(MeshCore::MeshFacet(0, 1, 4));
+
+    MeshCore::MeshKernel kernel;
+    kernel.Adopt(points, facets, false);
+    MeshCore::MeshRefEdgeToFacets e2f(kernel);
+
+    EXPECT_EQ(e2f[MeshCore::MeshEdge(0, 1)], std::make_pair(0UL, 2UL));
+    EXPECT_EQ(e2f[MeshCore::MeshEdge(3, 0)], std::make_pair(1UL, MeshCore::FACET_INDEX_MAX));
+    EXPECT_EQ(e2f[MeshCore::MeshEdge(1, 0)].first, MeshCore::FACET_INDEX_MAX);
+    EXPECT_EQ(e2f[MeshCore::MeshEdge(7, 0)].first, MeshCore::FACET_INDEX_MAX);
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -0,0 +1,144 @@
+#include <gtest/gtest.h>
+#include <limits>
+#include <vector>
+#include <Mod/Mesh/App/Core/BVH.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+
+#include "src/Mod/Mesh/App/MeshTestHelpers.h"
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+using MeshTestHelpers::createRays;
+using MeshTestHelpers::createUnevenMesh;
+
+namespace
+{
+// The nearest intersection in ray direction by testing all facets
+bool bruteForce(const MeshCore::MeshKernel& kernel,
+                const MeshCore::MeshFacetBVH::Ray& ray,
+                float& dist)
+{
+    bool found = false;
+    dist = std::numeric_limits<float>::max();
+    for (MeshCore::FacetIndex i = 0; i < kernel.CountFacets(); i++) {
+        Base::Vector3f res;
+        if (kernel.GetFacet(i).Foraminate(ray.point, ray.dir, res)
+            && (res - ray.point) * ray.dir >= 0.0F) {
+            dist = std::min(dist, Base::Distance(res, ray.point));
+            found = true;
+        }
+    }
+    return found;
+}
+}  // namespace
+
+TEST(MeshFacetBVHTest, rayMatchesBruteForce)
+{
+    MeshCore::MeshKernel kernel = createUnevenMesh(10, 20);
+    MeshCore::MeshFacetBVH bvh(kernel);
+    EXPECT_GT(bvh.CountNodes(), 1);
+
+    for (const auto& ray : createRays(200)) {
+        float dist {};
+        ASSERT_TRUE(bruteForce(kernel, ray, dist));
+
+        Base::Vector3f res;
+        MeshCore::FacetIndex index {};
+        ASSERT_TRUE(bvh.NearestFacetOnRay(ray.point, ray.dir, res, index));
+        EXPECT_NEAR(Base::Distance(res, ray.point), dist, 1e-4F);
+        Base::Vector3f onFacet;
+        ASSERT_TRUE(kernel.GetFacet(index).Foraminate(ray.point, ray.dir, onFacet));
+        EXPECT_LT(Base::Distance(res, onFacet), 1e-4F);
+
+        // in opposite direction there is nothing
+        EXPECT_FALSE(bvh.NearestFacetOnRay(ray.point, -ray.dir, res, index));
+    }
+}
+
+TEST(MeshFacetBVHTest, maxAngle)
+{
+    MeshCore::MeshKernel kernel = createUnevenMesh(4, 4);
+    MeshCore::MeshFacetBVH bvh(kernel);
+
+    // the facets point upwards
+    Base::Vector3f res;
+    MeshCore::FacetIndex index {};
+    Base::Vector3f pnt(50.5F, 50.5F, 10.0F);
+    Base::Vector3f dir(0.0F, 0.0F, -1.0F);
+    EXPECT_TRUE(bvh.NearestFacetOnRay(pnt, dir, res, index));
+    EXPECT_TRUE(bvh.NearestFacetOnRay(pnt, dir, 3.0F, res, index));
+    EXPECT_FALSE(bvh.NearestFacetOnRay(pnt, dir, 1.0F, res, index));
+    EXPECT_TRUE(bvh.NearestFacetOnRay(pnt + 20.0F * dir, -dir, 1.0F, res, index));
+}
+
+TEST(MeshFacetBVHTest, packetsMatchSingleRays)
+{
+    MeshCore::MeshKernel kernel = createUnevenMesh(30, 60);
+    MeshCore::MeshFacetBVH bvh(kernel);
+    std::vector<MeshCore::MeshFacetBVH::Ray> rays = createRays(2000);
+    // some rays miss the mesh
+    rays[3].dir = Base::Vector3f(0.0F, 0.0F, 1.0F);
+    rays[100].point.x = -1000.0F;
+
+    for (int threads : {1, 3}) {
+        std::vector<MeshCore::MeshFacetBVH::RayHit> hits = bvh.NearestFacetsOnRays(rays, threads);
+        ASSERT_EQ(hits.size(), rays.size());
+        for (std::size_t i = 0; i < rays.size(); i++) {
+            Base::Vector3f res;
+            MeshCore::FacetIndex index = MeshCore::FACET_INDEX_MAX;
+            bvh.NearestFacetOnRay(rays[i].point, rays[i].dir, res, index);
+            EXPECT_EQ(hits[i].facet, index);
+            if (index != MeshCore::FACET_INDEX_MAX) {
+                EXPECT_EQ(hits[i].point, res);
+            }
+        }
+        EXPECT_EQ(hits[3].facet, MeshCore::FACET_INDEX_MAX);
+        EXPECT_EQ(hits[100].facet, MeshCore::FACET_INDEX_MAX);
+    }
+}
+
+TEST(MeshFacetBVHTest, nearestFacetToPoint)
+{
+    MeshCore::MeshKernel kernel = createUnevenMesh(10, 20);
+    MeshCore::MeshFacetBVH bvh(kernel);
+
+    std::mt19937 gen(7);
+    std::uniform_real_distribution<float> pos(-5.0F, 105.0F);
+    for (int i = 0; i < 100; i++) {
+        Base::Vector3f pnt(pos(gen), pos(gen), pos(gen) * 0.1F);
+        float minDist = std::numeric_limits<float>::max();
+        for (MeshCore::FacetIndex j = 0; j < kernel.CountFacets(); j++) {
+            minDist = std::min(minDist, kernel.GetFacet(j).DistanceToPoint(pnt));
+        }
+
+        MeshCore::FacetIndex index {};
+        float dist {};
+        ASSERT_TRUE(bvh.NearestFacetToPoint(pnt, std::numeric_limits<float>::max(), index, dist));
+        EXPECT_FLOAT_EQ(dist, minDist);
+        EXPECT_FLOAT_EQ(kernel.GetFacet(index).DistanceToPoint(pnt), minDist);
+        EXPECT_FALSE(bvh.NearestFacetToPoint(pnt, 0.5F * minDist, index, dist));
+    }
+}
+
+TEST(MeshFacetBVHTest, transformed)
+{
+    MeshCore::MeshKernel kernel = createUnevenMesh(4, 4);
+    Base::Matrix4D mat;
+    mat.move(Base::Vector3f(0.0F, 0.0F, 5.0F));
+    MeshCore::MeshFacetBVH bvh(kernel, mat);
+    EXPECT_FLOAT_EQ(bvh.GetBoundBox().MinZ, kernel.GetBoundBox().MinZ + 5.0F);
+
+    Base::Vector3f res;
+    MeshCore::FacetIndex index {};
+    ASSERT_TRUE(bvh.NearestFacetOnRay(Base::Vector3f(50.5F, 50.5F, 20.0F),
+                                      Base::Vector3f(0.0F, 0.0F, -1.0F),
+                                      res,
+                                      index));
+    EXPECT_GE(res.z, 5.0F);
+
+    bvh.Clear();
+    EXPECT_TRUE(bvh.IsEmpty());
+    EXPECT_FALSE(bvh.NearestFacetOnRay(res, Base::Vector3f(0.0F, 0.0F, -1.0F), res, index));
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -0,0 +1,136 @@
+#include <gtest/gtest.h>
+#include <vector>
+#include <Mod/Mesh/App/Core/Boolean.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+#include <Mod/Mesh/App/Core/SetOperations.h>
+
+#include "src/Mod/Mesh/App/MeshTestHelpers.h"
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+using MeshTestHelpers::createSphere;
+
+namespace
+{
+// An axis-aligned box with outward oriented facets
+MeshCore::MeshKernel createBox(const Base::Vector3f& min, const Base::Vector3f& max)
+{
+    MeshCore::MeshPointArray points;
+    for (int i = 0; i < 8; i++) {
+        points.push_back(MeshCore::MeshPoint(Base::Vector3f((i & 1) ? max.x : min.x,
+                                                            (i & 2) ? max.y : min.y,
+                                                            (i & 4) ? max.z : min.z)));
+    }
+
+    MeshCore::MeshFacetArray facets;
+    auto addQuad = [&facets](int a, int b, int c, int d) {
+        facets.push_back(MeshCore::MeshFacet(a, b, c));
+        facets.push_back(MeshCore::MeshFacet(a, c, d));
+    };
+    addQuad(0, 2, 3, 1);
+    addQuad(4, 5, 7, 6);
+    addQuad(0, 1, 5, 4);
+    addQuad(2, 6, 7, 3);
+    addQuad(0, 4, 6, 2);
+    addQuad(1, 3, 7, 5);
+
+    MeshCore::MeshKernel kernel;
+    kernel.Adopt(points, facets, true);
+    return kernel;
+}
+
+MeshCore::MeshKernel boolean(const MeshCore::MeshKernel& mesh1,
+                             const MeshCore::MeshKernel& mesh2,
+                             MeshCore::SetOperations::OperationType type)
+{
+    MeshCore::MeshKernel result;
+    MeshCore::MeshBoolean op(mesh1, mesh2, result, type);
+    EXPECT_TRUE(op.Do());
+    EXPECT_EQ(op.CountFailedFacets(), 0);
+    return result;
+}
+}  // namespace
+
+TEST(MeshBooleanTest, overlappingBoxes)
+{
+    MeshCore::MeshKernel box1 = createBox(Base::Vector3f(0, 0, 0), Base::Vector3f(1, 1, 1));
+    MeshCore::MeshKernel box2 =
+        createBox(Base::Vector3f(0.5F, 0.25F, 0.5F), Base::Vector3f(1.5F, 0.75F, 1.5F));
+
+    MeshCore::MeshKernel result = boolean(box1, box2, MeshCore::SetOperations::Union);
+    EXPECT_FALSE(result.HasOpenEdges());
+    EXPECT_NEAR(result.GetVolume(), 1.375F, 1e-5F);
+
+    result = boolean(box1, box2, MeshCore::SetOperations::Intersect);
+    EXPECT_FALSE(result.HasOpenEdges());
+    EXPECT_NEAR(result.GetVolume(), 0.125F, 1e-5F);
+
+    result = boolean(box1, box2, MeshCore::SetOperations::Difference);
+    EXPECT_FALSE(result.HasOpenEdges());
+    EXPECT_NEAR(result.GetVolume(), 0.875F, 1e-5F);
+
+    result = boolean(box1, box2, MeshCore::SetOperations::Inner);
+    EXPECT_TRUE(result.HasOpenEdges());
+    result = boolean(box1, box2, MeshCore::SetOperations::Outer);
+    EXPECT_TRUE(result.HasOpenEdges());
+}
+
+TEST(MeshBooleanTest, disjointAndContained)
+{
+    MeshCore::MeshKernel box1 = createBox(Base::Vector3f(0, 0, 0), Base::Vector3f(2, 2, 2));
+    MeshCore::MeshKernel box2 = createBox(Base::Vector3f(3, 0, 0), Base::Vector3f(4, 1, 1));
+    MeshCore::MeshKernel box3 =
+        createBox(Base::Vector3f(0.5F, 0.5F, 0.5F), Base::Vector3f(1, 1, 1));
+
+    MeshCore::MeshKernel result = boolean(box1, box2, MeshCore::SetOperations::Union);
+    EXPECT_EQ(result.CountFacets(), 24);
+    EXPECT_NEAR(result.GetVolume(), 9.0F, 1e-5F);
+    result = boolean(box1, box2, MeshCore::SetOperations::Intersect);
+    EXPECT_EQ(result.CountFacets(), 0);
+
+    result = boolean(box1, box3, MeshCore::SetOperations::Union);
+    EXPECT_EQ(result.CountFacets(), 12);
+    EXPECT_NEAR(result.GetVolume(), 8.0F, 1e-5F);
+    result = boolean(box1, box3, MeshCore::SetOperations::Intersect);
+    EXPECT_NEAR(result.GetVolume(), 0.125F, 1e-5F);
+
+    // the inner box becomes a cavity
+    result = boolean(box1, box3, MeshCore::SetOperations::Difference);
+    EXPECT_EQ(result.CountFacets(), 24);
+    EXPECT_FALSE(result.HasOpenEdges());
+    EXPECT_NEAR(result.GetVolume(), 7.875F, 1e-5F);
+}
+
+TEST(MeshBooleanTest, coplanarFaces)
+{
+    // the boxes share parts of four side planes
+    MeshCore::MeshKernel box1 = createBox(Base::Vector3f(0, 0, 0), Base::Vector3f(1, 1, 1));
+    MeshCore::MeshKernel box2 = createBox(Base::Vector3f(0.5F, 0, 0), Base::Vector3f(1.5F, 1, 1));
+
+    MeshCore::MeshKernel result = boolean(box1, box2, MeshCore::SetOperations::Intersect);
+    EXPECT_FALSE(result.HasOpenEdges());
+    EXPECT_NEAR(result.GetVolume(), 0.5F, 1e-5F);
+
+    result = boolean(box1, box2, MeshCore::SetOperations::Union);
+    EXPECT_FALSE(result.HasOpenEdges());
+    EXPECT_NEAR(result.GetVolume(), 1.5F, 1e-5F);
+}
+
+TEST(MeshBooleanTest, spheres)
+{
+    MeshCore::MeshKernel sphere1 = createSphere(Base::Vector3f(0, 0, 0), 1.0F, 20);
+    MeshCore::MeshKernel sphere2 = createSphere(Base::Vector3f(0.7F, 0.3F, 0.2F), 0.8F, 24);
+
+    for (int threads : {1, 4}) {
+        MeshCore::MeshKernel result;
+        MeshCore::MeshBoolean op(sphere1, sphere2, result, MeshCore::SetOperations::Difference);
+        op.SetThreads(threads);
+        EXPECT_TRUE(op.Do());
+        EXPECT_GT(op.CountIntersections(), 0);
+        EXPECT_FALSE(result.HasOpenEdges());
+        EXPECT_LT(result.GetVolume(), sphere1.GetVolume());
+        EXPECT_GT(result.GetVolume(), sphere1.GetVolume() - sphere2.GetVolume());
+    }
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
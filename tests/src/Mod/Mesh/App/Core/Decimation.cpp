@@ -0,0 +1,184 @@
+#include <gtest/gtest.h>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <vector>
+#include <Base/FileInfo.h>
+#include <Base/Stream.h>
+#include <Mod/Mesh/App/Core/Builder.h>
+#include <Mod/Mesh/App/Core/Decimation.h>
+#include <Mod/Mesh/App/Core/Elements.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class MeshStreamSimplifyTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        input.setFile(Base::FileInfo::getTempFileName());
+        output.setFile(Base::FileInfo::getTempFileName());
+    }
+
+    void TearDown() override
+    {
+        input.deleteFile();
+        output.deleteFile();
+    }
+
+    // A closed sphere with 4 * rings * (rings - 1) facets
+    static std::vector<MeshCore::MeshGeomFacet> sphere(int rings)
+    {
+        auto point = [rings](int i, int j) {
+            const float pi = 3.14159265F;
+            float theta = pi * float(i) / float(rings);
+            float phi = 2.0F * pi * float(j % (2 * rings)) / float(2 * rings);
+            if (i == 0 || i == rings) {
+                phi = 0.0F;
+            }
+            return Base::Vector3f(10.0F * std::sin(theta) * std::cos(phi),
+                                  10.0F * std::sin(theta) * std::sin(phi),
+                                  10.0F * std::cos(theta));
+        };
+        std::vector<MeshCore::MeshGeomFacet> facets;
+        for (int i = 0; i < rings; i++) {
+            for (int j = 0; j < 2 * rings; j++) {
+                if (i > 0) {
+                    facets.emplace_back(point(i, j), point(i + 1, j), point(i, j + 1));
+                }
+                if (i < rings - 1) {
+                    facets.emplace_back(point(i, j + 1), point(i + 1, j), point(i + 1, j + 1));
+                }
+            }
+        }
+        return facets;
+    }
+
+    static void writeBinarySTL(const Base::FileInfo& fi,
+                               const std::vector<MeshCore::MeshGeomFacet>& facets)
+    {
+        Base::ofstream str(fi, std::ios::out | std::ios::binary);
+        std::array<char, 80> header {};
+        str.write(header.data(), header.size());
+        auto count = static_cast<uint32_t>(facets.size());
+        str.write(reinterpret_cast<const char*>(&count), sizeof(count));
+        for (const auto& it : facets) {
+            std::array<float, 12> record {};
+            Base::Vector3f normal = it.GetNormal();
+            std::memcpy(record.data(), &normal.x, 3 * sizeof(float));
+            for (int i = 0; i < 3; i++) {
+                std::memcpy(&record[3 * i + 3], &it._aclPoints[i].x, 3 * sizeof(float));
+            }
+            uint16_t attr = 0;
+            str.write(reinterpret_cast<const char*>(record.data()), sizeof(record));
+            str.write(reinterpret_cast<const char*>(&attr), sizeof(attr));
+        }
+    }
+
+    static MeshCore::MeshKernel readBinarySTL(const Base::FileInfo& fi)
+    {
+        Base::ifstream str(fi, std::ios::in | std::ios::binary);
+        std::array<char, 80> header {};
+        str.read(header.data(), header.size());
+        uint32_t count {};
+        str.read(reinterpret_cast<char*>(&count), sizeof(count));
+
+        MeshCore::MeshKernel kernel;
+        MeshCore::MeshHashBuilder builder(kernel);
+        Base::Vector3f* corners = builder.Initialize(count);
+        for (uint32_t i = 0; i < count; i++) {
+            std::array<float, 12> record {};
+            uint16_t attr = 0;
+            str.read(reinterpret_cast<char*>(record.data()), sizeof(record));
+            str.read(reinterpret_cast<char*>(&attr), sizeof(attr));
+            for (int j = 0; j < 3; j++) {
+                corners[3 * i + j].Set(record[3 * j + 3], record[3 * j + 4], record[3 * j + 5]);
+            }
+        }
+        builder.Finish();
+        return kernel;
+    }
+
+    static MeshCore::MeshKernel toKernel(const std::vector<MeshCore::MeshGeomFacet>& facets)
+    {
+        MeshCore::MeshKernel kernel;
+        MeshCore::MeshHashBuilder builder(kernel);
+        Base::Vector3f* corners = builder.Initialize(facets.size());
+        for (const auto& it : facets) {
+            for (const auto& pnt : it._aclPoints) {
+                *corners++ = pnt;
+            }
+        }
+        builder.Finish();
+        return kernel;
+    }
+
+    static std::size_t countOpenEdges(const MeshCore::MeshKernel& kernel)
+    {
+        std::size_t count = 0;
+        for (const auto& it : kernel.GetFacets()) {
+            for (auto index : it._aulNeighbours) {
+                if (index == MeshCore::FACET_INDEX_MAX) {
+                    count++;
+                }
+            }
+        }
+        return count;
+    }
+
+    Base::FileInfo input;
+    Base::FileInfo output;
+};
+
+TEST_F(MeshStreamSimplifyTest, singleChunkMatchesInMemory)
+{
+    auto facets = sphere(40);
+    writeBinarySTL(input, facets);
+
+    MeshCore::MeshKernel kernel = toKernel(facets);
+    MeshCore::MeshSimplify simplify(kernel);
+    simplify.simplify(1000);
+
+    MeshCore::MeshStreamSimplify stream;
+    stream.SetChunkSize(facets.size());
+    ASSERT_TRUE(stream.simplify(input.filePath(), output.filePath(), 1000));
+    EXPECT_EQ(stream.GetMaxChunkFacets(), facets.size());
+
+    MeshCore::MeshKernel result = readBinarySTL(output);
+    EXPECT_EQ(result.CountFacets(), kernel.CountFacets());
+    EXPECT_FLOAT_EQ(result.GetSurface(), kernel.GetSurface());
+}
+
+TEST_F(MeshStreamSimplifyTest, chunksFitTogether)
+{
+    auto facets = sphere(100);
+    writeBinarySTL(input, facets);
+    MeshCore::MeshKernel original = toKernel(facets);
+    ASSERT_EQ(countOpenEdges(original), 0);
+
+    MeshCore::MeshStreamSimplify stream;
+    stream.SetChunkSize(500);
+    stream.SetThreads(3);
+    ASSERT_TRUE(stream.simplify(input.filePath(), output.filePath(), 0.1F, 0.75F));
+    EXPECT_LE(stream.GetMaxChunkFacets(), 500);
+
+    MeshCore::MeshKernel result = readBinarySTL(output);
+    EXPECT_GT(result.CountFacets(), 0);
+    EXPECT_LT(result.CountFacets(), facets.size() / 2);
+    EXPECT_EQ(countOpenEdges(result), 0);
+    EXPECT_NEAR(result.GetSurface(), original.GetSurface(), 0.02F * original.GetSurface());
+}
+
+TEST_F(MeshStreamSimplifyTest, rejectInvalidFile)
+{
+    {
+        Base::ofstream str(input, std::ios::out);
+        str << "solid ascii\n";
+    }
+
+    MeshCore::MeshStreamSimplify stream;
+    EXPECT_FALSE(stream.simplify(input.filePath(), output.filePath(), 100));
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
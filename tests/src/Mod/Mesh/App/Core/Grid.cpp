@@ -0,0 +1,96 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <set>
+#include <Mod/Mesh/App/Core/Grid.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+
+#include "src/Mod/Mesh/App/MeshTestHelpers.h"
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+using MeshTestHelpers::createHeightField;
+
+namespace
+{
+std::size_t countEntries(const MeshCore::MeshGrid& grid)
+{
+    std::size_t count = 0;
+    MeshCore::MeshGridIterator it(grid);
+    for (it.Init(); it.More(); it.Next()) {
+        count += it.GetCtElements();
+    }
+    return count;
+}
+}  // namespace
+
+TEST(MeshGridTest, cellsAreSortedAndUnique)
+{
+    MeshCore::MeshKernel kernel = createHeightField(40);
+    MeshCore::MeshFacetGrid grid(kernel, 8);
+
+    MeshCore::MeshGridIterator it(grid);
+    for (it.Init(); it.More(); it.Next()) {
+        std::vector<MeshCore::ElementIndex> elements;
+        it.GetElements(elements);
+        EXPECT_TRUE(std::is_sorted(elements.begin(), elements.end()));
+        EXPECT_EQ(std::adjacent_find(elements.begin(), elements.end()), elements.end());
+        EXPECT_EQ(elements.size(), it.GetCtElements());
+    }
+}
+
+TEST(MeshGridTest, everyFacetIsFoundInItsBoundingBox)
+{
+    MeshCore::MeshKernel kernel = createHeightField(40);
+    MeshCore::MeshFacetGrid grid(kernel, 8);
+
+    for (MeshCore::FacetIndex index = 0; index < kernel.CountFacets(); index++) {
+        std::vector<MeshCore::ElementIndex> elements;
+        grid.Inside(kernel.GetFacet(index).GetBoundBox(), elements);
+        EXPECT_TRUE(std::binary_search(elements.begin(), elements.end(), index));
+    }
+}
+
+TEST(MeshGridTest, everyPointIsInOneCell)
+{
+    MeshCore::MeshKernel kernel = createHeightField(40);
+    MeshCore::MeshPointGrid grid(kernel, 8);
+
+    EXPECT_EQ(countEntries(grid), kernel.CountPoints());
+    for (MeshCore::PointIndex index = 0; index < kernel.CountPoints(); index++) {
+        std::set<MeshCore::ElementIndex> elements;
+        grid.FindElements(kernel.GetPoint(index), elements);
+        EXPECT_EQ(elements.count(index), 1);
+    }
+}
+
+TEST(MeshGridTest, rebuildReplacesContent)
+{
+    MeshCore::MeshKernel kernel = createHeightField(20);
+    MeshCore::MeshFacetGrid grid(kernel, 4);
+    std::size_t entries = countEntries(grid);
+
+    grid.Rebuild(2, 2, 2);
+    unsigned long ulX {}, ulY {}, ulZ {};
+    grid.GetCtGrids(ulX, ulY, ulZ);
+    EXPECT_EQ(ulX * ulY * ulZ, 8);
+    EXPECT_LE(countEntries(grid), entries);
+    EXPECT_GE(countEntries(grid), kernel.CountFacets());
+}
+
+TEST(MeshGridTest, searchNearestFacet)
+{
+    MeshCore::MeshKernel kernel = createHeightField(20);
+    MeshCore::MeshFacetGrid grid(kernel, 6);
+
+    Base::Vector3f pnt(5.2F, 7.1F, 3.0F);
+    MeshCore::FacetIndex nearest = grid.SearchNearestFromPoint(pnt);
+    ASSERT_LT(nearest, kernel.CountFacets());
+
+    float minDist = std::numeric_limits<float>::max();
+    for (MeshCore::FacetIndex index = 0; index < kernel.CountFacets(); index++) {
+        minDist = std::min(minDist, kernel.GetFacet(index).DistanceToPoint(pnt));
+    }
+    EXPECT_FLOAT_EQ(kernel.GetFacet(nearest).DistanceToPoint(pnt), minDist);
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+#include <set>
+#include <vector>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+#include <Mod/Mesh/App/Core/Smoothing.h>
+
+#include "src/Mod/Mesh/App/MeshTestHelpers.h"
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+using MeshTestHelpers::createHeightField;
+
+namespace
+{
+template<class Smoothing>
+MeshCore::MeshPointArray smooth(int threads, const std::vector<MeshCore::PointIndex>& indices)
+{
+    MeshCore::MeshKernel kernel = createHeightField(150);
+    Smoothing smoothing(kernel);
+    smoothing.SetThreads(threads);
+    if (indices.empty()) {
+        smoothing.Smooth(4);
+    }
+    else {
+        smoothing.SmoothPoints(4, indices);
+    }
+    return kernel.GetPoints();
+}
+
+bool isEqual(const MeshCore::MeshPointArray& points1, const MeshCore::MeshPointArray& points2)
+{
+    if (points1.size() != points2.size()) {
+        return false;
+    }
+    for (std::size_t i = 0; i < points1.size(); i++) {
+        // bitwise identical
+        if (points1[i].x != points2[i].x || points1[i].y != points2[i].y
+            || points1[i].z != points2[i].z) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<class Smoothing>
+void testThreadIndependence()
+{
+    std::vector<MeshCore::PointIndex> indices;
+    for (MeshCore::PointIndex i = 0; i < 151 * 151; i += 3) {
+        indices.push_back(i);
+    }
+
+    MeshCore::MeshPointArray all = smooth<Smoothing>(1, {});
+    MeshCore::MeshPointArray some = smooth<Smoothing>(1, indices);
+    EXPECT_FALSE(isEqual(all, createHeightField(150).GetPoints()));
+    for (int threads : {2, 5, 8}) {
+        EXPECT_TRUE(isEqual(all, smooth<Smoothing>(threads, {})));
+        EXPECT_TRUE(isEqual(some, smooth<Smoothing>(threads, indices)));
+    }
+}
+}  // namespace
+
+TEST(MeshSmoothingTest, laplaceIsIndependentOfThreads)
+{
+    testThreadIndependence<MeshCore::LaplaceSmoothing>();
+}
+
+TEST(MeshSmoothingTest, taubinIsIndependentOfThreads)
+{
+    testThreadIndependence<MeshCore::TaubinSmoothing>();
+}
+
+TEST(MeshSmoothingTest, planeFitIsIndependentOfThreads)
+{
+    testThreadIndependence<MeshCore::PlaneFitSmoothing>();
+}
+
+TEST(MeshSmoothingTest, laplaceUsesPositionsOfPreviousIteration)
+{
+    MeshCore::MeshKernel kernel = createHeightField(3);
+    MeshCore::MeshPointArray points = kernel.GetPoints();
+    std::vector<std::set<MeshCore::PointIndex>> neighbours(points.size());
+    for (const auto& facet : kernel.GetFacets()) {
+        for (int i = 0; i < 3; i++) {
+            neighbours[facet._aulPoints[i]].insert(facet._aulPoints[(i + 1) % 3]);
+            neighbours[facet._aulPoints[i]].insert(facet._aulPoints[(i + 2) % 3]);
+        }
+    }
+
+    MeshCore::LaplaceSmoothing smoothing(kernel);
+    smoothing.SetLambda(1.0);
+    smoothing.Smooth(1);
+
+    // the four interior points are moved into the centroid of their old neighbours
+    for (MeshCore::PointIndex index = 0; index < points.size(); index++) {
+        if (index == 5 || index == 6 || index == 9 || index == 10) {
+            Base::Vector3f center;
+            for (MeshCore::PointIndex neighbour : neighbours[index]) {
+                center += points[neighbour];
+            }
+            center /= float(neighbours[index].size());
+            EXPECT_FLOAT_EQ(kernel.GetPoint(index).x, center.x);
+            EXPECT_FLOAT_EQ(kernel.GetPoint(index).y, center.y);
+            EXPECT_FLOAT_EQ(kernel.GetPoint(index).z, center.z);
+        }
+        else {
+            EXPECT_EQ(kernel.GetPoint(index), points[index]);
+        }
+    }
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
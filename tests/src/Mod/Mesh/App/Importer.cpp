@@ -1,6 +1,13 @@
 #include <gtest/gtest.h>
+#include <array>
+#include <cstring>
+#include <filesystem>
 #include <Base/FileInfo.h>
+#include <Base/Stream.h>
+#include <Mod/Mesh/App/Core/Builder.h>
 #include <Mod/Mesh/App/Core/IO/Reader3MF.h>
+#include <Mod/Mesh/App/Core/IO/ReaderSTL.h>
+#include <Mod/Mesh/App/Core/MeshIO.h>
 #include <xercesc/util/PlatformUtils.hpp>
 #include <zipios++/fcoll.h>
 
@@ -37,4 +44,209 @@ TEST_F(ImporterTest, Test3MF)
     EXPECT_EQ(mesh2.CountEdges(), 1950);
     EXPECT_EQ(mesh2.CountFacets(), 1300);
 }
+
+class MappedImporterTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        fileInfo.setFile(Base::FileInfo::getTempFileName());
+    }
+
+    void TearDown() override
+    {
+        fileInfo.deleteFile();
+    }
+
+    static std::vector<MeshCore::MeshGeomFacet> cube()
+    {
+        const std::array<Base::Vector3f, 8> pts {Base::Vector3f(0, 0, 0),
+                                                 Base::Vector3f(1, 0, 0),
+                                                 Base::Vector3f(1, 1, 0),
+                                                 Base::Vector3f(0, 1, 0),
+                                                 Base::Vector3f(0, 0, 1),
+                                                 Base::Vector3f(1, 0, 1),
+                                                 Base::Vector3f(1, 1, 1),
+                                                 Base::Vector3f(0, 1, 1)};
+        const std::array<std::array<int, 3>, 12> tria {{{0, 2, 1},
+                                                        {0, 3, 2},
+                                                        {4, 5, 6},
+                                                        {4, 6, 7},
+                                                        {0, 1, 5},
+                                                        {0, 5, 4},
+                                                        {1, 2, 6},
+                                                        {1, 6, 5},
+                                                        {2, 3, 7},
+                                                        {2, 7, 6},
+                                                        {3, 0, 4},
+                                                        {3, 4, 7}}};
+        std::vector<MeshCore::MeshGeomFacet> facets;
+        for (const auto& it : tria) {
+            facets.emplace_back(pts[it[0]], pts[it[1]], pts[it[2]]);
+        }
+        return facets;
+    }
+
+    void writeBinarySTL(const std::vector<MeshCore::MeshGeomFacet>& facets)
+    {
+        Base::ofstream str(fileInfo, std::ios::out | std::ios::binary);
+        std::array<char, 80> header {};
+        str.write(header.data(), header.size());
+        auto count = static_cast<uint32_t>(facets.size());
+        str.write(reinterpret_cast<const char*>(&count), sizeof(count));
+        for (const auto& it : facets) {
+            std::array<float, 12> record {};
+            Base::Vector3f normal = it.GetNormal();
+            std::memcpy(record.data(), &normal.x, 3 * sizeof(float));
+            for (int i = 0; i < 3; i++) {
+                record[3 * i + 3] = it._aclPoints[i].x;
+                record[3 * i + 4] = it._aclPoints[i].y;
+                record[3 * i + 5] = it._aclPoints[i].z;
+            }
+            uint16_t attr = 0;
+            str.write(reinterpret_cast<const char*>(record.data()), sizeof(record));
+            str.write(reinterpret_cast<const char*>(&attr), sizeof(attr));
+        }
+    }
+
+    Base::FileInfo fileInfo;
+};
+
+TEST_F(MappedImporterTest, testBinarySTL)
+{
+    writeBinarySTL(cube());
+
+    MeshCore::MeshKernel kernel;
+    MeshCore::ReaderSTL reader(kernel);
+    EXPECT_TRUE(reader.LoadBinary(fileInfo.filePath()));
+    EXPECT_EQ(kernel.CountPoints(), 8);
+    EXPECT_EQ(kernel.CountEdges(), 18);
+    EXPECT_EQ(kernel.CountFacets(), 12);
+    EXPECT_FLOAT_EQ(kernel.GetSurface(), 6.0F);
+}
+
+TEST_F(MappedImporterTest, testBinarySTLSameAsStream)
+{
+    writeBinarySTL(cube());
+
+    MeshCore::MeshKernel kernel1;
+    MeshCore::MeshInput input1(kernel1);
+    EXPECT_TRUE(input1.LoadAny(fileInfo.filePath().c_str()));
+
+    MeshCore::MeshKernel kernel2;
+    MeshCore::MeshInput input2(kernel2);
+    Base::ifstream str(fileInfo, std::ios::in | std::ios::binary);
+    EXPECT_TRUE(input2.LoadSTL(str));
+
+    EXPECT_EQ(kernel1.CountPoints(), kernel2.CountPoints());
+    EXPECT_EQ(kernel1.CountFacets(), kernel2.CountFacets());
+    EXPECT_FLOAT_EQ(kernel1.GetSurface(), kernel2.GetSurface());
+}
+
+TEST_F(MappedImporterTest, testRejectTruncatedSTL)
+{
+    auto facets = cube();
+    writeBinarySTL(facets);
+    std::filesystem::resize_file(fileInfo.filePath(), 84 + 50 * 6);
+
+    MeshCore::MeshKernel kernel;
+    MeshCore::ReaderSTL reader(kernel);
+    EXPECT_FALSE(reader.LoadBinary(fileInfo.filePath()));
+    EXPECT_EQ(kernel.CountFacets(), 0);
+}
+
+TEST_F(MappedImporterTest, testBinaryPLY)
+{
+    {
+        Base::ofstream str(fileInfo, std::ios::out | std::ios::binary);
+        str << "ply\n"
+               "format binary_little_endian 1.0\n"
+               "element vertex 4\n"
+               "property float x\n"
+               "property float y\n"
+               "property float z\n"
+               "property uchar red\n"
+               "property uchar green\n"
+               "property uchar blue\n"
+               "element face 2\n"
+               "property list uchar int vertex_indices\n"
+               "end_header\n";
+        const std::array<float, 12> pts {0, 0, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0};
+        for (int i = 0; i < 4; i++) {
+            str.write(reinterpret_cast<const char*>(&pts[3 * i]), 3 * sizeof(float));
+            std::array<unsigned char, 3> rgb {255, 0, static_cast<unsigned char>(i)};
+            str.write(reinterpret_cast<const char*>(rgb.data()), rgb.size());
+        }
+        const std::array<int32_t, 6> faces {0, 1, 2, 0, 2, 3};
+        for (int i = 0; i < 2; i++) {
+            unsigned char num = 3;
+            str.write(reinterpret_cast<const char*>(&num), 1);
+            str.write(reinterpret_cast<const char*>(&faces[3 * i]), 3 * sizeof(int32_t));
+        }
+    }
+
+    MeshCore::MeshKernel kernel;
+    MeshCore::Material mat;
+    MeshCore::MeshInput input(kernel, &mat);
+    Base::ifstream str(fileInfo, std::ios::in | std::ios::binary);
+    EXPECT_TRUE(input.LoadPLY(str, fileInfo.filePath().c_str()));
+    EXPECT_EQ(kernel.CountPoints(), 4);
+    EXPECT_EQ(kernel.CountFacets(), 2);
+    EXPECT_EQ(kernel.GetPoint(2), Base::Vector3f(1, 1, 0));
+    EXPECT_EQ(mat.binding, MeshCore::MeshIO::PER_VERTEX);
+    ASSERT_EQ(mat.diffuseColor.size(), 4);
+    EXPECT_FLOAT_EQ(mat.diffuseColor[3].b, 3.0F / 255.0F);
+}
+
+TEST_F(MappedImporterTest, testHashBuilderIndependentOfThreads)
+{
+    // a triangle soup that is big enough to be split over several threads
+    const int size = 150;
+    std::vector<MeshCore::MeshGeomFacet> facets;
+    for (int i = 0; i < size; i++) {
+        for (int j = 0; j < size; j++) {
+            Base::Vector3f p1(float(i), float(j), float((i * j) % 7));
+            Base::Vector3f p2(float(i + 1), float(j), float(((i + 1) * j) % 7));
+            Base::Vector3f p3(float(i + 1), float(j + 1), float(((i + 1) * (j + 1)) % 7));
+            Base::Vector3f p4(float(i), float(j + 1), float((i * (j + 1)) % 7));
+            facets.emplace_back(p1, p2, p3);
+            facets.emplace_back(p1, p3, p4);
+        }
+    }
+
+    auto build = [&facets](int threads) {
+        MeshCore::MeshKernel kernel;
+        MeshCore::MeshHashBuilder builder(kernel);
+        builder.SetThreads(threads);
+        Base::Vector3f* corners = builder.Initialize(facets.size());
+        for (const auto& it : facets) {
+            for (const auto& pnt : it._aclPoints) {
+                *corners++ = pnt;
+            }
+        }
+        builder.Finish();
+        return kernel;
+    };
+
+    MeshCore::MeshKernel kernel1 = build(1);
+    MeshCore::MeshKernel kernel2 = build(4);
+    EXPECT_EQ(kernel1.CountPoints(), (size + 1) * (size + 1));
+    EXPECT_EQ(kernel1.CountFacets(), 2 * size * size);
+    ASSERT_EQ(kernel1.CountPoints(), kernel2.CountPoints());
+    ASSERT_EQ(kernel1.CountFacets(), kernel2.CountFacets());
+
+    // points are ordered by their first occurrence
+    EXPECT_EQ(kernel1.GetPoint(0), facets[0]._aclPoints[0]);
+    for (MeshCore::PointIndex i = 0; i < kernel1.CountPoints(); i++) {
+        EXPECT_EQ(kernel1.GetPoint(i), kernel2.GetPoint(i));
+    }
+    const auto& facets1 = kernel1.GetFacets();
+    const auto& facets2 = kernel2.GetFacets();
+    for (std::size_t i = 0; i < facets1.size(); i++) {
+        for (int j = 0; j < 3; j++) {
+            EXPECT_EQ(facets1[i]._aulPoints[j], facets2[i]._aulPoints[j]);
+            EXPECT_EQ(facets1[i]._aulNeighbours[j], facets2[i]._aulNeighbours[j]);
+        }
+    }
+}
 // NOLINTEND(cppcoreguidelines-*,readability-*)
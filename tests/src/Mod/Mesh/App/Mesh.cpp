@@ -106,4 +106,41 @@ TEST_F(MeshTest, TestGrid2OfAlmostPlanarMesh)
     EXPECT_EQ(countY, 1);
     EXPECT_EQ(countZ, 1);
 }
+
+TEST_F(MeshTest, TestPointLayout)
+{
+    // coordinates and the flag byte, without any other payload
+    EXPECT_EQ(sizeof(MeshCore::MeshPoint), 4 * sizeof(float));
+}
+
+TEST_F(MeshTest, TestDeleteFacetsRemovesUnreferencedPoints)
+{
+    MeshCore::MeshKernel kernel;
+    Base::Vector3f p1 {0, 0, 0};
+    Base::Vector3f p2 {1, 0, 0};
+    Base::Vector3f p3 {0, 1, 0};
+    Base::Vector3f p4 {1, 1, 0};
+    kernel.AddFacet(MeshCore::MeshGeomFacet(p1, p2, p3));
+    kernel.AddFacet(MeshCore::MeshGeomFacet(p3, p2, p4));
+
+    kernel.DeleteFacets({1});
+    EXPECT_EQ(kernel.CountFacets(), 1);
+    EXPECT_EQ(kernel.CountPoints(), 3);
+}
+
+TEST_F(MeshTest, TestDeletePointsRemovesFacets)
+{
+    MeshCore::MeshKernel kernel;
+    Base::Vector3f p1 {0, 0, 0};
+    Base::Vector3f p2 {1, 0, 0};
+    Base::Vector3f p3 {0, 1, 0};
+    Base::Vector3f p4 {1, 1, 0};
+    kernel.AddFacet(MeshCore::MeshGeomFacet(p1, p2, p3));
+    kernel.AddFacet(MeshCore::MeshGeomFacet(p3, p2, p4));
+
+    // removes the first facet and the now unused first point
+    kernel.DeletePoints({0});
+    EXPECT_EQ(kernel.CountFacets(), 1);
+    EXPECT_EQ(kernel.CountPoints(), 3);
+}
 // NOLINTEND(cppcoreguidelines-*,readability-*)
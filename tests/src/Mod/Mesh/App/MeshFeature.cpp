@@ -1,5 +1,9 @@
 #include "gtest/gtest.h"
+#include <memory>
 #include <src/App/InitApplication.h>
+#include <App/Application.h>
+#include <App/Document.h>
+#include <Mod/Mesh/App/FeatureMeshDefects.h>
 #include <Mod/Mesh/App/MeshFeature.h>
 
 class MeshFeatureTest: public ::testing::Test
@@ -37,4 +41,94 @@ TEST_F(MeshFeatureTest, getComplexElementTypes)
     EXPECT_STREQ(types[0], "Mesh");
     EXPECT_STREQ(types[1], "Segment");
 }
+
+TEST_F(MeshFeatureTest, copySharesMeshUntilModified)
+{
+    Mesh::PropertyMeshKernel prop;
+    MeshCore::MeshKernel kernel;
+    kernel.AddFacet(MeshCore::MeshGeomFacet(Base::Vector3f(0, 0, 0),
+                                            Base::Vector3f(1, 0, 0),
+                                            Base::Vector3f(0, 1, 0)));
+    prop.setValue(kernel);
+
+    std::unique_ptr<App::Property> copy(prop.Copy());
+    auto snapshot = static_cast<Mesh::PropertyMeshKernel*>(copy.get());
+    EXPECT_EQ(snapshot->getValuePtr(), prop.getValuePtr());
+
+    Mesh::MeshObject* mesh = prop.startEditing();
+    mesh->getKernel().AddFacet(MeshCore::MeshGeomFacet(Base::Vector3f(1, 0, 0),
+                                                       Base::Vector3f(1, 1, 0),
+                                                       Base::Vector3f(0, 1, 0)));
+    prop.finishEditing();
+    EXPECT_NE(snapshot->getValuePtr(), prop.getValuePtr());
+    EXPECT_EQ(snapshot->getValue().countFacets(), 1);
+    EXPECT_EQ(prop.getValue().countFacets(), 2);
+
+    prop.Paste(*snapshot);
+    EXPECT_EQ(snapshot->getValuePtr(), prop.getValuePtr());
+    EXPECT_EQ(prop.getValue().countFacets(), 1);
+}
+
+TEST_F(MeshFeatureTest, editDoesNotCopyMeshReferencedOutsideOfProperties)
+{
+    Mesh::PropertyMeshKernel prop;
+    MeshCore::MeshKernel kernel;
+    kernel.AddFacet(MeshCore::MeshGeomFacet(Base::Vector3f(0, 0, 0),
+                                            Base::Vector3f(1, 0, 0),
+                                            Base::Vector3f(0, 1, 0)));
+    prop.setValue(kernel);
+
+    // e.g. the view provider keeps a reference to the displayed mesh
+    const Mesh::MeshObject* mesh = prop.getValuePtr();
+    Base::Reference<Mesh::MeshObject> viewRef(const_cast<Mesh::MeshObject*>(mesh));
+
+    prop.startEditing()->getKernel().AddFacet(
+        MeshCore::MeshGeomFacet(Base::Vector3f(1, 0, 0),
+                                Base::Vector3f(1, 1, 0),
+                                Base::Vector3f(0, 1, 0)));
+    prop.finishEditing();
+    EXPECT_EQ(prop.getValuePtr(), mesh);
+    EXPECT_EQ(prop.getValue().countFacets(), 2);
+
+    // a copy that is gone doesn't keep the mesh shared
+    delete prop.Copy();
+    prop.startEditing();
+    prop.finishEditing();
+    EXPECT_EQ(prop.getValuePtr(), mesh);
+}
+
+TEST_F(MeshFeatureTest, fixDefectsInParallelRecompute)
+{
+    ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Document");
+    hGrp->SetBool("ParallelRecompute", true);
+    App::Document* doc = App::GetApplication().newDocument("ParallelFixDefects");
+
+    MeshCore::MeshKernel kernel;
+    kernel.AddFacet(MeshCore::MeshGeomFacet(Base::Vector3f(0, 0, 0),
+                                            Base::Vector3f(1, 0, 0),
+                                            Base::Vector3f(0, 1, 0)));
+    auto source = doc->addObject<Mesh::Feature>("Source");
+    source->Mesh.setValue(kernel);
+    std::vector<Mesh::FlipNormals*> flips;
+    for (const char* name : {"Flip1", "Flip2", "Flip3"}) {
+        auto flip = doc->addObject<Mesh::FlipNormals>(name);
+        flip->Source.setValue(source);
+        flips.push_back(flip);
+    }
+
+    EXPECT_TRUE(flips.front()->isRecomputeThreadSafe());
+    bool hasError = false;
+    doc->recompute({}, false, &hasError);
+    EXPECT_FALSE(hasError);
+    for (auto flip : flips) {
+        const MeshCore::MeshKernel& flipped = flip->Mesh.getValue().getKernel();
+        ASSERT_EQ(flipped.CountFacets(), 1);
+        EXPECT_EQ(flipped.GetFacet(0).GetNormal(), Base::Vector3f(0, 0, -1));
+        EXPECT_FALSE(flip->isTouched());
+    }
+
+    App::GetApplication().closeDocument(doc->getName());
+    hGrp->RemoveBool("ParallelRecompute");
+}
 // NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -0,0 +1,146 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <cmath>
+#include <numbers>
+#include <random>
+
+#include "MeshTestHelpers.h"
+
+// NOLINTBEGIN(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
+
+namespace
+{
+// Adds a triangulated height field with 2 * size * size facets covering the square
+// [x, x + length] x [y, y + length]
+void addHeightField(MeshCore::MeshPointArray& points,
+                    MeshCore::MeshFacetArray& facets,
+                    int size,
+                    float x,
+                    float y,
+                    float length)
+{
+    auto offset = MeshCore::PointIndex(points.size());
+    auto index = [size, offset](int i, int j) {
+        return offset + MeshCore::PointIndex(i * (size + 1) + j);
+    };
+    float step = length / float(size);
+    for (int i = 0; i <= size; i++) {
+        for (int j = 0; j <= size; j++) {
+            float z = 0.1F * step * float((i * 7 + j * 3) % 5);
+            points.push_back(
+                MeshCore::MeshPoint(Base::Vector3f(x + float(i) * step, y + float(j) * step, z)));
+        }
+    }
+    for (int i = 0; i < size; i++) {
+        for (int j = 0; j < size; j++) {
+            facets.push_back(MeshCore::MeshFacet(index(i, j), index(i + 1, j), index(i, j + 1)));
+            facets.push_back(
+                MeshCore::MeshFacet(index(i, j + 1), index(i + 1, j), index(i + 1, j + 1)));
+        }
+    }
+}
+}  // namespace
+
+namespace MeshTestHelpers
+{
+
+MeshCore::MeshKernel createHeightField(int size)
+{
+    MeshCore::MeshFacetArray facets;
+    MeshCore::MeshPointArray points;
+    auto index = [size](int i, int j) {
+        return MeshCore::PointIndex(i * (size + 1) + j);
+    };
+    for (int i = 0; i <= size; i++) {
+        for (int j = 0; j <= size; j++) {
+            float z = 0.1F * float((i * 7 + j * 3) % 5);
+            points.push_back(MeshCore::MeshPoint(Base::Vector3f(float(i), float(j), z)));
+        }
+    }
+    for (int i = 0; i < size; i++) {
+        for (int j = 0; j < size; j++) {
+            facets.push_back(MeshCore::MeshFacet(index(i, j), index(i + 1, j), index(i, j + 1)));
+            facets.push_back(
+                MeshCore::MeshFacet(index(i, j + 1), index(i + 1, j), index(i + 1, j + 1)));
+        }
+    }
+
+    MeshCore::MeshKernel kernel;
+    kernel.Adopt(points, facets, true);
+    return kernel;
+}
+
+MeshCore::MeshKernel createUnevenMesh(int coarse, int dense)
+{
+    MeshCore::MeshPointArray points;
+    MeshCore::MeshFacetArray facets;
+    addHeightField(points, facets, coarse, 0.0F, 0.0F, 100.0F);
+    addHeightField(points, facets, dense, 100.0F, 0.0F, 2.0F);
+
+    MeshCore::MeshKernel kernel;
+    kernel.Adopt(points, facets, true);
+    return kernel;
+}
+
+MeshCore::MeshKernel createSphere(const Base::Vector3f& center, float radius, int rings)
+{
+    int segments = 2 * rings;
+    MeshCore::MeshPointArray points;
+    points.push_back(MeshCore::MeshPoint(center + Base::Vector3f(0, 0, radius)));
+    for (int i = 1; i < rings; i++) {
+        double theta = std::numbers::pi * i / rings;
+        for (int j = 0; j < segments; j++) {
+            double phi = 2.0 * std::numbers::pi * j / segments;
+            Base::Vector3f dir(float(std::sin(theta) * std::cos(phi)),
+                               float(std::sin(theta) * std::sin(phi)),
+                               float(std::cos(theta)));
+            points.push_back(MeshCore::MeshPoint(center + dir * radius));
+        }
+    }
+    points.push_back(MeshCore::MeshPoint(center - Base::Vector3f(0, 0, radius)));
+
+    auto index = [segments](int i, int j) {
+        return MeshCore::PointIndex(1 + (i - 1) * segments + (j % segments));
+    };
+    auto south = MeshCore::PointIndex(points.size() - 1);
+    MeshCore::MeshFacetArray facets;
+    for (int j = 0; j < segments; j++) {
+        facets.push_back(MeshCore::MeshFacet(0, index(1, j), index(1, j + 1)));
+        for (int i = 1; i < rings - 1; i++) {
+            facets.push_back(
+                MeshCore::MeshFacet(index(i, j), index(i + 1, j), index(i + 1, j + 1)));
+            facets.push_back(
+                MeshCore::MeshFacet(index(i, j), index(i + 1, j + 1), index(i, j + 1)));
+        }
+        facets.push_back(MeshCore::MeshFacet(south, index(rings - 1, j + 1), index(rings - 1, j)));
+    }
+
+    MeshCore::MeshKernel kernel;
+    kernel.Adopt(points, facets, true);
+    return kernel;
+}
+
+std::vector<MeshCore::MeshFacetBVH::Ray> createRays(std::size_t count)
+{
+    // rays from above pointing down with slightly varying directions
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> pos(1.0F, 99.0F);
+    std::uniform_real_distribution<float> dir(-0.05F, 0.05F);
+
+    std::vector<MeshCore::MeshFacetBVH::Ray> rays;
+    for (std::size_t i = 0; i < count; i++) {
+        Base::Vector3f pnt(pos(gen), pos(gen), 10.0F);
+        Base::Vector3f vec(dir(gen), dir(gen), -1.0F);
+        if (i % 2 == 1) {
+            // every other ray into the dense patch
+            pnt.Set(100.0F + 0.02F * pnt.x, 0.02F * pnt.y, 1.0F);
+            vec.Set(0.01F * vec.x, 0.01F * vec.y, -1.0F);
+        }
+        rays.push_back({pnt, vec});
+    }
+    return rays;
+}
+
+}  // namespace MeshTestHelpers
+
+// NOLINTEND(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
@@ -0,0 +1,50 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#ifndef MESH_TEST_HELPERS_H
+#define MESH_TEST_HELPERS_H
+
+#include <vector>
+#include <Mod/Mesh/App/Core/BVH.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+
+namespace MeshTestHelpers
+{
+
+/**
+ * Creates a triangulated, slightly wavy height field over [0, size] x [0, size]
+ *
+ * @param size  The number of grid cells along each axis
+ *
+ * @return  A kernel with (size + 1)^2 points and 2 * size * size facets
+ */
+MeshCore::MeshKernel createHeightField(int size);
+
+/**
+ * Creates a coarse height field over [0, 100] x [0, 100] with a small patch of very dense facets
+ * over [100, 102] x [0, 2] next to it, like a scan with a detailed area
+ *
+ * @param coarse  The number of grid cells along each axis of the coarse part
+ * @param dense  The number of grid cells along each axis of the dense patch
+ */
+MeshCore::MeshKernel createUnevenMesh(int coarse, int dense);
+
+/**
+ * Creates a closed UV sphere with outward oriented facets
+ *
+ * @param center  The center of the sphere
+ * @param radius  The radius of the sphere
+ * @param rings  The number of rings from pole to pole, each ring has 2 * rings segments
+ */
+MeshCore::MeshKernel createSphere(const Base::Vector3f& center, float radius, int rings);
+
+/**
+ * Creates rays from above pointing down onto a mesh of createUnevenMesh(), every other ray
+ * into the dense patch
+ *
+ * @param count  The number of rays
+ */
+std::vector<MeshCore::MeshFacetBVH::Ray> createRays(std::size_t count);
+
+}  // namespace MeshTestHelpers
+
+#endif  // MESH_TEST_HELPERS_H
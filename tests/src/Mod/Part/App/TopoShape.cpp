@@ -5,6 +5,12 @@
 #include <Mod/Part/App/TopoShape.h>
 #include "src/App/InitApplication.h"
 
+#include <sstream>
+#include <BRepMesh_IncrementalMesh.hxx>
+#include <BRep_Tool.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+
 
 class TopoShapeTest: public ::testing::Test
 {
@@ -136,4 +142,38 @@ TEST_F(TopoShapeTest, TestGetSubshape)
     EXPECT_THROW(cube1.getSubShape("WOOHOO", false), Base::ValueError);  // Invalid
 }
 
+TEST_F(TopoShapeTest, TestExportBrepWithTriangles)
+{
+    // Arrange
+    auto [cube1, cube2] = PartTestHelpers::CreateTwoTopoShapeCubes();
+    BRepMesh_IncrementalMesh(cube1.getShape(), 0.1);
+    auto countTriangulations = [](const TopoDS_Shape& shape) {
+        int count = 0;
+        for (TopExp_Explorer xp(shape, TopAbs_FACE); xp.More(); xp.Next()) {
+            TopLoc_Location loc;
+            if (!BRep_Tool::Triangulation(TopoDS::Face(xp.Current()), loc).IsNull()) {
+                count++;
+            }
+        }
+        return count;
+    };
+    std::stringstream with;
+    std::stringstream without;
+    std::stringstream binary;
+    Part::TopoShape shapeWith;
+    Part::TopoShape shapeWithout;
+    Part::TopoShape shapeBinary;
+    // Act
+    cube1.exportBrep(with, true);
+    cube1.exportBrep(without);
+    cube1.exportBinary(binary, true);
+    shapeWith.importBrep(with);
+    shapeWithout.importBrep(without);
+    shapeBinary.importBinary(binary);
+    // Assert
+    EXPECT_EQ(countTriangulations(shapeWith.getShape()), 6);
+    EXPECT_EQ(countTriangulations(shapeWithout.getShape()), 0);
+    EXPECT_EQ(countTriangulations(shapeBinary.getShape()), 6);
+}
+
 // clang-format on
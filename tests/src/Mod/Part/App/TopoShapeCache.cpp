@@ -11,6 +11,7 @@
 #include <BRepBuilderAPI_MakeEdge.hxx>
 #include <BRepAlgoAPI_Fuse.hxx>
 #include <BRepPrimAPI_MakeBox.hxx>
+#include <TopExp_Explorer.hxx>
 #include <TopoDS_Edge.hxx>
 
 // NOLINTBEGIN(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
@@ -258,6 +259,28 @@ TEST_F(TopoShapeCacheTest, FindShapeGivenTypeAndIndex)
     EXPECT_FALSE(shapeResult.IsNull());
 }
 
+TEST_F(TopoShapeCacheTest, FindGivenInvertedLocation)
+{
+    // Arrange
+    gp_Trsf transform;
+    transform.SetTranslation(gp_Vec(1.0, 2.0, 3.0));
+    TopoDS_Shape box =
+        BRepPrimAPI_MakeBox(1.0, 1.0, 1.0).Shape().Moved(TopLoc_Location(transform));
+    Part::TopoShapeCache cache(box);
+    auto& ancestry = cache.getAncestry(TopAbs_FACE);
+    TopLoc_Location inverse = box.Location().Inverted();
+
+    // Act and assert
+    int count = 0;
+    for (TopExp_Explorer xp(box, TopAbs_FACE); xp.More(); xp.Next()) {
+        int index = ancestry.find(inverse, xp.Current());
+        EXPECT_NE(0, index);
+        EXPECT_EQ(ancestry.find(box, xp.Current()), index);
+        ++count;
+    }
+    EXPECT_EQ(6, count);
+}
+
 std::tuple<TopoDS_Shape, std::pair<TopoDS_Shape, TopoDS_Shape>> CreateFusedCubes()
 {
     auto boxMaker1 = BRepPrimAPI_MakeBox(1.0, 1.0, 1.0);
@@ -9,6 +9,8 @@
 #include <Mod/Part/App/TopoShape.h>
 #include <Mod/Part/App/TopoShapeOpCode.h>
 
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <gp_Trsf.hxx>
 #include <TopoDS_Vertex.hxx>
 #include <TopoDS_Edge.hxx>
 #include <TopoDS_Wire.hxx>
@@ -325,6 +327,36 @@ TEST_F(TopoShapeMakeShapeWithElementMapTests, findMakerOpInElementMap)
     }
 }
 
+TEST_F(TopoShapeMakeShapeWithElementMapTests, parallelNamesMatchSerial)
+{
+    // Arrange: a grid of overlapping boxes, so that the fuse has a few thousand elements
+    constexpr int gridSize = 8;
+    std::vector<TopoShape> boxes;
+    for (int i = 0; i < gridSize * gridSize; ++i) {
+        gp_Trsf tr;
+        tr.SetTranslation(gp_Vec((i % gridSize) * 0.5, (i / gridSize) * 0.5, 0.0));
+        TopoDS_Shape box = BRepPrimAPI_MakeBox(1.0, 1.0, 1.0).Shape().Moved(TopLoc_Location(tr));
+        boxes.emplace_back(box, i + 1L);
+    }
+    auto fuse = [&boxes](int threads) {
+        TopoShape::setElementMapThreads(threads);
+        TopoShape result;
+        result.makeElementFuse(boxes);
+        return PartTestHelpers::elementMap(result);
+    };
+
+    // Act
+    auto serial = fuse(1);
+    auto parallel = fuse(4);
+    auto parallelAgain = fuse(8);
+    TopoShape::setElementMapThreads(0);
+
+    // Assert
+    EXPECT_FALSE(serial.empty());
+    EXPECT_EQ(serial, parallel);
+    EXPECT_EQ(serial, parallelAgain);
+}
+
 std::string composeTagInfo(const MappedElement& element, const TopoShape& shape)
 {
     std::string elementNameStr {element.name.constPostfix()};
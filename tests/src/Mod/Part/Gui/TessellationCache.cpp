@@ -0,0 +1,143 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include "src/App/InitApplication.h"
+
+#include <Mod/Part/Gui/TessellationCache.h>
+
+#include <BRep_Tool.hxx>
+#include <BRepMesh_IncrementalMesh.hxx>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <cmath>
+#include <gp_Trsf.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+
+// NOLINTBEGIN(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
+
+using PartGui::TessellationCache;
+
+class TessellationCacheTest: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+    }
+
+    void SetUp() override
+    {
+        TessellationCache::instance().clear();
+    }
+
+    void TearDown() override
+    {
+        TessellationCache::instance().clear();
+    }
+
+    /// Tessellates \a shape like the view provider does, returns the number of uncached faces
+    static std::size_t tessellate(const TopoDS_Shape& shape, double deflection)
+    {
+        TessellationCache& cache = TessellationCache::instance();
+        auto uncached = cache.apply(shape, deflection, angle);
+        BRepMesh_IncrementalMesh(shape, deflection, Standard_False, angle, Standard_True);
+        cache.insert(uncached);
+        return uncached.size();
+    }
+
+    static bool isTessellated(const TopoDS_Shape& shape)
+    {
+        for (TopExp_Explorer xp(shape, TopAbs_FACE); xp.More(); xp.Next()) {
+            TopLoc_Location loc;
+            if (BRep_Tool::Triangulation(TopoDS::Face(xp.Current()), loc).IsNull()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static constexpr double angle = 0.5;
+};
+
+TEST_F(TessellationCacheTest, quantizeRoundsDown)
+{
+    for (double deflection : {1e-7, 0.013, 0.1, 1.0, 3.7, 250.0}) {
+        double quantized = TessellationCache::quantizeDeflection(deflection);
+        EXPECT_LE(quantized, deflection);
+        EXPECT_GT(quantized, deflection * 0.84);
+    }
+}
+
+TEST_F(TessellationCacheTest, quantizeKeepsSmallChanges)
+{
+    // both lie between 2^(-13/4) and 2^(-12/4)
+    EXPECT_EQ(TessellationCache::quantizeDeflection(std::exp2(-3.2)),
+              TessellationCache::quantizeDeflection(std::exp2(-3.05)));
+}
+
+TEST_F(TessellationCacheTest, missOnFirstUse)
+{
+    TopoDS_Shape box = BRepPrimAPI_MakeBox(1.0, 2.0, 3.0).Shape();
+
+    EXPECT_EQ(tessellate(box, 0.01), 6U);
+    EXPECT_EQ(TessellationCache::instance().size(), 6U);
+}
+
+TEST_F(TessellationCacheTest, hitForRecreatedShape)
+{
+    tessellate(BRepPrimAPI_MakeBox(1.0, 2.0, 3.0).Shape(), 0.01);
+
+    // a recompute creates new faces with the same geometry
+    TopoDS_Shape box = BRepPrimAPI_MakeBox(1.0, 2.0, 3.0).Shape();
+    auto uncached = TessellationCache::instance().apply(box, 0.01, angle);
+
+    EXPECT_TRUE(uncached.empty());
+    EXPECT_TRUE(isTessellated(box));
+}
+
+TEST_F(TessellationCacheTest, hitForMovedShape)
+{
+    tessellate(BRepPrimAPI_MakeBox(1.0, 2.0, 3.0).Shape(), 0.01);
+
+    gp_Trsf trsf;
+    trsf.SetTranslation(gp_Vec(5.0, 0.0, 0.0));
+    TopoDS_Shape box = BRepPrimAPI_MakeBox(1.0, 2.0, 3.0).Shape().Moved(TopLoc_Location(trsf));
+
+    EXPECT_TRUE(TessellationCache::instance().apply(box, 0.01, angle).empty());
+}
+
+TEST_F(TessellationCacheTest, hitAfterSmallDeflectionChange)
+{
+    double before = TessellationCache::quantizeDeflection(std::exp2(-3.2));
+    double after = TessellationCache::quantizeDeflection(std::exp2(-3.05));
+    tessellate(BRepPrimAPI_MakeBox(1.0, 2.0, 3.0).Shape(), before);
+
+    TopoDS_Shape box = BRepPrimAPI_MakeBox(1.0, 2.0, 3.0).Shape();
+
+    EXPECT_TRUE(TessellationCache::instance().apply(box, after, angle).empty());
+}
+
+TEST_F(TessellationCacheTest, missForOtherDeflection)
+{
+    tessellate(BRepPrimAPI_MakeBox(1.0, 2.0, 3.0).Shape(), 0.01);
+
+    TopoDS_Shape box = BRepPrimAPI_MakeBox(1.0, 2.0, 3.0).Shape();
+
+    EXPECT_EQ(TessellationCache::instance().apply(box, 0.02, angle).size(), 6U);
+    EXPECT_EQ(TessellationCache::instance().apply(box, 0.01, 0.25).size(), 6U);
+}
+
+TEST_F(TessellationCacheTest, missForChangedFaces)
+{
+    tessellate(BRepPrimAPI_MakeBox(1.0, 2.0, 3.0).Shape(), 0.01);
+
+    // at least the top face and the sides differ
+    TopoDS_Shape box = BRepPrimAPI_MakeBox(1.0, 2.0, 4.0).Shape();
+    auto uncached = TessellationCache::instance().apply(box, 0.01, angle);
+
+    EXPECT_GE(uncached.size(), 5U);
+    EXPECT_EQ(tessellate(box, 0.01), uncached.size());
+    EXPECT_TRUE(isTessellated(box));
+}
+
+// NOLINTEND(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
@@ -0,0 +1,192 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include "src/App/InitApplication.h"
+
+#include <App/Application.h>
+#include <Mod/Part/App/TopoShapeOpCode.h>
+#include <Mod/PartDesign/App/PatternBoolean.h>
+
+#include <BRepGProp.hxx>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <GProp_GProps.hxx>
+#include <gp_Pnt.hxx>
+#include <TopExp_Explorer.hxx>
+
+// NOLINTBEGIN(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
+
+using PartDesign::PatternBoolean;
+using Part::TopoShape;
+
+class PatternBooleanTest: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+    }
+
+    void SetUp() override
+    {
+        _hGrp = App::GetApplication().GetParameterGroupByPath(
+            "User parameter:BaseApp/Preferences/Mod/PartDesign");
+        _threshold = _hGrp->GetInt("PatternBatchThreshold", 16);
+    }
+
+    void TearDown() override
+    {
+        _hGrp->SetInt("PatternBatchThreshold", _threshold);
+    }
+
+    void setThreshold(long value)
+    {
+        _hGrp->SetInt("PatternBatchThreshold", value);
+    }
+
+    /// A row of unit cubes along X, \a step apart
+    static std::vector<TopoShape> makeRow(int count, double step, double z = 0.0)
+    {
+        std::vector<TopoShape> shapes;
+        for (int i = 0; i < count; ++i) {
+            shapes.emplace_back(BRepPrimAPI_MakeBox(gp_Pnt(i * step, 0.0, z), 1.0, 1.0, 1.0)
+                                    .Shape());
+        }
+        return shapes;
+    }
+
+    static double getVolume(const TopoShape& shape)
+    {
+        GProp_GProps props;
+        BRepGProp::VolumeProperties(shape.getShape(), props);
+        return props.Mass();
+    }
+
+    /// Gives every shape its own tag, so that the booleans build element maps
+    static void setTags(TopoShape& support, std::vector<TopoShape>& instances)
+    {
+        support.Tag = 1;
+        for (std::size_t i = 0; i < instances.size(); ++i) {
+            instances[i].Tag = static_cast<long>(i) + 2;
+        }
+    }
+
+    static std::map<Data::IndexedName, Data::MappedName> elementMap(const TopoShape& shape)
+    {
+        std::map<Data::IndexedName, Data::MappedName> result;
+        for (const auto& entry : shape.getElementMap()) {
+            result[entry.index] = entry.name;
+        }
+        return result;
+    }
+
+    static int countSolids(const TopoShape& shape)
+    {
+        int count = 0;
+        for (TopExp_Explorer xp(shape.getShape(), TopAbs_SOLID); xp.More(); xp.Next()) {
+            ++count;
+        }
+        return count;
+    }
+
+private:
+    ParameterGrp::handle _hGrp;
+    long _threshold = 16;
+};
+
+TEST_F(PatternBooleanTest, disjointInstancesShareOneBatch)
+{
+    auto batches = PatternBoolean::makeBatches(makeRow(10, 2.0));
+
+    ASSERT_EQ(batches.size(), 1U);
+    EXPECT_EQ(batches[0].size(), 10U);
+}
+
+TEST_F(PatternBooleanTest, overlappingInstancesAreSeparated)
+{
+    // every cube overlaps its direct neighbours only
+    auto batches = PatternBoolean::makeBatches(makeRow(10, 0.6));
+
+    ASSERT_EQ(batches.size(), 2U);
+    EXPECT_EQ(batches[0], std::vector<int>({0, 2, 4, 6, 8}));
+    EXPECT_EQ(batches[1], std::vector<int>({1, 3, 5, 7, 9}));
+}
+
+TEST_F(PatternBooleanTest, touchingInstancesAreSeparated)
+{
+    auto batches = PatternBoolean::makeBatches(makeRow(4, 1.0));
+
+    EXPECT_EQ(batches.size(), 2U);
+}
+
+TEST_F(PatternBooleanTest, batchedFuseMatchesSingleFuse)
+{
+    TopoShape plate(BRepPrimAPI_MakeBox(gp_Pnt(-1.0, -1.0, -1.0), 30.0, 3.0, 1.5).Shape());
+    auto instances = makeRow(40, 0.6, 0.25);
+
+    setThreshold(1000);
+    TopoShape single(plate);
+    PatternBoolean::apply(single, instances, PatternBoolean::Operation::Fuse);
+    setThreshold(2);
+    TopoShape batched(plate);
+    PatternBoolean::apply(batched, instances, PatternBoolean::Operation::Fuse);
+
+    EXPECT_EQ(countSolids(batched), 1);
+    EXPECT_NEAR(getVolume(batched), getVolume(single), 1e-6);
+}
+
+TEST_F(PatternBooleanTest, batchedCutMatchesSingleCut)
+{
+    TopoShape plate(BRepPrimAPI_MakeBox(gp_Pnt(-1.0, -1.0, 0.5), 30.0, 3.0, 1.0).Shape());
+    auto instances = makeRow(40, 0.6);
+
+    setThreshold(1000);
+    TopoShape single(plate);
+    PatternBoolean::apply(single, instances, PatternBoolean::Operation::Cut);
+    setThreshold(2);
+    TopoShape batched(plate);
+    PatternBoolean::apply(batched, instances, PatternBoolean::Operation::Cut);
+
+    EXPECT_NEAR(getVolume(batched), getVolume(single), 1e-6);
+    EXPECT_LT(getVolume(batched), getVolume(plate));
+}
+
+TEST_F(PatternBooleanTest, unbatchedKeepsElementNamesOfSingleBoolean)
+{
+    TopoShape plate(BRepPrimAPI_MakeBox(gp_Pnt(-1.0, -1.0, -1.0), 30.0, 3.0, 1.5).Shape());
+    auto instances = makeRow(40, 0.6, 0.25);
+    setTags(plate, instances);
+    setThreshold(2);
+
+    std::vector<TopoShape> shapes {plate};
+    shapes.insert(shapes.end(), instances.begin(), instances.end());
+    TopoShape single(plate);
+    single.makeElementBoolean(Part::OpCodes::Fuse, shapes);
+    TopoShape unbatched(plate);
+    PatternBoolean::apply(unbatched, instances, PatternBoolean::Operation::Fuse, false);
+
+    EXPECT_FALSE(elementMap(single).empty());
+    EXPECT_EQ(elementMap(unbatched), elementMap(single));
+}
+
+TEST_F(PatternBooleanTest, batchedElementNamesAreStable)
+{
+    TopoShape plate(BRepPrimAPI_MakeBox(gp_Pnt(-1.0, -1.0, -1.0), 30.0, 3.0, 1.5).Shape());
+    auto instances = makeRow(40, 0.6, 0.25);
+    setTags(plate, instances);
+    setThreshold(2);
+
+    TopoShape first(plate);
+    PatternBoolean::apply(first, instances, PatternBoolean::Operation::Fuse);
+    TopoShape second(plate);
+    PatternBoolean::apply(second, instances, PatternBoolean::Operation::Fuse);
+
+    // every face is named, and the names don't depend on the order the threads finish in
+    auto names = elementMap(first);
+    auto faces = static_cast<int>(first.countSubShapes(TopAbs_FACE));
+    for (int i = 1; i <= faces; ++i) {
+        EXPECT_EQ(names.count(Data::IndexedName::fromConst("Face", i)), 1U) << "Face" << i;
+    }
+    EXPECT_EQ(names, elementMap(second));
+}
+
+// NOLINTEND(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
@@ -238,4 +238,104 @@ TEST_F(PointsTest, TestPCDStructured)
     EXPECT_EQ(reader.getWidth(), 4);
     EXPECT_EQ(reader.getHeight(), 2);
 }
+
+TEST_F(PointsTest, TestReadBlocks)
+{
+    std::string name = getFileName();
+    Points::PlyWriter writer(getKernel());
+    writer.setIntensities(getIntensity());
+    writer.write(name);
+
+    Points::PlyReader reader;
+    reader.setBlockSize(3);
+    std::vector<std::size_t> sizes;
+    std::vector<Base::Vector3f> points;
+    reader.readBlocks(name, [&](Points::PointBlock& block) {
+        EXPECT_EQ(block.intensity.size(), block.size());
+        EXPECT_TRUE(block.colors.empty());
+        sizes.push_back(block.size());
+        points.insert(points.end(), block.points.begin(), block.points.end());
+    });
+
+    EXPECT_EQ(sizes, std::vector<std::size_t>({3, 3, 2}));
+    EXPECT_EQ(points, getKernel().getBasicPoints());
+}
+
+TEST_F(PointsTest, TestSubsampling)
+{
+    std::string name = getFileName();
+    Points::PlyWriter writer(getKernel());
+    writer.setColors(getColors());
+    writer.write(name);
+
+    Points::PlyReader reader;
+    reader.setBlockSize(3);
+    reader.setSubsampling(2);
+    reader.read(name);
+
+    const Points::PointKernel& points = reader.getPoints();
+    ASSERT_EQ(points.size(), 4);
+    EXPECT_EQ(points.getPoint(1), getKernel().getPoint(2));
+    EXPECT_EQ(reader.getColors().size(), 4);
+    EXPECT_EQ(reader.getWidth(), 4);
+    EXPECT_EQ(reader.getHeight(), 1);
+}
+
+TEST_F(PointsTest, TestCropBox)
+{
+    std::string name = getFileName();
+    Points::PcdWriter writer(getKernel());
+    writer.setIntensities(getIntensity());
+    writer.setNormals(getNormals());
+    writer.setWidth(4);
+    writer.setHeight(2);
+    writer.write(name);
+
+    Points::PcdReader reader;
+    reader.setCropBox(Base::BoundBox3d(-0.5, -0.5, -0.5, 0.5, 1.5, 1.5));
+    reader.read(name);
+
+    EXPECT_EQ(reader.getPoints().size(), 4);
+    EXPECT_EQ(reader.getIntensities().size(), 4);
+    EXPECT_EQ(reader.getNormals().size(), 4);
+    // a section of a structured cloud isn't structured anymore
+    EXPECT_FALSE(reader.isStructured());
+    EXPECT_EQ(reader.getWidth(), 4);
+    EXPECT_EQ(reader.getHeight(), 1);
+}
+
+TEST_F(PointsTest, TestTakePoints)
+{
+    std::string name = getFileName();
+    Points::PcdWriter writer(getKernel());
+    writer.write(name);
+
+    Points::PcdReader reader;
+    reader.read(name);
+    Points::PointKernel points = reader.takePoints();
+
+    EXPECT_EQ(points.getBasicPoints(), getKernel().getBasicPoints());
+    EXPECT_EQ(reader.getPoints().size(), 0);
+}
+
+TEST_F(PointsTest, TestTakeProperties)
+{
+    std::string name = getFileName();
+    Points::PlyWriter writer(getKernel());
+    writer.setIntensities(getIntensity());
+    writer.setNormals(getNormals());
+    writer.setColors(getColors());
+    writer.write(name);
+
+    Points::PlyReader reader;
+    reader.read(name);
+    std::vector<float> intensity = reader.takeIntensities();
+    std::vector<Base::Vector3f> normals = reader.takeNormals();
+    std::vector<Base::Color> colors = reader.takeColors();
+
+    EXPECT_EQ(intensity.size(), 8);
+    EXPECT_EQ(normals, getNormals());
+    EXPECT_EQ(colors.size(), 8);
+    EXPECT_FALSE(reader.hasProperties());
+}
 // NOLINTEND(cppcoreguidelines-*,readability-*)
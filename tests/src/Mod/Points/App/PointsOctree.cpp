@@ -0,0 +1,153 @@
+#include <gtest/gtest.h>
+#include <random>
+#include <set>
+#include <Base/FileInfo.h>
+#include <Mod/Points/App/PointsOctree.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class PointsOctreeTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        std::mt19937 gen(42);
+        std::uniform_real_distribution<float> dist(0.0F, 10.0F);
+        std::vector<Base::Vector3f> points;
+        for (int i = 0; i < 20000; ++i) {
+            points.emplace_back(dist(gen), dist(gen), dist(gen));
+            // the intensity identifies the original point
+            intensity.push_back(static_cast<float>(i));
+            colors.emplace_back(0.0F, 1.0F, 0.0F);
+        }
+        kernel.setBasicPoints(points);
+
+        tmp.setFile(Base::FileInfo::getTempFileName());
+    }
+
+    void TearDown() override
+    {
+        tmp.deleteFile();
+    }
+
+    void checkAllPointsOnce(const Points::PointOctree& octree) const
+    {
+        std::set<int> seen;
+        Points::PointOctree::NodeData data;
+        const auto& nodes = octree.getNodes();
+        for (std::size_t i = 0; i < nodes.size(); ++i) {
+            octree.readNode(static_cast<int>(i), data);
+            ASSERT_EQ(data.size(), nodes[i].count);
+            ASSERT_EQ(data.intensity.size(), data.size());
+            ASSERT_EQ(data.colors.size(), data.size());
+            for (std::size_t j = 0; j < data.size(); ++j) {
+                int index = static_cast<int>(data.intensity[j]);
+                EXPECT_TRUE(seen.insert(index).second);
+                const Base::Vector3f& pt = kernel.getBasicPoints()[index];
+                EXPECT_EQ(pt, Base::Vector3f(data.coords[3 * j],
+                                             data.coords[3 * j + 1],
+                                             data.coords[3 * j + 2]));
+                EXPECT_TRUE(nodes[i].box.IsInBox(pt));
+                EXPECT_EQ(data.colors[j], 0x00FF00FFU);
+            }
+        }
+        EXPECT_EQ(seen.size(), kernel.size());
+    }
+
+    Points::PointKernel kernel;
+    std::vector<float> intensity;
+    std::vector<Base::Color> colors;
+    Base::FileInfo tmp;
+};
+
+TEST_F(PointsOctreeTest, testEveryPointStoredOnce)
+{
+    Points::PointOctree octree(500);
+    octree.build(kernel, &colors, nullptr, &intensity);
+
+    EXPECT_EQ(octree.size(), kernel.size());
+    EXPECT_GT(octree.getNodes().size(), 1);
+    EXPECT_TRUE(octree.hasColors());
+    EXPECT_FALSE(octree.hasNormals());
+    EXPECT_TRUE(octree.hasIntensity());
+    checkAllPointsOnce(octree);
+}
+
+TEST_F(PointsOctreeTest, testSwapOut)
+{
+    Points::PointOctree octree(500);
+    octree.build(kernel, &colors, nullptr, &intensity);
+    octree.swapOut(tmp.filePath());
+
+    EXPECT_TRUE(octree.isSwappedOut());
+    checkAllPointsOnce(octree);
+
+    octree.clear();
+    EXPECT_FALSE(tmp.exists());
+}
+
+TEST_F(PointsOctreeTest, testMismatchingAttributesIgnored)
+{
+    colors.pop_back();
+    Points::PointOctree octree(500);
+    octree.build(kernel, &colors, nullptr, &intensity);
+
+    EXPECT_FALSE(octree.hasColors());
+    EXPECT_TRUE(octree.hasIntensity());
+}
+
+TEST_F(PointsOctreeTest, testSelectionRespectsBudget)
+{
+    Points::PointOctree octree(500);
+    octree.build(kernel);
+
+    Points::PointOctree::View view;
+    view.eye = Base::Vector3f(5.0F, 5.0F, -20.0F);
+    view.pixelsPerUnit = 1000.0F;
+    view.maxError = 1.0F;
+    view.pointBudget = 5000;
+
+    auto selection = octree.selectNodes(view);
+    ASSERT_FALSE(selection.empty());
+    EXPECT_EQ(selection.front(), 0);
+
+    std::set<int> selected(selection.begin(), selection.end());
+    std::uint64_t count = 0;
+    for (int index : selection) {
+        const auto& node = octree.getNodes()[index];
+        count += node.count;
+        // a node is only drawn together with its parent
+        if (node.parent >= 0) {
+            EXPECT_EQ(selected.count(node.parent), 1);
+        }
+    }
+    EXPECT_LE(count, view.pointBudget);
+}
+
+TEST_F(PointsOctreeTest, testCoarseViewSelectsRoot)
+{
+    Points::PointOctree octree(500);
+    octree.build(kernel);
+
+    Points::PointOctree::View view;
+    view.perspective = false;
+    view.pixelsPerUnit = 0.01F;
+
+    EXPECT_EQ(octree.selectNodes(view), std::vector<int>({0}));
+}
+
+TEST_F(PointsOctreeTest, testCulling)
+{
+    Points::PointOctree octree(500);
+    octree.build(kernel);
+
+    Points::PointOctree::View view;
+    view.perspective = false;
+    view.pixelsPerUnit = 1000.0F;
+    // only x > 100 is inside
+    view.planes.push_back({1.0F, 0.0F, 0.0F, -100.0F});
+
+    EXPECT_TRUE(octree.selectNodes(view).empty());
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
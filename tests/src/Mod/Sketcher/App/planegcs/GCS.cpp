@@ -2,8 +2,17 @@
 
 #include <gtest/gtest.h>
 
+#include <string>
+#include <tuple>
+#include <vector>
+
 #include "Mod/Sketcher/App/planegcs/GCS.h"
 
+#include "GCSTestHelpers.h"
+
+using GCSTestHelpers::LargeSketch;
+using GCSTestHelpers::makeStaircase;
+
 class SystemTest: public GCS::System
 {
 public:
@@ -11,6 +20,10 @@ public:
     {
         return _getNumberOfConstraints(tagID);
     }
+    int getNumberOfSolvedComponents() const
+    {
+        return _getNumberOfSolvedComponents();
+    }
 };
 
 class GCSTest: public ::testing::Test
@@ -50,3 +63,183 @@ TEST_F(GCSTest, clearConstraints)  // NOLINT
     // Assert
     EXPECT_EQ(0, System()->getNumberOfConstraints());
 }
+
+TEST_F(GCSTest, solveOnlyChangedComponents)  // NOLINT
+{
+    // Arrange: two points pinned to external coordinates, i.e. four decoupled components
+    double x1 {0.0}, y1 {0.0}, x2 {0.0}, y2 {0.0};
+    double tx1 {1.0}, ty1 {2.0}, tx2 {3.0}, ty2 {4.0};
+    GCS::Point p1(&x1, &y1);
+    GCS::Point p2(&x2, &y2);
+    GCS::VEC_pD params {&x1, &y1, &x2, &y2};
+    System()->addConstraintCoordinateX(p1, &tx1, 1);
+    System()->addConstraintCoordinateY(p1, &ty1, 1);
+    System()->addConstraintCoordinateX(p2, &tx2, 1);
+    System()->addConstraintCoordinateY(p2, &ty2, 1);
+    System()->declareUnknowns(params);
+    System()->initSolution();
+    ASSERT_EQ(GCS::Success, System()->solve());
+    System()->applySolution();
+    ASSERT_EQ(4, System()->getNumberOfSolvedComponents());
+
+    // Act
+    tx1 = 5.0;
+    int result = System()->solve();
+    System()->applySolution();
+
+    // Assert
+    EXPECT_EQ(GCS::Success, result);
+    EXPECT_EQ(1, System()->getNumberOfSolvedComponents());
+    EXPECT_NEAR(x1, 5.0, 1e-10);
+    EXPECT_NEAR(y1, 2.0, 1e-10);
+    EXPECT_NEAR(x2, 3.0, 1e-10);
+    EXPECT_NEAR(y2, 4.0, 1e-10);
+}
+
+TEST_F(GCSTest, undoSolutionResolvesAllComponents)  // NOLINT
+{
+    // Arrange
+    double x {0.0}, y {0.0};
+    double tx {1.0}, ty {2.0};
+    GCS::Point p(&x, &y);
+    GCS::VEC_pD params {&x, &y};
+    System()->addConstraintCoordinateX(p, &tx, 1);
+    System()->addConstraintCoordinateY(p, &ty, 1);
+    System()->declareUnknowns(params);
+    System()->initSolution();
+    ASSERT_EQ(GCS::Success, System()->solve());
+
+    // Act
+    System()->undoSolution();
+    int result = System()->solve();
+    System()->applySolution();
+
+    // Assert
+    EXPECT_EQ(GCS::Success, result);
+    EXPECT_EQ(2, System()->getNumberOfSolvedComponents());
+    EXPECT_NEAR(x, 1.0, 1e-10);
+    EXPECT_NEAR(y, 2.0, 1e-10);
+}
+
+TEST_F(GCSTest, sparseJacobianSolvesStaircase)  // NOLINT
+{
+    for (auto alg : {GCS::DogLeg, GCS::LevenbergMarquardt}) {
+        // Arrange
+        SystemTest system;
+        system.jacobianStorage = GCS::SparseJacobian;
+        std::vector<double> values, lengths;
+        double origin {};
+        const int n {200};
+        makeStaircase(&system, n, values, lengths, origin);
+
+        // Act
+        int result = system.solve(true, alg);
+        system.applySolution();
+
+        // Assert
+        EXPECT_EQ(GCS::Success, result);
+        for (int i = 0; i <= n; ++i) {
+            EXPECT_NEAR(values[2 * i], (i + 1) / 2, 1e-8);
+            EXPECT_NEAR(values[2 * i + 1], i / 2, 1e-8);
+        }
+    }
+}
+
+// Each large sketch is solved with the dense and the sparse Jacobian, see
+// tests/benchmarks for their timings.
+using LargeSketchParam = std::tuple<LargeSketch, GCS::Algorithm, GCS::JacobianStorage>;
+
+class LargeSketchTest: public ::testing::TestWithParam<LargeSketchParam>
+{
+};
+
+TEST_P(LargeSketchTest, solve)  // NOLINT
+{
+    // Arrange
+    const auto& [sketch, alg, storage] = GetParam();
+    SystemTest system;
+    system.jacobianStorage = storage;
+    std::vector<double> values, dimensions;
+    double origin {};
+    sketch.make(&system, sketch.size, values, dimensions, origin);
+
+    // Act
+    int result = system.solve(true, alg);
+    system.applySolution();
+
+    // Assert
+    EXPECT_EQ(GCS::Success, result);
+    for (int i = 0; i < int(values.size()); ++i) {
+        EXPECT_NEAR(values[i], sketch.expected(i), 1e-6);
+    }
+}
+
+static std::string largeSketchTestName(const ::testing::TestParamInfo<LargeSketchParam>& info)
+{
+    const auto& [sketch, alg, storage] = info.param;
+    return GCSTestHelpers::largeSketchName(sketch, alg, storage);
+}
+
+INSTANTIATE_TEST_SUITE_P(GCSTest,
+                         LargeSketchTest,
+                         ::testing::Combine(::testing::ValuesIn(GCSTestHelpers::largeSketches),
+                                            ::testing::Values(GCS::DogLeg,
+                                                              GCS::LevenbergMarquardt),
+                                            ::testing::Values(GCS::DenseJacobian,
+                                                              GCS::SparseJacobian)),
+                         largeSketchTestName);
+
+TEST_F(GCSTest, sparseJacobianHonoursGaussStep)  // NOLINT
+{
+    for (auto step : {GCS::FullPivLU, GCS::LeastNormFullPivLU, GCS::LeastNormLdlt}) {
+        // Arrange
+        SystemTest system;
+        system.jacobianStorage = GCS::SparseJacobian;
+        system.dogLegGaussStep = step;
+        std::vector<double> values, lengths;
+        double origin {};
+        const int n {50};
+        makeStaircase(&system, n, values, lengths, origin);
+
+        // Act
+        int result = system.solve(true, GCS::DogLeg);
+        system.applySolution();
+
+        // Assert
+        EXPECT_EQ(GCS::Success, result);
+        for (int i = 0; i <= n; ++i) {
+            EXPECT_NEAR(values[2 * i], (i + 1) / 2, 1e-8);
+            EXPECT_NEAR(values[2 * i + 1], i / 2, 1e-8);
+        }
+    }
+}
+
+TEST_F(GCSTest, sparseJacobianSolvesRedundantConstraints)  // NOLINT
+{
+    for (auto step : {GCS::FullPivLU, GCS::LeastNormFullPivLU, GCS::LeastNormLdlt}) {
+        // Arrange
+        SystemTest system;
+        system.jacobianStorage = GCS::SparseJacobian;
+        system.dogLegGaussStep = step;
+        std::vector<double> values, lengths;
+        double origin {};
+        const int n {20};
+        makeStaircase(&system, n, values, lengths, origin);
+        // the same distance twice makes the Jacobian rank deficient
+        GCS::Point p0(&values[0], &values[1]);
+        GCS::Point p1(&values[2], &values[3]);
+        system.addConstraintP2PDistance(p0, p1, &lengths[0], 1);
+        system.initSolution();
+
+        // Act
+        int result = system.solve(true, GCS::DogLeg);
+        system.applySolution();
+
+        // Assert
+        EXPECT_EQ(GCS::Success, result);
+        for (int i = 0; i <= n; ++i) {
+            EXPECT_NEAR(values[2 * i], (i + 1) / 2, 1e-8);
+            EXPECT_NEAR(values[2 * i + 1], i / 2, 1e-8);
+        }
+    }
+}
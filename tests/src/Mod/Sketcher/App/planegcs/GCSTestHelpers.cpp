@@ -0,0 +1,154 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <cmath>
+
+#include "GCSTestHelpers.h"
+
+// NOLINTBEGIN(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
+
+namespace GCSTestHelpers
+{
+
+void makeStaircase(GCS::System* system,
+                   int n,
+                   std::vector<double>& values,
+                   std::vector<double>& lengths,
+                   double& origin)
+{
+    origin = 0.0;
+    values.resize(2 * (n + 1));
+    lengths.assign(n, 1.0);
+    GCS::VEC_pD params;
+    std::vector<GCS::Point> points;
+    for (int i = 0; i <= n; ++i) {
+        values[2 * i] = ((i + 1) / 2) + 0.1 * (i % 3);
+        values[2 * i + 1] = (i / 2) - 0.1 * (i % 2);
+        points.emplace_back(&values[2 * i], &values[2 * i + 1]);
+        params.push_back(&values[2 * i]);
+        params.push_back(&values[2 * i + 1]);
+    }
+    system->addConstraintCoordinateX(points[0], &origin, 1);
+    system->addConstraintCoordinateY(points[0], &origin, 1);
+    for (int i = 0; i < n; ++i) {
+        system->addConstraintP2PDistance(points[i], points[i + 1], &lengths[i], 1);
+        if (i % 2 == 0) {
+            system->addConstraintHorizontal(points[i], points[i + 1], 1);
+        }
+        else {
+            system->addConstraintVertical(points[i], points[i + 1], 1);
+        }
+    }
+    system->declareUnknowns(params);
+    system->initSolution();
+}
+
+void makeTruss(GCS::System* system,
+               int n,
+               std::vector<double>& values,
+               std::vector<double>& lengths,
+               double& origin)
+{
+    origin = 0.0;
+    values.resize(4 * (n + 1));
+    lengths = {1.0, std::sqrt(2.0)};
+    GCS::VEC_pD params;
+    std::vector<GCS::Point> lower, upper;
+    for (int i = 0; i <= n; ++i) {
+        values[4 * i] = i + 0.1 * (i % 3);
+        values[4 * i + 1] = -0.1 * (i % 2);
+        values[4 * i + 2] = i - 0.1 * (i % 2);
+        values[4 * i + 3] = 1.0 + 0.1 * (i % 3);
+        lower.emplace_back(&values[4 * i], &values[4 * i + 1]);
+        upper.emplace_back(&values[4 * i + 2], &values[4 * i + 3]);
+        for (int k = 0; k < 4; ++k) {
+            params.push_back(&values[4 * i + k]);
+        }
+    }
+    system->addConstraintCoordinateX(lower[0], &origin, 1);
+    system->addConstraintCoordinateY(lower[0], &origin, 1);
+    system->addConstraintHorizontal(lower[0], lower[1], 1);
+    for (int i = 0; i <= n; ++i) {
+        system->addConstraintP2PDistance(lower[i], upper[i], &lengths[0], 1);
+        if (i < n) {
+            system->addConstraintP2PDistance(lower[i], lower[i + 1], &lengths[0], 1);
+            system->addConstraintP2PDistance(upper[i], upper[i + 1], &lengths[0], 1);
+            system->addConstraintP2PDistance(lower[i], upper[i + 1], &lengths[1], 1);
+        }
+    }
+    system->declareUnknowns(params);
+    system->initSolution();
+}
+
+void makeTangentCircles(GCS::System* system,
+                        int n,
+                        std::vector<double>& values,
+                        std::vector<double>& radii,
+                        double& origin)
+{
+    origin = 0.0;
+    values.resize(3 * n);
+    radii.assign(n, 1.0);
+    GCS::VEC_pD params;
+    std::vector<GCS::Circle> circles(n);
+    for (int i = 0; i < n; ++i) {
+        values[3 * i] = 2 * i + 0.1 * (i % 3);
+        values[3 * i + 1] = 0.1 * (i % 2);
+        values[3 * i + 2] = 1.0 - 0.05 * (i % 2);
+        circles[i].center = GCS::Point(&values[3 * i], &values[3 * i + 1]);
+        circles[i].rad = &values[3 * i + 2];
+        params.push_back(&values[3 * i]);
+        params.push_back(&values[3 * i + 1]);
+        params.push_back(&values[3 * i + 2]);
+    }
+    system->addConstraintCoordinateX(circles[0].center, &origin, 1);
+    for (int i = 0; i < n; ++i) {
+        system->addConstraintCoordinateY(circles[i].center, &origin, 1);
+        system->addConstraintCircleRadius(circles[i], &radii[i], 1);
+        if (i > 0) {
+            system->addConstraintTangent(circles[i - 1], circles[i], 1);
+        }
+    }
+    system->declareUnknowns(params);
+    system->initSolution();
+}
+
+const std::vector<LargeSketch> largeSketches = {
+    {"Staircase",
+     400,
+     makeStaircase,
+     [](int index) {
+         int i = index / 2;
+         return double(index % 2 == 0 ? (i + 1) / 2 : i / 2);
+     }},
+    {"Truss",
+     100,
+     makeTruss,
+     [](int index) {
+         int i = index / 4;
+         return index % 2 == 0 ? double(i) : double(index % 4 == 3);
+     }},
+    {"TangentCircles",
+     200,
+     makeTangentCircles,
+     [](int index) {
+         return index % 3 == 0 ? 2.0 * (index / 3) : (index % 3 == 1 ? 0.0 : 1.0);
+     }},
+};
+
+void PrintTo(const LargeSketch& sketch, std::ostream* os)
+{
+    *os << sketch.name << sketch.size;
+}
+
+std::string largeSketchName(const LargeSketch& sketch,
+                            GCS::Algorithm alg,
+                            GCS::JacobianStorage storage)
+{
+    return std::string(sketch.name) + std::to_string(sketch.size)
+        + (alg == GCS::DogLeg ? "_DogLeg" : "_LevenbergMarquardt")
+        + (storage == GCS::SparseJacobian ? "_Sparse" : "_Dense");
+}
+
+}  // namespace GCSTestHelpers
+
+// NOLINTEND(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
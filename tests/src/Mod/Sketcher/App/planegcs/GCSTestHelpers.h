@@ -0,0 +1,73 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#ifndef PLANEGCS_TEST_HELPERS_H
+#define PLANEGCS_TEST_HELPERS_H
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "Mod/Sketcher/App/planegcs/GCS.h"
+
+namespace GCSTestHelpers
+{
+
+/**
+ * Adds a staircase of n segments, alternately horizontal and vertical, each of length 1,
+ * starting at the origin. The unknowns are perturbed away from the solution.
+ *
+ * @param system  The system to add the constraints to
+ * @param n  The number of segments
+ * @param values  Receives the coordinates of the n + 1 points
+ * @param lengths  Receives the segment lengths referenced by the constraints
+ * @param origin  Receives the origin referenced by the constraints
+ */
+void makeStaircase(GCS::System* system,
+                   int n,
+                   std::vector<double>& values,
+                   std::vector<double>& lengths,
+                   double& origin);
+
+/**
+ * Adds a triangulated strip of n unit squares along the x axis, dimensioned by distances only.
+ * The values are the lower and the upper point of each rung.
+ */
+void makeTruss(GCS::System* system,
+               int n,
+               std::vector<double>& values,
+               std::vector<double>& lengths,
+               double& origin);
+
+/**
+ * Adds a row of n circles of radius 1 along the x axis, each one tangent to the next. The
+ * values are the center and the radius of each circle.
+ */
+void makeTangentCircles(GCS::System* system,
+                        int n,
+                        std::vector<double>& values,
+                        std::vector<double>& radii,
+                        double& origin);
+
+/// A large sketch that is solvable with either Jacobian storage
+struct LargeSketch
+{
+    const char* name;
+    int size;
+    void (*make)(GCS::System*, int, std::vector<double>&, std::vector<double>&, double&);
+    // expected value of the parameter at index
+    double (*expected)(int index);
+};
+
+/// The staircase, truss and tangent circles at a size where the storage matters
+extern const std::vector<LargeSketch> largeSketches;
+
+void PrintTo(const LargeSketch& sketch, std::ostream* os);
+
+/// Returns a name like Staircase400_DogLeg_Sparse
+std::string largeSketchName(const LargeSketch& sketch,
+                            GCS::Algorithm alg,
+                            GCS::JacobianStorage storage);
+
+}  // namespace GCSTestHelpers
+
+#endif  // PLANEGCS_TEST_HELPERS_H
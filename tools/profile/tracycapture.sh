@@ -0,0 +1,29 @@
+#! /bin/bash
+
+# Record a Tracy trace of a headless FreeCAD run without the Tracy GUI attached.
+# Requires a build configured with -DBUILD_TRACY_FRAME_PROFILER=ON (and optionally
+# -DBUILD_TRACY_MEMORY_PROFILER=ON) plus the tracy-capture tool from the Tracy
+# release matching src/3rdParty/tracy.
+#
+# Usage: tracycapture.sh <output.tracy> <FreeCADCmd> [FreeCADCmd arguments...]
+# e.g.   tracycapture.sh recompute.tracy build/bin/FreeCADCmd -t TestPerf
+
+if [ $# -lt 2 ]; then
+    echo "Usage: $0 <output.tracy> <FreeCADCmd> [arguments...]" >&2
+    exit 1
+fi
+
+output="$1"
+shift
+
+capture=${TRACY_CAPTURE:-tracy-capture}
+
+"$capture" -o "$output" -f -a 127.0.0.1 &
+capture_pid=$!
+
+# Keep the client alive until all queued zones have been sent to tracy-capture.
+TRACY_NO_EXIT=1 "$@"
+status=$?
+
+wait $capture_pid
+exit $status